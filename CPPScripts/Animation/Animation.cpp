@@ -1,7 +1,7 @@
 #include "Animation.h"
 #include "NodeAnimation.h"
+#include "Skeleton.h"
 #include "../Time.h"
-#include "../ZMesh.h"
 #include "../PublicStruct.h"
 
 namespace ZXEngine
@@ -44,17 +44,30 @@ namespace ZXEngine
 	}
 
 	void Animation::Update()
+	{
+		if (Advance(Time::deltaTime))
+			Sample();
+	}
+
+	void Animation::Update(float tick)
+	{
+		mCurTick = tick;
+		Sample();
+	}
+
+	bool Animation::Advance(float deltaTime)
 	{
 		if (!mIsPlaying)
-			return;
+			return false;
 
-		mCurTick += Time::deltaTime * mSpeed * mTicksPerSecond;
+		mCurTick += deltaTime * mSpeed * mTicksPerSecond;
 
 		if (mCurTick >= mFullTick)
 		{
 			if (mIsLoop)
 			{
-				mCurTick -= mFullTick;
+				// 降频更新时一次推进的时间可能超过一整个动画
+				mCurTick = fmodf(mCurTick, mFullTick);
 			}
 			else
 			{
@@ -64,30 +77,24 @@ namespace ZXEngine
 			Reset();
 		}
 
-		UpdateNodeAnimations();
+		return true;
 	}
 
-	void Animation::Update(float tick)
+	void Animation::Sample()
 	{
-		mCurTick = tick;
-		UpdateNodeAnimations();
+		for (auto& iter : mNodeAnimations)
+		{
+			iter.second->UpdateCurFrame(mCurTick);
+		}
 	}
 
-	void Animation::UpdateMeshes(const BoneNode* pBoneNode, const vector<Mesh*>& pMeshes)
+	void Animation::Sample(const vector<uint32_t>& boneIndices)
 	{
-		UpdateBoneTransforms(pBoneNode, Matrix4());
-
-		for (auto& pMesh : pMeshes)
+		for (auto boneIndex : boneIndices)
 		{
-			for (auto& iter : mBoneTransforms)
-			{
-				if (pMesh->mBoneNameToIndexMap.find(iter.first) != pMesh->mBoneNameToIndexMap.end())
-				{
-					uint32_t index = pMesh->mBoneNameToIndexMap[iter.first];
-					// ˴ľǸShaderõģҪתΪ
-					pMesh->mBonesFinalTransform[index] = Math::Transpose(iter.second * pMesh->mBonesOffset[index]);
-				}
-			}
+			auto pNodeAnim = mBoneChannels[boneIndex];
+			if (pNodeAnim)
+				pNodeAnim->UpdateCurFrame(mCurTick);
 		}
 	}
 
@@ -113,41 +120,19 @@ namespace ZXEngine
 		return pNodeAnim != nullptr;
 	}
 
-	void Animation::UpdateNodeAnimations()
+	void Animation::BindSkeleton(const Skeleton* pSkeleton)
 	{
-		for (auto& iter : mNodeAnimations)
-		{
-			iter.second->UpdateCurFrame(mCurTick);
-		}
+		uint32_t boneNum = pSkeleton->GetBoneNum();
+		mBoneChannels.resize(boneNum);
+
+		for (uint32_t i = 0; i < boneNum; i++)
+			mBoneChannels[i] = GetNodeAnimation(pSkeleton->mBoneNames[i]);
 	}
 
-	void Animation::UpdateBoneTransforms(const BoneNode* pBoneNode, const Matrix4& parentTransform)
+	const KeyFrame* Animation::GetCurFrameByBone(uint32_t boneIndex) const
 	{
-		string nodeName = pBoneNode->name;
-
-		Matrix4 nodeTransform(pBoneNode->transform);
-
-		NodeAnimation* pNodeAnimation = GetNodeAnimation(nodeName);
-
-		if (pNodeAnimation)
-		{
-			Matrix4 scaleMatrix = Math::ScaleMatrix(pNodeAnimation->mCurFrame.mScale);
-
-			Matrix4 translationMatrix = Math::TranslationMatrix(pNodeAnimation->mCurFrame.mPosition);
-
-			Matrix4 rotationMatrix = pNodeAnimation->mCurFrame.mRotation.ToMatrix();
-
-			nodeTransform = translationMatrix * rotationMatrix * scaleMatrix;
-		}
-
-		Matrix4 globalTransform = parentTransform * nodeTransform;
-
-		mBoneTransforms[nodeName] = globalTransform;
-
-		for (auto pChild : pBoneNode->children)
-		{
-			UpdateBoneTransforms(pChild, globalTransform);
-		}
+		auto pNodeAnim = mBoneChannels[boneIndex];
+		return pNodeAnim ? &pNodeAnim->mCurFrame : nullptr;
 	}
 
 	NodeAnimation* Animation::GetNodeAnimation(const string& nodeName)
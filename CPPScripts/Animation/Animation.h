@@ -4,8 +4,7 @@
 
 namespace ZXEngine
 {
-	class Mesh;
-	struct BoneNode;
+	class Skeleton;
 	class NodeAnimation;
 	class Animation
 	{
@@ -24,24 +23,30 @@ namespace ZXEngine
 		void Stop();
 		void Reset();
 		bool IsPlaying() const;
-		// йڵбĶ
+		// 更新所有骨骼节点列表里的动画
 		void Update();
-		// йڵбĶ(ֶTick)
+		// 更新所有骨骼节点列表里的动画(手动传入Tick)
 		void Update(float tick);
-		// ǰһ֡Ĺ任µMesh(ڵ)
-		void UpdateMeshes(const BoneNode* pBoneNode, const vector<Mesh*>& pMeshes);
+		// 按时间推进播放进度但不采样，返回这次推进前动画是否在播放
+		bool Advance(float deltaTime);
+		// 按当前播放进度采样所有骨骼节点的动画
+		void Sample();
+		// 只采样这些骨骼下标对应的动画，需要先绑定骨骼
+		void Sample(const vector<uint32_t>& boneIndices);
 		void AddNodeAnimation(NodeAnimation* nodeAnimation);
 		bool GetCurFrameByNode(const string& nodeName, KeyFrame& keyFrame);
+		// 按骨骼下标建立动画通道的索引，之后可以通过骨骼下标直接获取当前帧
+		void BindSkeleton(const Skeleton* pSkeleton);
+		// 获取骨骼当前帧的数据，这个骨骼没有动画时返回nullptr
+		const KeyFrame* GetCurFrameByBone(uint32_t boneIndex) const;
 
 	private:
 		bool mIsPlaying = false;
-		// йĶ
+		// 所有骨骼结点的动画
 		unordered_map<string, NodeAnimation*> mNodeAnimations;
-		// йձ任(ŵʱ)
-		unordered_map<string, Matrix4> mBoneTransforms;
+		// 按骨骼下标排列的动画，没有动画的骨骼为nullptr
+		vector<NodeAnimation*> mBoneChannels;
 
-		void UpdateNodeAnimations();
-		void UpdateBoneTransforms(const BoneNode* pBoneNode, const Matrix4& parentTransform);
 		NodeAnimation* GetNodeAnimation(const string& nodeName);
 	};
 }
\ No newline at end of file
@@ -1,72 +1,131 @@
 #include "AnimationController.h"
 #include "Animation.h"
+#include "BlendTree.h"
+#include "Skeleton.h"
 #include "../Time.h"
 #include "../ZMesh.h"
-#include "../PublicStruct.h"
 
 namespace ZXEngine
 {
+	AnimationController::AnimationController()
+	{
+		// 基础层
+		AddLayer("Base", AnimationLayerBlendMode::Override);
+	}
+
 	AnimationController::~AnimationController()
 	{
 		for (auto& iter : mAnimations)
 		{
 			delete iter.second;
 		}
+
+		for (auto& iter : mBlendTrees)
+		{
+			delete iter.second;
+		}
+	}
+
+	static Matrix4 GetKeyFrameMatrix(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+	{
+		return Math::TranslationMatrix(position) * rotation.ToMatrix() * Math::ScaleMatrix(scale);
 	}
 
-	void AnimationController::Update(const BoneNode* pBoneNode, const vector<Mesh*>& pMeshes)
+	// 按权重把旋转累加到sum上，和sum的方向相反时取反，保证混合时走较近的路径
+	static void AccumulateRotation(Quaternion& sum, const Quaternion& rotation, float weight)
 	{
-		if (mIsBlending)
+		if (Math::Dot(sum, rotation) < 0.0f)
+			weight = -weight;
+
+		sum.x += rotation.x * weight;
+		sum.y += rotation.y * weight;
+		sum.z += rotation.z * weight;
+		sum.w += rotation.w * weight;
+	}
+
+	void AnimationController::Update(const vector<Mesh*>& pMeshes)
+	{
+		Sample(pMeshes, Time::deltaTime);
+		Publish(pMeshes);
+	}
+
+	void AnimationController::Sample(const vector<Mesh*>& pMeshes, float deltaTime, bool isReduced)
+	{
+		mHasNewPose = false;
+
+		if (mSkeleton == nullptr)
+			return;
+
+		// 上一帧用过的姿势全部归还，缓存也只在一帧内有效
+		mUsedPoseNum = 0;
+		mPoseCache.clear();
+		mUpdatedAnimations.clear();
+		mSampledAnimations.clear();
+
+		// 先推进所有层的进度再计算姿势，保证同一个动画在不同层里用的是同一个时间
+		for (auto& layer : mLayers)
+			UpdateLayer(layer, deltaTime);
+
+		const vector<uint32_t>& boneIndices = isReduced ? mReducedBoneIndices : mAllBoneIndices;
+
+		uint32_t resultPose = UINT32_MAX;
+		bool isResultOwned = false;
+		for (size_t i = 0; i < mLayers.size(); i++)
 		{
-			mBlendTime += Time::deltaTime;
+			const AnimationLayer& layer = mLayers[i];
+			if (!layer.mCurMotion.IsValid())
+				continue;
 
-			if (mBlendTime > mBlendDuration)
+			if (i == 0)
 			{
-				mIsBlending = false;
-				mCurAnimation = mTargetAnimation;
-				mTargetAnimation = nullptr;
-				mBlendTime = 0.0f;
-				mBlendDuration = 0.0f;
-				mCurBlendAnimTime = 0.0f;
-				mBlendFactor = 0.0f;
+				resultPose = EvaluateLayer(layer, boneIndices, isReduced);
+				continue;
 			}
-			else
-			{
-				mBlendFactor = mBlendTime / mBlendDuration;
 
-				// ϶ʱ
-				float blendAnimDuration = Math::Lerp(mCurAnimation->mDuration, mTargetAnimation->mDuration, mBlendFactor);
+			// 远处的角色只计算基础层
+			if (isReduced || layer.mWeight <= 0.0f)
+				continue;
 
-				// ϶Ž
-				float curAnimProgressDelta = Time::deltaTime / mCurAnimation->mDuration;
-				float targetAnimProgressDelta = Time::deltaTime / mTargetAnimation->mDuration;
-				float blendAnimProgressDelta = Math::Lerp(curAnimProgressDelta, targetAnimProgressDelta, mBlendFactor);
-				
-				mCurBlendAnimTime += blendAnimProgressDelta * blendAnimDuration;
+			uint32_t layerPose = EvaluateLayer(layer, boneIndices, isReduced);
 
-				if (mCurBlendAnimTime > blendAnimDuration)
+			// 结果要在原地修改，而基础层的姿势可能还会被上面的层从缓存里复用，所以先拷贝一份
+			if (!isResultOwned)
+			{
+				uint32_t newResultPose = AcquirePose();
+				if (resultPose == UINT32_MAX)
 				{
-					mCurAnimation->Reset();
-					mTargetAnimation->Reset();
-					mCurBlendAnimTime -= blendAnimDuration;
+					// 基础层没有在播放，从绑定姿势开始叠加
+					auto& pose = mPosePool[newResultPose];
+					for (auto boneIndex : boneIndices)
+						pose[boneIndex] = mSkeleton->mBindPose[boneIndex];
 				}
-				float blendAnimProgress = mCurBlendAnimTime / blendAnimDuration;
+				else
+				{
+					CopyPose(resultPose, newResultPose, boneIndices);
+				}
+				resultPose = newResultPose;
+				isResultOwned = true;
+			}
 
-				// ϶ĲŽתtick
-				float curAnimTicks = blendAnimProgress * mCurAnimation->mFullTick;
-				float targetAnimTicks = blendAnimProgress * mTargetAnimation->mFullTick;
+			ApplyLayer(layer, layerPose, resultPose, boneIndices);
+		}
 
-				mCurAnimation->Update(curAnimTicks);
-				mTargetAnimation->Update(targetAnimTicks);
+		if (resultPose == UINT32_MAX)
+			return;
 
-				UpdateBlendAnimation(pBoneNode, pMeshes, Matrix4());
-			}
-		}
-		else if (mCurAnimation)
-		{
-			mCurAnimation->Update();
-			mCurAnimation->UpdateMeshes(pBoneNode, pMeshes);
-		}
+		UpdateLocalTransforms(resultPose, boneIndices);
+		UpdateGlobalTransforms();
+		UpdateSkinningTransforms(pMeshes);
+	}
+
+	void AnimationController::Publish(const vector<Mesh*>& pMeshes)
+	{
+		if (!mHasNewPose)
+			return;
+
+		// 交换数组不需要拷贝，交换回来的旧数组下一帧会被完整覆盖
+		for (size_t i = 0; i < pMeshes.size(); i++)
+			std::swap(pMeshes[i]->mBonesFinalTransform, mSkinningTransforms[i]);
 	}
 
 	void AnimationController::Add(Animation* anim)
@@ -74,6 +133,9 @@ namespace ZXEngine
 		if (mAnimations.find(anim->mName) == mAnimations.end())
 		{
 			mAnimations[anim->mName] = anim;
+
+			if (mSkeleton)
+				anim->BindSkeleton(mSkeleton);
 		}
 		else
 		{
@@ -81,18 +143,84 @@ namespace ZXEngine
 		}
 	}
 
-	void AnimationController::Play(const string& name)
+	Animation* AnimationController::GetAnimation(const string& name) const
 	{
-		if (mAnimations.find(name) != mAnimations.end())
+		auto iter = mAnimations.find(name);
+		return iter == mAnimations.end() ? nullptr : iter->second;
+	}
+
+	BlendTree* AnimationController::AddBlendTree(const string& name, BlendTreeType type, const string& parameterX, const string& parameterY)
+	{
+		if (mAnimations.find(name) != mAnimations.end() || mBlendTrees.find(name) != mBlendTrees.end())
 		{
-			// ӿڻֱֹͣǰڲŵĶ
-			if (mCurAnimation)
-			{
-				mCurAnimation->Stop();
-			}
+			Debug::LogWarning("AnimationController try to add a blend tree with an existing name: %s", name);
+			return nullptr;
+		}
+
+		BlendTree* pBlendTree = new BlendTree(name, type, parameterX, parameterY);
+		mBlendTrees[name] = pBlendTree;
+		return pBlendTree;
+	}
+
+	void AnimationController::RemoveBlendTree(const string& name)
+	{
+		auto iter = mBlendTrees.find(name);
+		if (iter == mBlendTrees.end())
+			return;
+
+		delete iter->second;
+		mBlendTrees.erase(iter);
+	}
 
-			mCurAnimation = mAnimations[name];
-			mCurAnimation->Play();
+	void AnimationController::BindSkeleton(const Skeleton* pSkeleton)
+	{
+		mSkeleton = pSkeleton;
+
+		// 简化模式下不采样的骨骼会保持之前的局部变换，所以初始化成绑定姿势
+		mLocalTransforms = pSkeleton->mBindLocalTransforms;
+		mGlobalTransforms.resize(pSkeleton->GetBoneNum());
+
+		mAllBoneIndices.resize(pSkeleton->GetBoneNum());
+		for (uint32_t i = 0; i < pSkeleton->GetBoneNum(); i++)
+			mAllBoneIndices[i] = i;
+		UpdateReducedBoneIndices();
+
+		// 骨骼数量变了，之前的姿势和参考姿势都不能用了
+		mPosePool.clear();
+		mReferencePoses.clear();
+
+		for (auto& layer : mLayers)
+			UpdateLayerBoneMask(layer);
+
+		for (auto& iter : mAnimations)
+			iter.second->BindSkeleton(pSkeleton);
+	}
+
+	void AnimationController::SetReducedBoneDepth(uint32_t depth)
+	{
+		mReducedBoneDepth = depth;
+
+		if (mSkeleton)
+			UpdateReducedBoneIndices();
+	}
+
+	void AnimationController::Play(const string& name, uint32_t layer)
+	{
+		if (layer >= mLayers.size())
+		{
+			Debug::LogWarning("AnimationController try to play on an non-existing layer: %s", layer);
+			return;
+		}
+
+		AnimationMotion motion;
+		if (GetMotion(name, motion))
+		{
+			// 这个接口会直接停止当前正在播放的动画，包括正在进行的过渡
+			Stop(layer);
+
+			auto& animationLayer = mLayers[layer];
+			animationLayer.mCurMotion = motion;
+			PlayMotion(motion);
 		}
 		else
 		{
@@ -100,33 +228,42 @@ namespace ZXEngine
 		}
 	}
 
-	void AnimationController::Switch(const string& name, float time)
+	void AnimationController::Switch(const string& name, float time, uint32_t layer)
 	{
-		if (mAnimations.find(name) != mAnimations.end())
+		if (layer >= mLayers.size())
 		{
-			// ǰжڲŲ߻л߼
-			if (mCurAnimation && mCurAnimation->IsPlaying())
+			Debug::LogWarning("AnimationController try to switch on an non-existing layer: %s", layer);
+			return;
+		}
+
+		AnimationMotion motion;
+		if (GetMotion(name, motion))
+		{
+			auto& animationLayer = mLayers[layer];
+
+			// 当前有动画正在播放才走混合切换逻辑
+			if (animationLayer.mCurMotion.IsValid() && IsMotionPlaying(animationLayer.mCurMotion))
 			{
-				// ǰҪлĶͬһͲл
-				if (mCurAnimation->mName == name)
+				// 如果当前动画和要切换的动画是同一个就不用切换了
+				if (animationLayer.mCurMotion.GetKey() == motion.GetKey())
 				{
 					return;
 				}
 
-				mBlendTime = 0.0f;
-				mBlendDuration = time;
-				mIsBlending = true;
-				// ϸտʼʱֱԵǰĲŽΪ϶ĲŽ
-				mCurBlendAnimTime = mCurAnimation->mCurTick / mCurAnimation->mTicksPerSecond;
+				animationLayer.mBlendTime = 0.0f;
+				animationLayer.mBlendDuration = time;
+				animationLayer.mIsBlending = true;
+				// 混合刚开始的时候直接以当前动画的播放进度作为混合动画的播放进度
+				animationLayer.mCurBlendAnimTime = GetMotionTime(animationLayer.mCurMotion);
 
-				mTargetAnimation = mAnimations[name];
-				mTargetAnimation->Play();
+				animationLayer.mTargetMotion = motion;
+				PlayMotion(motion);
 			}
-			// ǰûڲŵĶֱӲ¶
+			// 当前没有正在播放的动画就直接播新动画
 			else
 			{
-				mCurAnimation = mAnimations[name];
-				mCurAnimation->Play();
+				animationLayer.mCurMotion = motion;
+				PlayMotion(motion);
 			}
 		}
 		else
@@ -135,51 +272,620 @@ namespace ZXEngine
 		}
 	}
 
-	void AnimationController::UpdateBlendAnimation(const BoneNode* pBoneNode, const vector<Mesh*>& pMeshes, const Matrix4& parentTransform)
+	void AnimationController::Stop(uint32_t layer)
 	{
-		string nodeName = pBoneNode->name;
+		if (layer >= mLayers.size())
+			return;
 
-		Matrix4 nodeTransform(pBoneNode->transform);
+		auto& animationLayer = mLayers[layer];
 
-		KeyFrame curKeyFrame;
-		KeyFrame targetKeyFrame;
+		if (animationLayer.mCurMotion.IsValid())
+			StopMotion(animationLayer.mCurMotion);
+		if (animationLayer.mTargetMotion.IsValid())
+			StopMotion(animationLayer.mTargetMotion);
 
-		bool getCurFrame = mCurAnimation->GetCurFrameByNode(nodeName, curKeyFrame);
-		bool getTargetFrame = mTargetAnimation->GetCurFrameByNode(nodeName, targetKeyFrame);
+		animationLayer.mCurMotion = AnimationMotion();
+		animationLayer.mTargetMotion = AnimationMotion();
+		animationLayer.mIsBlending = false;
+		animationLayer.mBlendFactor = 0.0f;
+		animationLayer.mBlendTime = 0.0f;
+		animationLayer.mBlendDuration = 0.0f;
+		animationLayer.mCurBlendAnimTime = 0.0f;
+	}
 
-		if (getCurFrame && getTargetFrame)
+	uint32_t AnimationController::AddLayer(const string& name, AnimationLayerBlendMode blendMode, float weight)
+	{
+		AnimationLayer layer;
+		layer.mName = name;
+		layer.mBlendMode = blendMode;
+		layer.mWeight = weight;
+		mLayers.push_back(layer);
+
+		return static_cast<uint32_t>(mLayers.size() - 1);
+	}
+
+	uint32_t AnimationController::GetLayerIndex(const string& name) const
+	{
+		for (size_t i = 0; i < mLayers.size(); i++)
 		{
-			Vector3 scale = Math::Lerp(curKeyFrame.mScale, targetKeyFrame.mScale, mBlendFactor);
-			Matrix4 scaleMatrix = Math::ScaleMatrix(scale);
+			if (mLayers[i].mName == name)
+				return static_cast<uint32_t>(i);
+		}
+		return UINT32_MAX;
+	}
+
+	void AnimationController::SetLayerWeight(uint32_t layer, float weight)
+	{
+		if (layer < mLayers.size())
+			mLayers[layer].mWeight = Math::Clamp(weight, 0.0f, 1.0f);
+	}
+
+	void AnimationController::SetLayerBoneMask(uint32_t layer, const vector<string>& rootBoneNames)
+	{
+		if (layer >= mLayers.size())
+			return;
+
+		mLayers[layer].mBoneMaskRoots = rootBoneNames;
+
+		if (mSkeleton)
+			UpdateLayerBoneMask(mLayers[layer]);
+	}
+
+	void AnimationController::SetParameter(const string& name, float value)
+	{
+		mParameters[name] = value;
+	}
+
+	float AnimationController::GetParameter(const string& name) const
+	{
+		auto iter = mParameters.find(name);
+		return iter == mParameters.end() ? 0.0f : iter->second;
+	}
+
+	bool AnimationController::GetMotion(const string& name, AnimationMotion& motion) const
+	{
+		auto animIter = mAnimations.find(name);
+		if (animIter != mAnimations.end())
+		{
+			motion.pAnimation = animIter->second;
+			motion.pBlendTree = nullptr;
+			return true;
+		}
+
+		auto treeIter = mBlendTrees.find(name);
+		if (treeIter != mBlendTrees.end())
+		{
+			motion.pAnimation = nullptr;
+			motion.pBlendTree = treeIter->second;
+			return true;
+		}
+
+		return false;
+	}
+
+	void AnimationController::PlayMotion(const AnimationMotion& motion)
+	{
+		if (motion.pAnimation)
+		{
+			motion.pAnimation->Play();
+		}
+		else
+		{
+			motion.pBlendTree->mProgress = 0.0f;
+			for (auto& child : motion.pBlendTree->mChildren)
+				child.pAnimation->Play();
+		}
+	}
+
+	void AnimationController::StopMotion(const AnimationMotion& motion)
+	{
+		if (motion.pAnimation)
+		{
+			motion.pAnimation->Stop();
+		}
+		else
+		{
+			for (auto& child : motion.pBlendTree->mChildren)
+				child.pAnimation->Stop();
+		}
+	}
+
+	void AnimationController::ResetMotion(const AnimationMotion& motion)
+	{
+		if (motion.pAnimation)
+		{
+			motion.pAnimation->Reset();
+		}
+		else
+		{
+			for (auto& child : motion.pBlendTree->mChildren)
+				child.pAnimation->Reset();
+		}
+	}
 
-			Vector3 position = Math::Lerp(curKeyFrame.mPosition, targetKeyFrame.mPosition, mBlendFactor);
-			Matrix4 translationMatrix = Math::TranslationMatrix(position);
+	bool AnimationController::IsMotionPlaying(const AnimationMotion& motion) const
+	{
+		// 混合树总是循环播放
+		return motion.pAnimation ? motion.pAnimation->IsPlaying() : true;
+	}
+
+	float AnimationController::GetMotionDuration(const AnimationMotion& motion) const
+	{
+		return motion.pAnimation ? motion.pAnimation->mDuration : motion.pBlendTree->GetDuration();
+	}
 
-			Quaternion rotation = Math::Slerp(curKeyFrame.mRotation, targetKeyFrame.mRotation, mBlendFactor);
-			Matrix4 rotationMatrix = rotation.ToMatrix();
+	float AnimationController::GetMotionTime(const AnimationMotion& motion) const
+	{
+		if (motion.pAnimation)
+			return motion.pAnimation->mCurTick / motion.pAnimation->mTicksPerSecond;
+		else
+			return motion.pBlendTree->mProgress * motion.pBlendTree->GetDuration();
+	}
 
-			nodeTransform = translationMatrix * rotationMatrix * scaleMatrix;
+	void AnimationController::SetMotionProgress(const AnimationMotion& motion, float progress)
+	{
+		if (motion.pAnimation)
+		{
+			motion.pAnimation->mCurTick = progress * motion.pAnimation->mFullTick;
 		}
-		else if (getCurFrame != getTargetFrame)
+		else
+		{
+			motion.pBlendTree->mProgress = progress;
+			for (auto& child : motion.pBlendTree->mChildren)
+				child.pAnimation->mCurTick = progress * child.pAnimation->mFullTick;
+		}
+	}
+
+	void AnimationController::AdvanceMotion(const AnimationMotion& motion, float deltaTime)
+	{
+		if (motion.pAnimation)
 		{
-			Debug::LogWarning("Blend animation do not match on node: %s", nodeName);
+			motion.pAnimation->Advance(deltaTime);
+			return;
 		}
 
-		Matrix4 globalTransform = parentTransform * nodeTransform;
+		// 混合树的所有子动画按同一个归一化进度播放，进度的速度由混合后的时长决定
+		BlendTree* pBlendTree = motion.pBlendTree;
+		float duration = pBlendTree->GetDuration();
+		if (duration > 0.0f)
+			pBlendTree->mProgress += deltaTime / duration;
 
-		for (auto pMesh : pMeshes)
+		if (pBlendTree->mProgress >= 1.0f)
 		{
-			if (pMesh->mBoneNameToIndexMap.find(nodeName) != pMesh->mBoneNameToIndexMap.end())
+			pBlendTree->mProgress = fmodf(pBlendTree->mProgress, 1.0f);
+			ResetMotion(motion);
+		}
+
+		SetMotionProgress(motion, pBlendTree->mProgress);
+	}
+
+	void AnimationController::UpdateBlendTreeWeights(const AnimationMotion& motion)
+	{
+		BlendTree* pBlendTree = motion.pBlendTree;
+		if (pBlendTree == nullptr)
+			return;
+
+		Vector2 parameter;
+		parameter.x = GetParameter(pBlendTree->mParameterX);
+		if (pBlendTree->mType == BlendTreeType::Freeform2D)
+			parameter.y = GetParameter(pBlendTree->mParameterY);
+
+		pBlendTree->UpdateWeights(parameter);
+	}
+
+	bool AnimationController::MarkMotionUpdated(const AnimationMotion& motion)
+	{
+		// 同一个动画可能同时被直接播放和放在混合树里，所以按最终的动画判断，而不是按动作本身
+		if (motion.pAnimation)
+		{
+			if (std::find(mUpdatedAnimations.begin(), mUpdatedAnimations.end(), motion.pAnimation) != mUpdatedAnimations.end())
+				return false;
+
+			mUpdatedAnimations.push_back(motion.pAnimation);
+			return true;
+		}
+
+		// 混合树的子动画按同一个进度同步播放，其中任何一个已经被推进过，整个混合树这一帧都不再推进
+		auto& children = motion.pBlendTree->mChildren;
+		for (auto& child : children)
+		{
+			if (std::find(mUpdatedAnimations.begin(), mUpdatedAnimations.end(), child.pAnimation) != mUpdatedAnimations.end())
+				return false;
+		}
+
+		for (auto& child : children)
+			mUpdatedAnimations.push_back(child.pAnimation);
+		return true;
+	}
+
+	void AnimationController::UpdateLayer(AnimationLayer& layer, float deltaTime)
+	{
+		if (!layer.mCurMotion.IsValid())
+			return;
+
+		UpdateBlendTreeWeights(layer.mCurMotion);
+
+		if (layer.mIsBlending)
+		{
+			UpdateBlendTreeWeights(layer.mTargetMotion);
+
+			layer.mBlendTime += deltaTime;
+
+			if (layer.mBlendTime > layer.mBlendDuration)
+			{
+				layer.mIsBlending = false;
+				layer.mCurMotion = layer.mTargetMotion;
+				layer.mTargetMotion = AnimationMotion();
+				layer.mBlendTime = 0.0f;
+				layer.mBlendDuration = 0.0f;
+				layer.mCurBlendAnimTime = 0.0f;
+				layer.mBlendFactor = 0.0f;
+			}
+			else
+			{
+				layer.mBlendFactor = layer.mBlendTime / layer.mBlendDuration;
+
+				// 混合动画时长
+				float curDuration = GetMotionDuration(layer.mCurMotion);
+				float targetDuration = GetMotionDuration(layer.mTargetMotion);
+				float blendAnimDuration = Math::Lerp(curDuration, targetDuration, layer.mBlendFactor);
+
+				// 混合动画播放进度
+				float curAnimProgressDelta = deltaTime / curDuration;
+				float targetAnimProgressDelta = deltaTime / targetDuration;
+				float blendAnimProgressDelta = Math::Lerp(curAnimProgressDelta, targetAnimProgressDelta, layer.mBlendFactor);
+
+				layer.mCurBlendAnimTime += blendAnimProgressDelta * blendAnimDuration;
+
+				if (layer.mCurBlendAnimTime > blendAnimDuration)
+				{
+					ResetMotion(layer.mCurMotion);
+					ResetMotion(layer.mTargetMotion);
+					layer.mCurBlendAnimTime = fmodf(layer.mCurBlendAnimTime, blendAnimDuration);
+				}
+				float blendAnimProgress = layer.mCurBlendAnimTime / blendAnimDuration;
+
+				if (MarkMotionUpdated(layer.mCurMotion))
+					SetMotionProgress(layer.mCurMotion, blendAnimProgress);
+				if (MarkMotionUpdated(layer.mTargetMotion))
+					SetMotionProgress(layer.mTargetMotion, blendAnimProgress);
+			}
+		}
+		else if (MarkMotionUpdated(layer.mCurMotion))
+		{
+			AdvanceMotion(layer.mCurMotion, deltaTime);
+		}
+	}
+
+	uint32_t AnimationController::EvaluateLayer(const AnimationLayer& layer, const vector<uint32_t>& boneIndices, bool isReduced)
+	{
+		bool isAdditive = layer.mBlendMode == AnimationLayerBlendMode::Additive;
+
+		if (!layer.mIsBlending)
+			return EvaluateMotion(layer.mCurMotion, isAdditive, boneIndices, isReduced);
+
+		// 远处看不出过渡的效果，只计算权重大的那个动作
+		if (isReduced)
+			return EvaluateMotion(layer.mBlendFactor < 0.5f ? layer.mCurMotion : layer.mTargetMotion, isAdditive, boneIndices, isReduced);
+
+		uint32_t curPose = EvaluateMotion(layer.mCurMotion, isAdditive, boneIndices, isReduced);
+		uint32_t targetPose = EvaluateMotion(layer.mTargetMotion, isAdditive, boneIndices, isReduced);
+		uint32_t blendPose = AcquirePose();
+
+		auto& cur = mPosePool[curPose];
+		auto& target = mPosePool[targetPose];
+		auto& blend = mPosePool[blendPose];
+		for (auto boneIndex : boneIndices)
+		{
+			blend[boneIndex].mScale = Math::Lerp(cur[boneIndex].mScale, target[boneIndex].mScale, layer.mBlendFactor);
+			blend[boneIndex].mPosition = Math::Lerp(cur[boneIndex].mPosition, target[boneIndex].mPosition, layer.mBlendFactor);
+			blend[boneIndex].mRotation = Math::Slerp(cur[boneIndex].mRotation, target[boneIndex].mRotation, layer.mBlendFactor);
+		}
+
+		return blendPose;
+	}
+
+	uint32_t AnimationController::EvaluateMotion(const AnimationMotion& motion, bool isAdditive, const vector<uint32_t>& boneIndices, bool isReduced)
+	{
+		const void* pKey = motion.GetKey();
+		for (auto& cachedPose : mPoseCache)
+		{
+			if (cachedPose.pKey == pKey && cachedPose.isAdditive == isAdditive)
+				return cachedPose.poseIndex;
+		}
+
+		mWeightedAnimations.clear();
+		if (motion.pAnimation)
+		{
+			mWeightedAnimations.push_back({ motion.pAnimation, 1.0f });
+		}
+		else
+		{
+			BlendTree* pBlendTree = motion.pBlendTree;
+			for (size_t i = 0; i < pBlendTree->mChildren.size(); i++)
+			{
+				if (pBlendTree->mWeights[i] > 0.0f)
+					mWeightedAnimations.push_back({ pBlendTree->mChildren[i].pAnimation, pBlendTree->mWeights[i] });
+			}
+
+			// 简化模式只用权重最大的动画
+			if (isReduced && mWeightedAnimations.size() > 1)
+			{
+				auto iter = std::max_element(mWeightedAnimations.begin(), mWeightedAnimations.end(),
+					[](const WeightedAnimation& a, const WeightedAnimation& b) { return a.weight < b.weight; });
+				WeightedAnimation mainAnimation = { iter->pAnimation, 1.0f };
+				mWeightedAnimations.clear();
+				mWeightedAnimations.push_back(mainAnimation);
+			}
+		}
+
+		uint32_t poseIndex = AcquirePose();
+		auto& pose = mPosePool[poseIndex];
+
+		size_t animationNum = mWeightedAnimations.size();
+
+		// 混合树里没有可用的动画时保持绑定姿势，叠加模式下就是没有变化
+		if (animationNum == 0)
+		{
+			KeyFrame identity = { Vector3(1.0f), Vector3(), Quaternion() };
+			for (auto boneIndex : boneIndices)
+				pose[boneIndex] = isAdditive ? identity : mSkeleton->mBindPose[boneIndex];
+
+			mPoseCache.push_back({ pKey, isAdditive, poseIndex });
+			return poseIndex;
+		}
+
+		// 计算参考姿势会覆盖动画当前帧的采样结果，所以要在采样之前准备好
+		mWeightedReferencePoses.clear();
+		if (isAdditive)
+		{
+			for (auto& weightedAnimation : mWeightedAnimations)
+				mWeightedReferencePoses.push_back(&GetReferencePose(weightedAnimation.pAnimation));
+		}
+
+		for (auto& weightedAnimation : mWeightedAnimations)
+			SampleAnimation(weightedAnimation.pAnimation, boneIndices);
+
+		// 最常见的只有一个动画的情况，直接拷贝采样结果
+		if (animationNum == 1 && !isAdditive)
+		{
+			Animation* pAnimation = mWeightedAnimations[0].pAnimation;
+			for (auto boneIndex : boneIndices)
+			{
+				const KeyFrame* pKeyFrame = pAnimation->GetCurFrameByBone(boneIndex);
+				pose[boneIndex] = pKeyFrame ? *pKeyFrame : mSkeleton->mBindPose[boneIndex];
+			}
+
+			mPoseCache.push_back({ pKey, isAdditive, poseIndex });
+			return poseIndex;
+		}
+
+		// 多个动画的混合在同一次骨骼遍历里完成
+		for (auto boneIndex : boneIndices)
+		{
+			const KeyFrame& bindPose = mSkeleton->mBindPose[boneIndex];
+
+			Vector3 scale;
+			Vector3 position;
+			Quaternion rotation(0.0f, 0.0f, 0.0f, 0.0f);
+			for (size_t i = 0; i < animationNum; i++)
+			{
+				float weight = mWeightedAnimations[i].weight;
+				const KeyFrame* pKeyFrame = mWeightedAnimations[i].pAnimation->GetCurFrameByBone(boneIndex);
+				const KeyFrame& keyFrame = pKeyFrame ? *pKeyFrame : bindPose;
+
+				if (isAdditive)
+				{
+					// 叠加模式记录的是相对参考姿势的变化量
+					const KeyFrame& reference = (*mWeightedReferencePoses[i])[boneIndex];
+					scale += (keyFrame.mScale / reference.mScale) * weight;
+					position += (keyFrame.mPosition - reference.mPosition) * weight;
+					AccumulateRotation(rotation, reference.mRotation.GetInverse() * keyFrame.mRotation, weight);
+				}
+				else
+				{
+					scale += keyFrame.mScale * weight;
+					position += keyFrame.mPosition * weight;
+					AccumulateRotation(rotation, keyFrame.mRotation, weight);
+				}
+			}
+			rotation.Normalize();
+
+			pose[boneIndex].mScale = scale;
+			pose[boneIndex].mPosition = position;
+			pose[boneIndex].mRotation = rotation;
+		}
+
+		mPoseCache.push_back({ pKey, isAdditive, poseIndex });
+		return poseIndex;
+	}
+
+	void AnimationController::ApplyLayer(const AnimationLayer& layer, uint32_t layerPose, uint32_t resultPose, const vector<uint32_t>& boneIndices)
+	{
+		auto& src = mPosePool[layerPose];
+		auto& dst = mPosePool[resultPose];
+		bool hasBoneMask = !layer.mBoneMask.empty();
+
+		for (auto boneIndex : boneIndices)
+		{
+			float weight = hasBoneMask ? layer.mWeight * layer.mBoneMask[boneIndex] : layer.mWeight;
+			if (weight <= 0.0f)
+				continue;
+
+			KeyFrame& result = dst[boneIndex];
+			const KeyFrame& layerFrame = src[boneIndex];
+
+			if (layer.mBlendMode == AnimationLayerBlendMode::Override)
+			{
+				if (weight >= 1.0f)
+				{
+					result = layerFrame;
+				}
+				else
+				{
+					result.mScale = Math::Lerp(result.mScale, layerFrame.mScale, weight);
+					result.mPosition = Math::Lerp(result.mPosition, layerFrame.mPosition, weight);
+					result.mRotation = Math::Slerp(result.mRotation, layerFrame.mRotation, weight);
+					result.mRotation.Normalize();
+				}
+			}
+			else
 			{
-				uint32_t index = pMesh->mBoneNameToIndexMap[nodeName];
-				// ˴ľǸShaderõģҪתΪ
-				pMesh->mBonesFinalTransform[index] = Math::Transpose(globalTransform * pMesh->mBonesOffset[index]);
+				Quaternion rotation = weight >= 1.0f ? layerFrame.mRotation : Math::Slerp(Quaternion(), layerFrame.mRotation, weight);
+				result.mScale *= Math::Lerp(Vector3(1.0f), layerFrame.mScale, weight);
+				result.mPosition += layerFrame.mPosition * weight;
+				result.mRotation = result.mRotation * rotation;
+				result.mRotation.Normalize();
 			}
 		}
+	}
+
+	uint32_t AnimationController::AcquirePose()
+	{
+		if (mUsedPoseNum == mPosePool.size())
+			mPosePool.emplace_back(mSkeleton->GetBoneNum());
+
+		return mUsedPoseNum++;
+	}
+
+	void AnimationController::CopyPose(uint32_t srcPose, uint32_t dstPose, const vector<uint32_t>& boneIndices)
+	{
+		auto& src = mPosePool[srcPose];
+		auto& dst = mPosePool[dstPose];
+		for (auto boneIndex : boneIndices)
+			dst[boneIndex] = src[boneIndex];
+	}
+
+	void AnimationController::SampleAnimation(Animation* pAnimation, const vector<uint32_t>& boneIndices)
+	{
+		if (std::find(mSampledAnimations.begin(), mSampledAnimations.end(), pAnimation) != mSampledAnimations.end())
+			return;
+
+		pAnimation->Sample(boneIndices);
+		mSampledAnimations.push_back(pAnimation);
+	}
+
+	const vector<KeyFrame>& AnimationController::GetReferencePose(Animation* pAnimation)
+	{
+		auto iter = mReferencePoses.find(pAnimation);
+		if (iter != mReferencePoses.end())
+			return iter->second;
+
+		auto& referencePose = mReferencePoses[pAnimation];
+		uint32_t boneNum = mSkeleton->GetBoneNum();
+		referencePose.resize(boneNum);
+
+		// 临时采样到第一帧，之后恢复播放进度，重置过的游标在下次采样时会重新往后查找
+		float curTick = pAnimation->mCurTick;
+		pAnimation->Reset();
+		pAnimation->Update(0.0f);
+
+		for (uint32_t i = 0; i < boneNum; i++)
+		{
+			const KeyFrame* pKeyFrame = pAnimation->GetCurFrameByBone(i);
+			referencePose[i] = pKeyFrame ? *pKeyFrame : mSkeleton->mBindPose[i];
+		}
+
+		pAnimation->Reset();
+		pAnimation->mCurTick = curTick;
+
+		// 这一帧之前的采样结果被覆盖了，需要重新采样
+		auto sampledIter = std::find(mSampledAnimations.begin(), mSampledAnimations.end(), pAnimation);
+		if (sampledIter != mSampledAnimations.end())
+			mSampledAnimations.erase(sampledIter);
+
+		return referencePose;
+	}
+
+	void AnimationController::UpdateReducedBoneIndices()
+	{
+		mReducedBoneIndices.clear();
+
+		uint32_t boneNum = mSkeleton->GetBoneNum();
+		for (uint32_t i = 0; i < boneNum; i++)
+		{
+			if (mSkeleton->mBoneDepths[i] <= mReducedBoneDepth)
+				mReducedBoneIndices.push_back(i);
+		}
+	}
+
+	void AnimationController::UpdateLayerBoneMask(AnimationLayer& layer)
+	{
+		layer.mBoneMask.clear();
+
+		if (layer.mBoneMaskRoots.empty())
+			return;
+
+		uint32_t boneNum = mSkeleton->GetBoneNum();
+		layer.mBoneMask.resize(boneNum, 0.0f);
+
+		for (auto& name : layer.mBoneMaskRoots)
+		{
+			uint32_t boneIndex = mSkeleton->GetBoneIndex(name);
+			if (boneIndex == UINT32_MAX)
+				Debug::LogWarning("Animation layer bone mask root not found: %s", name);
+			else
+				layer.mBoneMask[boneIndex] = 1.0f;
+		}
 
-		for (auto& iter : pBoneNode->children)
+		// 父节点排在子节点前面，按顺序遍历一遍就能把权重传递给所有子骨骼
+		for (uint32_t i = 0; i < boneNum; i++)
 		{
-			UpdateBlendAnimation(iter, pMeshes, globalTransform);
+			uint32_t parentIndex = mSkeleton->mParentIndices[i];
+			if (parentIndex != UINT32_MAX)
+				layer.mBoneMask[i] = Math::Max(layer.mBoneMask[i], layer.mBoneMask[parentIndex]);
 		}
 	}
+
+	void AnimationController::UpdateLocalTransforms(uint32_t pose, const vector<uint32_t>& boneIndices)
+	{
+		auto& keyFrames = mPosePool[pose];
+		for (auto boneIndex : boneIndices)
+		{
+			const KeyFrame& keyFrame = keyFrames[boneIndex];
+			mLocalTransforms[boneIndex] = GetKeyFrameMatrix(keyFrame.mPosition, keyFrame.mRotation, keyFrame.mScale);
+		}
+	}
+
+	void AnimationController::UpdateGlobalTransforms()
+	{
+		uint32_t boneNum = mSkeleton->GetBoneNum();
+		for (uint32_t i = 0; i < boneNum; i++)
+		{
+			uint32_t parentIndex = mSkeleton->mParentIndices[i];
+
+			if (parentIndex == UINT32_MAX)
+				mGlobalTransforms[i] = mLocalTransforms[i];
+			else
+				mGlobalTransforms[i] = mGlobalTransforms[parentIndex] * mLocalTransforms[i];
+		}
+	}
+
+	void AnimationController::UpdateSkinningTransforms(const vector<Mesh*>& pMeshes)
+	{
+		// 只在第一次或者Mesh变化时分配
+		if (mSkinningTransforms.size() != pMeshes.size())
+			mSkinningTransforms.resize(pMeshes.size());
+
+		for (size_t meshIdx = 0; meshIdx < pMeshes.size(); meshIdx++)
+		{
+			const Mesh* pMesh = pMeshes[meshIdx];
+			auto& skinningTransforms = mSkinningTransforms[meshIdx];
+			if (skinningTransforms.size() != pMesh->mBonesFinalTransform.size())
+				skinningTransforms.resize(pMesh->mBonesFinalTransform.size());
+
+			size_t boneNum = pMesh->mBoneSkeletonIndices.size();
+			for (size_t i = 0; i < boneNum; i++)
+			{
+				uint32_t boneIndex = pMesh->mBoneSkeletonIndices[i];
+				if (boneIndex == UINT32_MAX)
+					continue;
+
+				// 此处的矩阵是给Shader用的，需要转置为列主序
+				skinningTransforms[i] = Math::Transpose(mGlobalTransforms[boneIndex] * pMesh->mBonesOffset[i]);
+			}
+		}
+
+		mHasNewPose = true;
+	}
 }
\ No newline at end of file
@@ -1,35 +1,149 @@
 #pragma once
 #include "../pubh.h"
+#include "../PublicStruct.h"
+#include "AnimationLayer.h"
 
 namespace ZXEngine
 {
 	class Mesh;
-	struct BoneNode;
+	class Skeleton;
 	class Animation;
+	class BlendTree;
 	class AnimationController
 	{
 	public:
+		AnimationController();
 		~AnimationController();
 
-		void Update(const BoneNode* pBoneNode, const vector<Mesh*>& pMeshes);
+		// 依次执行Sample和Publish
+		void Update(const vector<Mesh*>& pMeshes);
+		// 推进播放进度，采样和混合动画，计算出蒙皮矩阵存放在自己的缓冲区里
+		// 只读Mesh上的骨骼数据，不同AnimationController之间可以在多个线程上同时执行
+		// deltaTime是距离上一次Sample的时间，isReduced为true时只采样简化骨骼，并且只计算基础层里权重最大的动画
+		void Sample(const vector<Mesh*>& pMeshes, float deltaTime, bool isReduced = false);
+		// 把Sample计算好的蒙皮矩阵交换到Mesh里，只能在主线程调用
+		void Publish(const vector<Mesh*>& pMeshes);
 		void Add(Animation* anim);
-		void Play(const string& name);
-		void Switch(const string& name, float time = 1.0f);
+		Animation* GetAnimation(const string& name) const;
+		// 添加混合树，名字不能和动画重复，之后可以像动画一样通过名字播放
+		BlendTree* AddBlendTree(const string& name, BlendTreeType type, const string& parameterX, const string& parameterY = "");
+		// 删除一个还没有播放过的混合树
+		void RemoveBlendTree(const string& name);
+		// 绑定骨骼并分配姿势数组，之后每帧更新只按骨骼下标遍历数组
+		void BindSkeleton(const Skeleton* pSkeleton);
+		// 设置简化骨骼的最大深度，深度超过这个值的骨骼在简化模式下保持上一次采样的姿势
+		void SetReducedBoneDepth(uint32_t depth);
+
+		// 以下接口的layer是动画层的下标，0是基础层
+		void Play(const string& name, uint32_t layer = 0);
+		void Switch(const string& name, float time = 1.0f, uint32_t layer = 0);
+		void Stop(uint32_t layer);
+
+		// 在最上面添加一个动画层，返回层的下标
+		uint32_t AddLayer(const string& name, AnimationLayerBlendMode blendMode, float weight = 1.0f);
+		// 找不到返回UINT32_MAX
+		uint32_t GetLayerIndex(const string& name) const;
+		void SetLayerWeight(uint32_t layer, float weight);
+		// 设置骨骼遮罩，只有这些骨骼和它们的子骨骼受这一层影响，传空数组表示影响所有骨骼
+		void SetLayerBoneMask(uint32_t layer, const vector<string>& rootBoneNames);
+
+		// 设置混合树使用的参数，没有设置过的参数为0
+		void SetParameter(const string& name, float value);
+		float GetParameter(const string& name) const;
 
 	private:
-		bool mIsBlending = false;
-		float mBlendFactor = 0.0f;
-		// ĵʱ
-		float mBlendTime = 0.0f;
-		// ǰϵĿ궯ʱ
-		float mBlendDuration = 0.0f;
-		// ǰ϶(״̬µʱ)Ĳʱ
-		float mCurBlendAnimTime = 0.0f;
-		
-		Animation* mCurAnimation = nullptr;
-		Animation* mTargetAnimation = nullptr;
+		// 姿势缓存，同一帧里多个层用到同一个动作时只计算一次
+		struct CachedPose
+		{
+			const void* pKey = nullptr;
+			bool isAdditive = false;
+			uint32_t poseIndex = 0;
+		};
+
+		// 带权重的动画，计算一个动作的姿势时使用
+		struct WeightedAnimation
+		{
+			Animation* pAnimation = nullptr;
+			float weight = 0.0f;
+		};
+
+		// 所有动画层，第0层是基础层
+		vector<AnimationLayer> mLayers;
 		unordered_map<string, Animation*> mAnimations;
+		unordered_map<string, BlendTree*> mBlendTrees;
+		unordered_map<string, float> mParameters;
+
+		const Skeleton* mSkeleton = nullptr;
+		// 所有骨骼的下标
+		vector<uint32_t> mAllBoneIndices;
+		// 简化模式下需要采样的骨骼下标，保持父节点在前的顺序
+		vector<uint32_t> mReducedBoneIndices;
+		uint32_t mReducedBoneDepth = UINT32_MAX;
+
+		// 姿势缓冲区池，每个姿势按骨骼下标排列，每帧开始时全部归还，只在池子不够用时分配
+		vector<vector<KeyFrame>> mPosePool;
+		// 这一帧已经使用的姿势数量
+		uint32_t mUsedPoseNum = 0;
+		vector<CachedPose> mPoseCache;
+		// 这一帧已经推进过进度的动画，按最终的动画记录，混合树里的动画和直接播放的动画是同一个时也只推进一次
+		vector<const Animation*> mUpdatedAnimations;
+		// 这一帧已经采样过的动画
+		vector<Animation*> mSampledAnimations;
+		// 叠加层使用的参考姿势(动画的第一帧)
+		unordered_map<const Animation*, vector<KeyFrame>> mReferencePoses;
+		// 计算动作姿势时的临时数组
+		vector<WeightedAnimation> mWeightedAnimations;
+		// 叠加模式下和mWeightedAnimations一一对应的参考姿势，同样是复用的临时数组
+		vector<const vector<KeyFrame>*> mWeightedReferencePoses;
+
+		// 按骨骼下标排列的局部变换矩阵
+		vector<Matrix4> mLocalTransforms;
+		// 按骨骼下标排列的全局变换矩阵
+		vector<Matrix4> mGlobalTransforms;
+		// 每个Mesh的蒙皮矩阵，Publish时和Mesh里的数组交换
+		vector<vector<Matrix4>> mSkinningTransforms;
+		// 这一帧Sample是否计算了新的蒙皮矩阵
+		bool mHasNewPose = false;
+
+		bool GetMotion(const string& name, AnimationMotion& motion) const;
+		// 以下是对单个动画和混合树的统一处理
+		void PlayMotion(const AnimationMotion& motion);
+		void StopMotion(const AnimationMotion& motion);
+		void ResetMotion(const AnimationMotion& motion);
+		bool IsMotionPlaying(const AnimationMotion& motion) const;
+		float GetMotionDuration(const AnimationMotion& motion) const;
+		// 当前的播放时间(秒)
+		float GetMotionTime(const AnimationMotion& motion) const;
+		// 按归一化的进度设置播放位置
+		void SetMotionProgress(const AnimationMotion& motion, float progress);
+		void AdvanceMotion(const AnimationMotion& motion, float deltaTime);
+		void UpdateBlendTreeWeights(const AnimationMotion& motion);
+		// 标记动作用到的所有动画这一帧已经推进过进度，其中有动画已经被推进过时返回false
+		bool MarkMotionUpdated(const AnimationMotion& motion);
+
+		// 推进一个层的播放进度和过渡状态
+		void UpdateLayer(AnimationLayer& layer, float deltaTime);
+		// 计算一个层的姿势，返回姿势下标
+		uint32_t EvaluateLayer(const AnimationLayer& layer, const vector<uint32_t>& boneIndices, bool isReduced);
+		// 计算一个动作的姿势，返回姿势下标，叠加模式计算的是相对参考姿势的变化量
+		uint32_t EvaluateMotion(const AnimationMotion& motion, bool isAdditive, const vector<uint32_t>& boneIndices, bool isReduced);
+		// 把一个层的姿势按权重和骨骼遮罩叠加到结果上
+		void ApplyLayer(const AnimationLayer& layer, uint32_t layerPose, uint32_t resultPose, const vector<uint32_t>& boneIndices);
+
+		uint32_t AcquirePose();
+		void CopyPose(uint32_t srcPose, uint32_t dstPose, const vector<uint32_t>& boneIndices);
+		// 一帧里每个动画只采样一次
+		void SampleAnimation(Animation* pAnimation, const vector<uint32_t>& boneIndices);
+		const vector<KeyFrame>& GetReferencePose(Animation* pAnimation);
 
-		void UpdateBlendAnimation(const BoneNode* pBoneNode, const vector<Mesh*>& pMeshes, const Matrix4& parentTransform);
+		// 按深度筛选出简化骨骼
+		void UpdateReducedBoneIndices();
+		void UpdateLayerBoneMask(AnimationLayer& layer);
+		// 把姿势转换成局部变换矩阵
+		void UpdateLocalTransforms(uint32_t pose, const vector<uint32_t>& boneIndices);
+		// 按父节点在前的顺序把局部变换累积成全局变换
+		void UpdateGlobalTransforms();
+		// 把全局变换乘上骨骼偏移量写入蒙皮矩阵缓冲区
+		void UpdateSkinningTransforms(const vector<Mesh*>& pMeshes);
 	};
 }
\ No newline at end of file
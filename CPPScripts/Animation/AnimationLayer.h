@@ -0,0 +1,44 @@
+#pragma once
+#include "../pubh.h"
+
+namespace ZXEngine
+{
+	class Animation;
+	class BlendTree;
+	// 可以播放的动作，是单个动画或者一个混合树，两个指针最多只有一个不为空
+	struct AnimationMotion
+	{
+		Animation* pAnimation = nullptr;
+		BlendTree* pBlendTree = nullptr;
+
+		bool IsValid() const { return pAnimation != nullptr || pBlendTree != nullptr; }
+		// 作为姿势缓存的Key
+		const void* GetKey() const { return pAnimation ? static_cast<const void*>(pAnimation) : static_cast<const void*>(pBlendTree); }
+	};
+
+	// 动画层，每一层有自己的播放状态和过渡，按顺序从下往上叠加，第0层是基础层
+	class AnimationLayer
+	{
+	public:
+		string mName;
+		AnimationLayerBlendMode mBlendMode = AnimationLayerBlendMode::Override;
+		// 整个层的权重，基础层总是完整输出，不使用权重和骨骼遮罩
+		float mWeight = 1.0f;
+		// 按骨骼下标排列的权重，为空时所有骨骼的权重都是1
+		vector<float> mBoneMask;
+		// 骨骼遮罩包含的骨骼名字，这些骨骼和它们的所有子骨骼权重为1
+		vector<string> mBoneMaskRoots;
+
+		AnimationMotion mCurMotion;
+		AnimationMotion mTargetMotion;
+
+		bool mIsBlending = false;
+		float mBlendFactor = 0.0f;
+		// 混合已消耗的时间
+		float mBlendTime = 0.0f;
+		// 当前动作混合到目标动作的总时间
+		float mBlendDuration = 0.0f;
+		// 当前这个混合动画(过渡状态下的临时动画)的播放时间
+		float mCurBlendAnimTime = 0.0f;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "BlendTree.h"
+#include "Animation.h"
+
+namespace ZXEngine
+{
+	BlendTree::BlendTree(const string& name, BlendTreeType type, const string& parameterX, const string& parameterY) :
+		mName(name),
+		mType(type),
+		mParameterX(parameterX),
+		mParameterY(parameterY)
+	{}
+
+	void BlendTree::AddChild(Animation* pAnimation, float threshold)
+	{
+		BlendTreeChild child;
+		child.pAnimation = pAnimation;
+		child.mPosition = Vector2(threshold, 0.0f);
+
+		auto iter = std::find_if(mChildren.begin(), mChildren.end(), [threshold](const BlendTreeChild& other) { return other.mPosition.x > threshold; });
+		mChildren.insert(iter, child);
+		mWeights.resize(mChildren.size());
+	}
+
+	void BlendTree::AddChild(Animation* pAnimation, const Vector2& position)
+	{
+		BlendTreeChild child;
+		child.pAnimation = pAnimation;
+		child.mPosition = position;
+
+		mChildren.push_back(child);
+		mWeights.resize(mChildren.size());
+	}
+
+	void BlendTree::UpdateWeights(const Vector2& parameter)
+	{
+		if (mChildren.empty())
+			return;
+
+		std::fill(mWeights.begin(), mWeights.end(), 0.0f);
+
+		if (mChildren.size() == 1)
+			mWeights[0] = 1.0f;
+		else if (mType == BlendTreeType::Simple1D)
+			UpdateWeights1D(parameter.x);
+		else
+			UpdateWeights2D(parameter);
+	}
+
+	float BlendTree::GetDuration() const
+	{
+		float duration = 0.0f;
+		for (size_t i = 0; i < mChildren.size(); i++)
+			duration += mChildren[i].pAnimation->mDuration * mWeights[i];
+		return duration;
+	}
+
+	void BlendTree::UpdateWeights1D(float parameter)
+	{
+		size_t last = mChildren.size() - 1;
+
+		// 超出阈值范围的按两端的动画处理
+		if (parameter <= mChildren[0].mPosition.x)
+		{
+			mWeights[0] = 1.0f;
+			return;
+		}
+		if (parameter >= mChildren[last].mPosition.x)
+		{
+			mWeights[last] = 1.0f;
+			return;
+		}
+
+		for (size_t i = 0; i < last; i++)
+		{
+			float min = mChildren[i].mPosition.x;
+			float max = mChildren[i + 1].mPosition.x;
+			if (parameter < max)
+			{
+				float t = max > min ? (parameter - min) / (max - min) : 0.0f;
+				mWeights[i] = 1.0f - t;
+				mWeights[i + 1] = t;
+				return;
+			}
+		}
+	}
+
+	void BlendTree::UpdateWeights2D(const Vector2& parameter)
+	{
+		// 梯度带插值(Gradient Band Interpolation)，每个动画的影响范围由它和其它所有动画之间的连线决定
+		// 参数越接近某个动画的位置，这个动画的权重就越大，参数正好在某个动画的位置上时只有它的权重是1
+		float totalWeight = 0.0f;
+		for (size_t i = 0; i < mChildren.size(); i++)
+		{
+			Vector2 toParameter = parameter - mChildren[i].mPosition;
+
+			float weight = 1.0f;
+			for (size_t j = 0; j < mChildren.size(); j++)
+			{
+				if (i == j)
+					continue;
+
+				Vector2 toOther = mChildren[j].mPosition - mChildren[i].mPosition;
+				float lengthSquared = Math::Dot(toOther, toOther);
+				if (lengthSquared <= 0.0f)
+					continue;
+
+				float h = 1.0f - Math::Dot(toParameter, toOther) / lengthSquared;
+				weight = Math::Min(weight, Math::Clamp(h, 0.0f, 1.0f));
+			}
+
+			mWeights[i] = weight;
+			totalWeight += weight;
+		}
+
+		if (totalWeight > 0.0f)
+		{
+			for (auto& weight : mWeights)
+				weight /= totalWeight;
+		}
+		else
+		{
+			mWeights[0] = 1.0f;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include "../pubh.h"
+
+namespace ZXEngine
+{
+	class Animation;
+	// 混合树里的一个动画，1D混合树只使用mPosition.x作为阈值
+	struct BlendTreeChild
+	{
+		Animation* pAnimation = nullptr;
+		Vector2 mPosition;
+	};
+
+	// 根据参数计算多个动画的权重，所有子动画按归一化的进度同步播放，适合走跑这类节奏一致的动作
+	class BlendTree
+	{
+	public:
+		string mName;
+		BlendTreeType mType = BlendTreeType::Simple1D;
+		// 控制混合的参数名，1D混合树只使用mParameterX
+		string mParameterX;
+		string mParameterY;
+		vector<BlendTreeChild> mChildren;
+
+		// 归一化的播放进度
+		float mProgress = 0.0f;
+		// 这一帧每个子动画的权重，和mChildren一一对应
+		vector<float> mWeights;
+
+		BlendTree(const string& name, BlendTreeType type, const string& parameterX, const string& parameterY = "");
+
+		// 1D混合树按阈值从小到大排列
+		void AddChild(Animation* pAnimation, float threshold);
+		void AddChild(Animation* pAnimation, const Vector2& position);
+		// 根据参数更新mWeights，权重之和为1
+		void UpdateWeights(const Vector2& parameter);
+		// 按权重混合后的动画时长
+		float GetDuration() const;
+
+	private:
+		void UpdateWeights1D(float parameter);
+		void UpdateWeights2D(const Vector2& parameter);
+	};
+}
\ No newline at end of file
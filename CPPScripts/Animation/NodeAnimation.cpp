@@ -2,6 +2,189 @@
 
 namespace ZXEngine
 {
+	// Smallest three压缩后三个分量的取值范围是[-1/sqrt(2), 1/sqrt(2)]
+	static constexpr float SmallestThreeRange = 0.70710678f;
+
+	// 从curIdx开始向后查找tick所在的关键帧区间，返回区间起点的下标
+	template<typename KeyType>
+	static size_t FindKeyIndex(const vector<KeyType>& keys, size_t keyNum, size_t curIdx, float tick)
+	{
+		if (tick >= keys[curIdx + 1].mTime)
+		{
+			for (size_t i = curIdx + 1; i < keyNum - 1; i++)
+			{
+				if (tick < keys[i + 1].mTime)
+					return i;
+			}
+		}
+		return curIdx;
+	}
+
+	// 从第一个关键帧开始尽量向后延伸，直到中间某个关键帧无法通过两端插值还原，就保留前一个关键帧作为新的起点
+	// 保留下来的关键帧之后会被量化，所以用量化再还原后的两端做插值，和原始关键帧比较，误差里已经包含了量化误差
+	template<typename KeyType, typename LerpFunc, typename ErrorFunc, typename QuantizeFunc>
+	static void ReduceKeys(vector<KeyType>& keys, float tolerance, LerpFunc lerp, ErrorFunc error, QuantizeFunc quantize)
+	{
+		if (keys.size() <= 2)
+		{
+			// 两个关键帧几乎一样的话只保留一个
+			if (keys.size() == 2 && error(quantize(keys[0].mValue), keys[1].mValue) <= tolerance)
+				keys.pop_back();
+			return;
+		}
+
+		vector<KeyType> reducedKeys;
+		reducedKeys.push_back(keys[0]);
+
+		size_t start = 0;
+		for (size_t end = 2; end < keys.size(); end++)
+		{
+			float duration = keys[end].mTime - keys[start].mTime;
+			auto from = quantize(keys[start].mValue);
+			auto to = quantize(keys[end].mValue);
+			for (size_t i = start + 1; i < end; i++)
+			{
+				float t = (keys[i].mTime - keys[start].mTime) / duration;
+				if (error(lerp(from, to, t), keys[i].mValue) > tolerance)
+				{
+					start = end - 1;
+					reducedKeys.push_back(keys[start]);
+					break;
+				}
+			}
+		}
+
+		// 整个通道都没有变化的话只保留一个
+		if (reducedKeys.size() == 1 && error(quantize(keys[0].mValue), keys.back().mValue) <= tolerance)
+		{
+			keys.resize(1);
+			return;
+		}
+
+		reducedKeys.push_back(keys.back());
+		keys = std::move(reducedKeys);
+	}
+
+	static float GetVector3Error(const Vector3& v1, const Vector3& v2)
+	{
+		return Math::Max(Math::Max(fabsf(v1.x - v2.x), fabsf(v1.y - v2.y)), fabsf(v1.z - v2.z));
+	}
+
+	static float GetQuaternionError(const Quaternion& q1, const Quaternion& q2)
+	{
+		// 两个旋转之间的夹角，用相对旋转的虚部和实部求atan2，夹角很小时acos(dot)的单精度结果只能精确到0.001弧度左右
+		// Slerp在两个四元数很接近时直接线性插值，结果不是单位四元数，atan2只和比值有关，不需要先归一化
+		Quaternion r = q1.GetInverse() * q2;
+		float sinHalfTheta = sqrtf(r.x * r.x + r.y * r.y + r.z * r.z);
+		return 2.0f * atan2f(sinHalfTheta, fabsf(r.w));
+	}
+
+	static uint16_t QuantizeFloat(float value, float min, float extent)
+	{
+		if (extent <= 0.0f)
+			return 0;
+
+		float t = Math::Clamp((value - min) / extent, 0.0f, 1.0f);
+		return static_cast<uint16_t>(t * 65535.0f + 0.5f);
+	}
+
+	static float DequantizeFloat(uint16_t value, float min, float extent)
+	{
+		return min + static_cast<float>(value) * (extent / 65535.0f);
+	}
+
+	static Vector3 DequantizeVector3(const uint16_t value[3], const Vector3& min, const Vector3& extent)
+	{
+		return Vector3(
+			DequantizeFloat(value[0], min.x, extent.x),
+			DequantizeFloat(value[1], min.y, extent.y),
+			DequantizeFloat(value[2], min.z, extent.z));
+	}
+
+	// 量化范围用删减之前的全部关键帧计算，删减时估算的量化误差和最终压缩的结果一致
+	static void GetVector3Range(const vector<KeyVector3>& keys, Vector3& min, Vector3& extent)
+	{
+		if (keys.empty())
+			return;
+
+		Vector3 max = keys[0].mValue;
+		min = keys[0].mValue;
+		for (auto& key : keys)
+		{
+			min = Vector3(Math::Min(min.x, key.mValue.x), Math::Min(min.y, key.mValue.y), Math::Min(min.z, key.mValue.z));
+			max = Vector3(Math::Max(max.x, key.mValue.x), Math::Max(max.y, key.mValue.y), Math::Max(max.z, key.mValue.z));
+		}
+		extent = max - min;
+	}
+
+	static void QuantizeVector3(const Vector3& v, const Vector3& min, const Vector3& extent, uint16_t value[3])
+	{
+		value[0] = QuantizeFloat(v.x, min.x, extent.x);
+		value[1] = QuantizeFloat(v.y, min.y, extent.y);
+		value[2] = QuantizeFloat(v.z, min.z, extent.z);
+	}
+
+	static void CompressVector3Keys(const vector<KeyVector3>& keys, vector<CompressedKeyVector3>& compressedKeys, const Vector3& min, const Vector3& extent)
+	{
+		compressedKeys.resize(keys.size());
+		for (size_t i = 0; i < keys.size(); i++)
+		{
+			compressedKeys[i].mTime = keys[i].mTime;
+			QuantizeVector3(keys[i].mValue, min, extent, compressedKeys[i].mValue);
+		}
+	}
+
+	static void QuantizeQuaternion(const Quaternion& quaternion, uint16_t value[3])
+	{
+		Quaternion q = quaternion;
+		q.Normalize();
+		float components[4] = { q.x, q.y, q.z, q.w };
+
+		uint32_t maxIdx = 0;
+		for (uint32_t i = 1; i < 4; i++)
+		{
+			if (fabsf(components[i]) > fabsf(components[maxIdx]))
+				maxIdx = i;
+		}
+
+		// q和-q表示同一个旋转，保证最大分量是正数，解压时用正的平方根还原
+		float sign = components[maxIdx] < 0.0f ? -1.0f : 1.0f;
+
+		uint32_t j = 0;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			if (i == maxIdx)
+				continue;
+
+			float t = Math::Clamp((components[i] * sign + SmallestThreeRange) / (2.0f * SmallestThreeRange), 0.0f, 1.0f);
+			value[j++] = static_cast<uint16_t>(t * 32767.0f + 0.5f);
+		}
+
+		value[0] |= static_cast<uint16_t>((maxIdx & 1) << 15);
+		value[1] |= static_cast<uint16_t>((maxIdx >> 1) << 15);
+	}
+
+	static Quaternion DequantizeQuaternion(const uint16_t value[3])
+	{
+		uint32_t maxIdx = (value[0] >> 15) | ((value[1] >> 15) << 1);
+
+		float components[4] = {};
+		float sum = 0.0f;
+		uint32_t j = 0;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			if (i == maxIdx)
+				continue;
+
+			float t = static_cast<float>(value[j++] & 0x7FFF) / 32767.0f;
+			components[i] = t * 2.0f * SmallestThreeRange - SmallestThreeRange;
+			sum += components[i] * components[i];
+		}
+		components[maxIdx] = sqrtf(Math::Max(1.0f - sum, 0.0f));
+
+		return Quaternion(components[0], components[1], components[2], components[3]);
+	}
+
 	void NodeAnimation::Reset()
 	{
 		mCurScaleIdx = 0;
@@ -16,34 +199,111 @@ namespace ZXEngine
 		mCurFrame.mRotation = GetRotation(tick);
 	}
 
+	void NodeAnimation::Compress()
+	{
+		if (mIsCompressed)
+			return;
+
+		auto lerpVector3 = [](const Vector3& v1, const Vector3& v2, float t) { return Math::Lerp(v1, v2, t); };
+		auto lerpQuaternion = [](const Quaternion& q1, const Quaternion& q2, float t) { return Math::Slerp(q1, q2, t); };
+		auto quantizeQuaternion = [](const Quaternion& q)
+		{
+			uint16_t value[3];
+			QuantizeQuaternion(q, value);
+			return DequantizeQuaternion(value);
+		};
+
+		GetVector3Range(mKeyScales, mScaleMin, mScaleExtent);
+		GetVector3Range(mKeyPositions, mPositionMin, mPositionExtent);
+		auto quantizeScale = [this](const Vector3& v)
+		{
+			uint16_t value[3];
+			QuantizeVector3(v, mScaleMin, mScaleExtent, value);
+			return DequantizeVector3(value, mScaleMin, mScaleExtent);
+		};
+		auto quantizePosition = [this](const Vector3& v)
+		{
+			uint16_t value[3];
+			QuantizeVector3(v, mPositionMin, mPositionExtent, value);
+			return DequantizeVector3(value, mPositionMin, mPositionExtent);
+		};
+
+		ReduceKeys(mKeyScales, ANIM_COMPRESS_SCALE_TOLERANCE, lerpVector3, GetVector3Error, quantizeScale);
+		ReduceKeys(mKeyPositions, ANIM_COMPRESS_POSITION_TOLERANCE, lerpVector3, GetVector3Error, quantizePosition);
+		ReduceKeys(mKeyRotations, ANIM_COMPRESS_ROTATION_TOLERANCE, lerpQuaternion, GetQuaternionError, quantizeQuaternion);
+
+		CompressVector3Keys(mKeyScales, mCompressedScales, mScaleMin, mScaleExtent);
+		CompressVector3Keys(mKeyPositions, mCompressedPositions, mPositionMin, mPositionExtent);
+
+		mCompressedRotations.resize(mKeyRotations.size());
+		for (size_t i = 0; i < mKeyRotations.size(); i++)
+		{
+			mCompressedRotations[i].mTime = mKeyRotations[i].mTime;
+			QuantizeQuaternion(mKeyRotations[i].mValue, mCompressedRotations[i].mValue);
+		}
+
+		mKeyScaleNum = mCompressedScales.size();
+		mKeyPositionNum = mCompressedPositions.size();
+		mKeyRotationNum = mCompressedRotations.size();
+
+		// 释放原始关键帧数据
+		vector<KeyVector3>().swap(mKeyScales);
+		vector<KeyVector3>().swap(mKeyPositions);
+		vector<KeyQuaternion>().swap(mKeyRotations);
+
+		mIsCompressed = true;
+		Reset();
+	}
+
+	bool NodeAnimation::IsCompressed() const
+	{
+		return mIsCompressed;
+	}
+
+	size_t NodeAnimation::GetKeyMemorySize() const
+	{
+		return mKeyScales.capacity() * sizeof(KeyVector3)
+			+ mKeyPositions.capacity() * sizeof(KeyVector3)
+			+ mKeyRotations.capacity() * sizeof(KeyQuaternion)
+			+ mCompressedScales.capacity() * sizeof(CompressedKeyVector3)
+			+ mCompressedPositions.capacity() * sizeof(CompressedKeyVector3)
+			+ mCompressedRotations.capacity() * sizeof(CompressedKeyQuaternion);
+	}
+
 	Vector3 NodeAnimation::GetScale(float tick)
 	{
 		if (mKeyScaleNum > 1)
 		{
-			if (tick >= mKeyScales[mCurScaleIdx + 1].mTime)
+			float start, end;
+			Vector3 from, to;
+
+			if (mIsCompressed)
 			{
-				for (size_t i = mCurScaleIdx + 1; i < mKeyScaleNum - 1; i++)
-				{
-					if (tick < mKeyScales[i + 1].mTime)
-					{
-						mCurScaleIdx = i;
-						break;
-					}
-				}
+				mCurScaleIdx = FindKeyIndex(mCompressedScales, mKeyScaleNum, mCurScaleIdx, tick);
+				start = mCompressedScales[mCurScaleIdx].mTime;
+				end = mCompressedScales[mCurScaleIdx + 1].mTime;
+				from = DequantizeVector3(mCompressedScales[mCurScaleIdx].mValue, mScaleMin, mScaleExtent);
+				to = DequantizeVector3(mCompressedScales[mCurScaleIdx + 1].mValue, mScaleMin, mScaleExtent);
+			}
+			else
+			{
+				mCurScaleIdx = FindKeyIndex(mKeyScales, mKeyScaleNum, mCurScaleIdx, tick);
+				start = mKeyScales[mCurScaleIdx].mTime;
+				end = mKeyScales[mCurScaleIdx + 1].mTime;
+				from = mKeyScales[mCurScaleIdx].mValue;
+				to = mKeyScales[mCurScaleIdx + 1].mValue;
 			}
 
-			float start = mKeyScales[mCurScaleIdx].mTime;
-			float end = mKeyScales[mCurScaleIdx + 1].mTime;
 			float t = (tick - start) / (end - start);
 
-			Vector3 from = mKeyScales[mCurScaleIdx].mValue;
-			Vector3 to = mKeyScales[mCurScaleIdx + 1].mValue;
-
 			return Math::Lerp(from, to, t);
 		}
 		else if (mKeyScaleNum == 1)
 		{
-			return mKeyScales[0].mValue;
+			if (mIsCompressed)
+				return DequantizeVector3(mCompressedScales[0].mValue, mScaleMin, mScaleExtent);
+			else
+				return mKeyScales[0].mValue;
 		}
 		else
 		{
@@ -55,30 +315,36 @@ namespace ZXEngine
 	{
 		if (mKeyPositionNum > 1)
 		{
-			if (tick >= mKeyPositions[mCurPositionIdx + 1].mTime)
+			float start, end;
+			Vector3 from, to;
+
+			if (mIsCompressed)
 			{
-				for (size_t i = mCurPositionIdx + 1; i < mKeyPositionNum - 1; i++)
-				{
-					if (tick < mKeyPositions[i + 1].mTime)
-					{
-						mCurPositionIdx = i;
-						break;
-					}
-				}
+				mCurPositionIdx = FindKeyIndex(mCompressedPositions, mKeyPositionNum, mCurPositionIdx, tick);
+				start = mCompressedPositions[mCurPositionIdx].mTime;
+				end = mCompressedPositions[mCurPositionIdx + 1].mTime;
+				from = DequantizeVector3(mCompressedPositions[mCurPositionIdx].mValue, mPositionMin, mPositionExtent);
+				to = DequantizeVector3(mCompressedPositions[mCurPositionIdx + 1].mValue, mPositionMin, mPositionExtent);
+			}
+			else
+			{
+				mCurPositionIdx = FindKeyIndex(mKeyPositions, mKeyPositionNum, mCurPositionIdx, tick);
+				start = mKeyPositions[mCurPositionIdx].mTime;
+				end = mKeyPositions[mCurPositionIdx + 1].mTime;
+				from = mKeyPositions[mCurPositionIdx].mValue;
+				to = mKeyPositions[mCurPositionIdx + 1].mValue;
 			}
 
-			float start = mKeyPositions[mCurPositionIdx].mTime;
-			float end = mKeyPositions[mCurPositionIdx + 1].mTime;
 			float t = (tick - start) / (end - start);
 
-			Vector3 from = mKeyPositions[mCurPositionIdx].mValue;
-			Vector3 to = mKeyPositions[mCurPositionIdx + 1].mValue;
-
 			return Math::Lerp(from, to, t);
 		}
 		else if (mKeyPositionNum == 1)
 		{
-			return mKeyPositions[0].mValue;
+			if (mIsCompressed)
+				return DequantizeVector3(mCompressedPositions[0].mValue, mPositionMin, mPositionExtent);
+			else
+				return mKeyPositions[0].mValue;
 		}
 		else
 		{
@@ -90,30 +356,36 @@ namespace ZXEngine
 	{
 		if (mKeyRotationNum > 1)
 		{
-			if (tick >= mKeyRotations[mCurRotationIdx + 1].mTime)
+			float start, end;
+			Quaternion from, to;
+
+			if (mIsCompressed)
 			{
-				for (size_t i = mCurRotationIdx + 1; i < mKeyRotationNum - 1; i++)
-				{
-					if (tick < mKeyRotations[i + 1].mTime)
-					{
-						mCurRotationIdx = i;
-						break;
-					}
-				}
+				mCurRotationIdx = FindKeyIndex(mCompressedRotations, mKeyRotationNum, mCurRotationIdx, tick);
+				start = mCompressedRotations[mCurRotationIdx].mTime;
+				end = mCompressedRotations[mCurRotationIdx + 1].mTime;
+				from = DequantizeQuaternion(mCompressedRotations[mCurRotationIdx].mValue);
+				to = DequantizeQuaternion(mCompressedRotations[mCurRotationIdx + 1].mValue);
+			}
+			else
+			{
+				mCurRotationIdx = FindKeyIndex(mKeyRotations, mKeyRotationNum, mCurRotationIdx, tick);
+				start = mKeyRotations[mCurRotationIdx].mTime;
+				end = mKeyRotations[mCurRotationIdx + 1].mTime;
+				from = mKeyRotations[mCurRotationIdx].mValue;
+				to = mKeyRotations[mCurRotationIdx + 1].mValue;
 			}
 
-			float start = mKeyRotations[mCurRotationIdx].mTime;
-			float end = mKeyRotations[mCurRotationIdx + 1].mTime;
 			float t = (tick - start) / (end - start);
 
-			Quaternion from = mKeyRotations[mCurRotationIdx].mValue;
-			Quaternion to = mKeyRotations[mCurRotationIdx + 1].mValue;
-
 			return Math::Slerp(from, to, t);
 		}
 		else if (mKeyRotationNum == 1)
 		{
-			return mKeyRotations[0].mValue;
+			if (mIsCompressed)
+				return DequantizeQuaternion(mCompressedRotations[0].mValue);
+			else
+				return mKeyRotations[0].mValue;
 		}
 		else
 		{
@@ -2,6 +2,11 @@
 #include "../pubh.h"
 #include "../PublicStruct.h"
 
+// 压缩动画允许的最大误差(包含删除关键帧和量化两部分)，位移和缩放是各分量的差值，旋转是弧度
+#define ANIM_COMPRESS_POSITION_TOLERANCE 0.0005f
+#define ANIM_COMPRESS_SCALE_TOLERANCE 0.0005f
+#define ANIM_COMPRESS_ROTATION_TOLERANCE 0.001f
+
 namespace ZXEngine
 {
 	struct KeyVector3
@@ -22,13 +27,29 @@ namespace ZXEngine
 		KeyQuaternion(float time, const Quaternion& value) : mTime(time), mValue(value) {}
 	};
 
+	// 压缩后的Vector3关键帧，每个分量在整个通道的取值范围内量化成16位
+	struct CompressedKeyVector3
+	{
+		float mTime;
+		uint16_t mValue[3];
+	};
+
+	// 压缩后的Quaternion关键帧，只存绝对值最大的分量之外的三个分量(smallest three)，每个15位
+	// 最大分量的下标占2位，拆开放在mValue[0]和mValue[1]的最高位，最大分量本身通过单位四元数的长度算出来
+	struct CompressedKeyQuaternion
+	{
+		float mTime;
+		uint16_t mValue[3];
+	};
+
+	// 一个骨骼的动画通道，压缩前后关键帧都按通道单独存放，不在骨骼之间按时间交错排列
 	class NodeAnimation
 	{
 	public:
-		// ֶӦ
+		// 与骨骼的名字对应
 		string mName;
 
-		// ؼ֡
+		// 关键帧数据
 		size_t mKeyScaleNum = 0;
 		vector<KeyVector3> mKeyScales;
 		size_t mKeyPositionNum = 0;
@@ -40,12 +61,28 @@ namespace ZXEngine
 
 		void Reset();
 		void UpdateCurFrame(float tick);
+		// 删除可以通过插值还原的关键帧并量化剩下的关键帧，采样结果和原始数据的误差不超过ANIM_COMPRESS_XXX_TOLERANCE，压缩后原始关键帧数据会被释放
+		void Compress();
+		bool IsCompressed() const;
+		// 关键帧数据占用的内存
+		size_t GetKeyMemorySize() const;
 
 	private:
 		size_t mCurScaleIdx = 0;
 		size_t mCurPositionIdx = 0;
 		size_t mCurRotationIdx = 0;
 
+		bool mIsCompressed = false;
+		// 压缩后的关键帧数据，mKeyXXXNum会更新为压缩后的数量
+		vector<CompressedKeyVector3> mCompressedScales;
+		vector<CompressedKeyVector3> mCompressedPositions;
+		vector<CompressedKeyQuaternion> mCompressedRotations;
+		// 量化的取值范围
+		Vector3 mScaleMin;
+		Vector3 mScaleExtent;
+		Vector3 mPositionMin;
+		Vector3 mPositionExtent;
+
 		Vector3 GetScale(float tick);
 		Vector3 GetPosition(float tick);
 		Quaternion GetRotation(float tick);
@@ -0,0 +1,109 @@
+#include "Skeleton.h"
+#include "../ZMesh.h"
+#include "../PublicStruct.h"
+
+namespace ZXEngine
+{
+	// 把只包含位移，旋转和缩放的变换矩阵分解开
+	static KeyFrame DecomposeTransform(const Matrix4& transform)
+	{
+		KeyFrame keyFrame;
+
+		Vector4 column0 = transform.GetColumn(0);
+		Vector4 column1 = transform.GetColumn(1);
+		Vector4 column2 = transform.GetColumn(2);
+		Vector4 column3 = transform.GetColumn(3);
+
+		keyFrame.mPosition = Vector3(column3.x, column3.y, column3.z);
+
+		Vector3 axisX(column0.x, column0.y, column0.z);
+		Vector3 axisY(column1.x, column1.y, column1.z);
+		Vector3 axisZ(column2.x, column2.y, column2.z);
+		keyFrame.mScale = Vector3(axisX.GetMagnitude(), axisY.GetMagnitude(), axisZ.GetMagnitude());
+
+		// 去掉缩放后剩下的就是旋转矩阵
+		if (keyFrame.mScale.x > 0.0f) axisX /= keyFrame.mScale.x;
+		if (keyFrame.mScale.y > 0.0f) axisY /= keyFrame.mScale.y;
+		if (keyFrame.mScale.z > 0.0f) axisZ /= keyFrame.mScale.z;
+
+		// 旋转矩阵转四元数，按对角线上最大的元素选择计算方式，避免除以很小的数
+		float m00 = axisX.x, m01 = axisY.x, m02 = axisZ.x;
+		float m10 = axisX.y, m11 = axisY.y, m12 = axisZ.y;
+		float m20 = axisX.z, m21 = axisY.z, m22 = axisZ.z;
+		float trace = m00 + m11 + m22;
+
+		Quaternion& q = keyFrame.mRotation;
+		if (trace > 0.0f)
+		{
+			float s = sqrtf(trace + 1.0f) * 2.0f;
+			q = Quaternion((m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, 0.25f * s);
+		}
+		else if (m00 > m11 && m00 > m22)
+		{
+			float s = sqrtf(1.0f + m00 - m11 - m22) * 2.0f;
+			q = Quaternion(0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s);
+		}
+		else if (m11 > m22)
+		{
+			float s = sqrtf(1.0f + m11 - m00 - m22) * 2.0f;
+			q = Quaternion((m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s);
+		}
+		else
+		{
+			float s = sqrtf(1.0f + m22 - m00 - m11) * 2.0f;
+			q = Quaternion((m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s);
+		}
+		q.Normalize();
+
+		return keyFrame;
+	}
+
+	Skeleton::Skeleton(const BoneNode* pRootBoneNode)
+	{
+		AddBoneNode(pRootBoneNode, UINT32_MAX);
+	}
+
+	uint32_t Skeleton::GetBoneNum() const
+	{
+		return static_cast<uint32_t>(mParentIndices.size());
+	}
+
+	uint32_t Skeleton::GetBoneIndex(const string& name) const
+	{
+		auto iter = mBoneNameToIndexMap.find(name);
+		return iter == mBoneNameToIndexMap.end() ? UINT32_MAX : iter->second;
+	}
+
+	void Skeleton::BindMesh(Mesh* pMesh) const
+	{
+		pMesh->mBoneSkeletonIndices.resize(pMesh->mBonesOffset.size(), UINT32_MAX);
+
+		for (auto& iter : pMesh->mBoneNameToIndexMap)
+		{
+			uint32_t boneIndex = GetBoneIndex(iter.first);
+
+			if (boneIndex == UINT32_MAX)
+				Debug::LogWarning("Mesh bone not found in skeleton: %s", iter.first);
+
+			pMesh->mBoneSkeletonIndices[iter.second] = boneIndex;
+		}
+	}
+
+	void Skeleton::AddBoneNode(const BoneNode* pBoneNode, uint32_t parentIndex)
+	{
+		uint32_t index = GetBoneNum();
+
+		mParentIndices.push_back(parentIndex);
+		mBoneDepths.push_back(parentIndex == UINT32_MAX ? 0 : mBoneDepths[parentIndex] + 1);
+		mBindLocalTransforms.push_back(pBoneNode->transform);
+		mBindPose.push_back(DecomposeTransform(pBoneNode->transform));
+		mBoneNames.push_back(pBoneNode->name);
+
+		// 重名的节点以后遍历到的为准
+		mBoneNameToIndexMap[pBoneNode->name] = index;
+
+		// 先序遍历，保证父节点排在子节点前面
+		for (auto pChild : pBoneNode->children)
+			AddBoneNode(pChild, index);
+	}
+}
\ No newline at end of file
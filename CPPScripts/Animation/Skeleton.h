@@ -0,0 +1,38 @@
+#pragma once
+#include "../pubh.h"
+#include "../PublicStruct.h"
+
+namespace ZXEngine
+{
+	class Mesh;
+	struct BoneNode;
+	// 把BoneNode树展开成按父节点在前的顺序排列的数组，加载模型时构建一次
+	// 运行时通过下标访问骨骼，按数组顺序遍历一遍就能从根节点开始计算出所有骨骼的全局变换
+	class Skeleton
+	{
+	public:
+		// 父节点下标，根节点为UINT32_MAX，父节点的下标一定小于子节点
+		vector<uint32_t> mParentIndices;
+		// 骨骼在层级中的深度，根节点为0
+		vector<uint32_t> mBoneDepths;
+		// 骨骼没有动画数据时使用的局部变换
+		vector<Matrix4> mBindLocalTransforms;
+		// 绑定姿势分解成的位移，旋转和缩放，混合动画时没有动画数据的骨骼使用这个
+		vector<KeyFrame> mBindPose;
+		// 骨骼名字
+		vector<string> mBoneNames;
+
+		Skeleton(const BoneNode* pRootBoneNode);
+
+		uint32_t GetBoneNum() const;
+		// 通过名字查找骨骼下标，找不到返回UINT32_MAX，只在加载和绑定时使用
+		uint32_t GetBoneIndex(const string& name) const;
+		// 计算Mesh中每个骨骼对应的骨骼下标，运行时不再需要通过名字查找
+		void BindMesh(Mesh* pMesh) const;
+
+	private:
+		unordered_map<string, uint32_t> mBoneNameToIndexMap;
+
+		void AddBoneNode(const BoneNode* pBoneNode, uint32_t parentIndex);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,269 @@
+#include "AssetCache.h"
+#include "Texture.h"
+#include "Resources.h"
+#include "ModelUtil.h"
+#include "ZMesh.h"
+
+namespace ZXEngine
+{
+#ifdef ZX_API_OPENGL
+	// OpenGL按图片原始通道数解码，其它API统一解码成RGBA，解码参数也是Key的一部分
+	static const string TextureImportOption = "|native";
+#else
+	static const string TextureImportOption = "|rgba";
+#endif
+
+	std::mutex AssetCache::mMutex;
+	unordered_map<string, AssetCache::CachedTexture> AssetCache::mTextures;
+	unordered_map<Texture*, string> AssetCache::mTextureToKey;
+	unordered_map<string, AssetCache::CachedModel> AssetCache::mModels;
+	unordered_map<const ModelData*, string> AssetCache::mModelToKey;
+	AssetCacheStats AssetCache::mStats[(size_t)CachedAssetType::Count];
+
+	string AssetCache::GetTextureKey(const string& path)
+	{
+		// 同一个文件可能以不同的相对路径写法被引用，统一规范化
+		return filesystem::path(path).lexically_normal().generic_string() + TextureImportOption;
+	}
+
+	string AssetCache::GetCubeMapKey(const vector<string>& paths)
+	{
+		string key;
+		for (auto& path : paths)
+			key += filesystem::path(path).lexically_normal().generic_string() + ";";
+		return key + TextureImportOption;
+	}
+
+	string AssetCache::GetModelKey(const string& path)
+	{
+		return filesystem::path(path).lexically_normal().generic_string();
+	}
+
+	bool AssetCache::IsCached(const string& key)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mTextures.find(key) != mTextures.end();
+	}
+
+	Texture* AssetCache::AcquireTexture(TextureStruct* textureStruct)
+	{
+		string key = GetTextureKey(textureStruct->path);
+		Texture* texture = FindTexture(key, CachedAssetType::Texture);
+		if (texture)
+			return texture;
+
+		if (textureStruct->data == nullptr)
+			textureStruct->data = Resources::LoadTextureFullData(textureStruct->path);
+
+		texture = new Texture(textureStruct->data);
+		AddTexture(key, texture, CachedAssetType::Texture);
+		return texture;
+	}
+
+	Texture* AssetCache::AcquireTexture(const string& path)
+	{
+		string key = GetTextureKey(path);
+		Texture* texture = FindTexture(key, CachedAssetType::Texture);
+		if (texture)
+			return texture;
+
+		texture = new Texture(path.c_str());
+		AddTexture(key, texture, CachedAssetType::Texture);
+		return texture;
+	}
+
+	Texture* AssetCache::AcquireCubeMap(CubeMapStruct* cubeMapStruct)
+	{
+		string key = GetCubeMapKey(cubeMapStruct->paths);
+		Texture* texture = FindTexture(key, CachedAssetType::CubeMap);
+		if (texture)
+			return texture;
+
+		if (cubeMapStruct->data == nullptr)
+			cubeMapStruct->data = Resources::LoadCubeMapFullData(cubeMapStruct->paths);
+
+		texture = new Texture(cubeMapStruct->data);
+		AddTexture(key, texture, CachedAssetType::CubeMap);
+		return texture;
+	}
+
+	void AssetCache::ReleaseTexture(Texture* texture)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		auto keyIter = mTextureToKey.find(texture);
+		if (keyIter == mTextureToKey.end())
+		{
+			Debug::LogWarning("Release texture which is not in asset cache.");
+			return;
+		}
+
+		auto iter = mTextures.find(keyIter->second);
+		iter->second.referenceCount--;
+		// 引用计数归零后执行真正的删除操作
+		if (iter->second.referenceCount == 0)
+		{
+			auto& stats = mStats[(size_t)iter->second.type];
+			stats.assetNum--;
+			stats.memorySize -= iter->second.memorySize;
+
+			delete texture;
+			mTextureToKey.erase(keyIter);
+			mTextures.erase(iter);
+		}
+	}
+
+	ModelData* AssetCache::AcquireModel(const string& path, bool async)
+	{
+		string key = GetModelKey(path);
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			auto iter = mModels.find(key);
+			if (iter != mModels.end())
+			{
+				iter->second.referenceCount++;
+				mStats[(size_t)CachedAssetType::Model].hitNum++;
+				return iter->second.modelData;
+			}
+		}
+
+		// 导入不加锁，同一个模型可能同时在多个加载线程里导入
+		ModelData* modelData = ModelUtil::LoadModel(path, true, async);
+		if (modelData->pAnimationController)
+			return modelData;
+
+		size_t memorySize = 0;
+		for (auto mesh : modelData->pMeshes)
+			memorySize += mesh->mVertices.size() * sizeof(Vertex) + mesh->mIndices.size() * sizeof(uint32_t);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		// 别的线程先导入完成了，这里导入的这份不共享，由调用者自己持有
+		if (mModels.find(key) != mModels.end())
+			return modelData;
+
+		modelData->isCached = true;
+		mModels[key] = { modelData, 1, memorySize };
+		mModelToKey[modelData] = key;
+
+		auto& stats = mStats[(size_t)CachedAssetType::Model];
+		stats.missNum++;
+		stats.assetNum++;
+		stats.memorySize += memorySize;
+
+		return modelData;
+	}
+
+	void AssetCache::RetainModel(ModelData* modelData)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		auto keyIter = mModelToKey.find(modelData);
+		if (keyIter == mModelToKey.end())
+		{
+			Debug::LogWarning("Retain model which is not in asset cache.");
+			return;
+		}
+
+		mModels[keyIter->second].referenceCount++;
+	}
+
+	void AssetCache::ReleaseModel(ModelData* modelData)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		auto keyIter = mModelToKey.find(modelData);
+		if (keyIter == mModelToKey.end())
+		{
+			Debug::LogWarning("Release model which is not in asset cache.");
+			return;
+		}
+
+		auto iter = mModels.find(keyIter->second);
+		iter->second.referenceCount--;
+		if (iter->second.referenceCount == 0)
+		{
+			auto& stats = mStats[(size_t)CachedAssetType::Model];
+			stats.assetNum--;
+			stats.memorySize -= iter->second.memorySize;
+
+			for (auto mesh : modelData->pMeshes)
+				delete mesh;
+			delete modelData;
+			mModelToKey.erase(keyIter);
+			mModels.erase(iter);
+		}
+	}
+
+	void AssetCache::RecordHit(CachedAssetType type)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStats[(size_t)type].hitNum++;
+	}
+
+	void AssetCache::RecordLoad(CachedAssetType type, size_t memorySize)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto& stats = mStats[(size_t)type];
+		stats.missNum++;
+		stats.assetNum++;
+		stats.memorySize += memorySize;
+	}
+
+	void AssetCache::RecordRelease(CachedAssetType type, size_t memorySize)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto& stats = mStats[(size_t)type];
+		stats.assetNum--;
+		stats.memorySize -= memorySize;
+	}
+
+	AssetCacheStats AssetCache::GetStats(CachedAssetType type)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mStats[(size_t)type];
+	}
+
+	void AssetCache::LogStats()
+	{
+		static const char* typeNames[] = { "Texture", "CubeMap", "Shader", "Model" };
+		for (size_t i = 0; i < (size_t)CachedAssetType::Count; i++)
+		{
+			auto stats = GetStats((CachedAssetType)i);
+			Debug::Log("Asset cache %s: %s assets, %s KB, hit %s, miss %s", typeNames[i], stats.assetNum, stats.memorySize / 1024, stats.hitNum, stats.missNum);
+		}
+	}
+
+	Texture* AssetCache::FindTexture(const string& key, CachedAssetType type)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		auto iter = mTextures.find(key);
+		if (iter == mTextures.end())
+			return nullptr;
+
+		iter->second.referenceCount++;
+		mStats[(size_t)type].hitNum++;
+		return iter->second.texture;
+	}
+
+	void AssetCache::AddTexture(const string& key, Texture* texture, CachedAssetType type)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		CachedTexture cachedTexture;
+		cachedTexture.key = key;
+		cachedTexture.texture = texture;
+		cachedTexture.referenceCount = 1;
+		cachedTexture.type = type;
+		cachedTexture.memorySize = static_cast<size_t>(texture->width) * texture->height * 4 * (type == CachedAssetType::CubeMap ? 6 : 1);
+
+		mTextures[key] = cachedTexture;
+		mTextureToKey[texture] = key;
+
+		auto& stats = mStats[(size_t)type];
+		stats.missNum++;
+		stats.assetNum++;
+		stats.memorySize += cachedTexture.memorySize;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+#include "pubh.h"
+
+namespace ZXEngine
+{
+	class Texture;
+	struct ModelData;
+	struct TextureStruct;
+	struct CubeMapStruct;
+
+	struct AssetCacheStats
+	{
+		uint32_t hitNum = 0;
+		uint32_t missNum = 0;
+		// 当前缓存中的资源数量
+		uint32_t assetNum = 0;
+		// 当前缓存中的资源占用的内存（字节），纹理按RGBA8估算，模型按顶点和索引数据计算
+		size_t memorySize = 0;
+	};
+
+	// 按资源路径缓存已经上传到GPU的资源，同一个资源只解码和上传一次，引用计数归零时释放
+	// IsCached和AcquireModel可以在加载线程调用，其它接口只能在主线程调用
+	class AssetCache
+	{
+	public:
+		static string GetTextureKey(const string& path);
+		static string GetCubeMapKey(const vector<string>& paths);
+		static string GetModelKey(const string& path);
+		// 加载线程用来判断是否需要解码，已缓存的资源不需要再解码
+		static bool IsCached(const string& key);
+
+		// 如果加载线程判断时已缓存，但是在这之前被释放了，这里会重新解码
+		static Texture* AcquireTexture(TextureStruct* textureStruct);
+		static Texture* AcquireTexture(const string& path);
+		static Texture* AcquireCubeMap(CubeMapStruct* cubeMapStruct);
+		static void ReleaseTexture(Texture* texture);
+
+		// 不带动画的模型导入一次后所有引用者共享同一份Mesh
+		// 带动画的模型每个实例都要有自己的动画状态和骨骼矩阵，不缓存，返回的ModelData的isCached为false
+		static ModelData* AcquireModel(const string& path, bool async = false);
+		// 已缓存的模型被新的引用者使用时增加引用计数
+		static void RetainModel(ModelData* modelData);
+		// 引用计数归零时删除模型和它的Mesh
+		static void ReleaseModel(ModelData* modelData);
+
+		// Shader有自己的引用计数，这里只记录统计数据
+		static void RecordHit(CachedAssetType type);
+		static void RecordLoad(CachedAssetType type, size_t memorySize);
+		static void RecordRelease(CachedAssetType type, size_t memorySize);
+
+		static AssetCacheStats GetStats(CachedAssetType type);
+		static void LogStats();
+
+	private:
+		struct CachedTexture
+		{
+			string key;
+			Texture* texture = nullptr;
+			uint32_t referenceCount = 0;
+			size_t memorySize = 0;
+			CachedAssetType type = CachedAssetType::Texture;
+		};
+
+		struct CachedModel
+		{
+			ModelData* modelData = nullptr;
+			uint32_t referenceCount = 0;
+			size_t memorySize = 0;
+		};
+
+		static std::mutex mMutex;
+		static unordered_map<string, CachedTexture> mTextures;
+		static unordered_map<Texture*, string> mTextureToKey;
+		static unordered_map<string, CachedModel> mModels;
+		static unordered_map<const ModelData*, string> mModelToKey;
+		static AssetCacheStats mStats[(size_t)CachedAssetType::Count];
+
+		static Texture* FindTexture(const string& key, CachedAssetType type);
+		static void AddTexture(const string& key, Texture* texture, CachedAssetType type);
+	};
+}
\ No newline at end of file
@@ -4,7 +4,7 @@
 
 namespace ZXEngine
 {
-	// ƵֻͨAudioEngine
+	// 音频数据流，此类只允许通过AudioEngine创建和销毁
 	class AudioStream
 	{
 		friend class AudioClip;
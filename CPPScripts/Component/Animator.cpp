@@ -1,6 +1,11 @@
 #include "Animator.h"
+#include "ZCamera.h"
+#include "Transform.h"
 #include "MeshRenderer.h"
+#include "../Time.h"
+#include "../Animation/Skeleton.h"
 #include "../Animation/AnimationController.h"
+#include "../Concurrent/JobSystem.h"
 
 namespace ZXEngine
 {
@@ -10,11 +15,51 @@ namespace ZXEngine
 	}
 
 	vector<Animator*> Animator::mAnimators;
+	vector<Animator*> Animator::mSampleAnimators;
+	vector<Frustum> Animator::mCameraFrustums;
+	vector<Vector3> Animator::mCameraPositions;
 
 	void Animator::Update()
 	{
+		mCameraFrustums.clear();
+		mCameraPositions.clear();
+		for (auto camera : Camera::GetAllCameras())
+		{
+			if (camera->cameraType != CameraType::GameCamera)
+				continue;
+
+			mCameraFrustums.push_back(Frustum(camera->GetProjectionMatrix() * camera->GetViewMatrix()));
+			mCameraPositions.push_back(camera->GetTransform()->GetPosition());
+		}
+
+		// 先在主线程确定每个Animator这一帧的LOD，跳过更新的不参与采样
+		mSampleAnimators.clear();
 		for (auto pAnimator : mAnimators)
-			pAnimator->UpdateMeshes();
+		{
+			pAnimator->UpdateLOD();
+			if (pAnimator->mCurLOD != AnimatorLOD::Skipped)
+				mSampleAnimators.push_back(pAnimator);
+		}
+
+		// 每个Animator只修改自己的动画数据，可以并行采样，最后在主线程统一写入Mesh，这个函数返回前所有Animator都已更新完
+		auto jobSystem = JobSystem::GetInstance();
+		uint32_t animatorNum = static_cast<uint32_t>(mSampleAnimators.size());
+		if (jobSystem == nullptr || animatorNum < ANIMATOR_PARALLEL_MIN_COUNT)
+		{
+			for (auto pAnimator : mSampleAnimators)
+				pAnimator->Sample();
+		}
+		else
+		{
+			jobSystem->ParallelFor(animatorNum, ANIMATOR_JOB_SIZE, [](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+					mSampleAnimators[i]->Sample();
+			});
+		}
+
+		for (auto pAnimator : mSampleAnimators)
+			pAnimator->Publish();
 	}
 
 	ComponentType Animator::GetInsType()
@@ -29,8 +74,8 @@ namespace ZXEngine
 
 	Animator::~Animator()
 	{
-		if (mRootBoneNode)
-			delete mRootBoneNode;
+		if (mSkeleton)
+			delete mSkeleton;
 		if (mAnimationController)
 			delete mAnimationController;
 
@@ -48,8 +93,112 @@ namespace ZXEngine
 		mAnimationController->Switch(name, time);
 	}
 
+	void Animator::Play(const string& name, const string& layerName)
+	{
+		uint32_t layer = GetLayerIndex(layerName);
+		if (layer != UINT32_MAX)
+			mAnimationController->Play(name, layer);
+	}
+
+	void Animator::Switch(const string& name, float time, const string& layerName)
+	{
+		uint32_t layer = GetLayerIndex(layerName);
+		if (layer != UINT32_MAX)
+			mAnimationController->Switch(name, time, layer);
+	}
+
+	void Animator::SetParameter(const string& name, float value)
+	{
+		mAnimationController->SetParameter(name, value);
+	}
+
+	void Animator::SetLayerWeight(const string& layerName, float weight)
+	{
+		uint32_t layer = GetLayerIndex(layerName);
+		if (layer != UINT32_MAX)
+			mAnimationController->SetLayerWeight(layer, weight);
+	}
+
+	uint32_t Animator::GetLayerIndex(const string& layerName) const
+	{
+		uint32_t layer = mAnimationController->GetLayerIndex(layerName);
+		if (layer == UINT32_MAX)
+			Debug::LogWarning("Animator can't find animation layer: %s", layerName);
+		return layer;
+	}
+
 	void Animator::UpdateMeshes()
 	{
-		mAnimationController->Update(mRootBoneNode, mMeshRenderer->mMeshes);
+		mAnimationController->Update(mMeshRenderer->mMeshes);
+	}
+
+	void Animator::Sample()
+	{
+		// 不在视野内时只有阴影能看到动画，和远处的角色一样用简化骨骼
+		mAnimationController->Sample(mMeshRenderer->mMeshes, mPendingDeltaTime, mCurLOD != AnimatorLOD::Full);
+		mPendingDeltaTime = 0.0f;
+	}
+
+	void Animator::Publish()
+	{
+		mAnimationController->Publish(mMeshRenderer->mMeshes);
+	}
+
+	void Animator::UpdateLOD()
+	{
+		mPendingDeltaTime += Time::deltaTime;
+
+		// 没有游戏相机时无法判断距离和视野，全部按最高精度更新
+		if (mCameraFrustums.empty())
+		{
+			mCurLOD = AnimatorLOD::Full;
+		}
+		else
+		{
+			auto& aabb = mMeshRenderer->GetWorldAABB();
+			Vector3 center = aabb.GetCenter();
+			float radius = aabb.GetExtents().GetMagnitude() * ANIMATOR_LOD_BOUNDS_SCALE;
+
+			bool isVisible = false;
+			float minDistance = FLT_MAX;
+			for (size_t i = 0; i < mCameraFrustums.size(); i++)
+			{
+				if (mCameraFrustums[i].Intersects(center, radius))
+				{
+					isVisible = true;
+					minDistance = Math::Min(minDistance, Math::Distance(center, mCameraPositions[i]));
+				}
+			}
+
+			if (isVisible)
+			{
+				mOffscreenFrameCount = 0;
+				mCurLOD = minDistance > mReducedLODDistance ? AnimatorLOD::Reduced : AnimatorLOD::Full;
+			}
+			// 跳过的帧的时间会累积到下一次采样，重新进入视野时动画进度和一直在更新的情况是一致的
+			else if (mOffscreenUpdateInterval > 0 && ++mOffscreenFrameCount >= mOffscreenUpdateInterval)
+			{
+				mOffscreenFrameCount = 0;
+				mCurLOD = AnimatorLOD::Offscreen;
+			}
+			else
+			{
+				mCurLOD = AnimatorLOD::Skipped;
+				// 不在视野内时完全不更新的话，动画在视野外是暂停的，不能累积时间，否则重新进入视野时会一次跳过很长一段
+				if (mOffscreenUpdateInterval == 0)
+					mPendingDeltaTime = 0.0f;
+			}
+		}
+
+#ifdef ZX_DEBUG
+		if (mCurLOD == AnimatorLOD::Full)
+			Debug::animatorFullCount++;
+		else if (mCurLOD == AnimatorLOD::Reduced)
+			Debug::animatorReducedCount++;
+		else if (mCurLOD == AnimatorLOD::Offscreen)
+			Debug::animatorOffscreenCount++;
+		else
+			Debug::animatorSkippedCount++;
+#endif
 	}
 }
\ No newline at end of file
@@ -1,10 +1,27 @@
 #pragma once
 #include "Component.h"
 #include "../PublicStruct.h"
+#include "../Culling.h"
+
+// Animator数量超过这个值时把动画采样拆分到JobSystem上并行执行
+#define ANIMATOR_PARALLEL_MIN_COUNT 8
+// 并行执行时每个Job处理的Animator数量
+#define ANIMATOR_JOB_SIZE 2
+
+// 以下是prefab里没有配置AnimationLOD时的默认值
+// 距离相机超过这个值时切换到简化骨骼
+#define ANIMATOR_LOD_REDUCED_DISTANCE 30.0f
+// 简化骨骼的最大深度
+#define ANIMATOR_LOD_REDUCED_BONE_DEPTH 6
+// 不在视野内时每隔多少帧更新一次
+#define ANIMATOR_LOD_OFFSCREEN_UPDATE_INTERVAL 4
+// 骨骼动画会让顶点超出绑定姿势下的包围盒，判断是否在视野内时把包围球半径放大这个倍数
+#define ANIMATOR_LOD_BOUNDS_SCALE 1.5f
 
 namespace ZXEngine
 {
 	class Mesh;
+	class Skeleton;
 	class MeshRenderer;
 	class AnimationController;
 	class Animator : public Component
@@ -15,16 +32,28 @@ namespace ZXEngine
 
 	private:
 		static vector<Animator*> mAnimators;
+		// 这一帧需要采样的Animator
+		static vector<Animator*> mSampleAnimators;
+		// 这一帧所有游戏相机的视锥体和位置，用于计算LOD
+		static vector<Frustum> mCameraFrustums;
+		static vector<Vector3> mCameraPositions;
 
 	public:
 		string mAvatarName;
-		// ģ͹ڵ
-		BoneNode* mRootBoneNode = nullptr;
-		// 
+		// 模型骨骼
+		Skeleton* mSkeleton = nullptr;
+		// 动画控制器
 		AnimationController* mAnimationController = nullptr;
-		// ӦMeshRenderer
+		// 对应的MeshRenderer
 		MeshRenderer* mMeshRenderer = nullptr;
 
+		// 距离最近的相机超过这个值时只更新简化骨骼，并且不做动画混合
+		float mReducedLODDistance = ANIMATOR_LOD_REDUCED_DISTANCE;
+		// 不在任何相机视野内时每隔多少帧更新一次，0表示不在视野内时不更新，动画暂停在离开视野时的位置
+		uint32_t mOffscreenUpdateInterval = ANIMATOR_LOD_OFFSCREEN_UPDATE_INTERVAL;
+		// 这一帧的LOD
+		AnimatorLOD mCurLOD = AnimatorLOD::Full;
+
 		Animator();
 		~Animator();
 
@@ -32,6 +61,28 @@ namespace ZXEngine
 
 		void Play(const string& name);
 		void Switch(const string& name, float time = 1.0f);
+		// 在指定的动画层上播放和切换，找不到这个层时输出警告
+		void Play(const string& name, const string& layerName);
+		void Switch(const string& name, float time, const string& layerName);
+		// 设置混合树参数
+		void SetParameter(const string& name, float value);
+		// 设置动画层权重，范围0到1
+		void SetLayerWeight(const string& layerName, float weight);
 		void UpdateMeshes();
+		// 采样动画，计算结果暂存在AnimationController里，可以在工作线程上执行
+		void Sample();
+		// 把采样结果写入Mesh，只能在主线程执行
+		void Publish();
+
+	private:
+		// 上一次采样之后累积的时间，降频更新时下一次采样会一次推进这么多
+		float mPendingDeltaTime = 0.0f;
+		// 不在视野内之后已经跳过的帧数
+		uint32_t mOffscreenFrameCount = 0;
+
+		// 根据相机的距离和视野计算这一帧的LOD，只能在主线程执行
+		void UpdateLOD();
+		// 找不到这个层时输出警告并返回UINT32_MAX
+		uint32_t GetLayerIndex(const string& layerName) const;
 	};
 }
\ No newline at end of file
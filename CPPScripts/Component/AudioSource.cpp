@@ -43,7 +43,7 @@ namespace ZXEngine
 		}
 
 #ifdef ZX_EDITOR
-		// ڱ༭ģʽ£Ϸͣ״̬ƵҲӦôͣ״̬
+		// 在编辑器模式下，如果游戏以暂停状态启动，音频也应该处于暂停状态
 		if (EditorDataManager::isGamePause)
 		{
 			SetPause(true);
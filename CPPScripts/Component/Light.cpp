@@ -33,7 +33,7 @@ namespace ZXEngine
 
 	Matrix4 Light::GetLightMatrix()
 	{
-		//  Camera::GetViewMatrix ͬ
+		// 与 Camera::GetViewMatrix 同理
 		Matrix4 model = GetTransform()->GetModelMatrix();
 		return Math::Inverse(model);
 	}
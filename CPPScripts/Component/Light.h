@@ -23,7 +23,7 @@ namespace ZXEngine
 
 		virtual ComponentType GetInsType();
 
-		// ȡռתԴռľ
+		// 获取将顶点从世界空间转换到光源空间的矩阵
 		Matrix4 GetLightMatrix();
 		Matrix4 GetProjectionMatrix();
 
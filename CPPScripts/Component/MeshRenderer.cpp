@@ -1,17 +1,32 @@
 #include "MeshRenderer.h"
 #include "Animator.h"
+#include "Transform.h"
 #include "../ZMesh.h"
 #include "../RenderAPI.h"
 #include "../Material.h"
 #include "../ModelUtil.h"
+#include "../AssetCache.h"
 
 namespace ZXEngine
 {
+    unordered_map<string, uint32_t> MeshRenderer::mSourceToMeshID;
+
     ComponentType MeshRenderer::GetType()
     {
         return ComponentType::MeshRenderer;
     }
 
+    uint32_t MeshRenderer::GetMeshSourceID(const string& source)
+    {
+        auto iter = mSourceToMeshID.find(source);
+        if (iter != mSourceToMeshID.end())
+            return iter->second;
+
+        uint32_t id = static_cast<uint32_t>(mSourceToMeshID.size());
+        mSourceToMeshID[source] = id;
+        return id;
+    }
+
     MeshRenderer::MeshRenderer()
     {
         
@@ -19,11 +34,21 @@ namespace ZXEngine
 
     MeshRenderer::~MeshRenderer()
     {
+        // 独立编译的测试程序(定义了ZX_HEADLESS)不链接渲染和资源模块，只用到包围盒和空间索引相关的部分，不会有材质和缓存的模型
+#ifndef ZX_HEADLESS
         delete mMatetrial;
         delete mShadowCastMaterial;
 
-        for (auto mesh : mMeshes)
-            delete mesh;
+        if (mCachedModel)
+        {
+            AssetCache::ReleaseModel(mCachedModel);
+        }
+        else
+#endif
+        {
+            for (auto mesh : mMeshes)
+                delete mesh;
+        }
     }
 
     ComponentType MeshRenderer::GetInsType()
@@ -31,17 +56,34 @@ namespace ZXEngine
         return ComponentType::MeshRenderer;
     }
 
+#ifndef ZX_HEADLESS
     void MeshRenderer::Draw()
     {
+        if (!mDrawRanges.empty())
+        {
+            for (auto& range : mDrawRanges)
+                RenderAPI::GetInstance()->DrawRange(mMeshes[0]->VAO, range.offset, range.count);
+            return;
+        }
+
         for (auto mesh : mMeshes)
         {
             RenderAPI::GetInstance()->Draw(mesh->VAO);
         }
     }
 
+    void MeshRenderer::DrawInstanced(uint32_t instanceNum, uint32_t instanceBuffer)
+    {
+        for (auto mesh : mMeshes)
+        {
+            RenderAPI::GetInstance()->Draw(mesh->VAO, instanceNum, instanceBuffer);
+        }
+    }
+
     void MeshRenderer::GenerateModel(GeometryType type)
     {
         mModelName = ModelUtil::GetGeometryTypeName(type);
+        mMeshSourceID = GetMeshSourceID("Geometry:" + mModelName);
         mMeshes.push_back(ModelUtil::GenerateGeometry(type));
         UpdateInternalData();
     }
@@ -69,6 +111,25 @@ namespace ZXEngine
                 mShadowCastMaterial->SetMatrix("_BoneMatrices", mesh->mBonesFinalTransform.data(), static_cast<uint32_t>(mesh->mBonesFinalTransform.size()));
         }
     }
+#endif
+
+    const AABB& MeshRenderer::GetWorldAABB()
+    {
+        auto transform = GetTransform();
+        uint32_t version = transform->GetVersion();
+        if (mWorldAABBVersion != version)
+        {
+            mWorldAABB = mLocalAABB.GetTransformed(transform->GetModelMatrix());
+            mWorldAABBVersion = version;
+        }
+        return mWorldAABB;
+    }
+
+    void MeshRenderer::SetLocalAABB(const AABB& aabb)
+    {
+        mLocalAABB = aabb;
+        mWorldAABBVersion = 0;
+    }
 
     void MeshRenderer::UpdateInternalData()
     {
@@ -94,5 +155,10 @@ namespace ZXEngine
         mAABBSizeX = mExtremeVertices[0].Position.x - mExtremeVertices[1].Position.x;
         mAABBSizeY = mExtremeVertices[2].Position.y - mExtremeVertices[3].Position.y;
         mAABBSizeZ = mExtremeVertices[4].Position.z - mExtremeVertices[5].Position.z;
+
+        mLocalAABB.min = Vector3(mExtremeVertices[1].Position.x, mExtremeVertices[3].Position.y, mExtremeVertices[5].Position.z);
+        mLocalAABB.max = Vector3(mExtremeVertices[0].Position.x, mExtremeVertices[2].Position.y, mExtremeVertices[4].Position.z);
+        // 模型数据变了，世界空间的AABB需要重新计算
+        mWorldAABBVersion = 0;
     }
 }
\ No newline at end of file
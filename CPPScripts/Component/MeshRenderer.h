@@ -1,39 +1,60 @@
 #pragma once
 #include "Component.h"
 #include "../PublicStruct.h"
+#include "../Culling.h"
 
 namespace ZXEngine
 {
 	class Mesh;
 	class Material;
 	class Animator;
+	class StaticBatch;
 	class MeshRenderer : public Component
 	{
+		friend class SpatialIndex;
 	public:
 		static ComponentType GetType();
+		static uint32_t GetMeshSourceID(const string& source);
+
+	private:
+		static unordered_map<string, uint32_t> mSourceToMeshID;
 
 	public:
 		bool mCastShadow = false;
 		bool mReceiveShadow = false;
 
 		string mModelName = "";
+		// 来自同一个模型文件或同一种几何体的Renderer有相同的ID，用于GPU Instancing合批，UINT32_MAX表示来源未知
+		uint32_t mMeshSourceID = UINT32_MAX;
 
 		Material* mMatetrial = nullptr;
 		Material* mShadowCastMaterial = nullptr;
 
 		Animator* mAnimator = nullptr;
 
+		// 在场景SpatialIndex中的叶节点，不在树中时为UINT32_MAX
+		uint32_t mSpatialIndexNode = UINT32_MAX;
+
+		// 所在的静态合批，没有参与静态合批时为nullptr
+		StaticBatch* mStaticBatch = nullptr;
+		// 在所在静态合批中的成员下标
+		uint32_t mStaticBatchIndex = 0;
+		// 不为空时只绘制mMeshes[0]中的这些索引区间，静态合批用来跳过被剔除的成员
+		vector<IndexRange> mDrawRanges;
+
 		size_t mVerticesNum = 0;
 		size_t mTrianglesNum = 0;
 		vector<Mesh*> mMeshes;
+		// mMeshes来自AssetCache中共享的模型时不为空，析构时归还给AssetCache而不是直接删除
+		ModelData* mCachedModel = nullptr;
 
-		// xyzԶĵ㣬0-5ֱӦ+x, -x, +y, -y, +z, -z
+		// 在xyz方向上最远的点，0-5分别对应+x, -x, +y, -y, +z, -z
 		array<Vertex, 6> mExtremeVertices;
-		// ģXϵĳ
+		// 模型在X轴上的长度
 		float mAABBSizeX = 0.0f;
-		// ģYϵĳ
+		// 模型在Y轴上的长度
 		float mAABBSizeY = 0.0f;
-		// ģZϵĳ
+		// 模型在Z轴上的长度
 		float mAABBSizeZ = 0.0f;
 
 		MeshRenderer();
@@ -42,12 +63,25 @@ namespace ZXEngine
 		virtual ComponentType GetInsType();
 
 		void Draw();
+		// 用instanceBuffer里的模型矩阵，把这个Renderer的Mesh绘制instanceNum次
+		void DrawInstanced(uint32_t instanceNum, uint32_t instanceBuffer);
 		void GenerateModel(GeometryType type);
 		void SetMeshes(const vector<Mesh*>& meshes);
 		void UpdateBoneTransformsForRender();
 		void UpdateBoneTransformsForShadow();
+		// 获取世界空间下的AABB，Transform没有变化时直接返回缓存
+		const AABB& GetWorldAABB();
+		// 不通过Mesh计算，直接指定模型空间下的AABB
+		void SetLocalAABB(const AABB& aabb);
 
 	private:
+		// 模型空间下的AABB
+		AABB mLocalAABB;
+		// 世界空间下的AABB缓存
+		AABB mWorldAABB;
+		// 计算mWorldAABB时Transform的版本号，0表示还没计算过
+		uint32_t mWorldAABBVersion = 0;
+
 		void UpdateInternalData();
 	};
 }
\ No newline at end of file
@@ -40,28 +40,28 @@ namespace ZXEngine
 
 	void ParticleSystem::Update()
 	{
-		// µǰλúƶ
+		// 更新当前位置和移动方向
 		Vector3 curPos = GetTransform()->GetPosition();
 		moveDir = (curPos - lastPos).GetNormalized();
 		lastPos = curPos;
 
-		// ʱ
+		// 粒子生产的时间间隔
 		float interval = lifeTime / (float)particleNum;
 		float curTime = Time::curTime;
 		int genNum = 0;
 		if (lastGenTime == 0)
 		{
-			// һ֡ȳʼ
+			// 第一帧先初始化数据
 			lastGenTime = curTime;
 		}
 		else
 		{
-			// һӵʱ
+			// 上一次生产粒子的时间
 			float delta = curTime - lastGenTime;
-			// ʱôʱ䣬һ֡Ӧ
+			// 如果相差时间大于了生产间隔，那么根据相差的这段时间，计算这一帧应该生产的数量
 			if (delta > interval)
 				genNum = (int)(delta / interval);
-			// һ֡ӣôʱ
+			// 如果这一帧生产了粒子，那么更新生产时间
 			if (genNum > 0)
 				lastGenTime = curTime;
 		}
@@ -152,7 +152,7 @@ namespace ZXEngine
 
 	unsigned int ParticleSystem::GetUnusedParticleIndex()
 	{
-		// һù
+		// 从上一个用过的向后找
 		for (unsigned int i = lastUsedIndex; i < particleNum; ++i) 
 		{
 			if (particles[i]->life <= 0.0f)
@@ -161,7 +161,7 @@ namespace ZXEngine
 				return i;
 			}
 		}
-		// ûҵʹͷ
+		// 没找到就从头找
 		for (unsigned int i = 0; i < lastUsedIndex; ++i) 
 		{
 			if (particles[i]->life <= 0.0f)
@@ -170,7 +170,7 @@ namespace ZXEngine
 				return i;
 			}
 		}
-		// ûҵʹͷʼ
+		// 都没找到就从头开始
 		lastUsedIndex = 0;
 		return 0;
 	}
@@ -23,13 +23,13 @@ namespace ZXEngine
 		static ComponentType GetType();
 
 	public:
-		// 
+		// 粒子总数
 		unsigned int particleNum = 0;
-		// 
+		// 粒子生命周期
 		float lifeTime = 0;
-		// ƶٶ
+		// 粒子移动方向和速度
 		Vector3 velocity;
-		// λƫ
+		// 粒子生成位置偏移量
 		Vector3 offset;
 
 		ParticleSystem();
@@ -49,7 +49,7 @@ namespace ZXEngine
 		unsigned int lastUsedIndex = 0;
 		float lastGenTime = 0;
 		Vector3 lastPos;
-		// صGOǰƶ
+		// 所挂载的GO当前移动方向
 		Vector3 moveDir;
 
 		unsigned int GetUnusedParticleIndex();
@@ -44,55 +44,55 @@ namespace ZXEngine
 			mParticles.push_back(pair(body, sphere));
 		}
 
-		// (Z)
+		// 行数(Z)
 		uint32_t row = 11;
-		// (X)
+		// 列数(X)
 		uint32_t col = 11;
-		// Ӻǰ
+		// 从后向前
 		for (uint32_t i = 0; i < row; i++)
 		{
-			// 
+			// 从左向右
 			for (uint32_t j = 0; j < col; j++)
 			{
 				uint32_t otherIdx = 0;
 				uint32_t curIdx = i * col + j;
 
-				// ұһ
+				// 右边一个
 				if (j < col - 1)
 				{
 					otherIdx = curIdx + 1;
 					AddInternalSpring(curIdx, otherIdx, mStretchStiffness);
 				}
 
-				// ±һ
+				// 下边一个
 				if (i < row - 1)
 				{
 					otherIdx = curIdx + col;
 					AddInternalSpring(curIdx, otherIdx, mStretchStiffness);
 				}
 
-				// ½һ
+				// 右下角一个
 				if (i < row - 1 && j < col - 1)
 				{
 					otherIdx = curIdx + col + 1;
 					AddInternalSpring(curIdx, otherIdx, mStretchStiffness);
 				}
 
-				// ½һ
+				// 左下角一个
 				if (i < row - 1 && j > 0)
 				{
 					otherIdx = curIdx + col - 1;
 					AddInternalSpring(curIdx, otherIdx, mStretchStiffness);
 				}
 
-				// ұ߸һ
+				// 右边隔一个
 				if (j < col - 2)
 				{
 					otherIdx = curIdx + 2;
 					AddInternalSpring(curIdx, otherIdx, mBendStiffness);
 				}
 
-				// ±߸һ
+				// 下边隔一个
 				if (i < row - 2)
 				{
 					otherIdx = curIdx + col * 2;
@@ -45,6 +45,8 @@ namespace ZXEngine
 	void ZRigidBody::SetPosition(const Vector3& position)
 	{
 		mRigidBody->SetPosition(position);
+		// 休眠的刚体不会更新，从外部修改后需要唤醒
+		mRigidBody->WakeUp();
 	}
 
 	Vector3 ZRigidBody::GetVelocity() const
@@ -55,5 +57,6 @@ namespace ZXEngine
 	void ZRigidBody::SetVelocity(const Vector3& velocity)
 	{
 		mRigidBody->SetVelocity(velocity);
+		mRigidBody->WakeUp();
 	}
 }
\ No newline at end of file
@@ -3,11 +3,48 @@
 
 namespace ZXEngine
 {
+	vector<Transform*> Transform::mDirtyTransforms;
+	vector<Transform*> Transform::mChangedTransforms;
+
 	ComponentType Transform::GetType()
 	{
 		return ComponentType::Transform;
 	}
 
+	void Transform::UpdateAllDirtyTransforms()
+	{
+		mChangedTransforms.clear();
+
+		for (auto transform : mDirtyTransforms)
+		{
+			// 已经被销毁的Transform会把自己在列表中的位置置空
+			if (transform == nullptr)
+				continue;
+
+			transform->mDirtyListIndex = SIZE_MAX;
+			transform->UpdateDirtyRecursively();
+		}
+		mDirtyTransforms.clear();
+	}
+
+	const vector<Transform*>& Transform::GetChangedTransforms()
+	{
+		return mChangedTransforms;
+	}
+
+	Transform::Transform()
+	{
+		// 新创建的Transform还没有计算过世界矩阵，直接加入脏列表
+		mDirtyListIndex = mDirtyTransforms.size();
+		mDirtyTransforms.push_back(this);
+	}
+
+	Transform::~Transform()
+	{
+		if (mDirtyListIndex != SIZE_MAX)
+			mDirtyTransforms[mDirtyListIndex] = nullptr;
+	}
+
 	ComponentType Transform::GetInsType()
 	{
 		return ComponentType::Transform;
@@ -30,18 +67,15 @@ namespace ZXEngine
 
 	Matrix4 Transform::GetModelMatrix() const
 	{
-		// ѶLocal Space任World Spaceľ
-		return GetPositionMatrix() * GetRotationAndScaleMatrix();
+		// 把顶点从Local Space变换到World Space的矩阵
+		if (mIsDirty)
+			UpdateWorldData();
+		return mModelMatrix;
 	}
 
 	Matrix4 Transform::GetPositionMatrix() const
 	{
-		Vector3 position = GetPosition();
-		return Matrix4(
-			1, 0, 0, position.x,
-			0, 1, 0, position.y,
-			0, 0, 1, position.z,
-			0, 0, 0, 1);
+		return Math::TranslationMatrix(GetPosition());
 	}
 
 	Matrix4 Transform::GetRotationMatrix() const
@@ -52,7 +86,7 @@ namespace ZXEngine
 
 	Matrix4 Transform::GetScaleMatrix() const
 	{
-		// TransformǶת£scaleֻܵƳ
+		// 在Transform嵌套起来，并且有旋转的情况下，scale只能倒推出来，很难正向计算
 		auto invRotationMat = Math::Inverse(GetRotation().ToMatrix());
 		auto rotationAndScaleMat = GetRotationAndScaleMatrix();
 		return invRotationMat * rotationAndScaleMat;
@@ -60,16 +94,8 @@ namespace ZXEngine
 
 	Matrix4 Transform::GetRotationAndScaleMatrix() const
 	{
-		auto localScaleMat = GetLocalScaleMatrix();
-		auto localRotationMat = GetLocalRotationMatrix();
-		if (gameObject->parent == nullptr)
-		{
-			return localRotationMat * localScaleMat;
-		}
-		else
-		{
-			return gameObject->parent->GetComponent<Transform>()->GetRotationAndScaleMatrix() * localRotationMat * localScaleMat;
-		}
+		// Model矩阵去掉位移部分就是旋转和缩放
+		return Matrix4(Matrix3(GetModelMatrix()));
 	}
 
 	Vector3 Transform::GetLocalScale() const
@@ -95,6 +121,7 @@ namespace ZXEngine
 	void Transform::SetLocalScale(const Vector3& scale)
 	{
 		localScale = scale;
+		MarkDirty();
 	}
 
 	void Transform::SetLocalScale(float x, float y, float z)
@@ -105,6 +132,7 @@ namespace ZXEngine
 	void Transform::SetLocalPosition(const Vector3& position)
 	{
 		localPosition = position;
+		MarkDirty();
 	}
 
 	void Transform::SetLocalPosition(float x, float y, float z)
@@ -115,6 +143,7 @@ namespace ZXEngine
 	void Transform::SetLocalEulerAngles(const Vector3& eulerAngles)
 	{
 		localRotation.SetEulerAngles(eulerAngles);
+		MarkDirty();
 	}
 
 	void Transform::SetLocalEulerAngles(float x, float y, float z)
@@ -125,28 +154,22 @@ namespace ZXEngine
 	void Transform::SetLocalRotation(const Quaternion& rotation)
 	{
 		localRotation = rotation;
+		MarkDirty();
 	}
 
 	Matrix3 Transform::GetScale() const
 	{
-		// TransformǶתʱscale޷ü򵥵Vector3
-		// ΪʱӶתӶ˵ŲǱ׼xyz
-		// ӦģҲ޷Vector3ֻMatrix3
+		// 当Transform嵌套起来，并且有旋转时，scale无法再用简单的Vector3表达
+		// 因为父级缩放时，子对象如果有旋转，则对于子对象来说缩放不再是标准的xyz轴缩放了
+		// 相应的，缩放也无法再用Vector3表达，只能用Matrix3表达
 		return Matrix3(GetScaleMatrix());
 	}
 
 	Vector3 Transform::GetPosition() const
 	{
-		if (gameObject->parent == nullptr)
-		{
-			return localPosition;
-		}
-		else
-		{
-			auto parent = gameObject->parent->GetComponent<Transform>();
-			Vector3 offset = parent->GetRotationAndScaleMatrix() * localPosition.ToPosVec4();
-			return parent->GetPosition() + offset;
-		}
+		if (mIsDirty)
+			UpdateWorldData();
+		return mPosition;
 	}
 
 	Vector3 Transform::GetEulerAngles() const
@@ -156,10 +179,9 @@ namespace ZXEngine
 
 	Quaternion Transform::GetRotation() const
 	{
-		if (gameObject->parent == nullptr)
-			return localRotation;
-		else
-			return localRotation * gameObject->parent->GetComponent<Transform>()->GetRotation();
+		if (mIsDirty)
+			UpdateWorldData();
+		return mRotation;
 	}
 
 	void Transform::SetPosition(const Vector3& position)
@@ -175,6 +197,7 @@ namespace ZXEngine
 			Vector3 offset = parent->GetRotationAndScaleMatrix() * localPosition;
 			localPosition = Math::Inverse(parent->GetRotationAndScaleMatrix()) * (offset + position - wPosition);
 		}
+		MarkDirty();
 	}
 
 	void Transform::SetPosition(float x, float y, float z)
@@ -198,6 +221,7 @@ namespace ZXEngine
 			localRotation = rotation;
 		else
 			localRotation = gameObject->parent->GetComponent<Transform>()->GetRotation().GetInverse() * rotation;
+		MarkDirty();
 	}
 
 	Vector3 Transform::GetUp() const
@@ -220,4 +244,76 @@ namespace ZXEngine
 		Vector4 forward = rotation.ToMatrix() * Vector4(0, 0, 1, 0);
 		return Vector3(forward.x, forward.y, forward.z);
 	}
+
+	uint32_t Transform::GetVersion() const
+	{
+		if (mIsDirty)
+			UpdateWorldData();
+		return mVersion;
+	}
+
+	void Transform::MarkDirty()
+	{
+		if (mDirtyListIndex == SIZE_MAX)
+		{
+			mDirtyListIndex = mDirtyTransforms.size();
+			mDirtyTransforms.push_back(this);
+		}
+		SetSubtreeDirty();
+	}
+
+	void Transform::SetSubtreeDirty()
+	{
+		// 已经是脏的节点，其子节点也一定是脏的，不需要继续往下标记
+		if (mIsDirty)
+			return;
+
+		mIsDirty = true;
+
+		for (auto child : gameObject->children)
+		{
+			auto childTransform = child->GetComponent<Transform>();
+			if (childTransform)
+				childTransform->SetSubtreeDirty();
+		}
+	}
+
+	void Transform::UpdateWorldData() const
+	{
+		Matrix4 localMatrix = GetLocalPositionMatrix() * GetLocalRotationMatrix() * GetLocalScaleMatrix();
+
+		if (gameObject->parent == nullptr)
+		{
+			mModelMatrix = localMatrix;
+			mRotation = localRotation;
+		}
+		else
+		{
+			// 父节点如果也是脏的，会在这里先被刷新
+			auto parent = gameObject->parent->GetComponent<Transform>();
+			mModelMatrix = parent->GetModelMatrix() * localMatrix;
+			mRotation = localRotation * parent->GetRotation();
+		}
+
+		mPosition = mModelMatrix.GetColumn(3);
+		mIsDirty = false;
+		mVersion++;
+	}
+
+	void Transform::UpdateDirtyRecursively()
+	{
+		if (mIsDirty)
+			UpdateWorldData();
+
+		// 可能在刷新之前就被单独访问过而提前算好了，所以子树里的节点都算作变化过
+		mChangedTransforms.push_back(this);
+
+		// 子节点可能已经被单独刷新过了，但是孙节点仍然可能是脏的，所以这里要遍历整个子树
+		for (auto child : gameObject->children)
+		{
+			auto childTransform = child->GetComponent<Transform>();
+			if (childTransform)
+				childTransform->UpdateDirtyRecursively();
+		}
+	}
 }
\ No newline at end of file
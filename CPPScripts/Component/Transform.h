@@ -7,10 +7,19 @@ namespace ZXEngine
 	{
 	public:
 		static ComponentType GetType();
+		// 每帧渲染前统一刷新所有被标记为脏的Transform的世界矩阵缓存
+		static void UpdateAllDirtyTransforms();
+		// 上一次UpdateAllDirtyTransforms中世界矩阵可能发生了变化的所有Transform(包括子节点)
+		static const vector<Transform*>& GetChangedTransforms();
+
+	private:
+		// 本帧被修改过的Transform(只记录修改时的那一个节点，子节点在刷新时递归处理)
+		static vector<Transform*> mDirtyTransforms;
+		static vector<Transform*> mChangedTransforms;
 
 	public:
-		Transform() {};
-		~Transform() {};
+		Transform();
+		~Transform();
 
 		virtual ComponentType GetInsType();
 
@@ -55,9 +64,27 @@ namespace ZXEngine
 		Vector3 GetRight() const;
 		Vector3 GetForward() const;
 
+		// 世界矩阵缓存的版本号，每次重新计算世界矩阵都会+1，外部可以用来判断Transform是否发生了变化
+		uint32_t GetVersion() const;
+
 	private:
 		Vector3 localPosition = Vector3();
 		Quaternion localRotation = Quaternion();
 		Vector3 localScale = Vector3(1.0f);
+
+		// 缓存的世界空间数据，只有在mIsDirty为true时才会重新计算
+		mutable Matrix4 mModelMatrix;
+		mutable Vector3 mPosition;
+		mutable Quaternion mRotation;
+		mutable uint32_t mVersion = 0;
+		// 脏标记，如果一个节点是脏的，那么它所有的子节点也一定是脏的
+		mutable bool mIsDirty = true;
+		// 在mDirtyTransforms中的索引，不在列表中时为SIZE_MAX
+		size_t mDirtyListIndex = SIZE_MAX;
+
+		void MarkDirty();
+		void SetSubtreeDirty();
+		void UpdateWorldData() const;
+		void UpdateDirtyRecursively();
 	};
 }
\ No newline at end of file
@@ -26,7 +26,7 @@ namespace ZXEngine
 
     void UITextRenderer::Render()
     {
-        // ı˱仯Ⱦ
+        // 如果文本发生了变化，重新生成渲染数据
         if (dirty)
         {
             for (auto material : textMaterials)
@@ -58,26 +58,26 @@ namespace ZXEngine
         auto characterMgr = TextCharactersManager::GetInstance();
 
         length = 0;
-        // ַÿַ
+        // 遍历字符串的每个字符
         string::const_iterator c;
         for (c = text.begin(); c != text.end(); c++)
         {
             Character ch = characterMgr->Characters[*c];
 
-            // ոʵͼֱַӺһξճʵȾ
+            // 如果遇到空格等无实际图像的字符，直接后移一段距离空出来，不做实际渲染
             if (ch.TextureID == UINT32_MAX)
             {
                 tmpX += (ch.Advance >> 6) * size;
                 continue;
             }
 
-            // ַλúʹС
+            // 计算字符位置和大小
             float xpos = tmpX + ch.Bearing[0] * size;
             float ypos = tmpY - (ch.Size[1] - ch.Bearing[1]) * size;
             float w = ch.Size[0] * size;
             float h = ch.Size[1] * size;
 
-            // ַ
+            // 设置字符顶点数据
             Vector3 points[4] =
             {
                 Vector3(xpos,     ypos,     0),
@@ -94,7 +94,7 @@ namespace ZXEngine
                 vertices.push_back(vertex);
             }
 
-            // ַMesh
+            // 更新字符Mesh
             if (length >= textMeshes.size())
             {
                 auto charMesh = new DynamicMesh(4, 6);
@@ -106,7 +106,7 @@ namespace ZXEngine
                 textMeshes[length]->UpdateData(vertices, GlyphIndices);
             }
 
-            // ַ
+            // 字符材质
             auto charMaterial = new Material(characterMgr->textShader);
             charMaterial->Use();
             charMaterial->SetVector("_TextColor", color, true);
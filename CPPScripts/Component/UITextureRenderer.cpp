@@ -5,6 +5,7 @@
 #include "../Material.h"
 #include "../Resources.h"
 #include "../GlobalData.h"
+#include "../AssetCache.h"
 
 namespace ZXEngine
 {
@@ -23,7 +24,7 @@ namespace ZXEngine
 	UITextureRenderer::~UITextureRenderer()
 	{
 		if (texture != nullptr)
-			delete texture;
+			AssetCache::ReleaseTexture(texture);
 		if (material != nullptr)
 			delete material;
 		if (textureMesh != nullptr)
@@ -46,8 +47,8 @@ namespace ZXEngine
 	void UITextureRenderer::SetTexture(const char* path)
 	{
 		if (texture != nullptr)
-			delete texture;
-		texture = new Texture(path);
+			AssetCache::ReleaseTexture(texture);
+		texture = AssetCache::AcquireTexture(path);
 
 		if (material != nullptr)
 			delete material;
@@ -71,7 +72,7 @@ namespace ZXEngine
 		float width = (float)texture->width;
 		float height = (float)texture->height;
 
-		// ͼƬߴ繹Mesh
+		// 根据图片尺寸构建Mesh
 		Vector3 points[4] =
 		{
 			Vector3(  width / 2 ,   height / 2 , 0),
@@ -79,7 +80,7 @@ namespace ZXEngine
 			Vector3(-(width / 2),   height / 2 , 0),
 			Vector3(-(width / 2), -(height / 2), 0),
 		};
-		// GLSLϵYǳµģHLSLǳϵ
+		// GLSL的纹理采样坐标系Y轴是朝下的，HLSL是朝上的
 		Vector2 coords[4] =
 		{
 			Vector2(1, 0),
@@ -37,9 +37,9 @@ namespace ZXEngine
 	
 	Matrix4 Camera::GetViewMatrix()
 	{
-		// ModelǰѶģͿռתռ䣬ViewʵǰѳжռתԼģͿռ
-		// ֱӷModel󼴿
-		// glm::lookAtMath::GetLookToMatrixҲһ
+		// Model矩阵是把顶点从模型空间转到世界空间，而相机的View矩阵，其实就是把场景中所有顶点从世界空间转到相机自己的模型空间
+		// 所以这里直接返回Model矩阵的逆矩阵即可
+		// 这里用glm::lookAt或者Math::GetLookToMatrix也是一样的
 		Matrix4 model = GetTransform()->GetModelMatrix();
 		return Math::Inverse(model);
 	}
@@ -13,7 +13,7 @@ namespace ZXEngine
         static vector<Camera*> GetAllCameras();
 
     private:
-        // 
+        // 所有相机
         static vector<Camera*> allCameras;
 
 	public:
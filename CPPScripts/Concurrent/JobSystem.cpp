@@ -0,0 +1,205 @@
+#include "JobSystem.h"
+
+namespace ZXEngine
+{
+	// 当前线程在JobSystem中的工作线程编号，非工作线程为UINT32_MAX
+	static thread_local uint32_t tWorkerIndex = UINT32_MAX;
+
+	JobSystem* JobSystem::mInstance = nullptr;
+
+	void JobSystem::Create(uint32_t workerNum)
+	{
+		if (workerNum == 0)
+		{
+			uint32_t coreNum = std::thread::hardware_concurrency();
+			workerNum = coreNum > 1 ? coreNum - 1 : 1;
+		}
+		mInstance = new JobSystem(workerNum);
+	}
+
+	void JobSystem::Destroy()
+	{
+		delete mInstance;
+		mInstance = nullptr;
+	}
+
+	JobSystem* JobSystem::GetInstance()
+	{
+		return mInstance;
+	}
+
+	JobSystem::JobSystem(uint32_t workerNum)
+	{
+		// 先把所有队列创建好再启动线程，工作线程会访问其它线程的队列
+		for (uint32_t i = 0; i < workerNum; i++)
+			mLocalQueues.push_back(make_unique<Concurrent::WorkStealingQueue<JobItem>>());
+
+		for (uint32_t i = 0; i < workerNum; i++)
+			mWorkers.emplace_back(&JobSystem::WorkerThread, this, i);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mDone = true;
+		}
+		mSleepCondition.notify_all();
+
+		for (auto& worker : mWorkers)
+			worker.join();
+	}
+
+	uint32_t JobSystem::GetWorkerNum() const
+	{
+		return static_cast<uint32_t>(mWorkers.size());
+	}
+
+	void JobSystem::Submit(Job job, JobCounter* counter, const JobCounter* dependency)
+	{
+		if (counter)
+			counter->mCount.fetch_add(1, std::memory_order_relaxed);
+
+		JobItem item = { std::move(job), counter };
+
+		if (dependency && !dependency->IsDone())
+		{
+			std::lock_guard<std::mutex> lock(dependency->mWaitingMutex);
+			// 加锁后再检查一次，计数器归零后会在同一把锁下取走所有挂起的Job，所以这里要么挂上去后一定会被放出来，要么直接入队
+			if (!dependency->IsDone())
+			{
+				dependency->mWaitingJobs.push_back(std::move(item));
+				return;
+			}
+		}
+
+		PushJob(std::move(item), tWorkerIndex != UINT32_MAX);
+	}
+
+	void JobSystem::Wait(const JobCounter* counter)
+	{
+		while (!counter->IsDone())
+		{
+			if (!TryRunPendingJob())
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& func)
+	{
+		if (count == 0)
+			return;
+
+		if (batchSize == 0)
+			batchSize = 1;
+
+		// 只有一段时没必要拆成Job
+		if (count <= batchSize)
+		{
+			func(0, count);
+			return;
+		}
+
+		JobCounter counter;
+		// 第一段留给当前线程自己执行，其余的提交出去
+		for (uint32_t begin = batchSize; begin < count; begin += batchSize)
+		{
+			uint32_t end = std::min(begin + batchSize, count);
+			Submit([&func, begin, end]() { func(begin, end); }, &counter);
+		}
+		func(0, batchSize);
+
+		Wait(&counter);
+	}
+
+	void JobSystem::WorkerThread(uint32_t index)
+	{
+		tWorkerIndex = index;
+
+		while (true)
+		{
+			if (TryRunPendingJob())
+				continue;
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [this] { return mDone || mPendingJobNum.load() > 0; });
+
+			if (mDone)
+				return;
+		}
+	}
+
+	void JobSystem::PushJob(JobItem&& item, bool local)
+	{
+		if (local)
+			mLocalQueues[tWorkerIndex]->Push(std::move(item));
+		else
+			mGlobalQueue.Push(std::move(item));
+
+		mPendingJobNum.fetch_add(1);
+
+		// 先拿一下锁再通知，避免工作线程检查完条件但还没进入等待时错过通知
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+		mSleepCondition.notify_one();
+	}
+
+	bool JobSystem::TryGetJob(JobItem& item)
+	{
+		// 先取自己队列里的
+		if (tWorkerIndex != UINT32_MAX && mLocalQueues[tWorkerIndex]->TryPop(item))
+			return true;
+
+		// 再取全局队列里的
+		if (mGlobalQueue.TryPop(item))
+			return true;
+
+		// 最后去其它工作线程的队列里偷，从自己的下一个开始，避免所有线程都去偷同一个队列
+		// 这里用队列数量而不是mWorkers的大小，构造函数里启动线程时mWorkers还在增长
+		uint32_t workerNum = static_cast<uint32_t>(mLocalQueues.size());
+		uint32_t start = tWorkerIndex == UINT32_MAX ? 0 : tWorkerIndex + 1;
+		for (uint32_t i = 0; i < workerNum; i++)
+		{
+			uint32_t idx = (start + i) % workerNum;
+			if (idx != tWorkerIndex && mLocalQueues[idx]->TrySteal(item))
+				return true;
+		}
+
+		return false;
+	}
+
+	bool JobSystem::TryRunPendingJob()
+	{
+		JobItem item;
+		if (!TryGetJob(item))
+			return false;
+
+		mPendingJobNum.fetch_sub(1);
+
+		Execute(item);
+		return true;
+	}
+
+	void JobSystem::Execute(JobItem& item)
+	{
+		item.job();
+
+		if (item.counter)
+			DecreaseCounter(item.counter);
+	}
+
+	void JobSystem::DecreaseCounter(JobCounter* counter)
+	{
+		vector<JobItem> jobs;
+		{
+			// 计数和挂起的Job在同一把锁下修改，锁释放后计数器可能马上被等待它的线程销毁，之后不能再访问counter
+			std::lock_guard<std::mutex> lock(counter->mWaitingMutex);
+			if (counter->mCount.fetch_sub(1, std::memory_order_release) == 1)
+				jobs.swap(counter->mWaitingJobs);
+		}
+
+		for (auto& job : jobs)
+			PushJob(std::move(job), tWorkerIndex != UINT32_MAX);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+#include "../pubh.h"
+#include "Queue.h"
+#include "WorkStealingQueue.h"
+
+namespace ZXEngine
+{
+	class JobCounter;
+	struct JobItem
+	{
+		std::function<void()> job;
+		// 不为空时，Job执行完后计数-1
+		JobCounter* counter = nullptr;
+	};
+
+	// 用来等待一组Job执行完，每提交一个Job计数+1，执行完-1
+	class JobCounter
+	{
+		friend class JobSystem;
+	public:
+		JobCounter() {};
+		// 最后一个Job减计数时还持有锁，等它释放后再销毁，否则在Wait返回后马上销毁计数器会和它冲突
+		~JobCounter() { std::lock_guard<std::mutex> lock(mWaitingMutex); };
+		JobCounter(const JobCounter& other) = delete;
+		JobCounter& operator= (const JobCounter& other) = delete;
+
+		bool IsDone() const { return mCount.load(std::memory_order_acquire) == 0; }
+
+	private:
+		std::atomic<uint32_t> mCount = 0;
+		// 依赖这个计数器的Job先挂在这里，计数归零时再放进队列，避免还不能执行的Job被工作线程反复取出
+		// 不改变计数本身，所以const的计数器也可以挂Job
+		mutable std::mutex mWaitingMutex;
+		mutable vector<JobItem> mWaitingJobs;
+	};
+
+	// 固定数量工作线程的任务系统
+	// 工作线程提交的Job放进自己的工作窃取队列，其它线程提交的Job放进全局队列
+	// 工作线程优先执行自己队列里的Job，然后是全局队列，都没有时去其它线程的队列里偷
+	class JobSystem
+	{
+	public:
+		using Job = std::function<void()>;
+
+		// workerNum为0时按CPU核心数创建，主线程占用一个核心
+		static void Create(uint32_t workerNum = 0);
+		// 通知所有工作线程退出并等待它们结束
+		static void Destroy();
+		static JobSystem* GetInstance();
+
+	private:
+		static JobSystem* mInstance;
+
+	public:
+		JobSystem(uint32_t workerNum);
+		~JobSystem();
+
+		uint32_t GetWorkerNum() const;
+
+		// counter不为空时，Job执行完后counter计数-1
+		// dependency不为空时，Job要等dependency归零后才会执行
+		void Submit(Job job, JobCounter* counter = nullptr, const JobCounter* dependency = nullptr);
+		// 等待counter归零，等待期间当前线程也会帮忙执行Job，所以在Job内部等待也不会死锁
+		void Wait(const JobCounter* counter);
+		// 把[0, count)拆成每段batchSize个的区间并行执行，func的参数是区间的begin和end，函数返回时所有区间都已执行完
+		void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& func);
+
+	private:
+		std::atomic<bool> mDone = false;
+		// 队列里还没被取走的Job数量，工作线程用来判断是否可以休眠，挂在计数器上等待依赖的Job不算在内
+		std::atomic<uint32_t> mPendingJobNum = 0;
+		std::mutex mSleepMutex;
+		std::condition_variable mSleepCondition;
+
+		Concurrent::Queue<JobItem> mGlobalQueue;
+		vector<unique_ptr<Concurrent::WorkStealingQueue<JobItem>>> mLocalQueues;
+		vector<std::thread> mWorkers;
+
+		void WorkerThread(uint32_t index);
+		// local为true时放进当前工作线程自己的队列，否则放进全局队列
+		void PushJob(JobItem&& item, bool local);
+		bool TryGetJob(JobItem& item);
+		bool TryRunPendingJob();
+		void Execute(JobItem& item);
+		// Job执行完后计数-1，归零时把挂在上面的Job放进队列
+		void DecreaseCounter(JobCounter* counter);
+	};
+}
\ No newline at end of file
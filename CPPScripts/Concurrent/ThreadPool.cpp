@@ -0,0 +1,69 @@
+#include "ThreadPool.h"
+
+namespace ZXEngine
+{
+	ThreadPool::ThreadPool(uint32_t threadNum)
+	{
+		for (uint32_t i = 0; i < threadNum; i++)
+			mThreads.emplace_back(&ThreadPool::WorkerThread, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mDone = true;
+			mPendingTasks.clear();
+		}
+		mCondition.notify_all();
+
+		for (auto& thread : mThreads)
+			thread.join();
+	}
+
+	uint32_t ThreadPool::Submit(Task task, int priority)
+	{
+		uint32_t id = 0;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			id = mNextTaskID++;
+			mPendingTasks.insert({ priority, { id, std::move(task) } });
+		}
+		mCondition.notify_one();
+		return id;
+	}
+
+	bool ThreadPool::Cancel(uint32_t id)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (auto iter = mPendingTasks.begin(); iter != mPendingTasks.end(); iter++)
+		{
+			if (iter->second.id == id)
+			{
+				mPendingTasks.erase(iter);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void ThreadPool::WorkerThread()
+	{
+		while (true)
+		{
+			Task task;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mCondition.wait(lock, [this] { return mDone || !mPendingTasks.empty(); });
+
+				if (mDone)
+					return;
+
+				auto iter = mPendingTasks.begin();
+				task = std::move(iter->second.task);
+				mPendingTasks.erase(iter);
+			}
+			task();
+		}
+	}
+}
\ No newline at end of file
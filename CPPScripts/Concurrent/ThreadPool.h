@@ -0,0 +1,40 @@
+#pragma once
+#include "../pubh.h"
+
+namespace ZXEngine
+{
+	// 固定线程数的任务池，给资源加载这类会阻塞在IO上的任务用，不和JobSystem抢计算线程
+	// 任务按优先级执行，同优先级先提交先执行，还没开始执行的任务可以取消
+	class ThreadPool
+	{
+	public:
+		using Task = std::function<void()>;
+
+		ThreadPool(uint32_t threadNum);
+		~ThreadPool();
+		ThreadPool(const ThreadPool& other) = delete;
+		ThreadPool& operator= (const ThreadPool& other) = delete;
+
+		// 返回任务ID，用于取消任务，priority越大越先执行
+		uint32_t Submit(Task task, int priority = 0);
+		// 任务还在排队时取消成功返回true，已经开始执行或执行完了返回false
+		bool Cancel(uint32_t id);
+
+	private:
+		struct PendingTask
+		{
+			uint32_t id = 0;
+			Task task;
+		};
+
+		bool mDone = false;
+		uint32_t mNextTaskID = 0;
+		// key是优先级，从大到小排序，multimap插入相同key时会放在最后，保证了同优先级先进先出
+		multimap<int, PendingTask, std::greater<int>> mPendingTasks;
+		std::mutex mMutex;
+		std::condition_variable mCondition;
+		vector<std::thread> mThreads;
+
+		void WorkerThread();
+	};
+}
\ No newline at end of file
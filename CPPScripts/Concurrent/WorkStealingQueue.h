@@ -0,0 +1,62 @@
+#pragma once
+#include "../pubh.h"
+
+// 给任务系统用的工作窃取队列，每个工作线程拥有一个：
+// 拥有者线程从头部Push和Pop，后进先出，刚Push的任务数据大概率还在缓存里
+// 其它空闲线程从尾部Steal，先进先出，偷走的通常是较早提交的大块任务，减少窃取次数
+// 这里用一个互斥锁保护整个deque，队列只在Push/Pop/Steal的瞬间加锁，竞争主要发生在窃取时，所以开销可以接受
+
+namespace ZXEngine
+{
+	namespace Concurrent
+	{
+		template<typename T>
+		class WorkStealingQueue
+		{
+		public:
+			WorkStealingQueue() {};
+			WorkStealingQueue(const WorkStealingQueue& other) = delete;
+			WorkStealingQueue& operator= (const WorkStealingQueue& other) = delete;
+
+			void Push(T value)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mData.push_front(std::move(value));
+			}
+
+			bool Empty() const
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				return mData.empty();
+			}
+
+			// 拥有者线程调用，从头部取
+			bool TryPop(T& value)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (mData.empty())
+					return false;
+
+				value = std::move(mData.front());
+				mData.pop_front();
+				return true;
+			}
+
+			// 其它线程调用，从尾部取
+			bool TrySteal(T& value)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if (mData.empty())
+					return false;
+
+				value = std::move(mData.back());
+				mData.pop_back();
+				return true;
+			}
+
+		private:
+			deque<T> mData;
+			mutable std::mutex mMutex;
+		};
+	}
+}
\ No newline at end of file
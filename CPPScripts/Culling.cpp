@@ -0,0 +1,87 @@
+#include "Culling.h"
+
+namespace ZXEngine
+{
+	Vector3 AABB::GetCenter() const
+	{
+		return (min + max) * 0.5f;
+	}
+
+	Vector3 AABB::GetExtents() const
+	{
+		return (max - min) * 0.5f;
+	}
+
+	AABB AABB::GetTransformed(const Matrix4& mat) const
+	{
+		// 中心点正常变换，半边长用矩阵3x3部分的绝对值变换，得到的就是能包住旋转后包围盒的最小AABB
+		Vector3 center = mat * Vector4(GetCenter(), 1.0f);
+		Vector3 extents = GetExtents();
+
+		Vector4 row0 = mat.GetRow(0);
+		Vector4 row1 = mat.GetRow(1);
+		Vector4 row2 = mat.GetRow(2);
+
+		Vector3 newExtents(
+			fabsf(row0.x) * extents.x + fabsf(row0.y) * extents.y + fabsf(row0.z) * extents.z,
+			fabsf(row1.x) * extents.x + fabsf(row1.y) * extents.y + fabsf(row1.z) * extents.z,
+			fabsf(row2.x) * extents.x + fabsf(row2.y) * extents.y + fabsf(row2.z) * extents.z
+		);
+
+		return AABB(center - newExtents, center + newExtents);
+	}
+
+	Frustum::Frustum(const Matrix4& viewProjection)
+	{
+		// Gribb-Hartmann方法，裁剪空间下的各个平面可以直接用VP矩阵的行向量组合出来
+		// 近平面统一按Z范围[-1, 1]计算，对于Z范围[0, 1]的投影矩阵来说只是稍微保守一点
+		Vector4 row0 = viewProjection.GetRow(0);
+		Vector4 row1 = viewProjection.GetRow(1);
+		Vector4 row2 = viewProjection.GetRow(2);
+		Vector4 row3 = viewProjection.GetRow(3);
+
+		mPlanes[0] = row3 + row0;
+		mPlanes[1] = row3 - row0;
+		mPlanes[2] = row3 + row1;
+		mPlanes[3] = row3 - row1;
+		mPlanes[4] = row3 + row2;
+		mPlanes[5] = row3 - row2;
+
+		for (auto& plane : mPlanes)
+		{
+			float length = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			if (length > 0.0f)
+				plane = plane / length;
+		}
+	}
+
+	bool Frustum::Intersects(const AABB& aabb) const
+	{
+		Vector3 center = aabb.GetCenter();
+		Vector3 extents = aabb.GetExtents();
+
+		for (auto& plane : mPlanes)
+		{
+			// 包围盒在平面法线上的投影半径
+			float radius = extents.x * fabsf(plane.x) + extents.y * fabsf(plane.y) + extents.z * fabsf(plane.z);
+			float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			// 完全在某个平面的外侧，就一定不在视锥体内
+			if (distance < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Frustum::Intersects(const Vector3& center, float radius) const
+	{
+		for (auto& plane : mPlanes)
+		{
+			float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			if (distance < -radius)
+				return false;
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
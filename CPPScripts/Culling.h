@@ -0,0 +1,37 @@
+#pragma once
+#include "pubh.h"
+
+namespace ZXEngine
+{
+	// 轴对齐包围盒
+	struct AABB
+	{
+		Vector3 min;
+		Vector3 max;
+
+		AABB() {};
+		AABB(const Vector3& min, const Vector3& max) : min(min), max(max) {};
+
+		Vector3 GetCenter() const;
+		// 包围盒的半边长
+		Vector3 GetExtents() const;
+		// 把包围盒变换到新的空间，返回新空间下能包住原包围盒的AABB
+		AABB GetTransformed(const Matrix4& mat) const;
+	};
+
+	class Frustum
+	{
+	public:
+		Frustum() {};
+		// 从VP矩阵中提取视锥体的6个平面
+		Frustum(const Matrix4& viewProjection);
+
+		bool Intersects(const AABB& aabb) const;
+		bool Intersects(const Vector3& center, float radius) const;
+
+	private:
+		// 平面方程为 Dot(xyz, p) + w = 0，法线xyz朝向视锥体内部
+		// 0-5分别对应左，右，下，上，近，远
+		array<Vector4, 6> mPlanes;
+	};
+}
\ No newline at end of file
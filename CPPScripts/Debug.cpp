@@ -1,13 +1,15 @@
 #include "Debug.h"
 #include <iostream>
 #include "PublicEnum.h"
+#ifndef ZX_HEADLESS
 #include "ProjectSetting.h"
 #include "Editor/EditorDataManager.h"
+#endif
 
 namespace ZXEngine
 {
 	/// <summary>
-	/// ־ģ
+	/// 日志模块
 	/// </summary>
 	
 	std::mutex Debug::mWriteMutex;
@@ -16,10 +18,12 @@ namespace ZXEngine
 	{
 		std::cout << "Log:     " << message << std::endl;
 
+#ifndef ZX_HEADLESS
 		if (ProjectSetting::logToFile)
 		{
 			WriteToFile("Log:     " + message);
 		}
+#endif
 
 #ifdef ZX_EDITOR
 		EditorDataManager::GetInstance()->AddLog(LogType::Message, message);
@@ -30,10 +34,12 @@ namespace ZXEngine
 	{
 		std::cout << "Warning: " << message << std::endl;
 
+#ifndef ZX_HEADLESS
 		if (ProjectSetting::logToFile)
 		{
 			WriteToFile("Warning: " + message);
 		}
+#endif
 
 #ifdef ZX_EDITOR
 		EditorDataManager::GetInstance()->AddLog(LogType::Warning, message);
@@ -44,10 +50,12 @@ namespace ZXEngine
 	{
 		std::cout << "Error:   " << message << std::endl;
 
+#ifndef ZX_HEADLESS
 		if (ProjectSetting::logToFile)
 		{
 			WriteToFile("Error:   " + message);
 		}
+#endif
 
 #ifdef ZX_EDITOR
 		EditorDataManager::GetInstance()->AddLog(LogType::Error, message);
@@ -56,13 +64,34 @@ namespace ZXEngine
 
 #ifdef ZX_DEBUG
 	int Debug::drawCallCount;
+	int Debug::forwardDrawnCount;
+	int Debug::forwardCulledCount;
+	int Debug::shadowDrawnCount;
+	int Debug::shadowCulledCount;
+	int Debug::animatorFullCount;
+	int Debug::animatorReducedCount;
+	int Debug::animatorOffscreenCount;
+	int Debug::animatorSkippedCount;
 	void Debug::Update() 
 	{
 		Log("Draw Call: " + std::to_string(drawCallCount));
+		Log("Forward Drawn: " + std::to_string(forwardDrawnCount) + " Culled: " + std::to_string(forwardCulledCount));
+		Log("Shadow Drawn: " + std::to_string(shadowDrawnCount) + " Culled: " + std::to_string(shadowCulledCount));
+		Log("Animator Full: " + std::to_string(animatorFullCount) + " Reduced: " + std::to_string(animatorReducedCount)
+			+ " Offscreen: " + std::to_string(animatorOffscreenCount) + " Skipped: " + std::to_string(animatorSkippedCount));
 		drawCallCount = 0;
+		forwardDrawnCount = 0;
+		forwardCulledCount = 0;
+		shadowDrawnCount = 0;
+		shadowCulledCount = 0;
+		animatorFullCount = 0;
+		animatorReducedCount = 0;
+		animatorOffscreenCount = 0;
+		animatorSkippedCount = 0;
 	}
 #endif
 
+#ifndef ZX_HEADLESS
 	void Debug::WriteToFile(const std::string& message)
 	{
 		std::lock_guard lock(mWriteMutex);
@@ -78,6 +107,7 @@ namespace ZXEngine
 
 		f.close();
 	}
+#endif
 
 	void Debug::Replace(std::string& message, const std::string& from, const std::string& to)
 	{
@@ -89,7 +119,7 @@ namespace ZXEngine
 	}
 	
 	/// <summary>
-	/// ʱģ
+	/// 计时器模块
 	/// </summary>
 	
 	size_t Debug::mTimerStackTop = 0;
@@ -105,7 +135,7 @@ namespace ZXEngine
 			return;
 		}
 
-		mTimerStack[mTimerStackTop++] = std::chrono::high_resolution_clock::now();
+		mTimerStack[mTimerStackTop++] = std::chrono::steady_clock::now();
 	}
 
 	void Debug::PopTimer(const std::string& name)
@@ -116,22 +146,22 @@ namespace ZXEngine
 			return;
 		}
 
-		auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - mTimerStack[--mTimerStackTop]).count();
+		auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mTimerStack[--mTimerStackTop]).count();
 
-		// ûLogΪLogٶһӰʱҪдļLog
-		// ƴЧʱֱ<<
-		cout << (name + " : " + std::to_string(duration) + " ns\n");
+		// 没有用Log，因为Log速度慢一倍，会影响计时，如果有需要写入文件再用Log
+		// 先拼接再输出，效率比直接用<<高
+		std::cout << (name + " : " + std::to_string(duration) + " ns\n");
 	}
 
 	void Debug::StartTimer(const std::string& name)
 	{
-		mTimerMap[name] = std::chrono::high_resolution_clock::now();
+		mTimerMap[name] = std::chrono::steady_clock::now();
 	}
 
 	void Debug::EndTimer(const std::string& name)
 	{
-		auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - mTimerMap[name]).count();
+		auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mTimerMap[name]).count();
 
-		cout << (name + " : " + std::to_string(duration) + " ns");
+		std::cout << (name + " : " + std::to_string(duration) + " ns");
 	}
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include <chrono>
 #include <unordered_map>
 
-// Դ뿪
+// 条件编译调试代码开关
 // #define ZX_DEBUG
 
 namespace ZXEngine
@@ -12,7 +12,7 @@ namespace ZXEngine
 	class Debug
 	{
 	/// <summary>
-	/// ־ģ
+	/// 日志模块
 	/// </summary>
 	public:
 		static void Log(const std::string& message);
@@ -28,6 +28,16 @@ namespace ZXEngine
 
 #ifdef ZX_DEBUG
 		static int drawCallCount;
+		// 视锥体剔除统计
+		static int forwardDrawnCount;
+		static int forwardCulledCount;
+		static int shadowDrawnCount;
+		static int shadowCulledCount;
+		// 这一帧各个LOD的Animator数量
+		static int animatorFullCount;
+		static int animatorReducedCount;
+		static int animatorOffscreenCount;
+		static int animatorSkippedCount;
 		static void Update();
 #endif
 
@@ -47,7 +57,7 @@ namespace ZXEngine
 
 
 	/// <summary>
-	/// ʱģ
+	/// 计时器模块
 	/// </summary>
 	public:
 		static void PushTimer();
@@ -64,7 +74,7 @@ namespace ZXEngine
 		static std::unordered_map<std::string, std::chrono::steady_clock::time_point> mTimerMap;
 	};
 
-	// ģ庯(ػ汾ƥ䲻ϵʱͻ)
+	// 基本模板函数(各种特化版本都匹配不上的时候就会用这个)
 	template<typename T, typename = void>
 	struct ToStringHelper 
 	{
@@ -74,7 +84,7 @@ namespace ZXEngine
 		}
 	};
 
-	// ػ汾ڴToStringԱ
+	// 特化版本，用于处理有ToString成员函数的类型
 	template<typename T>
 	struct ToStringHelper<T, std::void_t<decltype(std::declval<T>().ToString())>> 
 	{
@@ -84,7 +94,7 @@ namespace ZXEngine
 		}
 	};
 
-	// ػ汾ڴstd::to_stringת
+	// 特化版本，用于处理可以用std::to_string转换的类型
 	template<typename T>
 	struct ToStringHelper<T, std::enable_if_t<std::is_arithmetic_v<T>>> 
 	{
@@ -94,7 +104,7 @@ namespace ZXEngine
 		}
 	};
 
-	// ػ汾ڴstring
+	// 特化版本，用于处理string
 	template<>
 	struct ToStringHelper<std::string>
 	{
@@ -104,7 +114,7 @@ namespace ZXEngine
 		}
 	};
 
-	// ػ汾ڴchar*
+	// 特化版本，用于处理char*
 	template<>
 	struct ToStringHelper<const char*>
 	{
@@ -144,8 +154,8 @@ namespace ZXEngine
 		return ToStringHelper<T>::Convert(t);
 	}
 
-	// ذ汾ڴconst char[N]
-	// дһconst char[N]ػ汾ToStringHelperᱻģƥ䣬ֻToStringػ汾ToStringHelper
+	// 重载版本，用于处理const char[N]类型
+	// 如果写一个const char[N]特化版本的ToStringHelper会被基本模板先匹配，所以这种情况只能重载ToString函数而不是新增特化版本的ToStringHelper
 	template<std::size_t N>
 	std::string Debug::ToString(const char(&value)[N])
 	{
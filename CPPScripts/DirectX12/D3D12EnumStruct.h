@@ -7,7 +7,7 @@
 #include <dxcapi.h>
 #include "../PublicStruct.h"
 
-// D3D12ؿ
+// 链接D3D12的相关库
 #pragma comment(lib, "d3dcompiler.lib")
 #pragma comment(lib, "D3D12.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -22,9 +22,9 @@ inline void ThrowIfFailed(HRESULT hr)
     {
         _com_error err(hr);
         OutputDebugString(err.ErrorMessage());
-        // ʵthrowʱǰErrorMessageصĴϢ
-        // ErrorMessageķֵconst TCHAR*throwʱֻܴconst char*
-        // TCHARcharתUnicodeַº鷳ֻ׳һ̶ĴϢ
+        // 其实这里throw的时候，最好是把ErrorMessage返回的错误信息当作参数
+        // 但是ErrorMessage的返回值是const TCHAR*，而throw的时候，只能传入const char*
+        // 这个TCHAR到char的转换，在Unicode字符集下很麻烦，所以这里只抛出一个固定的错误信息
         throw std::exception("D3D12 interface call failed !");
     }
 }
@@ -59,14 +59,18 @@ namespace ZXEngine
         uint32_t VAO = 0;
         uint32_t pipelineID = 0;
         uint32_t materialDataID = 0;
+        uint32_t instanceNum = 1;
+        uint32_t instanceBufferID = UINT32_MAX; // UINT32_MAX表示不是Instancing绘制
+        uint32_t indexOffset = 0;
+        uint32_t indexCount = UINT32_MAX; // UINT32_MAX表示绘制整个索引缓冲区
     };
 
     struct ZXD3D12DrawCommand
     {
         CommandType commandType = CommandType::NotCare;
-        // AllocatorCommandListʵ11ģһAllocatorԶӦCommandList
-        // һAllocatorӦCommandListУֻһCommandListRecording״̬
-        // ΢е͵ˣֱӸ11С
+        // Allocator和CommandList其实不用1对1的，一个Allocator可以对应多个CommandList
+        // 但是在一个Allocator所对应的所有CommandList中，只能有一个CommandList处于Recording状态
+        // 这里稍微有点偷懒了，先直接搞成1对1，反正现在数量小
         vector<ComPtr<ID3D12CommandAllocator>> allocators;
         vector<ComPtr<ID3D12GraphicsCommandList4>> commandLists;
         bool inUse = false;
@@ -80,9 +84,9 @@ namespace ZXEngine
 
     struct ZXD3D12DescriptorHandle
     {
-        // 
+        // 在描述符堆里的索引
         uint32_t descriptorIdx = UINT32_MAX;
-        // 
+        // 在描述符堆数组里的索引
         uint32_t descriptorHeapIdx = UINT32_MAX;
         D3D12_DESCRIPTOR_HEAP_TYPE heapType = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
     };
@@ -119,11 +123,11 @@ namespace ZXEngine
 
     struct ZXD3D12VAO
     {
-        UINT indexCount = 0; // 
+        UINT indexCount = 0; // 索引数量
         ZXD3D12Buffer indexBuffer;
         D3D12_INDEX_BUFFER_VIEW indexBufferView = {};
 
-        UINT vertexCount = 0; // 
+        UINT vertexCount = 0; // 顶点数量
         ZXD3D12Buffer vertexBuffer;
         D3D12_VERTEX_BUFFER_VIEW vertexBufferView = {};
 
@@ -131,6 +135,14 @@ namespace ZXEngine
         bool inUse = false;
     };
 
+    struct ZXD3D12InstanceBuffer
+    {
+        vector<ZXD3D12Buffer> buffers; // 每个in flight的帧一个
+        vector<D3D12_VERTEX_BUFFER_VIEW> bufferViews;
+        uint32_t size = 0; // 最多能存放的实例数量
+        bool inUse = false;
+    };
+
     struct ZXD3D12RenderBuffer
     {
         vector<uint32_t> renderBuffers;
@@ -19,7 +19,7 @@ namespace ZXEngine
 		ZXD3D12DescriptorHandle handle;
 		handle.heapType = mHeapType;
 
-		// ҵһпλõѣͬʱ¼λ
+		// 找到第一个有空余位置的描述符堆，同时录这个空余位置
 		for (size_t i = 0; i < mDescriptorHeaps.size(); i++)
 		{
 			if (mDescriptorHeaps[i]->availableNum > 0)
@@ -31,7 +31,7 @@ namespace ZXEngine
 			}
 		}
 
-		// ûҵʹһµ
+		// 如果没有找到，就创建一个新的描述符堆
 		if (zxDescriptorHeap == nullptr)
 		{
 			CreateNewHeap();
@@ -48,7 +48,7 @@ namespace ZXEngine
 		ZXD3D12DescriptorHeap* zxDescriptorHeap = nullptr;
 		auto handle = GetNextDescriptorHeapAndHandle(zxDescriptorHeap);
 
-		// Sampler
+		// 创建Sampler
 		auto renderAPI = static_cast<RenderAPID3D12*>(RenderAPI::GetInstance());
 		CD3DX12_CPU_DESCRIPTOR_HANDLE descriptorHandle(zxDescriptorHeap->descriptorHeap->GetCPUDescriptorHandleForHeapStart());
 		descriptorHandle.Offset(handle.descriptorIdx, mDescriptorSize);
@@ -65,7 +65,7 @@ namespace ZXEngine
 		ZXD3D12DescriptorHeap* zxDescriptorHeap = nullptr;
 		auto handle = GetNextDescriptorHeapAndHandle(zxDescriptorHeap);
 
-		// CBV
+		// 创建CBV
 		auto renderAPI = static_cast<RenderAPID3D12*>(RenderAPI::GetInstance());
 		CD3DX12_CPU_DESCRIPTOR_HANDLE descriptorHandle(zxDescriptorHeap->descriptorHeap->GetCPUDescriptorHandleForHeapStart());
 		descriptorHandle.Offset(handle.descriptorIdx, mDescriptorSize);
@@ -82,7 +82,7 @@ namespace ZXEngine
 		ZXD3D12DescriptorHeap* zxDescriptorHeap = nullptr;
 		auto handle = GetNextDescriptorHeapAndHandle(zxDescriptorHeap);
 
-		// RTV
+		// 创建RTV
 		auto renderAPI = static_cast<RenderAPID3D12*>(RenderAPI::GetInstance());
 		CD3DX12_CPU_DESCRIPTOR_HANDLE descriptorHandle(zxDescriptorHeap->descriptorHeap->GetCPUDescriptorHandleForHeapStart());
 		descriptorHandle.Offset(handle.descriptorIdx, mDescriptorSize);
@@ -99,7 +99,7 @@ namespace ZXEngine
 		ZXD3D12DescriptorHeap* zxDescriptorHeap = nullptr;
 		auto handle = GetNextDescriptorHeapAndHandle(zxDescriptorHeap);
 
-		// DSV
+		// 创建DSV
 		auto renderAPI = static_cast<RenderAPID3D12*>(RenderAPI::GetInstance());
 		CD3DX12_CPU_DESCRIPTOR_HANDLE descriptorHandle(zxDescriptorHeap->descriptorHeap->GetCPUDescriptorHandleForHeapStart());
 		descriptorHandle.Offset(handle.descriptorIdx, mDescriptorSize);
@@ -116,7 +116,7 @@ namespace ZXEngine
 		ZXD3D12DescriptorHeap* zxDescriptorHeap = nullptr;
 		auto handle = GetNextDescriptorHeapAndHandle(zxDescriptorHeap);
 
-		// SRV
+		// 创建SRV
 		auto renderAPI = static_cast<RenderAPID3D12*>(RenderAPI::GetInstance());
 		CD3DX12_CPU_DESCRIPTOR_HANDLE descriptorHandle(zxDescriptorHeap->descriptorHeap->GetCPUDescriptorHandleForHeapStart());
 		descriptorHandle.Offset(handle.descriptorIdx, mDescriptorSize);
@@ -6,18 +6,18 @@ namespace ZXEngine
 {
 	struct ZXD3D12DescriptorHeap
 	{
-		// ǰʣ
+		// 当前剩余可用描述符数量
 		UINT availableNum = 0;
-		// е
+		// 描述符堆中的描述符数量
 		UINT descriptorNum = 0;
-		// ÿǷʹ
+		// 每个描述符是否正在使用
 		vector<bool> inUseState;
-		// 
+		// 描述符堆
 		ComPtr<ID3D12DescriptorHeap> descriptorHeap;
 	};
 
 	/// <summary>
-	/// ฺΪmHeapTypeCPUѣд͵CPUͳһ
+	/// 此类负责管理类型为mHeapType的CPU描述符堆，所有此类型的CPU描述符都在这里统一分配和销毁
 	/// </summary>
 	class ZXD3D12DescriptorAllocator
 	{
@@ -6,8 +6,8 @@
 namespace ZXEngine
 {
 	/// <summary>
-	/// ฺṩͷŽӿڣڲ˷ֱӦ4͵4ZXD3D12DescriptorAllocator
-	/// ڲеCPUGPUֻҪõʱCPUCopyȥ
+	/// 此类负责对外提供描述符创建和释放接口，内部管理了分别对应4种描述符堆类型的4个ZXD3D12DescriptorAllocator
+	/// 内部管理了所有的CPU描述符，GPU描述符只在需要用到的时候从这里的CPU描述符Copy过去
 	/// </summary>
 	class ZXD3D12DescriptorManager
 	{
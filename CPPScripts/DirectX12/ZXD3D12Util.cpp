@@ -23,7 +23,7 @@ namespace ZXEngine
 		string hlslPath = TranslateShaderToHLSL(path, stageFlags);
 		string outputPath = hlslPath.substr(0, hlslPath.length() - 5);
 
-		// ΢ĹԤhlsl
+		// 用微软的工具预编译hlsl代码
 		// VS
 		string command = "..\\..\\..\\Tools\\fxc.exe /T vs_5_1 /E VS /Fo " + Utils::ConvertPathToWindowsFormat(outputPath + ".vert.fxc") + " " + Utils::ConvertPathToWindowsFormat(hlslPath);
 		std::system(command.c_str());
@@ -37,7 +37,7 @@ namespace ZXEngine
 			std::system(command.c_str());
 		}
 
-		// ɾʱļ
+		// 删除临时文件
 		if (!ProjectSetting::preserveIntermediateShader)
 			if (!(std::remove(hlslPath.c_str()) == 0))
 				Debug::LogError("Remove temporary HLSL file failed: " + path.string());
@@ -107,10 +107,10 @@ namespace ZXEngine
 	{
 		FBOManager::GetInstance()->SwitchFBO("AssetPreview");
 		auto renderAPI = RenderAPI::GetInstance();
-		// ViewPortSizeƫǻڵǰFBOǻڵǰĽ̴ڣһҪ
+		// ViewPort的Size和偏移量是基于当前的FBO，而不是基于当前的进程窗口，这一点很重要
 		renderAPI->SetViewPort(previewSize, previewSize);
 		renderAPI->SetRenderState(renderState);
-		// һ֡ݣˢ±ɫ
+		// 清理上一帧数据，刷新背景颜色
 		renderAPI->ClearFrameBuffer();
 
 		auto curAsset = EditorDataManager::GetInstance()->selectedAsset;
@@ -152,7 +152,7 @@ namespace ZXEngine
 		engineProperties->matP = mat_P;
 		engineProperties->matM_Inv = Math::Inverse(mat_M);
 
-		// ̶ģ⻷
+		// 固定参数模拟环境
 		engineProperties->camPos = camera->GetTransform()->GetPosition();
 		engineProperties->lightPos = Vector3(10.0f, 10.0f, -10.0f);
 		engineProperties->lightDir = Vector3(1.0f, 1.0f, -1.0f).GetNormalized();
@@ -217,7 +217,7 @@ namespace ZXEngine
 		scale = standardSize / size;
 		minScale = scale * 0.1f;
 		maxScale = scale * 10.0f;
-		// жȣòͬСģٶȵָһֱ
+		// 调整缩放敏感度，让不同大小的模型缩放速度的手感一直
 		scaleSensitivity = scale * standardScaleSensitivity;
 	}
 
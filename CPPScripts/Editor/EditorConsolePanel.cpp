@@ -14,11 +14,11 @@ namespace ZXEngine
 
 	void EditorConsolePanel::DrawPanel()
 	{
-		// Сλ
+		// 面板大小和位置
 		ImGui::SetNextWindowPos(ImVec2((float)ProjectSetting::projectWidth, (float)ProjectSetting::mainBarHeight + (float)ProjectSetting::hierarchyHeight));
 		ImGui::SetNextWindowSize(ImVec2((float)ProjectSetting::consoleWidth, (float)ProjectSetting::consoleHeight));
 
-		// 
+		// 设置面板具体内容
 		ImGui::Begin("Console", NULL, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize);
 		{
 			auto EditorData = EditorDataManager::GetInstance();
@@ -57,7 +57,7 @@ namespace ZXEngine
 				if (log == nullptr)
 					break;
 			}
-			// Ĭײ
+			// 默认拉到最底部
 			if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
 				ImGui::SetScrollHereY(1.0f);
 			ImGui::EndChild();
@@ -87,10 +87,10 @@ namespace ZXEngine
 		long long dt = curTime - lastClickTime;
 		lastClickTime = curTime;
 
-		// ͬһAsset
+		// 点击同一个Asset
 		if (selectedAsset == asset)
 		{
-			// ʱС300msΪ˫
+			// 如果间隔时间小于300ms，则认为是双击
 			if (dt < 300000)
 			{
 
@@ -110,7 +110,7 @@ namespace ZXEngine
 				}
 			}
 
-			// Ƿ˫Ҫִк(µǰѡԴ)
+			// 无论是否双击，都不需要继续执行后续代码(更新当前选中资源)
 			return;
 		}
 
@@ -213,7 +213,7 @@ namespace ZXEngine
 	{
 		if (curAssetInfo != nullptr)
 		{
-			// deleteһAssetInfoʱҪȰָӳɶӦͣȷȷڴȷͷ
+			// delete上一个AssetInfo的时候需要先把指针映射成对应类型，才能正确调用析构函数，确保内存正确释放
 			if (selectedAsset->type == AssetType::Script)
 				delete static_cast<AssetScriptInfo*>(curAssetInfo);
 			else if (selectedAsset->type == AssetType::Shader ||
@@ -230,7 +230,7 @@ namespace ZXEngine
 				delete static_cast<AssetAudioInfo*>(curAssetInfo);
 			else
 				delete curAssetInfo;
-			// delete¸ֵΪnullptrֹdeleteָ޷ԤڵΪֱӱ
+			// delete后立刻重新赋值为nullptr，防止连续delete指针出现无法预期的行为导致直接崩溃
 			curAssetInfo = nullptr;
 #ifdef ZX_EDITOR
 			Resources::ClearEditorAsyncLoad();
@@ -33,22 +33,22 @@ namespace ZXEngine
 		ImGuiIO& io = ImGui::GetIO();
 		ImGuiStyle& style = ImGui::GetStyle();
 
-		// ھ
+		// 窗口居中
 		ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x * 0.5f, io.DisplaySize.y * 0.5f), ImGuiCond_Always, ImVec2(0.5f, 0.5f));
 
-		// ()
+		// 标题(居中)
 		style.WindowTitleAlign.x = 0.5f;
 		ImGui::Begin(msg.title.c_str(), 0, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoCollapse);
 		style.WindowTitleAlign.x = 0.0f;
 
-		// 
+		// 内容
 		string str = "\n" + msg.content + "\n\n";
 		ImGui::Text(str.c_str());
 
-		// ť()
+		// 按钮(居中)
 		float size = ImGui::CalcTextSize("OK").x + style.FramePadding.x * 2.0f;
 		float avail = ImGui::GetContentRegionAvail().x;
-		float off = (avail - size) * 0.5f; // 0.5f, 
+		float off = (avail - size) * 0.5f; // 0.5f, 即居中
 		if (off > 0.0f)
 			ImGui::SetCursorPosX(ImGui::GetCursorPosX() + off);
 
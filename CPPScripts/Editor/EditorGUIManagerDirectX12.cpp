@@ -38,7 +38,7 @@ namespace ZXEngine
 
 	void EditorGUIManagerDirectX12::Init()
 	{
-		// InspectorĻҪHierarchyProject棬ΪInspector
+		// Inspector的绘制要放在Hierarchy和Project后面，因为这两个面板会决定Inspector的内容
 		allPanels.push_back(new EditorProjectPanel());
 		allPanels.push_back(new EditorMainBarPanel());
 		allPanels.push_back(new EditorHierarchyPanel());
@@ -120,7 +120,7 @@ namespace ZXEngine
 
 		ImGui_ImplWin32_Init(static_cast<HWND>(WindowManager::GetInstance()->GetWindow()));
 
-		// ﴴѣһǹ̶ImGuiıTextureõģʣµǸͼƬȾõ
+		// 这里创建的描述符堆，第一个描述符是固定给ImGui的文本Texture用的，剩下的是给图片渲染用的
 		D3D12_DESCRIPTOR_HEAP_DESC desc = {};
 		desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
 		desc.NumDescriptors = maxDescriptorNum;
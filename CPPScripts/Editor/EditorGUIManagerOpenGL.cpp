@@ -32,7 +32,7 @@ namespace ZXEngine
 
 	void EditorGUIManagerOpenGL::Init()
 	{
-		// InspectorĻҪHierarchyProject棬ΪInspector
+		// Inspector的绘制要放在Hierarchy和Project后面，因为这两个面板会决定Inspector的内容
 		allPanels.push_back(new EditorProjectPanel());
 		allPanels.push_back(new EditorMainBarPanel());
 		allPanels.push_back(new EditorHierarchyPanel());
@@ -11,7 +11,7 @@
 #include "../External/ImGui/imgui_impl_glfw.h"
 #include "../External/ImGui/imgui_impl_vulkan.h"
 
-// VulkanImGuiȽ鷳ο̳: https://frguthmann.github.io/posts/vulkan_imgui/
+// Vulkan的ImGui接入比较麻烦，参考教程: https://frguthmann.github.io/posts/vulkan_imgui/
 static int g_MinImageCount = 2;
 static VkDescriptorPool g_DescriptorPool = VK_NULL_HANDLE;
 static VkRenderPass g_RenderPass = VK_NULL_HANDLE;
@@ -55,7 +55,7 @@ namespace ZXEngine
 
 	void EditorGUIManagerVulkan::Init()
 	{
-		// InspectorĻҪHierarchyProject棬ΪInspector
+		// Inspector的绘制要放在Hierarchy和Project后面，因为这两个面板会决定Inspector的内容
 		allPanels.push_back(new EditorProjectPanel());
 		allPanels.push_back(new EditorMainBarPanel());
 		allPanels.push_back(new EditorHierarchyPanel());
@@ -106,7 +106,7 @@ namespace ZXEngine
 	{
 		auto renderAPI = reinterpret_cast<RenderAPIVulkan*>(RenderAPI::GetInstance());
 
-		// һרõDescriptorPool
+		// 创建一个专用的DescriptorPool
 		{
 			VkDescriptorPoolSize pool_sizes[] =
 			{
@@ -132,7 +132,7 @@ namespace ZXEngine
 			check_vk_result(err);
 		}
 
-		// һרõRenderPass
+		// 创建一个专用的RenderPass
 		{
 			VkAttachmentDescription colorAttachment = {};
 			colorAttachment.format = renderAPI->swapChainImageFormat;
@@ -173,7 +173,7 @@ namespace ZXEngine
 				throw std::runtime_error("Could not create Dear ImGui's render pass");
 		}
 
-		// רõFrameBuffer
+		// 创建专用的FrameBuffer
 		{
 			g_FrameBuffers.resize(renderAPI->swapChainImageViews.size());
 			for (size_t i = 0; i < renderAPI->swapChainImageViews.size(); i++)
@@ -192,7 +192,7 @@ namespace ZXEngine
 			}
 		}
 
-		// һרõCommandPool
+		// 创建一个专用的CommandPool
 		{
 			VkCommandPoolCreateInfo commandPoolCreateInfo = {};
 			commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -203,7 +203,7 @@ namespace ZXEngine
 				throw std::runtime_error("Could not create graphics command pool");
 		}
 
-		// רõCommandBuffer
+		// 创建专用的CommandBuffer
 		{
 			g_CommandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
 
@@ -217,7 +217,7 @@ namespace ZXEngine
 				throw std::runtime_error("failed to allocate command buffers!");
 		}
 
-		// ȾɵVkSemaphore
+		// 渲染完成的VkSemaphore
 		{
 			g_RenderFinishSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
 
@@ -230,14 +230,14 @@ namespace ZXEngine
 			}
 		}
 
-		// ڵImGui_ImplVulkan_InitʼVulkanImGui֮ǰȵӿڣImGuiһԼVulkanĺ
-		// ʵԲҪһģΪImGuiĻֻõVulkanCoreVulkanCoreҪֶ
-		// ҪʹVulkan׷ҪչVulkanչĺȻvulkan.hͷļЩûֱӼغ
-		// ҪԼȥغ(󶨺ָ)˼Ӱ˻VulkanImGui
-		// ȻVulkanImGuiȾҪκչΪҪԼVulkanˣҲҪImGuiһImGuiȥVulkanַ
+		// 在调用ImGui_ImplVulkan_Init初始化基于Vulkan的ImGui之前，先调用这个接口，给ImGui一个可以加载Vulkan函数的函数
+		// 其实本来可以不需要这一步的，因为ImGui的绘制只会用到Vulkan的Core函数，而Vulkan的Core函数不需要我们手动加载
+		// 但是如果我们要使用Vulkan光追，就要启用相关扩展，而Vulkan扩展的函数虽然在vulkan.h的头文件里，但是这些函数并没有直接加载好
+		// 需要我们自己去加载函数(绑定函数指针)，所以因此间接影响了基于Vulkan的ImGui
+		// 虽然基于Vulkan的ImGui渲染并不需要任何扩展，但是因为我们要自己加载所有Vulkan函数了，就也需要给ImGui传递一个函数，让ImGui去找Vulkan函数地址
 		ImGui_ImplVulkan_LoadFunctions([](const char* name, void*) { return vkGetInstanceProcAddr(volkGetLoadedInstance(), name); });
 
-		// ʼVulkan汾ImGUI
+		// 初始化Vulkan版本的ImGUI
 		ImGui_ImplGlfw_InitForVulkan(static_cast<GLFWwindow*>(WindowManager::GetInstance()->GetWindow()), true);
 		ImGui_ImplVulkan_InitInfo init_info = {};
 		init_info.Instance = renderAPI->vkInstance;
@@ -255,7 +255,7 @@ namespace ZXEngine
 		init_info.CheckVkResultFn = check_vk_result;
 		ImGui_ImplVulkan_Init(&init_info, g_RenderPass);
 
-		// ʼ
+		// 初始化字体
 		renderAPI->ImmediatelyExecute([=](VkCommandBuffer cmd) { ImGui_ImplVulkan_CreateFontsTexture(cmd); });
 	}
 
@@ -288,7 +288,7 @@ namespace ZXEngine
 		err = vkEndCommandBuffer(commandBuffer);
 		check_vk_result(err);
 
-		// ύCommandBuffer
+		// 提交CommandBuffer
 		vector<VkPipelineStageFlags> waitStages = {};
 		waitStages.resize(renderAPI->curWaitSemaphores.size(), VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT);
 		VkSubmitInfo submitInfo = {};
@@ -8,11 +8,11 @@ namespace ZXEngine
 {
 	void EditorHierarchyPanel::DrawPanel()
 	{
-		// Сλ
+		// 面板大小和位置
 		ImGui::SetNextWindowPos(ImVec2(0, (float)ProjectSetting::mainBarHeight));
 		ImGui::SetNextWindowSize(ImVec2((float)ProjectSetting::hierarchyWidth, (float)ProjectSetting::hierarchyHeight));
 
-		// 
+		// 设置面板具体内容
 		if (ImGui::Begin("Hierarchy", NULL, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize))
 		{
 			nodeIdx = 0;
@@ -38,7 +38,7 @@ namespace ZXEngine
 
 		if (gameObject->children.size() == 0)
 		{
-			// Ҷӽڵ
+			// 叶子节点
 			nodeFlags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 			ImGui::TreeNodeEx((void*)(intptr_t)nodeIdx, nodeFlags, gameObject->name.c_str());
 			if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
@@ -49,7 +49,7 @@ namespace ZXEngine
 		}
 		else
 		{
-			// мڵ
+			// 中间节点
 			bool nodeOpen = ImGui::TreeNodeEx((void*)(intptr_t)nodeIdx, nodeFlags, gameObject->name.c_str());
 			if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
 			{
@@ -31,7 +31,7 @@ namespace ZXEngine
 
 		if (CheckCurMousePos() == EditorAreaType::AssetPreview)
 		{
-			// Preview༭ק״̬
+			// Preview区域按下鼠标左键进入编辑器的拖拽状态
 			if (ImGui::IsMouseDown(0))
 				isDragging = true;
 		}
@@ -39,10 +39,10 @@ namespace ZXEngine
 		if (isDragging)
 		{
 			ImGuiIO& io = ImGui::GetIO();
-			// ק״̬תԤģ
+			// 拖拽状态下旋转预览模型
 			EditorGUIManager::GetInstance()->assetPreviewer->UpdateModelRotation(io.MouseDelta.x, io.MouseDelta.y);
 
-			// ק״̬ɿ˳ק״̬
+			// 拖拽状态下松开鼠标左键退出拖拽状态
 			if (!ImGui::IsMouseDown(0))
 				isDragging = false;
 		}
@@ -66,13 +66,13 @@ namespace ZXEngine
 
 	bool EditorInputManager::IsProcessGameInput()
 	{
-		// ǰδڱ༭ק״̬걻ϷߵǰλϷڣҪϷ
+		// 如果当前未处于编辑器拖拽状态，并且鼠标被游戏捕获或者当前位置在游戏画面区域内，则需要处理游戏输入
 		return !isDragging && (!InputManager::GetInstance()->IsShowCursor() || CheckCurMousePos() == EditorAreaType::Game);
 	}
 
 	void EditorInputManager::UpdateMouseScroll(float xOffset, float yOffset)
 	{
-		// ༭ͳһImGuiIOģImGuiIOMouseWheelҪImGui::BeginEnd֮òЧ
+		// 本来编辑器的输入是想统一用ImGuiIO的，但是ImGuiIO的MouseWheel必须要在ImGui::Begin和End之间调用才能生效
 		if (CheckCurMousePos() == EditorAreaType::AssetPreview)
 			EditorGUIManager::GetInstance()->assetPreviewer->UpdateModelScale(yOffset);
 	}
@@ -18,14 +18,14 @@ namespace ZXEngine
 		~EditorInputManager() {};
 
 		void Update();
-		// жϵǰ
+		// 判断当前鼠标所在区域
 		EditorAreaType CheckCurMousePos();
-		// ǰǷϷ
+		// 当前是否处理游戏输入
 		bool IsProcessGameInput();
 		void UpdateMouseScroll(float xOffset, float yOffset);
 
 	private:
-		// Ƿק״̬
+		// 是否处于拖拽状态
 		bool isDragging = false;
 	};
 }
\ No newline at end of file
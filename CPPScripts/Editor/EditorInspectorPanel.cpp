@@ -22,11 +22,11 @@ namespace ZXEngine
 {
 	void EditorInspectorPanel::DrawPanel()
 	{
-		// Сλ
+		// 面板大小和位置
 		ImGui::SetNextWindowPos(ImVec2((float)ProjectSetting::hierarchyWidth + (float)GlobalData::srcWidth, (float)ProjectSetting::mainBarHeight));
 		ImGui::SetNextWindowSize(ImVec2((float)ProjectSetting::inspectorWidth, (float)ProjectSetting::inspectorHeight));
 
-		// 
+		// 设置面板具体内容
 		if (ImGui::Begin("Inspector", NULL, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize))
 		{
 			auto curGO = EditorDataManager::GetInstance()->selectedGO;
@@ -806,6 +806,21 @@ namespace ZXEngine
 		const string& avatarName = component->mAvatarName;
 		ImGui::Text("Avatar           ");
 		ImGui::SameLine(); ImGui::Text(avatarName.c_str());
+
+		// LOD Distance
+		float reducedLODDistance = component->mReducedLODDistance;
+		ImGui::Text("Reduced Distance ");
+		ImGui::SameLine(); ImGui::DragFloat("##reducedLODDistance", &reducedLODDistance, 0.1f, 0.0f, FLT_MAX);
+
+		// Offscreen Update Interval
+		int offscreenUpdateInterval = static_cast<int>(component->mOffscreenUpdateInterval);
+		ImGui::Text("Offscreen Frames ");
+		ImGui::SameLine(); ImGui::DragInt("##offscreenUpdateInterval", &offscreenUpdateInterval, 1.0f, 0, INT_MAX);
+
+		// Current LOD
+		static const char* lodNames[] = { "Full", "Reduced", "Offscreen", "Skipped" };
+		ImGui::Text("Current LOD      ");
+		ImGui::SameLine(); ImGui::Text(lodNames[static_cast<int>(component->mCurLOD)]);
 	}
 
 	void EditorInspectorPanel::DrawSpringJoint(SpringJoint* component)
@@ -24,11 +24,11 @@ namespace ZXEngine
 
 	void EditorMainBarPanel::DrawPanel()
 	{
-		// Сλ
+		// 面板大小和位置
 		ImGui::SetNextWindowPos(ImVec2(0, 0));
 		ImGui::SetNextWindowSize(ImVec2((float)ProjectSetting::mainBarWidth, (float)ProjectSetting::mainBarHeight));
 
-		// 
+		// 设置面板具体内容
 		if (ImGui::Begin("ZXEngine", NULL, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_MenuBar))
 		{
 			if (ImGui::BeginMenuBar())
@@ -100,11 +100,11 @@ namespace ZXEngine
 				ImGui::EndMenuBar();
 			}
 
-			// 3ťҵĿ
+			// 3个按钮从左到右的宽度
 			float threeButtonSize = 80.0f;
 			float avail = ImGui::GetContentRegionAvail().x;
 			float offset = (avail - threeButtonSize) * 0.5f;
-			// 3ťҪеĻһťʼλ
+			// 计算3个按钮要居中的话，第一个按钮的起始位置
 			ImGui::SetCursorPosX(ImGui::GetCursorPosX() + offset);
 
 			bool isPop = false;
@@ -117,7 +117,7 @@ namespace ZXEngine
 			}
 			if (ImGui::Button(">>", buttonSize))
 			{
-				// صϷеʱͣť
+				// 关掉游戏运行的时候，重置暂停按钮
 				if (EditorDataManager::isGameStart)
 				{
 					Time::curTime = 0.0f;
@@ -3,16 +3,16 @@
 
 namespace ZXEngine
 {
-	// Projectεļ
+	// 在Project面板中屏蔽的文件类型
 	unordered_set<string> ignoreExtensions = 
 	{ 
-		// ɵHLSL
+		// 生成的HLSL代码
 		".hlsl",
-		// ԤD3D12 Shader
+		// 预编译的D3D12 Shader
 		".fxc",
-		// ɵGLSL
+		// 生成的GLSL代码
 		".vert", ".frag", ".geom",
-		// ԤVulkan Shader
+		// 预编译的Vulkan Shader
 		".spv",
 	};
 
@@ -32,23 +32,23 @@ namespace ZXEngine
 
 	void EditorProjectPanel::DrawPanel()
 	{
-		// Сλ
+		// 面板大小和位置
 		ImGui::SetNextWindowPos(ImVec2(0, (float)ProjectSetting::mainBarHeight + (float)ProjectSetting::hierarchyHeight));
 		ImGui::SetNextWindowSize(ImVec2((float)ProjectSetting::projectWidth, (float)ProjectSetting::projectHeight));
 
-		// 
+		// 设置面板具体内容
 		ImGui::Begin("Peoject", NULL, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize);
 		{
-			// ¼һ°ťԭɫ
+			// 记录一下按钮原本颜色
 			ImGuiStyle& style = ImGui::GetStyle();
 			ImVec4 btnColor = style.Colors[ImGuiCol_Button];
 			ImVec4 selectBtnColor = ImVec4(btnColor.x - 0.1f, btnColor.y - 0.1f, btnColor.z - 0.1f, 1.0f);
 			ImVec4 textColor = style.Colors[ImGuiCol_Text];
 			ImVec4 selectTextColor = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-			// ǰ·ڵ㣬ǰڵ㲻ļУõǰڵĸڵ
+			// 当前路径节点，如果当前节点不是文件夹，就用当前节点的父节点
 			auto curPathNode = curNode->extension == "" ? curNode : curNode->parent;
 
-			// ·
+			// 绘制路径条
 			ImGui::PushStyleColor(ImGuiCol_Button, style.Colors[ImGuiCol_WindowBg]);
 			auto tmpPathNode = curPathNode;
 			vector<EditorAssetNode*> pathNodes;
@@ -57,14 +57,14 @@ namespace ZXEngine
 				pathNodes.push_back(tmpPathNode);
 				tmpPathNode = tmpPathNode->parent;
 			}
-			// ƣrootǰλ
+			// 倒叙绘制，从root到当前位置
 			for (auto i = pathNodes.size(); i > 0; i--)
 			{
 				ImGui::SameLine(); 
 				if (ImGui::SmallButton(pathNodes[i - 1]->name.c_str()))
 				{
 					SetCurNode(pathNodes[i - 1]);
-					// л·ʱˢѡ״̬
+					// 切换路径的时候刷新选中状态
 					selected = -1;
 				}
 				if (i > 1)
@@ -76,15 +76,15 @@ namespace ZXEngine
 			ImGui::PopStyleColor(1);
 			ImGui::Separator();
 
-			// ǰ·ļ
+			// 当前路径文件数量
 			size_t childNum = curPathNode->children.size();
-			// ǰڵxֵ(ұ߽λ)
+			// 当前窗口的x最大值(右边界位置)
 			float window_visible_x2 = ImGui::GetWindowPos().x + ImGui::GetWindowContentRegionMax().x;
-			// ¼ǰƵһļ
+			// 记录当前绘制的一排文件名
 			vector<string> fileNames;
-			// ǰƵļڵǰһǵڼ
+			// 当前绘制的文件在当前这一行里是第几个
 			int rowIdx = 0;
-			// ¼ǰѡеļڵǰһǵڼ
+			// 记录当前选中的文件在当前这一行里是第几个
 			int curRowIdx = -1;
 			for (size_t i = 0; i < childNum; i++)
 			{
@@ -99,7 +99,7 @@ namespace ZXEngine
 					ImGui::PushStyleColor(ImGuiCol_Button, btnColor);
 				}
 
-				// ǷPopStyleColorûֱдif
+				// 无论是否点击都必须PopStyleColor，所以没有直接写在if中
 				string label = "##File" + to_string(i);
 				auto icon = fileIcons[(int)node->type];
 				bool click = ImGui::ImageButton(label.c_str(), icon.ImGuiID, iconSize);
@@ -110,14 +110,14 @@ namespace ZXEngine
 					SetCurNode(node);
 					if (node->extension == "")
 					{
-						// л·ʱˢѡ״̬
+						// 切换路径的时候刷新选中状态
 						selected = -1;
 						break;
 					}
 				}
 				fileNames.push_back(node->name);
 
-				// Ƿ
+				// 计算是否换行
 				float last_button_x2 = ImGui::GetItemRectMax().x;
 				float next_button_x2 = last_button_x2 + style.ItemSpacing.x + iconSize.x;
 				if (i + 1 < childNum && next_button_x2 < window_visible_x2)
@@ -128,7 +128,7 @@ namespace ZXEngine
 				else
 				{
 					rowIdx = 0;
-					// һļǰȰһеļƳ
+					// 绘制下一行文件前，先把这一行的文件名绘制出来
 					for (size_t j = 0; j < fileNames.size(); j++)
 					{
 						if (j > 0)
@@ -167,7 +167,7 @@ namespace ZXEngine
 		for (const auto& entry : filesystem::directory_iterator(node->path))
 		{
 			string extension = entry.path().filename().extension().string();
-			// ǺԵļͣ
+			// 如果是忽略的文件类型，就跳过
 			if (ignoreExtensions.find(extension) != ignoreExtensions.end())
 				continue;
 
@@ -178,20 +178,20 @@ namespace ZXEngine
 			child->extension = extension;
 			child->size = static_cast<uint32_t>(entry.file_size());
 			child->type = GetAssetType(child->extension);
-			// ļչ(׺)ȡ
+			// 把文件扩展(后缀名)截取掉
 			child->name = child->name.substr(0, child->name.length() - child->extension.length());
 			node->children.push_back(child);
 
-			// 
+			// 排序
 			std::sort(node->children.begin(), node->children.end(), 
 				[](EditorAssetNode* a, EditorAssetNode* b) 
 				{ 
-					// ļǰ
+					// 文件夹排在前面
 					if (a->extension == "" && b->extension != "")
 						return true;
 					if (a->extension != "" && b->extension == "")
 						return false;
-					// 
+					// 按名字排序
 					return a->name < b->name;
 				}
 			);
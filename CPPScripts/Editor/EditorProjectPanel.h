@@ -14,7 +14,7 @@ namespace ZXEngine
 		virtual void DrawPanel();
 
 	private:
-		// ǰѡеid
+		// 当前选中的id
 		size_t selected = -1;
 		EditorAssetNode* root;
 		EditorAssetNode* curNode;
@@ -25,9 +25,9 @@ namespace ZXEngine
 		void InitAssetType();
 		AssetType GetAssetType(const string& extension);
 
-		// ļС
+		// 文件名大小
 		const ImVec2 nameSize = ImVec2(72.0f, 20.0f);
-		// ļiconС
+		// 文件icon大小
 		const ImVec2 iconSize = ImVec2(64.0f, 64.0f);
 		ImGuiTextureIndex fileIcons[static_cast<size_t>(AssetType::Count)];
 		void InitIcons();
@@ -1,7 +1,7 @@
 #pragma once
 #include "../pubh.h"
 #include "../External/ImGui/imgui.h"
-// ImGuiͼȾ: https://github.com/ocornut/imgui/wiki/Image-Loading-and-Displaying-Examples
+// ImGui图像渲染: https://github.com/ocornut/imgui/wiki/Image-Loading-and-Displaying-Examples
 
 namespace ZXEngine
 {
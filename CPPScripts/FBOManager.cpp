@@ -20,7 +20,7 @@ namespace ZXEngine
 
 	void FBOManager::SwitchFBO(const string& name)
 	{
-		// ֱд뵽ĬϵĻBuffer
+		// 直接写入到默认的屏幕Buffer
 		if (name == ScreenBuffer)
 		{
 #ifdef ZX_EDITOR
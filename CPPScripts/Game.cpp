@@ -10,6 +10,8 @@
 #include "Component/Animator.h"
 #include "Audio/AudioEngine.h"
 #include "Resources.h"
+#include "Concurrent/JobSystem.h"
+#include "PhysZ/RigidBodyStore.h"
 
 #ifdef ZX_EDITOR
 #include "Editor/EditorGUIManager.h"
@@ -35,6 +37,9 @@ namespace ZXEngine
 			std::cout << "ZXEngine launch project: " << path << std::endl;
 		}
 
+		JobSystem::Create();
+		PhysZ::RigidBodyStore::Create();
+
 		EventManager::Create();
 		AudioEngine::Create();
 		RenderEngine::Create();
@@ -49,17 +54,19 @@ namespace ZXEngine
 
 		while (!RenderEngine::GetInstance()->WindowShouldClose())
 		{
-			// ߼
+			// 逻辑
 			Update();
 
-			// Ⱦ
+			// 渲染
 			Render();
 
 #ifdef ZX_DEBUG
-			// 
+			// 调试
 			Debug::Update();
 #endif
 		}
+
+		JobSystem::Destroy();
 	}
 
 	void Game::Update()
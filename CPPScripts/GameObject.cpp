@@ -3,6 +3,9 @@
 #include "ModelUtil.h"
 #include "SceneManager.h"
 #include "ZMesh.h"
+#include "AssetCache.h"
+#include "Animation/AnimationController.h"
+#include "Animation/BlendTree.h"
 
 namespace ZXEngine
 {
@@ -67,6 +70,7 @@ namespace ZXEngine
 	{
 		name = prefab->name;
 		layer = prefab->layer;
+		isStatic = prefab->isStatic;
 		this->parent = parent;
 
 		for (auto& component : prefab->components)
@@ -190,7 +194,7 @@ namespace ZXEngine
 		transform->SetLocalScale(Vector3(data["Scale"][0], data["Scale"][1], data["Scale"][2]));
 	}
 
-	void GameObject::ParseMeshRenderer(json data, const ModelData* pModelData, MaterialStruct* material)
+	void GameObject::ParseMeshRenderer(json data, ModelData* pModelData, MaterialStruct* material)
 	{
 		MeshRenderer* meshRenderer = AddComponent<MeshRenderer>();
 		string p = "";
@@ -217,6 +221,7 @@ namespace ZXEngine
 		{
 			p = Resources::JsonStrToString(data["Mesh"]);
 			meshRenderer->mModelName = Resources::GetAssetName(p);
+			meshRenderer->mMeshSourceID = MeshRenderer::GetMeshSourceID(p);
 
 			for (auto mesh : pModelData->pMeshes)
 			{
@@ -224,15 +229,94 @@ namespace ZXEngine
 			}
 			meshRenderer->SetMeshes(pModelData->pMeshes);
 
+			// 共享的模型由AssetCache管理Mesh的生命周期，每个Renderer持有一个引用
+			if (pModelData->isCached)
+			{
+				meshRenderer->mCachedModel = pModelData;
+				AssetCache::RetainModel(meshRenderer->mCachedModel);
+			}
+
 			if (pModelData->pAnimationController)
 			{
 				Animator* animator = AddComponent<Animator>();
 				animator->mAvatarName = meshRenderer->mModelName + "Avatar";
-				animator->mRootBoneNode = pModelData->pRootBoneNode;
+				animator->mSkeleton = pModelData->pSkeleton;
 				animator->mAnimationController = pModelData->pAnimationController;
-				// Ϊ˷㣬ֱMeshRendererAnimator
+				// 为了方便，这里直接让MeshRenderer和Animator互相引用
 				meshRenderer->mAnimator = animator;
 				animator->mMeshRenderer = meshRenderer;
+
+				// 动画LOD配置，没有配置的项使用默认值
+				uint32_t reducedBoneDepth = ANIMATOR_LOD_REDUCED_BONE_DEPTH;
+				json lodData = data["AnimationLOD"];
+				if (!lodData.is_null())
+				{
+					if (!lodData["ReducedDistance"].is_null())
+						animator->mReducedLODDistance = lodData["ReducedDistance"];
+					if (!lodData["ReducedBoneDepth"].is_null())
+						reducedBoneDepth = lodData["ReducedBoneDepth"];
+					if (!lodData["OffscreenUpdateInterval"].is_null())
+						animator->mOffscreenUpdateInterval = lodData["OffscreenUpdateInterval"];
+				}
+				animator->mAnimationController->SetReducedBoneDepth(reducedBoneDepth);
+
+				// 混合树配置，之后可以像动画一样通过名字播放
+				if (!data["BlendTrees"].is_null())
+				{
+					for (auto& treeData : data["BlendTrees"])
+					{
+						string treeName = treeData["Name"];
+						BlendTreeType treeType = treeData["Type"];
+						string parameterX = treeData["ParameterX"];
+						string parameterY = treeData["ParameterY"].is_null() ? "" : treeData["ParameterY"];
+
+						BlendTree* pBlendTree = animator->mAnimationController->AddBlendTree(treeName, treeType, parameterX, parameterY);
+						if (pBlendTree == nullptr)
+							continue;
+
+						for (auto& childData : treeData["Children"])
+						{
+							string animName = childData["Animation"];
+							Animation* pAnimation = animator->mAnimationController->GetAnimation(animName);
+							if (pAnimation == nullptr)
+							{
+								Debug::LogWarning("Blend tree %s use an non-existing animation: %s", treeName, animName);
+								continue;
+							}
+
+							if (treeType == BlendTreeType::Simple1D)
+								pBlendTree->AddChild(pAnimation, (float)childData["Position"][0]);
+							else
+								pBlendTree->AddChild(pAnimation, Vector2(childData["Position"][0], childData["Position"][1]));
+						}
+
+						// 没有任何可用的动画时混合不出姿势，不添加这个混合树
+						if (pBlendTree->mChildren.empty())
+						{
+							Debug::LogError("Blend tree %s has no valid animation and is ignored", treeName);
+							animator->mAnimationController->RemoveBlendTree(treeName);
+						}
+					}
+				}
+
+				// 动画层配置，基础层是默认存在的，这里配置的层按顺序叠加在基础层上面
+				if (!data["AnimationLayers"].is_null())
+				{
+					for (auto& layerData : data["AnimationLayers"])
+					{
+						AnimationLayerBlendMode blendMode = layerData["BlendMode"];
+						float weight = layerData["Weight"].is_null() ? 1.0f : (float)layerData["Weight"];
+						uint32_t layer = animator->mAnimationController->AddLayer(layerData["Name"], blendMode, weight);
+
+						if (!layerData["BoneMask"].is_null())
+						{
+							vector<string> rootBoneNames;
+							for (auto& boneName : layerData["BoneMask"])
+								rootBoneNames.push_back(boneName);
+							animator->mAnimationController->SetLayerBoneMask(layer, rootBoneNames);
+						}
+					}
+				}
 			}
 		}
 		else
@@ -314,7 +398,7 @@ namespace ZXEngine
 
 		boxCollider->SynchronizeData();
 
-		// øײ͹(ȽRigidBodyٽColliderͻ)
+		// 设置刚体的碰撞体和惯性张量(如果先解析RigidBody再解析Collider就会从这里设置)
 		auto rigidBody = GetComponent<ZRigidBody>();
 		if (rigidBody)
 		{
@@ -340,7 +424,7 @@ namespace ZXEngine
 
 		planeCollider->SynchronizeData();
 
-		// øײ͹(ȽRigidBodyٽColliderͻ)
+		// 设置刚体的碰撞体和惯性张量(如果先解析RigidBody再解析Collider就会从这里设置)
 		auto rigidBody = GetComponent<ZRigidBody>();
 		if (rigidBody)
 		{
@@ -365,7 +449,7 @@ namespace ZXEngine
 
 		sphereCollider->SynchronizeData();
 
-		// øײ͹(ȽRigidBodyٽColliderͻ)
+		// 设置刚体的碰撞体和惯性张量(如果先解析RigidBody再解析Collider就会从这里设置)
 		auto rigidBody = GetComponent<ZRigidBody>();
 		if (rigidBody)
 		{
@@ -381,7 +465,7 @@ namespace ZXEngine
 
 		rigidBody->mUseGravity = data["UseGravity"];
 
-		// ٶ
+		// 添加重力加速度
 		if (rigidBody->mUseGravity)
 		{
 			auto fgGravity = new PhysZ::FGGravity(Vector3(0.0f, -9.8f, 0.0f));
@@ -399,11 +483,11 @@ namespace ZXEngine
 		float angularDamping = data["AngularDamping"];
 		rigidBody->mRigidBody->SetAngularDamping(1.0f - angularDamping);
 
-		// ʼλúת
+		// 初始化刚体的位置和旋转
 		rigidBody->mRigidBody->SetPosition(GetComponent<Transform>()->GetPosition());
 		rigidBody->mRigidBody->SetRotation(GetComponent<Transform>()->GetRotation());
 
-		// øײ͹(ȽColliderٽRigidBodyͻ)
+		// 设置刚体的碰撞体和惯性张量(如果先解析Collider再解析RigidBody就会从这里设置)
 		if (mColliderType == PhysZ::ColliderType::Box)
 		{
 			auto boxCollider = GetComponent<BoxCollider>();
@@ -38,6 +38,8 @@ namespace ZXEngine
 	public:
 		string name;
 		uint32_t layer = 0;
+		// 静态物体在场景加载时参与静态合批
+		bool isStatic = false;
 		GameObject* parent = nullptr;
 		vector<GameObject*> children;
 		PhysZ::ColliderType mColliderType = PhysZ::ColliderType::None;
@@ -63,7 +65,7 @@ namespace ZXEngine
 		vector<std::function<void()>> mConstructionCallBacks;
 
 		void ParseTransform(json data);
-		void ParseMeshRenderer(json data, const ModelData* pModelData, MaterialStruct* material);
+		void ParseMeshRenderer(json data, ModelData* pModelData, MaterialStruct* material);
 		void ParseCamera(json data);
 		void ParseLight(json data);
 		void ParseGameLogic(json data);
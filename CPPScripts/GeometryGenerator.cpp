@@ -75,9 +75,9 @@ namespace ZXEngine
 		vector<Vertex> vertices;
 		vector<uint32_t> indices;
 
-		// 
+		// 顶部顶点
 		Vertex topVertex = { .Position = { 0.0f, +radius, 0.0f }, .TexCoords = { 0.0f, 0.0f }, .Normal = { 0.0f, +1.0f, 0.0f }, .Tangent = { 1.0f, 0.0f, 0.0f } };
-		// ײ
+		// 底部顶点
 		Vertex bottomVertex = { .Position = { 0.0f, -radius, 0.0f }, .TexCoords = { 0.0f, 1.0f }, .Normal = { 0.0f, -1.0f, 0.0f }, .Tangent = { 1.0f, 0.0f, 0.0f } };
 
 		float phiStep = Math::PI / stackCount;
@@ -85,27 +85,27 @@ namespace ZXEngine
 
 		vertices.push_back(topVertex);
 
-		// ÿһ
+		// 遍历球的每一层
 		for (uint32_t i = 1; i < stackCount; i++)
 		{
 			float phi = i * phiStep;
 
-			// 㵱ǰһԲȦĶ
+			// 计算当前这一层圆圈的顶点
 			for (uint32_t j = 0; j <= sliceCount; j++)
 			{
 				float theta = j * thetaStep;
 
 				Vertex v;
 
-				// ϵתѿϵ
+				// 从球坐标系转到笛卡尔坐标系
 				v.Position.x = radius * sinf(phi) * cosf(theta);
 				v.Position.y = radius * cosf(phi);
 				v.Position.z = radius * sinf(phi) * sinf(theta);
 
-				// Ϊϵԭ㣬ֱNormalizeǷ
+				// 因为是球，球心又在坐标系原点，所以坐标直接Normalize就是法线
 				v.Normal = v.Position.GetNormalized();
 
-				// Ƶ
+				// 重新推导切线
 				v.Tangent.x = -radius * sinf(phi) * sinf(theta);
 				v.Tangent.y = 0.0f;
 				v.Tangent.z = +radius * sinf(phi) * cosf(theta);
@@ -120,7 +120,7 @@ namespace ZXEngine
 
 		vertices.push_back(bottomVertex);
 
-		// һȦ㣬һȦǹ̶Ͷ
+		// 计算第一圈顶点，第一圈是固定和顶部顶点相连的
 		for (uint32_t i = 1; i <= sliceCount; i++)
 		{
 			indices.push_back(0);
@@ -128,9 +128,9 @@ namespace ZXEngine
 			indices.push_back(i + 1);
 		}
 
-		// мĸȦ
-		uint32_t baseIndex = 1; // һ()
-		uint32_t ringVertexCount = sliceCount + 1; // ÿһȦĶ
+		// 计算在中间的各圈顶点
+		uint32_t baseIndex = 1; // 跳过第一个顶点(顶部顶点)
+		uint32_t ringVertexCount = sliceCount + 1; // 每一圈的顶点数
 		for (uint32_t i = 0; i < stackCount - 2; i++)
 		{
 			for (uint32_t j = 0; j < sliceCount; j++)
@@ -145,11 +145,11 @@ namespace ZXEngine
 			}
 		}
 
-		// ײ㣬Ҳһ
+		// 底部顶点，也就是最后一个
 		uint32_t bottomIndex = static_cast<uint32_t>(vertices.size()) - 1;
-		// һȦ
+		// 计算最后一圈顶点的起点索引
 		baseIndex = bottomIndex - ringVertexCount;
-		// һȦ͵ײ
+		// 最后一圈顶点和底部顶点相连
 		for (uint32_t i = 0; i < sliceCount; i++)
 		{
 			indices.push_back(bottomIndex);
@@ -162,7 +162,7 @@ namespace ZXEngine
 
 	StaticMesh* GeometryGenerator::CreateSphereTessellation(float radius, uint32_t subdivisionNum)
 	{
-		// дһ20
+		// 先手写一个正20面体
 		const float X = 0.525731f;
 		const float Z = 0.850651f;
 
@@ -192,33 +192,33 @@ namespace ZXEngine
 			10,6,1,  11,9,0,  2,9,11,  5,9,2,   11,7,2
 		};
 
-		// ϸN
+		// 细分N次
 		for (uint32_t i = 0; i < subdivisionNum; i++)
 			Subdivide(vertices, indices);
 
-		// ϸֺĶ
+		// 计算重新细分后的顶点属性
 		for (size_t i = 0; i < vertices.size(); ++i)
 		{
-			// 
+			// 调整法线
 			Vector3 n = vertices[i].Position.GetNormalized();
-			// ݷߺͰ뾶¼λ
+			// 根据法线和半径重新计算位置
 			Vector3 p = radius * n;
 
 			vertices[i].Normal = n;
 			vertices[i].Position = p;
 
-			// λתؽǶ
+			// 把位置转换回角度
 			float theta = atan2f(vertices[i].Position.z, vertices[i].Position.x);
-			// Ƶ02 PI֮
+			// 限制到0到2 PI之间
 			if (theta < 0.0f)
 				theta += Math::PIx2;
 			float phi = acosf(vertices[i].Position.y / radius);
 
-			// ݽǶȼUV
+			// 根据角度计算UV
 			vertices[i].TexCoords.x = theta / Math::PIx2;
 			vertices[i].TexCoords.y = phi / Math::PI;
 
-			// Ƶ
+			// 重新推导切线
 			vertices[i].Tangent.x = -radius * sinf(phi) * sinf(theta);
 			vertices[i].Tangent.y = 0.0f;
 			vertices[i].Tangent.z = +radius * sinf(phi) * cosf(theta);
@@ -233,29 +233,29 @@ namespace ZXEngine
 		vector<Vertex> vertices;
 		vector<uint32_t> indices;
 
-		// ԲϵĶȦ
+		// 圆柱上的顶点圈数
 		uint32_t ringCount = stackCount + 1;
-		// Բÿһĸ߶
+		// 圆柱上每一层的高度
 		float stackHeight = height / stackCount;
-		// ÿһİ뾶
+		// 每一层的半径增量
 		float radiusStep = (topRadius - bottomRadius) / stackCount;
-		// XZƽÿһȦĻ
+		// XZ平面上每一圈的弧度增量
 		float dTheta = Math::PIx2 / sliceCount;
 
-		// ʱڼ
+		// 临时变量，用于计算切线
 		Vector3 bitangent;
-		// µϼÿһȦĶ
+		// 从下到上计算每一圈的顶点
 		for (uint32_t i = 0; i < ringCount; i++)
 		{
 			float y = -0.5f * height + i * stackHeight;
 			float r = bottomRadius + i * radiusStep;
 
-			// 㵱ǰһȦĶ
+			// 计算当前这一圈的顶点
 			for (uint32_t j = 0; j <= sliceCount; j++)
 			{
 				Vertex vertex;
 
-				// ǺֶϢֲ̫Ͳ
+				// 根据三角函数计算各种顶点信息，文字不太好描述就不解释了
 				float c = cosf(j * dTheta);
 				float s = sinf(j * dTheta);
 
@@ -275,10 +275,10 @@ namespace ZXEngine
 			}
 		}
 
-		// ÿһȦĶ(еͬһλãUVͬ2㣬Ҫ+1)
+		// 每一圈的顶点数量(起点和中点在同一个位置，但是UV不同，所以是2个点，这里要+1)
 		uint32_t ringVertexCount = sliceCount + 1;
 
-		// ΪոЩ
+		// 为刚刚那些顶点计算索引，构成三角形
 		for (uint32_t i = 0; i < stackCount; i++)
 		{
 			for (uint32_t j = 0; j < sliceCount; j++)
@@ -293,10 +293,10 @@ namespace ZXEngine
 			}
 		}
 
-		// ʼԲԲ
-		// ¼ǰΪԲʼ
+		// 开始生成圆柱顶部的圆
+		// 记录当前索引，作为顶部圆的起始索引
 		uint32_t baseIndex = static_cast<uint32_t>(vertices.size());
-		// ȻһȦոѾˣΪ˶ԲȦUVȷҪظһȦUVͬĶ
+		// 虽然最顶部一圈顶点刚刚已经算过了，但是为了顶部圆圈的UV正确，这里需要重复生成一圈UV不同的顶点
 		float topY = 0.5f * height;
 		for (uint32_t i = 0; i <= sliceCount; i++)
 		{
@@ -317,7 +317,7 @@ namespace ZXEngine
 			});
 		}
 
-		// Ķ
+		// 顶部中心顶点
 		vertices.push_back({
 			.Position = { 0.0f, topY, 0.0f },
 			.TexCoords = { 0.5f, 0.5f },
@@ -325,7 +325,7 @@ namespace ZXEngine
 			.Tangent = { 1.0f, 0.0f, 0.0f }
 		});
 
-		// Ķ
+		// 顶部中心顶点索引
 		uint32_t topCenterIndex = static_cast<uint32_t>(vertices.size()) - 1;
 
 		for (uint32_t i = 0; i < sliceCount; i++)
@@ -335,7 +335,7 @@ namespace ZXEngine
 			indices.push_back(baseIndex + i + 1);
 		}
 
-		// ʼԲײԲɶԲһ
+		// 开始生成圆柱底部的圆，步骤和生成顶部圆一致
 		baseIndex = static_cast<uint32_t>(vertices.size());
 
 		float bottomY = -0.5f * height;
@@ -402,11 +402,11 @@ namespace ZXEngine
 		float dv = 1.0f / (zSplit - 1);
 
 		vertices.resize(vertexCount);
-		// Ӻǰ
+		// 从后向前
 		for (size_t i = 0; i < zSplit; i++)
 		{
 			float z = halfDepth - i * dz;
-			// 
+			// 从左向右
 			for (size_t j = 0; j < xSplit; j++)
 			{
 				float x = -halfWidth + j * dx;
@@ -435,7 +435,7 @@ namespace ZXEngine
 				indices[k + 4] = (i + 1) * xSplit + j + 1;
 				indices[k + 5] = i * xSplit + j + 1;
 
-				// Ƶ¸ı
+				// 移到下个四边形
 				k += 6;
 			}
 		}
@@ -466,18 +466,18 @@ namespace ZXEngine
 	StaticMesh* GeometryGenerator::CreateScreenQuad()
 	{
 		/*
-		˺һĻıMeshMVP任ֱдNDCݣҪעⲻͬAPINDC
-		APINDCϵ(ﲻÿZ)
+		此函数生成一个覆盖屏幕的四边形Mesh，无需MVP变换，直接手写的NDC顶点数据，所以需要格外注意不同API的NDC差异
+		各API的NDC坐标系如下(这里不用考虑Z轴)：
 		|-----------------------------|
-		| OpenGL  | X | Y |
+		| OpenGL  | X轴向右 | Y轴向上 |
 		|---------|---------|---------|
-		| Vulkan  | X | Y |
+		| Vulkan  | X轴向右 | Y轴向下 |
 		|---------|---------|---------|
-		| DirectX | X | Y |
+		| DirectX | X轴向右 | Y轴向上 |
 		|-----------------------------|
 		*/
 
-		// ı4꣬λDNCֱ޹أҲͼAPI޹أ귶Χ[-1, 1]
+		// 四边形4个顶点坐标，位于DNC，与分辨率无关，也与图形API无关，坐标范围都是[-1, 1]
 		Vector3 points[4] =
 		{
 			Vector3( 1,  1, 0),
@@ -488,16 +488,16 @@ namespace ZXEngine
 
 		/*
 		|---------------------------------------------|
-		| OpenGL  | NDC Y | FrameBuffer Y |
+		| OpenGL  | NDC Y轴向上 | FrameBuffer Y轴向上 |
 		|---------|-------------|---------------------|
-		| Vulkan  | NDC Y | FrameBuffer Y |
+		| Vulkan  | NDC Y轴向下 | FrameBuffer Y轴向下 |
 		|---------|-------------|---------------------|
-		| DirectX | NDC Y | FrameBuffer Y |
+		| DirectX | NDC Y轴向上 | FrameBuffer Y轴向下 |
 		|---------------------------------------------|
 		
-		OpenGLVulkanNDCFrameBufferYͬģDirectXNDCFrameBufferYǷ
-		OpenGLVulkanеĶUVYǶӦģ1Ӧ1-1Ӧ0
-		DirectXжUVYǷģ1Ӧ0-1Ӧ1
+		OpenGL和Vulkan的NDC和FrameBuffer在Y轴是同向的，而DirectX的NDC和FrameBuffer在Y轴是反向的
+		所以在OpenGL和Vulkan中的顶点坐标和UV在Y轴是对应的，即1对应1，-1对应0
+		而在DirectX中顶点坐标和UV在Y轴就是反的，即1对应0，-1对应1
 		*/
 		Vector2 coords[4] =
 		{
@@ -514,9 +514,9 @@ namespace ZXEngine
 #endif
 		};
 
-		// Ķ˳棬ĿǰﶼʱΪͼԪ
-		// ĻıֻXY꣬OpenGLDirectXXYᳯһµģԶ˳һµ
-		// VulkanYAPI෴Զ˳
+		// 这里的顶点索引顺序决定了正反面，目前工程里都是以逆时针为图元正面
+		// 覆盖屏幕的四边形只考虑XY坐标，而OpenGL和DirectX的XY轴朝向是一致的，所以顶点索引顺序是一致的
+		// Vulkan的Y轴和其它来个API相反，所以顶点索引顺序是逆序的
 		vector<uint32_t> indices =
 		{
 #if defined(ZX_API_OPENGL) || defined(ZX_API_D3D12)
@@ -556,22 +556,22 @@ namespace ZXEngine
 
 		vector<uint32_t> indices =
 		{
-			// ǰ
+			// 前
 			7,5,1,
 			3,7,1,
-			// 
+			// 右
 			3,1,0,
 			2,3,0,
-			// 
+			// 后
 			0,4,6,
 			2,0,6,
-			// 
+			// 左
 			5,7,4,
 			7,6,4,
-			// 
+			// 上
 			1,5,0,
 			5,4,0,
-			// 
+			// 下
 			7,3,2,
 			2,6,7
 		};
@@ -636,8 +636,8 @@ namespace ZXEngine
 		// *-----*-----*
 		// v0    m2     v2
 		// 
-		// ֻᰴַʽϸ֣ϸ껹ԭ
-		// ҪƽΣҪͬģͽṹڵм
+		// 这个函数只会按这种方式把三角形细分，但是细分完还是在原来的面上
+		// 如果需要将平面变形，需要按不同几何模型结构，在调用这个函数后自行计算
 
 		vector<Vertex> verticesCopy = vertices;
 		vector<uint32_t> indicesCopy = indices;
@@ -15,9 +15,9 @@ namespace ZXEngine
 		static StaticMesh* CreateCylinder(float topRadius, float bottomRadius, float height, uint32_t sliceCount, uint32_t stackCount);
 		static StaticMesh* CreatePlane(float xLength, float zLength, uint32_t xSplit, uint32_t zSplit);
 		static StaticMesh* CreateQuad(float xLength, float yLength);
-		// Ļľ(λNDC)
+		// 覆盖屏幕的矩形(位于NDC)
 		static StaticMesh* CreateScreenQuad();
-		// 泯ڲĵλ
+		// 面朝内部的单位立方体
 		static StaticMesh* CreateSimpleInwardBox();
 
 		static DynamicMesh* CreateDynamicPlane(float xLength, float zLength, uint32_t xSplit, uint32_t zSplit);
@@ -4,7 +4,7 @@
 #include "../Window/WindowManager.h"
 #include <GLFW/glfw3.h>
 
-// ΪGLFWĺӿ⣬û취ݳԱͨһ
+// 因为GLFW的函数接口问题，没办法传递成员函数，所以这里用普通函数包了一层
 void CursorPosCallback(GLFWwindow* window, double xpos, double ypos);
 void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset);
 
@@ -61,17 +61,17 @@ namespace ZXEngine
 
 	void InputManagerGLFW::UpdateKeyInput()
 	{
-		// 갴
+		// 鼠标按键
 		CheckMouse(GLFW_MOUSE_BUTTON_1, InputButton::MOUSE_BUTTON_1, EventType::MOUSE_BUTTON_1_PRESS);
 		CheckMouse(GLFW_MOUSE_BUTTON_2, InputButton::MOUSE_BUTTON_2, EventType::MOUSE_BUTTON_2_PRESS);
 
-		// 09
+		// 从0到9
 		for (int i = 0; i < 10; i++)
 		{
 			CheckKey(GLFW_KEY_0 + i, InputButton((int)InputButton::KEY_0 + i), EventType((int)EventType::KEY_0_PRESS + i * 3));
 		}
 
-		// AZ
+		// 从A到Z
 		for (int i = 0; i < 26; i++)
 		{
 			CheckKey(GLFW_KEY_A + i, InputButton((int)InputButton::KEY_A + i), EventType((int)EventType::KEY_A_PRESS + i * 3));
@@ -2,7 +2,7 @@
 #include "../EventManager.h"
 #include "../Editor/EditorInputManager.h"
 
-// ֹwindows.hĺ궨maxminӰ쵽ֶͬ
+// 防止windows.h里的宏定义max和min影响到其它库里的相同字段
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
@@ -37,17 +37,17 @@ namespace ZXEngine
 
 	void InputManagerWindows::UpdateKeyInput()
 	{
-		// Ҽ
+		// 鼠标左右键
 		CheckKey(VK_LBUTTON, InputButton::MOUSE_BUTTON_1, EventType::MOUSE_BUTTON_1_PRESS);
 		CheckKey(VK_RBUTTON, InputButton::MOUSE_BUTTON_2, EventType::MOUSE_BUTTON_2_PRESS);
 
-		// 09
+		// 从0到9
 		for (int i = 0; i < 10; i++)
 		{
 			CheckKey(0x30 + i, InputButton((int)InputButton::KEY_0 + i), EventType((int)EventType::KEY_0_PRESS + i * 3));
 		}
 
-		// AZ
+		// 从A到Z
 		for (int i = 0; i < 26; i++)
 		{
 			CheckKey(0x41 + i, InputButton((int)InputButton::KEY_A + i), EventType((int)EventType::KEY_A_PRESS + i * 3));
@@ -90,8 +90,8 @@ namespace ZXEngine
 		if (show == isCursorShow)
 			return;
 
-		// ShowCursorֱӼ򵥵ͨboolʾ΢ڲάһ
-		// trueһξ+1falseһξ-1ڼֵڵ0ʱʾ
+		// ShowCursor这个函数不是直接简单的通过bool控制显示，微软在这个函数内部维护了一个计数器
+		// 用true调一次就+1，false调一次就-1，在计数值大于等于0的时候才显示
 		if (show)
 		{
 			while (::ShowCursor(true) < 0) {};
@@ -108,7 +108,7 @@ namespace ZXEngine
 	{
 		for (int i = 0; i < (int)InputButton::END; i++)
 		{
-			// 0ɿ1
+			// 0代表松开，1代表按下
 			mButtonState[i] = 0;
 		}
 	}
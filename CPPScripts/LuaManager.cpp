@@ -87,23 +87,23 @@ namespace ZXEngine
 	void LuaManager::InitLuaState()
 	{
 		L = luaL_newstate(); /* create state */
-		luaL_openlibs(L);    /* ر׼ */
-		luaL_openMyLibs(L);  /* Զ */
+		luaL_openlibs(L);    /* 加载标准库 */
+		luaL_openMyLibs(L);  /* 加载自定义库 */
 
-		// LuaԴ·package.path
+		// 将内置Lua源码的路径加入package.path
 		lua_getglobal(L, "package");
-		lua_getfield(L, -1, "path");         /* ȡpackage.path */
+		lua_getfield(L, -1, "path");         /* 获取package.path */
 		const char* cur_path = lua_tostring(L, -1);
 		string new_path(cur_path);
 		new_path += ";" + Resources::mBuiltInAssetsPath + "/Scripts/?.lua";
-		lua_pop(L, 1);                       /* ԭpackage.path */
-		lua_pushstring(L, new_path.c_str()); /* ѹµpackage.path */
-		lua_setfield(L, -2, "path");         /* package.pathֵ */
-		lua_pop(L, 1);                       /* package */
+		lua_pop(L, 1);                       /* 弹出原来的package.path */
+		lua_pushstring(L, new_path.c_str()); /* 压入新的package.path */
+		lua_setfield(L, -2, "path");         /* 对package.path赋值 */
+		lua_pop(L, 1);                       /* 弹出package库 */
 
-		// ִLuaű
+		// 执行Lua启动脚本
 		auto suc = luaL_dofile(L, Resources::GetAssetFullPath("Scripts/Init.lua", true).c_str());
-		// ־
+		// 输出错误日志
 		if (suc != LUA_OK)
 			Debug::LogError(lua_tostring(L, -1));
 	}
@@ -116,15 +116,15 @@ namespace ZXEngine
 
 	void LuaManager::CallFunction(const char* table, const char* func, const char* msg, bool self)
 	{
-		// ¼ǰջС
+		// 记录当前栈大小
 		int stack_size = lua_gettop(L);
-		// global tableջ
+		// global table名入栈
 		lua_getglobal(L, table);
-		// ջ
+		// 函数名入栈
 		lua_pushstring(L, func);
-		// ȡfunc
+		// 获取函数func
 		int type = lua_gettable(L, -2);
-		// һû
+		// 检查一下有没有这个函数
 		if (type != LUA_TFUNCTION)
 		{
 			Debug::LogWarning("Called invalid global function: " + (string)func);
@@ -132,18 +132,18 @@ namespace ZXEngine
 		}
 		if (self)
 		{
-			// λ-2λϵtableһ飬ջΪfuncselfӦluaǱߵ:
+			// 把位于-2位置上的table复制一遍，重新入栈，作为调用func的self参数，对应lua那边的:调用
 			lua_pushvalue(L, -2);
 		}
-		// ջ
+		// 参数入栈
 		lua_pushstring(L, msg);
-		// úfunc120ֵ
+		// 调用函数func，1或2个参数，0返回值
 		if (lua_pcall(L, self?2:1, 0, 0) != LUA_OK)
 		{
-			// ʧܴӡ־
+			// 调用失败打印日志
 			Debug::LogError(lua_tostring(L, -1));
 		}
-		// ָջС(Popδջϲ)
+		// 恢复栈大小(Pop掉这段代码在栈上产生的数据)
 		lua_settop(L, stack_size);
 	}
 
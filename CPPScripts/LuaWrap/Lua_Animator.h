@@ -10,11 +10,30 @@ extern "C"
 
 static int Animator_Play(lua_State* L)
 {
-	ZXEngine::Animator** animator = (ZXEngine::Animator**)luaL_checkudata(L, -2, "ZXEngine.Animator");
+	int argc = lua_gettop(L);
+
+	if (argc == 2)
+	{
+		ZXEngine::Animator** animator = (ZXEngine::Animator**)luaL_checkudata(L, -2, "ZXEngine.Animator");
+
+		const char* animationName = lua_tostring(L, -1);
+
+		(*animator)->Play(animationName);
+	}
+	else if (argc == 3)
+	{
+		ZXEngine::Animator** animator = (ZXEngine::Animator**)luaL_checkudata(L, -3, "ZXEngine.Animator");
 
-	const char* animationName = lua_tostring(L, -1);
+		const char* animationName = lua_tostring(L, -2);
 
-	(*animator)->Play(animationName);
+		const char* layerName = lua_tostring(L, -1);
+
+		(*animator)->Play(animationName, layerName);
+	}
+	else
+	{
+		ZXEngine::Debug::LogError("No matched lua warp function to call: ZXEngine::Animator::Play");
+	}
 
 	return 0;
 }
@@ -41,6 +60,18 @@ static int Animator_Switch(lua_State* L)
 
 		(*animator)->Switch(animationName, time);
 	}
+	else if (argc == 4)
+	{
+		ZXEngine::Animator** animator = (ZXEngine::Animator**)luaL_checkudata(L, -4, "ZXEngine.Animator");
+
+		const char* animationName = lua_tostring(L, -3);
+
+		float time = (float)lua_tonumber(L, -2);
+
+		const char* layerName = lua_tostring(L, -1);
+
+		(*animator)->Switch(animationName, time, layerName);
+	}
 	else
 	{
 		ZXEngine::Debug::LogError("No matched lua warp function to call: ZXEngine::Animator::Switch");
@@ -49,6 +80,32 @@ static int Animator_Switch(lua_State* L)
 	return 0;
 }
 
+static int Animator_SetParameter(lua_State* L)
+{
+	ZXEngine::Animator** animator = (ZXEngine::Animator**)luaL_checkudata(L, -3, "ZXEngine.Animator");
+
+	const char* name = lua_tostring(L, -2);
+
+	float value = (float)lua_tonumber(L, -1);
+
+	(*animator)->SetParameter(name, value);
+
+	return 0;
+}
+
+static int Animator_SetLayerWeight(lua_State* L)
+{
+	ZXEngine::Animator** animator = (ZXEngine::Animator**)luaL_checkudata(L, -3, "ZXEngine.Animator");
+
+	const char* layerName = lua_tostring(L, -2);
+
+	float weight = (float)lua_tonumber(L, -1);
+
+	(*animator)->SetLayerWeight(layerName, weight);
+
+	return 0;
+}
+
 static const luaL_Reg Animator_Funcs[] = 
 {
 	{ NULL, NULL }
@@ -56,8 +113,10 @@ static const luaL_Reg Animator_Funcs[] =
 
 static const luaL_Reg Animator_Funcs_Meta[] = 
 {
-	{ "Play",   Animator_Play   },
-	{ "Switch", Animator_Switch },
+	{ "Play",           Animator_Play           },
+	{ "Switch",         Animator_Switch         },
+	{ "SetParameter",   Animator_SetParameter   },
+	{ "SetLayerWeight", Animator_SetLayerWeight },
 	{ NULL, NULL }
 };
 
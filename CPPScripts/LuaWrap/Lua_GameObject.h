@@ -95,13 +95,13 @@ static const luaL_Reg GameObject_Funcs_Meta[] =
 
 LUAMOD_API int luaopen_GameObject(lua_State* L) 
 {
-	// Ԫ
+	// 创建元表
 	luaL_newmetatable(L, "ZXEngine.GameObject");
-	// ԪΪһд׼
+	// 复制元表，为下一行代码调用准备参数
 	lua_pushvalue(L, -1);
-	// mt.__index = mt -2λϵmt(һnewmetatable)__indexֶΪmt(ڶpushvalueƵ)
+	// mt.__index = mt 把-2位置上的mt表(第一行newmetatable的)的__index字段设置为mt(第二行pushvalue复制的)
 	lua_setfield(L, -2, "__index");
-	// עԪ
+	// 注册元方法
 	luaL_setfuncs(L, GameObject_Funcs_Meta, 0);
 
 	luaL_newlib(L, GameObject_Funcs);
@@ -1,6 +1,7 @@
 #include "Material.h"
 #include "ZShader.h"
 #include "Texture.h"
+#include "AssetCache.h"
 #include "RenderAPI.h"
 #include "GlobalData.h"
 #include "MaterialData.h"
@@ -9,10 +10,24 @@
 
 namespace ZXEngine
 {
+	unordered_map<string, uint32_t> Material::mPathToSortID;
+
+	uint32_t Material::GetSortID(const string& path)
+	{
+		auto iter = mPathToSortID.find(path);
+		if (iter != mPathToSortID.end())
+			return iter->second;
+
+		uint32_t id = static_cast<uint32_t>(mPathToSortID.size());
+		mPathToSortID[path] = id;
+		return id;
+	}
+
 	Material::Material(MaterialStruct* matStruct)
 	{
 		name = matStruct->name;
 		path = matStruct->path;
+		sortID = GetSortID(path);
 		isShareShader = false;
 		type = matStruct->type;
 		data = new MaterialData(type);
@@ -28,7 +43,7 @@ namespace ZXEngine
 		else if (type == MaterialType::RayTracing)
 		{
 			hitGroupIdx = matStruct->hitGroupIdx;
-			// ׷ʱҪֶУһĬϵOpaque
+			// 光追管线暂时不需要区分队列，用一个默认的Opaque队列
 			renderQueue = (int)RenderQueueType::Opaque;
 			RenderAPI::GetInstance()->SetUpRayTracingMaterialData(this);
 		}
@@ -36,14 +51,15 @@ namespace ZXEngine
 
 	Material::Material(Shader* shader)
 	{
-		// Ҫעһ⣬캯ʱֱӰnew Shaderдڲģ:
+		// 这里要注意一个问题，如果调用这个构造函数时，是直接把new Shader写在参数里的，如:
 		// new Material(new Shader(...))
-		// ôһ⣬newʱûбãջһdeletereferenceCountٴ1shaderԶᱻ
+		// 那么会有一个问题，new的时候没有保存引用，最终会少一个delete，导致referenceCount至少大于1，这个shader永远不会被正真销毁
 		isShareShader = true;
+		sortID = GetSortID(path);
 		shader->reference->referenceCount++;
 		this->shader = shader;
 		renderQueue = (int)shader->reference->shaderInfo.stateSet.renderQueue;
-		// ͨ캯ʼĲʣĬΪդȾߵĲ
+		// 通过这个构造函数初始化的材质，默认为光栅化渲染管线的材质
 		type = MaterialType::Rasterization;
 		data = new MaterialData(type);
 		RenderAPI::GetInstance()->SetUpMaterial(this);
@@ -117,7 +133,7 @@ namespace ZXEngine
 		}
 		else if (type == ShaderPropertyType::ENGINE_DEPTH_CUBE_MAP)
 		{
-			// SetMaterialPropertiesĳʼtextureIdxȻ++
+			// 先设置SetMaterialProperties获得引擎纹理的初始textureIdx，然后++
 			SetCubeMap(name, engineProperties->shadowCubeMap, textureIdx, false, engineProperties->isShadowCubeMapBuffer);
 			textureIdx++;
 		}
@@ -242,13 +258,13 @@ namespace ZXEngine
 
 		for (auto textureStruct : matStruct->textures)
 		{
-			Texture* texture = new Texture(textureStruct->data);
+			Texture* texture = AssetCache::AcquireTexture(textureStruct);
 			data->textures.push_back(make_pair(textureStruct->uniformName, texture));
 		}
 
 		for (auto cubeMapStruct : matStruct->cubeMaps)
 		{
-			Texture* texture = new Texture(cubeMapStruct->data);
+			Texture* texture = AssetCache::AcquireCubeMap(cubeMapStruct);
 			data->textures.push_back(make_pair(cubeMapStruct->uniformName, texture));
 		}
 	}
@@ -12,12 +12,14 @@ namespace ZXEngine
 		string name = "";
 		string path = "";
 		uint32_t hitGroupIdx = 0;
+		// 相同路径的材质有相同的sortID，用于渲染队列排序和合批
+		uint32_t sortID = 0;
 		Shader* shader = nullptr;
 		MaterialData* data = nullptr;
 		MaterialType type = MaterialType::Rasterization;
 
 		Material(MaterialStruct* matStruct);
-		// ע: ˹캯ڹդȾ߲
+		// 注意: 此构造函数仅用于光栅化渲染管线材质
 		Material(Shader* shader);
 		~Material();
 
@@ -46,7 +48,11 @@ namespace ZXEngine
 		void SetCubeMap(const string& name, uint32_t ID, uint32_t idx, bool allBuffer = false, bool isBuffer = false);
 
 	private:
-		// õShaderǻطãӰ
+		static unordered_map<string, uint32_t> mPathToSortID;
+		static uint32_t GetSortID(const string& path);
+
+	private:
+		// 这个材质引用的Shader是还有其他地方引用，会影响材质销毁流程
 		bool isShareShader;
 		uint32_t textureIdx = 0;
 		int renderQueue = 0;
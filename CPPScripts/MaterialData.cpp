@@ -1,6 +1,7 @@
 #include "MaterialData.h"
 #include "RenderAPI.h"
 #include "Texture.h"
+#include "AssetCache.h"
 
 namespace ZXEngine
 {
@@ -20,7 +21,7 @@ namespace ZXEngine
 		else if (type == MaterialType::RayTracing)
 			RenderAPI::GetInstance()->DeleteRayTracingMaterialData(rtID);
 		for (auto& iter : textures)
-			delete iter.second;
+			AssetCache::ReleaseTexture(iter.second);
 	}
 
 	void MaterialData::Use()
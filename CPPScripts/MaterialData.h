@@ -18,7 +18,7 @@ namespace ZXEngine
 		map<string, Vector4> vec4Datas;
 		vector<pair<string, Texture*>> textures;
 
-		// ׷ʵϢ
+		// 光追材质的数据信息
 		uint32_t rtMaterialDataSize;
 		vector<ShaderProperty> rtMaterialProperties;
 
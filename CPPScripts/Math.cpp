@@ -1,9 +1,82 @@
 #include "pubh.h"
 #include "Math.h"
 #include "Debug.h"
+#include "Math/SIMD.h"
+#include "Concurrent/JobSystem.h"
+
+// 批量变换的数量超过这个值时拆分到JobSystem上并行执行
+#define MATH_BATCH_PARALLEL_MIN_COUNT 16384
+// 并行执行时每个Job处理的数量
+#define MATH_BATCH_JOB_SIZE 4096
 
 namespace ZXEngine
 {
+	// rows是3x4矩阵的前三行，按行主序排列
+	static void TransformVector3Range(const float* rows, const Vector3* in, Vector3* out, size_t begin, size_t end, size_t inStride, size_t outStride)
+	{
+		auto inData = reinterpret_cast<const char*>(in);
+		auto outData = reinterpret_cast<char*>(out);
+		size_t i = begin;
+
+#ifdef ZX_MATH_SSE
+		// 每次处理4个向量，把4个向量的x,y,z分别读到一个寄存器里(SoA)，矩阵的每个元素广播到一个寄存器里
+		// 这样不需要任何水平运算，每个分量只需要3次乘法和3次加法
+		__m128 m00 = _mm_set1_ps(rows[0]), m01 = _mm_set1_ps(rows[1]), m02 = _mm_set1_ps(rows[2]), m03 = _mm_set1_ps(rows[3]);
+		__m128 m10 = _mm_set1_ps(rows[4]), m11 = _mm_set1_ps(rows[5]), m12 = _mm_set1_ps(rows[6]), m13 = _mm_set1_ps(rows[7]);
+		__m128 m20 = _mm_set1_ps(rows[8]), m21 = _mm_set1_ps(rows[9]), m22 = _mm_set1_ps(rows[10]), m23 = _mm_set1_ps(rows[11]);
+
+		for (; i + 4 <= end; i += 4)
+		{
+			auto v0 = reinterpret_cast<const Vector3*>(inData + (i + 0) * inStride);
+			auto v1 = reinterpret_cast<const Vector3*>(inData + (i + 1) * inStride);
+			auto v2 = reinterpret_cast<const Vector3*>(inData + (i + 2) * inStride);
+			auto v3 = reinterpret_cast<const Vector3*>(inData + (i + 3) * inStride);
+
+			__m128 x = _mm_setr_ps(v0->x, v1->x, v2->x, v3->x);
+			__m128 y = _mm_setr_ps(v0->y, v1->y, v2->y, v3->y);
+			__m128 z = _mm_setr_ps(v0->z, v1->z, v2->z, v3->z);
+
+			alignas(16) float rx[4], ry[4], rz[4];
+			_mm_store_ps(rx, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_add_ps(_mm_mul_ps(m02, z), m03)));
+			_mm_store_ps(ry, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m12, z), m13)));
+			_mm_store_ps(rz, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_add_ps(_mm_mul_ps(m22, z), m23)));
+
+			for (size_t j = 0; j < 4; j++)
+			{
+				auto v = reinterpret_cast<Vector3*>(outData + (i + j) * outStride);
+				v->x = rx[j];
+				v->y = ry[j];
+				v->z = rz[j];
+			}
+		}
+#endif
+
+		for (; i < end; i++)
+		{
+			const Vector3 v = *reinterpret_cast<const Vector3*>(inData + i * inStride);
+			auto res = reinterpret_cast<Vector3*>(outData + i * outStride);
+			res->x = rows[0] * v.x + rows[1] * v.y + rows[2]  * v.z + rows[3];
+			res->y = rows[4] * v.x + rows[5] * v.y + rows[6]  * v.z + rows[7];
+			res->z = rows[8] * v.x + rows[9] * v.y + rows[10] * v.z + rows[11];
+		}
+	}
+
+	static void TransformVector3s(const float* rows, const Vector3* in, Vector3* out, size_t count, size_t inStride, size_t outStride)
+	{
+		auto jobSystem = JobSystem::GetInstance();
+		if (jobSystem == nullptr || count < MATH_BATCH_PARALLEL_MIN_COUNT)
+		{
+			TransformVector3Range(rows, in, out, 0, count, inStride, outStride);
+		}
+		else
+		{
+			jobSystem->ParallelFor(static_cast<uint32_t>(count), MATH_BATCH_JOB_SIZE, [=](uint32_t begin, uint32_t end)
+			{
+				TransformVector3Range(rows, in, out, begin, end, inStride, outStride);
+			});
+		}
+	}
+
 	float Math::PI = 3.141592653f;
 	float Math::PIx2 = 6.283185306f;
 	float Math::SQRT2 = 1.414213562f;
@@ -21,12 +94,12 @@ namespace ZXEngine
 
 		float dot = Dot(v1, v2) / (v1Mag * v2Mag);
 
-		// һ
+		// 两个向量几乎一致
 		if (dot > 0.99999f)
 		{
 			return Lerp(v1, v2, t);
 		}
-		// ෴
+		// 两个向量几乎相反
 		else if (dot < -0.99999f)
 		{
 			Vector3 v1Normalized = v1 / v1Mag;
@@ -34,7 +107,7 @@ namespace ZXEngine
 			Matrix3 m(axis, PI * t);
 			return m * v1Normalized * lerpMag;
 		}
-		// һ
+		// 一般情况
 		else
 		{
 			float theta = acos(dot) * t;
@@ -61,7 +134,7 @@ namespace ZXEngine
 		}
 
 		float p1, p2;
-		// ԪǳӽôֱԲֵ
+		// 如果两个四元数非常接近，那么直接线性插值即可
 		if (cosTheta > 0.95f)
 		{
 			p1 = 1.0f - t;
@@ -85,40 +158,40 @@ namespace ZXEngine
 
 	Matrix4 Math::Perspective(float fov, float aspect, float nearClip, float farClip)
 	{
-		// Ĭϵ
+		// 默认用左手坐标系的
 		return PerspectiveLHNO(fov, aspect, nearClip, farClip);
 	}
 
 	Matrix4 Math::PerspectiveLHNO(float fov, float aspect, float nearClip, float farClip)
 	{
-		// οhttps://www.ogldev.org/www/tutorial12/tutorial12.html
+		// 参考：https://www.ogldev.org/www/tutorial12/tutorial12.html
 
-		// һ
+		// 第一行
 		float m00 = 1 / (aspect * tan(fov * 0.5f));
 		float m01 = 0;
 		float m02 = 0;
 		float m03 = 0;
 
-		// ڶ
+		// 第二行
 		float m10 = 0;
 		float m11 = 1 / tan(fov * 0.5f);
 		float m12 = 0;
 		float m13 = 0;
 
-		// 
+		// 第三行
 		float m20 = 0;
 		float m21 = 0;
 		float m22 = (farClip + nearClip) / (farClip - nearClip);
 		float m23 = (2 * farClip * nearClip) / (nearClip - farClip);
 
-		// 
+		// 第四行
 		float m30 = 0;
 		float m31 = 0;
 		float m32 = 1;
 		float m33 = 0;
 
 #ifdef ZX_API_VULKAN
-		// VulkanYҪתһ£ߵ
+		// Vulkan的Y轴要反转一下，否则画面会颠倒
 		m11 *= -1;
 #endif
 
@@ -131,32 +204,32 @@ namespace ZXEngine
 
 	Matrix4 Math::PerspectiveLHZO(float fov, float aspect, float nearClip, float farClip)
 	{
-		// һ
+		// 第一行
 		float m00 = 1 / (aspect * tan(fov * 0.5f));
 		float m01 = 0;
 		float m02 = 0;
 		float m03 = 0;
 
-		// ڶ
+		// 第二行
 		float m10 = 0;
 		float m11 = 1 / tan(fov * 0.5f);
 		float m12 = 0;
 		float m13 = 0;
 
-		// 
+		// 第三行
 		float m20 = 0;
 		float m21 = 0;
 		float m22 = farClip / (farClip - nearClip);
 		float m23 = (farClip * nearClip) / (nearClip - farClip);
 
-		// 
+		// 第四行
 		float m30 = 0;
 		float m31 = 0;
 		float m32 = 1;
 		float m33 = 0;
 
 #ifdef ZX_API_VULKAN
-		// VulkanYҪתһ£ߵ
+		// Vulkan的Y轴要反转一下，否则画面会颠倒
 		m11 *= -1;
 #endif
 
@@ -169,25 +242,25 @@ namespace ZXEngine
 
 	Matrix4 Math::PerspectiveRHNO(float fov, float aspect, float nearClip, float farClip)
 	{
-		// һ
+		// 第一行
 		float m00 = 1 / (aspect * tan(fov * 0.5f));
 		float m01 = 0;
 		float m02 = 0;
 		float m03 = 0;
 
-		// ڶ
+		// 第二行
 		float m10 = 0;
 		float m11 = 1 / tan(fov * 0.5f);
 		float m12 = 0;
 		float m13 = 0;
 
-		// 
+		// 第三行
 		float m20 = 0;
 		float m21 = 0;
 		float m22 = (farClip + nearClip) / (nearClip - farClip);
 		float m23 = (2 * farClip * nearClip) / (nearClip - farClip);
 
-		// 
+		// 第四行
 		float m30 = 0;
 		float m31 = 0;
 		float m32 = -1;
@@ -202,25 +275,25 @@ namespace ZXEngine
 
 	Matrix4 Math::PerspectiveRHZO(float fov, float aspect, float nearClip, float farClip)
 	{
-		// һ
+		// 第一行
 		float m00 = 1 / (aspect * tan(fov * 0.5f));
 		float m01 = 0;
 		float m02 = 0;
 		float m03 = 0;
 
-		// ڶ
+		// 第二行
 		float m10 = 0;
 		float m11 = 1 / tan(fov * 0.5f);
 		float m12 = 0;
 		float m13 = 0;
 
-		// 
+		// 第三行
 		float m20 = 0;
 		float m21 = 0;
 		float m22 = farClip / (nearClip - farClip);
 		float m23 = (farClip * nearClip) / (nearClip - farClip);
 
-		// 
+		// 第四行
 		float m30 = 0;
 		float m31 = 0;
 		float m32 = -1;
@@ -243,7 +316,7 @@ namespace ZXEngine
 		resMat.m13 = (top + bottom) / (bottom - top);
 
 #ifdef ZX_API_VULKAN
-		// VulkanYҪתһ£ߵ
+		// Vulkan的Y轴要反转一下，否则画面会颠倒
 		resMat.m11 *= -1;
 #endif
 
@@ -252,7 +325,7 @@ namespace ZXEngine
 
 	Matrix4 Math::Orthographic(float left, float right, float bottom, float top, float zNear, float zFar)
 	{
-		// Ĭϵ
+		// 默认用左手坐标系的
 		return OrthographicLHZO(left, right, bottom, top, zNear, zFar);
 	}
 
@@ -267,7 +340,7 @@ namespace ZXEngine
 		resMat.m23 = (zFar + zNear) / (zNear - zFar);
 
 #ifdef ZX_API_VULKAN
-		// VulkanYҪתһ£ߵ
+		// Vulkan的Y轴要反转一下，否则画面会颠倒
 		resMat.m11 *= -1;
 #endif
 
@@ -285,7 +358,7 @@ namespace ZXEngine
 		resMat.m23 = zNear / (zNear - zFar);
 
 #ifdef ZX_API_VULKAN
-		// VulkanYҪתһ£ߵ
+		// Vulkan的Y轴要反转一下，否则画面会颠倒
 		resMat.m11 *= -1;
 #endif
 
@@ -368,7 +441,7 @@ namespace ZXEngine
 
 	Matrix3 Math::Inverse(const Matrix3& mat)
 	{
-		// 
+		// 伴随矩阵法
 		float oneOverDeterminant = 1.0f / mat.GetDeterminant();
 
 		Matrix3 resMat = Matrix3();
@@ -389,7 +462,12 @@ namespace ZXEngine
 
 	Matrix4 Math::Inverse(const Matrix4& mat)
 	{
-		// 
+#ifdef ZX_MATH_SSE
+		Matrix4 resMat{ Matrix4::Uninitialized() };
+		MathSIMD::Matrix4Inverse(&mat.m00, &resMat.m00);
+		return resMat;
+#else
+		// 伴随矩阵法
 		float inv00, inv01, inv02, inv03, inv10, inv11, inv12, inv13, inv20, inv21, inv22, inv23, inv30, inv31, inv32, inv33;
 		inv00 =  mat.m11 * mat.m22 * mat.m33 - mat.m11 * mat.m23 * mat.m32 - mat.m21 * mat.m12 * mat.m33 + mat.m21 * mat.m13 * mat.m32 + mat.m31 * mat.m12 * mat.m23 - mat.m31 * mat.m13 * mat.m22;
 		inv10 = -mat.m10 * mat.m22 * mat.m33 + mat.m10 * mat.m23 * mat.m32 + mat.m20 * mat.m12 * mat.m33 - mat.m20 * mat.m13 * mat.m32 - mat.m30 * mat.m12 * mat.m23 + mat.m30 * mat.m13 * mat.m22;
@@ -415,6 +493,7 @@ namespace ZXEngine
 			inv10 * oneOverDeterminant, inv11 * oneOverDeterminant, inv12 * oneOverDeterminant, inv13 * oneOverDeterminant,
 			inv20 * oneOverDeterminant, inv21 * oneOverDeterminant, inv22 * oneOverDeterminant, inv23 * oneOverDeterminant,
 			inv30 * oneOverDeterminant, inv31 * oneOverDeterminant, inv32 * oneOverDeterminant, inv33 * oneOverDeterminant);
+#endif
 	}
 
 	Matrix3 Math::Transpose(const Matrix3& mat)
@@ -427,11 +506,17 @@ namespace ZXEngine
 
 	Matrix4 Math::Transpose(const Matrix4& mat)
 	{
+#ifdef ZX_MATH_SSE
+		Matrix4 resMat{ Matrix4::Uninitialized() };
+		MathSIMD::Matrix4Transpose(&mat.m00, &resMat.m00);
+		return resMat;
+#else
 		return Matrix4(
 			mat.m00, mat.m10, mat.m20, mat.m30,
 			mat.m01, mat.m11, mat.m21, mat.m31,
 			mat.m02, mat.m12, mat.m22, mat.m32,
 			mat.m03, mat.m13, mat.m23, mat.m33);
+#endif
 	}
 
 	Vector2 Math::GetPerpendicular(const Vector2& v)
@@ -445,14 +530,14 @@ namespace ZXEngine
 		{
 			float a = v.y * v.y + v.z * v.z;
 			float k = 1.0f / sqrtf(a);
-			// YZƽ
+			// YZ平面
 			return Vector3(0.0f, -v.z * k, v.y * k);
 		}
 		else
 		{
 			float a = v.x * v.x + v.y * v.y;
 			float k = 1.0f / sqrtf(a);
-			// XYƽ
+			// XY平面
 			return Vector3(-v.y * k, v.x * k, 0.0f);
 		}
 	}
@@ -509,10 +594,10 @@ namespace ZXEngine
 
 	Matrix4 Math::GetLookToMatrix(const Vector3& pos, const Vector3& forward, const Vector3& up)
 	{
-		// ѧUnityõϵupforwardõrightϵ÷
+		// 学Unity用的左手坐标系，up叉乘forward得到right，右手坐标系得反过来
 		Vector3 right = Cross(up, forward);
 
-		// ϵViewforwardӦģϵǸ
+		// 基于左手坐标系构建View矩阵这里的forward应该是正的，右手坐标系是负的
 		Matrix4 viewMat = Matrix4(
 			right.x  , right.y  , right.z  , 0,
 			up.x     , up.y     , up.z     , 0,
@@ -526,4 +611,28 @@ namespace ZXEngine
 		
 		return viewMat * posMat;
 	}
+
+	void Math::TransformPoints(const Matrix4& mat, const Vector3* in, Vector3* out, size_t count, size_t inStride, size_t outStride)
+	{
+		float rows[12] = {
+			mat.m00, mat.m01, mat.m02, mat.m03,
+			mat.m10, mat.m11, mat.m12, mat.m13,
+			mat.m20, mat.m21, mat.m22, mat.m23 };
+		TransformVector3s(rows, in, out, count, inStride, outStride);
+	}
+
+	void Math::TransformDirections(const Matrix4& mat, const Vector3* in, Vector3* out, size_t count, size_t inStride, size_t outStride)
+	{
+		float rows[12] = {
+			mat.m00, mat.m01, mat.m02, 0.0f,
+			mat.m10, mat.m11, mat.m12, 0.0f,
+			mat.m20, mat.m21, mat.m22, 0.0f };
+		TransformVector3s(rows, in, out, count, inStride, outStride);
+	}
+
+	void Math::TransformNormals(const Matrix4& mat, const Vector3* in, Vector3* out, size_t count, size_t inStride, size_t outStride)
+	{
+		Matrix4 mat_IT = Transpose(Inverse(mat));
+		TransformDirections(mat_IT, in, out, count, inStride, outStride);
+	}
 }
\ No newline at end of file
@@ -50,52 +50,62 @@ namespace ZXEngine
 		static Vector3 Slerp(const Vector3& v1, const Vector3& v2, float t);
 		static Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t);
 
-		// ͸ͶӰ
+		// 计算透视投影矩阵
 		static Matrix4 Perspective(float fov, float aspect, float nearClip, float farClip);
-		// ϵZΧ[-1, 1]
+		// 左手坐标系，Z范围[-1, 1]
 		static Matrix4 PerspectiveLHNO(float fov, float aspect, float nearClip, float farClip);
-		// ϵZΧ[0, 1]
+		// 左手坐标系，Z范围[0, 1]
 		static Matrix4 PerspectiveLHZO(float fov, float aspect, float nearClip, float farClip);
-		// ϵZΧ[-1, 1]
+		// 右手坐标系，Z范围[-1, 1]
 		static Matrix4 PerspectiveRHNO(float fov, float aspect, float nearClip, float farClip);
-		// ϵZΧ[0, 1]
+		// 右手坐标系，Z范围[0, 1]
 		static Matrix4 PerspectiveRHZO(float fov, float aspect, float nearClip, float farClip);
 
-		// ͶӰ
+		// 计算正交投影矩阵
 		static Matrix4 Orthographic(float left, float right, float bottom, float top);
 		static Matrix4 Orthographic(float left, float right, float bottom, float top, float zNear, float zFar);
-		// ϵZΧ[-1, 1]
+		// 左手坐标系，Z范围[-1, 1]
 		static Matrix4 OrthographicLHNO(float left, float right, float bottom, float top, float zNear, float zFar);
-		// ϵZΧ[0, 1]
+		// 左手坐标系，Z范围[0, 1]
 		static Matrix4 OrthographicLHZO(float left, float right, float bottom, float top, float zNear, float zFar);
-		// ϵZΧ[-1, 1]
+		// 右手坐标系，Z范围[-1, 1]
 		static Matrix4 OrthographicRHNO(float left, float right, float bottom, float top, float zNear, float zFar);
-		// ϵZΧ[0, 1]
+		// 右手坐标系，Z范围[0, 1]
 		static Matrix4 OrthographicRHZO(float left, float right, float bottom, float top, float zNear, float zFar);
 
-		// λ
+		// 位移
 		static Matrix4 Translate(const Matrix4& oriMat, const Vector3& v);
-		// ת
+		// 旋转
 		static Matrix4 Rotate(const Matrix4& oriMat, float angle, const Vector3& axis);
-		// 
+		// 缩放
 		static Matrix4 Scale(const Matrix4& oriMat, const Vector3& scale);
 
-		// 
+		// 计算逆矩阵
 		static Matrix3 Inverse(const Matrix3& mat);
 		static Matrix4 Inverse(const Matrix4& mat);
-		// תþ
+		// 计算转置矩阵
 		static Matrix3 Transpose(const Matrix3& mat);
 		static Matrix4 Transpose(const Matrix4& mat);
 		
-		// ȡֱ
+		// 获取垂直向量
 		static Vector2 GetPerpendicular(const Vector2& v);
 		static Vector3 GetPerpendicular(const Vector3& v);
-		// ȡֱ
+		// 获取随机垂直向量
 		static Vector2 GetRandomPerpendicular(const Vector2& v);
 		static Vector3 GetRandomPerpendicular(const Vector3& v);
-		// GLMLookAtЧһ
+		// 这个函数和GLM的LookAt函数效果是一样的
 		static Matrix4 GetLookToMatrix(const Vector3& pos, const Vector3& forward, const Vector3& up);
 
+		// 用同一个矩阵批量变换一组向量，只计算矩阵前三行，适用于模型矩阵这类仿射变换
+		// stride是相邻两个元素之间的字节数，可以直接传顶点数组里的某个成员，in和out可以是同一块内存
+		// 数量很多时会拆分到JobSystem上并行执行
+		// 变换点(w = 1)
+		static void TransformPoints(const Matrix4& mat, const Vector3* in, Vector3* out, size_t count, size_t inStride = sizeof(Vector3), size_t outStride = sizeof(Vector3));
+		// 变换方向(w = 0)
+		static void TransformDirections(const Matrix4& mat, const Vector3* in, Vector3* out, size_t count, size_t inStride = sizeof(Vector3), size_t outStride = sizeof(Vector3));
+		// 用mat的逆转置矩阵变换法线，结果不做归一化
+		static void TransformNormals(const Matrix4& mat, const Vector3* in, Vector3* out, size_t count, size_t inStride = sizeof(Vector3), size_t outStride = sizeof(Vector3));
+
 
 		template<class T>
 		static constexpr T Min(T num1, T num2);
@@ -207,12 +217,12 @@ namespace ZXEngine
 
 	Quaternion Math::Lerp(const Quaternion& q1, const Quaternion& q2, float t)
 	{
-		// С0˵Ԫ೬360
-		// Ԫֻ720ȵɶȣֵʱҪȡ
+		// 如果点积小于0，说明两个四元数的相距超过360度
+		// 但是四元数只有720度的自由度，所以这里插值的时候要取反
 		// 
-		// ȡԼעͶǲοUnity 4.3Դ
-		// ˸оӦǲֵʱҪ180ˣ180ȾӦûֵ
-		// ͻƸԶķȥת
+		// 这里的取反操作以及上面两行注释都是参考的网上流传的Unity 4.3的源码
+		// 个人感觉这里的意义应该是插值的时候不要超过180度了，超过180度就应该换个方向插值
+		// 否则就会出现绕更远的方向去旋转的情况
 		if (Dot(q1, q2) < 0.0f)
 		{
 			return Quaternion(
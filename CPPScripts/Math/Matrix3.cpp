@@ -53,8 +53,8 @@ namespace ZXEngine
 
 	Matrix3::Matrix3(const Vector3& axis, float angle)
 	{
-		// 㷨ǲοUnity 4.3Unity 4.3ǲοMesa OpenGL
-		// ͬʱGPT㷨Ҳ
+		// 此算法先是参考的Unity 4.3，发现Unity 4.3又是参考的Mesa OpenGL
+		// 同时GPT给出的算法也是这样的
 		float c = cosf(angle);
 		float s = sinf(angle);
 		float t = 1.0f - c;
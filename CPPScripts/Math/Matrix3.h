@@ -3,6 +3,7 @@
 
 namespace ZXEngine
 {
+	class Matrix4;
 	class Matrix3
 	{
 		friend class Math;
@@ -18,9 +19,9 @@ namespace ZXEngine
 			float m10, float m11, float m12,
 			float m20, float m21, float m22
 		);
-		// бԳƾ캯
+		// 斜对称矩阵构造函数
 		Matrix3(const Vector3& v);
-		// ת캯(axisתangle)
+		// 旋转矩阵构造函数(绕axis轴旋转angle度)
 		Matrix3(const Vector3& axis, float angle);
 
 		float GetDeterminant() const;
@@ -48,11 +49,11 @@ namespace ZXEngine
 		friend Matrix3 operator* (float n, const Matrix3& mat);
 
 	private:
-		// һ
+		// 第一行
 		float m00; float m01; float m02;
-		// ڶ
+		// 第二行
 		float m10; float m11; float m12;
-		// 
+		// 第三行
 		float m20; float m21; float m22;
 	};
 }
\ No newline at end of file
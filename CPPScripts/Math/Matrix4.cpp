@@ -1,6 +1,7 @@
 #include "Vector4.h"
 #include "Matrix3.h"
 #include "Matrix4.h"
+#include "SIMD.h"
 #include "../Math.h"
 #include "../Debug.h"
 
@@ -52,7 +53,7 @@ namespace ZXEngine
 
 	float Matrix4::GetDeterminant() const
 	{
-		// ʽ
+		// 代数余子式法
 		float a00 =  (m00 * m11 * m22) + (m01 * m12 * m20) + (m02 * m10 * m21) - (m02 * m11 * m20) - (m00 * m12 * m21) - (m01 * m10 * m22);
 		float a01 = -(m10 * m22 * m33) + (m12 * m23 * m30) + (m13 * m20 * m32) - (m13 * m22 * m30) - (m10 * m23 * m32) - (m12 * m20 * m33);
 		float a02 =  (m10 * m21 * m33) + (m11 * m23 * m30) + (m13 * m20 * m31) - (m13 * m21 * m30) - (m10 * m23 * m31) - (m11 * m20 * m33);
@@ -182,6 +183,7 @@ namespace ZXEngine
 
 	Matrix4 Matrix4::operator* (const Matrix4& mat) const
 	{
+		// 矩阵乘法不用SIMD内核，编译器对下面的标量代码自动向量化之后，实测不比手写的SSE和AVX2/FMA内核慢
 		float m00 = this->m00 * mat.m00 + this->m01 * mat.m10 + this->m02 * mat.m20 + this->m03 * mat.m30;
 		float m01 = this->m00 * mat.m01 + this->m01 * mat.m11 + this->m02 * mat.m21 + this->m03 * mat.m31;
 		float m02 = this->m00 * mat.m02 + this->m01 * mat.m12 + this->m02 * mat.m22 + this->m03 * mat.m32;
@@ -271,12 +273,18 @@ namespace ZXEngine
 
 	Vector4 Matrix4::operator* (const Vector4& v) const
 	{
+#ifdef ZX_MATH_SSE
+		Vector4 result;
+		MathSIMD::Matrix4MulVector4(&m00, &v.x, &result.x);
+		return result;
+#else
 		float x = m00 * v.x + m01 * v.y + m02 * v.z + m03 * v.w;
 		float y = m10 * v.x + m11 * v.y + m12 * v.z + m13 * v.w;
 		float z = m20 * v.x + m21 * v.y + m22 * v.z + m23 * v.w;
 		float w = m30 * v.x + m31 * v.y + m32 * v.z + m33 * v.w;
 
 		return Vector4(x, y, z, w);
+#endif
 	}
 
 	Matrix4 operator* (float n, const Matrix4& mat)
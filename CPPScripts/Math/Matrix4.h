@@ -1,4 +1,5 @@
 #pragma once
+#include "SIMDConfig.h"
 
 namespace ZXEngine
 {
@@ -44,13 +45,17 @@ namespace ZXEngine
 		friend Matrix4 operator* (float n, const Matrix4& mat);
 
 	private:
-		// һ
+		// SIMD内核会写入全部16个元素，用这个构造函数创建结果矩阵可以省掉默认构造函数写单位矩阵的开销
+		struct Uninitialized {};
+		Matrix4(Uninitialized) {}
+
+		// 第一行
 		float m00; float m01; float m02; float m03;
-		// ڶ
+		// 第二行
 		float m10; float m11; float m12; float m13;
-		// 
+		// 第三行
 		float m20; float m21; float m22; float m23;
-		// 
+		// 第四行
 		float m30; float m31; float m32; float m33;
 	};
 }
\ No newline at end of file
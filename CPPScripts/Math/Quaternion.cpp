@@ -1,11 +1,12 @@
 #include "Quaternion.h"
 #include "../Math.h"
+#include "SIMD.h"
 
 namespace ZXEngine
 {
 	Quaternion Quaternion::Euler(float x, float y, float z)
 	{
-		// ο: https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles
+		// 参考: https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles
 		float pitch = Math::Deg2Rad(x);
 		float yaw = Math::Deg2Rad(y);
 		float roll = Math::Deg2Rad(z);
@@ -77,8 +78,8 @@ namespace ZXEngine
 
 	Quaternion Quaternion::GetInverse() const
 	{
-		// ο: https://www.mathworks.com/help/aeroblks/quaternioninverse.html
-		// Ԫ˵ӦһԳȵļ㣬תԪȶ1ֱʡһ
+		// 参考: https://www.mathworks.com/help/aeroblks/quaternioninverse.html
+		// 四元数的逆操作按理说应该有一个除以长度的计算，但是我们这里表达旋转的四元数长度都是1，所以直接省略了这一步
 		return Quaternion(-x, -y, -z, w);
 	}
 
@@ -93,7 +94,7 @@ namespace ZXEngine
 	}
 	Vector3 Quaternion::GetEulerAngles() const
 	{
-		// ο: https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles
+		// 参考: https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles
 		float sinp = sqrt(1 + 2 * (w * x - y * z));
 		float cosp = sqrt(1 - 2 * (w * x - y * z));
 		float pitch = 2 * atan2(sinp, cosp) - Math::PI / 2.0f;
@@ -148,17 +149,17 @@ namespace ZXEngine
 
 	Matrix4 Quaternion::ToMatrix() const
 	{
-		// һ
+		// 第一行
 		float m00 = 1 - (2 * y * y) - (2 * z * z);
 		float m01 = (2 * x * y) - (2 * w * z);
 		float m02 = (2 * x * z) + (2 * w * y);
 
-		// ڶ
+		// 第二行
 		float m10 = (2 * x * y) + (2 * w * z);
 		float m11 = 1 - (2 * x * x) - (2 * z * z);
 		float m12 = (2 * y * z) - (2 * w * x);
 
-		// 
+		// 第三行
 		float m20 = (2 * x * z) - (2 * w * y);
 		float m21 = (2 * y * z) + (2 * w * x);
 		float m22 = 1 - (2 * x * x) - (2 * y * y);
@@ -201,19 +202,24 @@ namespace ZXEngine
 
 	Quaternion Quaternion::operator* (const Quaternion& q) const
 	{
-		// ο: https://www.mathworks.com/help/aeroblks/quaternionmultiplication.html
+#ifdef ZX_MATH_SSE
+		Quaternion result;
+		MathSIMD::QuaternionMul(&x, &q.x, &result.x);
+#else
+		// 参考: https://www.mathworks.com/help/aeroblks/quaternionmultiplication.html
 		float qx =  q.x * w - q.y * z + q.z * y + q.w * x;
 		float qy =  q.x * z + q.y * w - q.z * x + q.w * y;
 		float qz = -q.x * y + q.y * x + q.z * w + q.w * z;
 		float qw = -q.x * x - q.y * y - q.z * z + q.w * w;
 		Quaternion result(qx, qy, qz, qw);
+#endif
 		result.Normalize();
 		return result;
 	}
 
 	Quaternion& Quaternion::operator*= (const Quaternion& q)
 	{
-		// thisٳ
+		// 把this解引用再乘
 		*this = *this * q;
 		return *this;
 	}
@@ -1,4 +1,5 @@
 #pragma once
+#include "SIMDConfig.h"
 #include <string>
 
 namespace ZXEngine
@@ -34,13 +35,13 @@ namespace ZXEngine
 		void SetEulerAngles(const Vector3& eulerAngles);
 
 		/// <summary>
-		/// axisתangle
+		/// 绕axis轴旋转angle度
 		/// </summary>
-		/// <param name="axis">ת(ǵλ)</param>
-		/// <param name="angle">תǶ()</param>
+		/// <param name="axis">旋转轴(必须是单位向量)</param>
+		/// <param name="angle">旋转角度(弧度制)</param>
 		void Rotate(const Vector3& axis, float angle);
-		// CycloneתԪĽӿڣʵ߼ҲǴģʱﵱο
-		// ʵPhysZﶼѧʽRotateӿ
+		// Cyclone引擎里用向量旋转四元数的接口，看不懂实现逻辑，运行起来也是错的，先暂时保留在这里当参考
+		// 实际PhysZ引擎里都改用了上面真正符合数学公式的Rotate接口
 		void RotateByVector(const Vector3& rotation, float scale = 1.0f);
 
 		Matrix4 ToMatrix() const;
@@ -0,0 +1,135 @@
+#pragma once
+#include "SIMDConfig.h"
+
+#ifdef ZX_MATH_SSE
+#include <immintrin.h>
+
+// _mm_shuffle_ps的掩码，参数按结果的x,y,z,w顺序写，和_MM_SHUFFLE的顺序相反
+#define ZX_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+#define ZX_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps(v, v, ZX_SHUFFLE_MASK(x, y, z, w))
+#define ZX_SHUFFLE(v1, v2, x, y, z, w) _mm_shuffle_ps(v1, v2, ZX_SHUFFLE_MASK(x, y, z, w))
+
+namespace ZXEngine
+{
+	// 数学库的SIMD计算内核，矩阵都是按行主序排列的16个float，向量和四元数是4个float
+	// 数学类型本身没有对齐要求，所以这里统一用非对齐的读写指令，数据恰好对齐时性能和对齐指令一样
+	namespace MathSIMD
+	{
+		// 2x2矩阵乘法 A * B，2x2矩阵按行主序存在一个寄存器里
+		inline __m128 Matrix2Mul(__m128 a, __m128 b)
+		{
+			return _mm_add_ps(
+				_mm_mul_ps(a, ZX_SWIZZLE(b, 0, 3, 0, 3)),
+				_mm_mul_ps(ZX_SWIZZLE(a, 1, 0, 3, 2), ZX_SWIZZLE(b, 2, 1, 2, 1)));
+		}
+
+		// 2x2矩阵的伴随矩阵乘另一个矩阵 adj(A) * B
+		inline __m128 Matrix2AdjMul(__m128 a, __m128 b)
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(ZX_SWIZZLE(a, 3, 3, 0, 0), b),
+				_mm_mul_ps(ZX_SWIZZLE(a, 1, 1, 2, 2), ZX_SWIZZLE(b, 2, 3, 0, 1)));
+		}
+
+		// 2x2矩阵乘另一个矩阵的伴随矩阵 A * adj(B)
+		inline __m128 Matrix2MulAdj(__m128 a, __m128 b)
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(a, ZX_SWIZZLE(b, 3, 0, 3, 0)),
+				_mm_mul_ps(ZX_SWIZZLE(a, 1, 0, 3, 2), ZX_SWIZZLE(b, 2, 1, 2, 1)));
+		}
+
+		inline void Matrix4MulVector4(const float* m, const float* v, float* out)
+		{
+			__m128 vec = _mm_loadu_ps(v);
+			__m128 r0 = _mm_mul_ps(_mm_loadu_ps(m), vec);
+			__m128 r1 = _mm_mul_ps(_mm_loadu_ps(m + 4), vec);
+			__m128 r2 = _mm_mul_ps(_mm_loadu_ps(m + 8), vec);
+			__m128 r3 = _mm_mul_ps(_mm_loadu_ps(m + 12), vec);
+			// 转置后按列相加就是每一行的点积，避免使用水平加法
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+		}
+
+		inline void Matrix4Transpose(const float* m, float* out)
+		{
+			__m128 r0 = _mm_loadu_ps(m);
+			__m128 r1 = _mm_loadu_ps(m + 4);
+			__m128 r2 = _mm_loadu_ps(m + 8);
+			__m128 r3 = _mm_loadu_ps(m + 12);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(out, r0);
+			_mm_storeu_ps(out + 4, r1);
+			_mm_storeu_ps(out + 8, r2);
+			_mm_storeu_ps(out + 12, r3);
+		}
+
+		// 分块矩阵法求逆，把4x4矩阵拆成4个2x2矩阵 | A B |
+		//                                      | C D |
+		// 参考: https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+		inline void Matrix4Inverse(const float* m, float* out)
+		{
+			__m128 r0 = _mm_loadu_ps(m);
+			__m128 r1 = _mm_loadu_ps(m + 4);
+			__m128 r2 = _mm_loadu_ps(m + 8);
+			__m128 r3 = _mm_loadu_ps(m + 12);
+
+			__m128 A = _mm_movelh_ps(r0, r1);
+			__m128 B = _mm_movehl_ps(r1, r0);
+			__m128 C = _mm_movelh_ps(r2, r3);
+			__m128 D = _mm_movehl_ps(r3, r2);
+
+			// 4个子矩阵的行列式 (|A|, |B|, |C|, |D|)
+			__m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(ZX_SHUFFLE(r0, r2, 0, 2, 0, 2), ZX_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+				_mm_mul_ps(ZX_SHUFFLE(r0, r2, 1, 3, 1, 3), ZX_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+			__m128 detA = ZX_SWIZZLE(detSub, 0, 0, 0, 0);
+			__m128 detB = ZX_SWIZZLE(detSub, 1, 1, 1, 1);
+			__m128 detC = ZX_SWIZZLE(detSub, 2, 2, 2, 2);
+			__m128 detD = ZX_SWIZZLE(detSub, 3, 3, 3, 3);
+
+			__m128 D_C = Matrix2AdjMul(D, C);
+			__m128 A_B = Matrix2AdjMul(A, B);
+
+			// 逆矩阵 = 1/|M| * | X Y |，这里先算出X,Y,Z,W的伴随矩阵
+			//                 | Z W |
+			__m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), Matrix2Mul(B, D_C));
+			__m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), Matrix2Mul(C, A_B));
+			__m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), Matrix2MulAdj(D, A_B));
+			__m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), Matrix2MulAdj(A, D_C));
+
+			// |M| = |A|*|D| + |B|*|C| - tr(adj(A)*B*adj(D)*C)
+			__m128 tr = _mm_mul_ps(A_B, ZX_SWIZZLE(D_C, 0, 2, 1, 3));
+			tr = _mm_add_ps(tr, ZX_SWIZZLE(tr, 2, 3, 0, 1));
+			tr = _mm_add_ps(tr, ZX_SWIZZLE(tr, 1, 0, 3, 2));
+			__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+			// 伴随矩阵的符号 (1/|M|, -1/|M|, -1/|M|, 1/|M|)
+			__m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+			X_ = _mm_mul_ps(X_, rDetM);
+			Y_ = _mm_mul_ps(Y_, rDetM);
+			Z_ = _mm_mul_ps(Z_, rDetM);
+			W_ = _mm_mul_ps(W_, rDetM);
+
+			// 求伴随矩阵的重排和写回4x4矩阵的重排合并成一步
+			_mm_storeu_ps(out, ZX_SHUFFLE(X_, Y_, 3, 1, 3, 1));
+			_mm_storeu_ps(out + 4, ZX_SHUFFLE(X_, Y_, 2, 0, 2, 0));
+			_mm_storeu_ps(out + 8, ZX_SHUFFLE(Z_, W_, 3, 1, 3, 1));
+			_mm_storeu_ps(out + 12, ZX_SHUFFLE(Z_, W_, 2, 0, 2, 0));
+		}
+
+		// 四元数乘法 a * b，计算公式和Quaternion::operator*的标量版本一致，结果没有归一化
+		inline void QuaternionMul(const float* a, const float* b, float* out)
+		{
+			__m128 qa = _mm_loadu_ps(a);
+			__m128 qb = _mm_loadu_ps(b);
+
+			__m128 r = _mm_mul_ps(ZX_SWIZZLE(qb, 3, 3, 3, 3), qa);
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(ZX_SWIZZLE(qb, 0, 0, 0, 0), ZX_SWIZZLE(qa, 3, 2, 1, 0)), _mm_setr_ps( 1.0f,  1.0f, -1.0f, -1.0f)));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(ZX_SWIZZLE(qb, 1, 1, 1, 1), ZX_SWIZZLE(qa, 2, 3, 0, 1)), _mm_setr_ps(-1.0f,  1.0f,  1.0f, -1.0f)));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(ZX_SWIZZLE(qb, 2, 2, 2, 2), ZX_SWIZZLE(qa, 1, 0, 3, 2)), _mm_setr_ps( 1.0f, -1.0f,  1.0f, -1.0f)));
+			_mm_storeu_ps(out, r);
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+// 编译期选择数学库的SIMD实现，x64平台默认至少有SSE2，所有内核都只用SSE2指令
+// 没有单独的SSE4.1和AVX2内核: SSE4.1的dpps点积指令比乘法加洗牌还慢，AVX2本身新增的主要是整数指令
+// 试过用AVX2/FMA编译矩阵乘法内核，实测不比编译器自动向量化的标量代码快，所以矩阵乘法直接用标量实现
+// 在编译选项里定义ZX_MATH_NO_SIMD可以强制使用标量实现，方便对比结果和排查问题
+#if !defined(ZX_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ZX_MATH_SSE
+#endif
+
+// Vector4，Quaternion和Matrix4不加对齐要求，保持原来的大小和布局，不会让KeyFrame这类包含它们的结构体变大
+// SIMD内核统一用非对齐的读写指令，只有函数内部的临时缓冲区才按16字节对齐
@@ -1,4 +1,5 @@
 #pragma once
+#include "SIMDConfig.h"
 #include <string>
 
 namespace ZXEngine
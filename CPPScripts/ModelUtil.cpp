@@ -3,9 +3,11 @@
 #include "StaticMesh.h"
 #include "DynamicMesh.h"
 #include "GeometryGenerator.h"
+#include "ProjectSetting.h"
 #include "Animation/Animation.h"
 #include "Animation/NodeAnimation.h"
 #include "Animation/AnimationController.h"
+#include "Animation/Skeleton.h"
 
 namespace ZXEngine
 {
@@ -86,31 +88,39 @@ namespace ZXEngine
     {
         ModelData* pModelData = new ModelData();
 
-        // ASSIMPģļ
+        // 用ASSIMP加载模型文件
         Assimp::Importer importer;
         const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace 
             | aiProcess_FixInfacingNormals | aiProcess_FlipWindingOrder | aiProcess_LimitBoneWeights);
         
-        // 쳣
+        // 检查异常
         if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
         {
             Debug::LogError("ASSIMP: %s", importer.GetErrorString());
             return pModelData;
         }
 
-        // 
+        // 处理动画数据
         if (loadFullAnim)
             pModelData->pAnimationController = ProcessAnimation(scene);
         else
             LoadAnimBriefInfos(scene, pModelData);
 
-        // ģͺ͹
+        // 处理模型和骨骼数据
         if (pModelData->pAnimationController)
         {
-            pModelData->pRootBoneNode = new BoneNode();
-            ProcessNode(scene->mRootNode, scene, pModelData, pModelData->pRootBoneNode, async);
+            BoneNode* pRootBoneNode = new BoneNode();
+            ProcessNode(scene->mRootNode, scene, pModelData, pRootBoneNode, async);
+
+            // 骨骼树只在加载时使用，展开成数组后就不需要了
+            pModelData->pSkeleton = new Skeleton(pRootBoneNode);
+            delete pRootBoneNode;
+
+            for (auto pMesh : pModelData->pMeshes)
+                pModelData->pSkeleton->BindMesh(pMesh);
+            pModelData->pAnimationController->BindSkeleton(pModelData->pSkeleton);
         }
-        // ģ
+        // 处理模型数据
         else
 		{
 			ProcessNode(scene->mRootNode, scene, pModelData, async);
@@ -122,16 +132,16 @@ namespace ZXEngine
 
     void ModelUtil::ProcessNode(const aiNode* pNode, const aiScene* pScene, ModelData* pModelData, bool async)
     {
-        // Mesh
+        // 处理Mesh数据
         for (unsigned int i = 0; i < pNode->mNumMeshes; i++)
         {
-            // aiNodeȡaiSceneеʵʶ
-            // aiSceneݣaiNodeֻΪ֯(¼ڵ֮Ĺϵ)
+            // aiNode仅包含索引来获取aiScene中的实际对象
+            // aiScene包含所有数据，aiNode只是为了让数据组织起来(比如记录节点之间的关系)
             aiMesh* mesh = pScene->mMeshes[pNode->mMeshes[i]];
             pModelData->pMeshes.push_back(ProcessMesh(mesh, async));
         }
 
-        // ݹ鴦ӽڵ
+        // 递归处理子节点
         for (unsigned int i = 0; i < pNode->mNumChildren; i++)
         {
             ProcessNode(pNode->mChildren[i], pScene, pModelData, async);
@@ -140,20 +150,20 @@ namespace ZXEngine
 
     void ModelUtil::ProcessNode(const aiNode* pNode, const aiScene* pScene, ModelData* pModelData, BoneNode* pBoneNode, bool async)
     {
-        // Mesh
+        // 处理Mesh数据
         for (unsigned int i = 0; i < pNode->mNumMeshes; i++)
         {
-            // aiNodeȡaiSceneеʵʶ
-            // aiSceneݣaiNodeֻΪ֯(¼ڵ֮Ĺϵ)
+            // aiNode仅包含索引来获取aiScene中的实际对象
+            // aiScene包含所有数据，aiNode只是为了让数据组织起来(比如记录节点之间的关系)
             aiMesh* mesh = pScene->mMeshes[pNode->mMeshes[i]];
             pModelData->pMeshes.push_back(ProcessMesh(mesh, async));
         }
 
-        // ع
+        // 加载骨骼数据
         pBoneNode->name = pNode->mName.C_Str();
         pBoneNode->transform = aiMatrix4x4ToMatrix4(pNode->mTransformation);
 
-        // ݹ鴦ӽڵ
+        // 递归处理子节点
         for (unsigned int i = 0; i < pNode->mNumChildren; i++)
         {
             pBoneNode->children.push_back(new BoneNode());
@@ -220,7 +230,7 @@ namespace ZXEngine
 
         vector<Matrix4> boneOffsetMatrices;
         unordered_map<string, uint32_t> boneNameToIndexMap;
-        // ӹϢ
+        // 添加骨骼信息
         if (mesh->HasBones())
         {
             for (unsigned int i = 0; i < mesh->mNumBones; i++)
@@ -231,7 +241,7 @@ namespace ZXEngine
 
                 boneOffsetMatrices.push_back(aiMatrix4x4ToMatrix4(bone->mOffsetMatrix));
 
-                // IDӳ
+                // 骨骼名到ID的映射
                 if (boneNameToIndexMap.find(boneName) == boneNameToIndexMap.end())
                 {
                     boneNameToIndexMap[boneName] = i;
@@ -241,7 +251,7 @@ namespace ZXEngine
                     Debug::LogWarning("Duplicate bone name %s", boneName);
                 }
 
-                // Ϣӵ
+                // 将骨骼信息添加到顶点中
                 for (unsigned int j = 0; j < bone->mNumWeights; j++)
 				{
 					uint32_t vertexID = bone->mWeights[j].mVertexId;
@@ -322,6 +332,9 @@ namespace ZXEngine
 				}
                 pNode->mKeyRotationNum = pNode->mKeyRotations.size();
 
+                if (ProjectSetting::animationCompression)
+                    pNode->Compress();
+
                 pAnim->AddNodeAnimation(pNode);
 			}
 
@@ -15,9 +15,9 @@ namespace ZXEngine
 	class ModelUtil
 	{
 	public:
-		// ʹASSIMPģļ
+		// 使用ASSIMP加载模型文件
 		static ModelData* LoadModel(const string& path, bool loadFullAnim = true, bool async = false);
-		// 㷨ɼģ
+		// 算法生成几何体模型
 		static Mesh* GenerateGeometry(GeometryType type);
 
 		static string GetGeometryTypeName(GeometryType type);
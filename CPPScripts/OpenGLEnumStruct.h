@@ -17,6 +17,15 @@ namespace ZXEngine
 		bool inUse = false;
 	};
 
+	struct OpenGLInstanceBuffer
+	{
+		// 存放逐实例模型矩阵的Vertex Buffer Object
+		uint32_t VBO = 0;
+		// 最多能存放的实例数量
+		uint32_t size = 0;
+		bool inUse = false;
+	};
+
 	struct OpenGLMaterialData
 	{
 		unordered_map<string, bool> boolList;
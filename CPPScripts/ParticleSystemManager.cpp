@@ -40,7 +40,7 @@ namespace ZXEngine
 
 	void ParticleSystemManager::Render(Camera* camera)
 	{
-		// лϵͳȾ
+		// 切换粒子系统渲染设置
 		RenderAPI::GetInstance()->SetRenderState(renderState);
 
 		for (auto particleSystem : allParticleSystem)
@@ -18,35 +18,35 @@ namespace ZXEngine
 		{
 			if (mParent != nullptr)
 			{
-				// ҵֵܽڵ
+				// 先找到兄弟节点
 				BVHNode* sibling = (mParent->mChildren[0] == this) ? mParent->mChildren[1] : mParent->mChildren[0];
 
-				// ֵܽڵݸƵڵ
+				// 把兄弟节点的数据复制到父节点
 				mParent->mRigidBody = sibling->mRigidBody;
 				mParent->mChildren[0] = sibling->mChildren[0];
 				mParent->mChildren[1] = sibling->mChildren[1];
 				mParent->mBoundingVolume = sibling->mBoundingVolume;
 
-				// ڵи壬ͬ¸BVHNodeָ
+				// 如果父节点有刚体，同步更新刚体的BVHNode指针
 				if (mParent->mRigidBody)
 					mParent->mRigidBody->mBVHNode = mParent;
 
-				// Ȼֵܽڵɾ
+				// 然后把兄弟节点删除
 				sibling->mParent = nullptr;
 				sibling->mRigidBody = nullptr;
 				sibling->mChildren[0] = nullptr;
 				sibling->mChildren[1] = nullptr;
 				delete sibling;
 
-				// ¼㸸ڵBV
+				// 最后重新计算父节点的BV
 				mParent->UpdateBoundingVolume();
 			}
 
-			// и壬˵ǰڵ㣬ñҰָ
+			// 如果有刚体，并且引用了当前节点，就消除引用避免野指针
 			if (mRigidBody && mRigidBody->mBVHNode == this)
 				mRigidBody->mBVHNode = nullptr;
 
-			// ݹɾӽڵ㣬ɾ֮ǰȰѸڵգӽڵɾʱٴֵܽڵ
+			// 递归删除子节点，删之前先把父节点引用清空，这样子节点删除时无需再处理兄弟节点
 			if (mChildren[0] != nullptr)
 			{
 				mChildren[0]->mParent = nullptr;
@@ -66,34 +66,34 @@ namespace ZXEngine
 
 		void BVHNode::UpdateBoundingVolume(bool recurse)
 		{
-			// Ҷӽڵֻһ壬ĿǰϵͳĬϸ岻䣬¼BVС
+			// 叶子节点只包含一个刚体，目前的物理系统默认刚体不会变，所以无需重新计算BV大小
 			if (!IsLeaf())
 				mBoundingVolume = BoundingSphere(mChildren[0]->mBoundingVolume, mChildren[1]->mBoundingVolume);
 
-			// Ҫݹ飬͵ݹ¸ڵBV
+			// 如果需要递归，就递归更新父节点的BV
 			if (mParent != nullptr && recurse)
 				mParent->UpdateBoundingVolume(true);
 		}
 
 		void BVHNode::Insert(const BoundingSphere& volume, RigidBody* body)
 		{
-			// Ҷӽڵ㣬Ϊڵ
+			// 如果是叶子节点，就升级为父节点
 			if (IsLeaf())
 			{
-				// õǰڵһӽڵ
+				// 用当前节点数据生成一个子节点
 				mChildren[0] = new BVHNode(this, mBoundingVolume, mRigidBody);
-				// һӽڵ
+				// 用新数据生成另一个子节点
 				mChildren[1] = new BVHNode(this, volume, body);
 
-				// ɾǰڵĸ
+				// 删掉当前节点的刚体
 				mRigidBody = nullptr;
-				// ɵǰڵиڵBV
+				// 重新生成当前节点和所有父节点的BV
 				UpdateBoundingVolume();
 			}
-			// Ҷӽڵ㣬²ҶӽڵȻ
+			// 如果不是叶子节点，就向下查找叶子节点然后插入
 			else
 			{
-				// Ƚϲ뵽ӽڵBVСǸ
+				// 比较插入到两个子节点后的BV增长量，插入增长量更小的那个
 				if (mChildren[0]->mBoundingVolume.GetGrowth(volume) < mChildren[1]->mBoundingVolume.GetGrowth(volume))
 					mChildren[0]->Insert(volume, body);
 				else
@@ -119,12 +119,12 @@ namespace ZXEngine
 
 		uint32_t BVHNode::GetPotentialContactsWith(const BVHNode* other, PotentialContact* contacts, uint32_t limit) const
 		{
-			// ûص߳ƣ0
+			// 如果没有重叠或者超过检测限制，返回0
 			if (!IsOverlapWith(other) || limit == 0)
 				return 0;
 
-			// ߵͱʾڵBVཻ
-			// ڵ㶼ӽڵ㣬ôпܲһʵײ
+			// 代码走到这里就表示两个节点的BV是相交的
+			// 如果两个节点都是子节点，那么就有可能产生一个实际碰撞
 			if (IsLeaf() && other->IsLeaf())
 			{
 				contacts->mRigidBodies[0] = mRigidBody;
@@ -132,27 +132,27 @@ namespace ZXEngine
 				return 1;
 			}
 
-			// һBVҶӽڵ(˵ǰڵ㲻Ҷӽڵ)
-			// ˵Ҷӽڵ㣬ǵǰBV
-			// õǰڵӽڵȥһڵǷڿܷײ
+			// 如果另外一个BV是叶子节点(说明当前这个节点不是叶子节点)
+			// 或者说如果两个都不是叶子节点，但是当前这个BV体积更大
+			// 就拿当前这个节点的两个子节点再去和另一个节点检测是否存在可能发生的碰撞
 			if (other->IsLeaf() || (!IsLeaf() && mBoundingVolume.GetVolume() >= other->mBoundingVolume.GetVolume()))
 			{
-				// ݹӽڵ
+				// 递归检测子节点
 				uint32_t count = mChildren[0]->GetPotentialContactsWith(other, contacts, limit);
-				// Ѿ⵽㹻ײͲټһӽڵ
+				// 如果已经检测到足够多的碰撞，就不再检测另一个子节点了
 				if (limit > count)
 					return count + mChildren[1]->GetPotentialContactsWith(other, contacts + count, limit - count);
 				else
 					return count;
 			}
-			// ǰBVҶӽڵ(˵һڵ㲻Ҷӽڵ)
-			// ˵Ҷӽڵ㣬һBV
-			// һڵӽڵȥ͵ǰڵǷڿܷײ
+			// 如果当前这个BV是叶子节点(说明另一个节点不是叶子节点)
+			// 或者说如果两个都不是叶子节点，但是另一个BV体积更大
+			// 就拿另一个节点的两个子节点再去和当前这个节点检测是否存在可能发生的碰撞
 			else
 			{
-				// ݹӽڵ
+				// 递归检测子节点
 				uint32_t count = GetPotentialContactsWith(other->mChildren[0], contacts, limit);
-				// Ѿ⵽㹻ײͲټһӽڵ
+				// 如果已经检测到足够多的碰撞，就不再检测另一个子节点了
 				if (limit > count)
 					return count + GetPotentialContactsWith(other->mChildren[1], contacts + count, limit - count);
 				else
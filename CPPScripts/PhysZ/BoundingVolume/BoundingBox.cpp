@@ -0,0 +1,49 @@
+#include "BoundingBox.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		BoundingBox::BoundingBox(const Vector3& min, const Vector3& max) :
+			mMin(min),
+			mMax(max)
+		{};
+
+		BoundingBox::BoundingBox(const BoundingBox& bb1, const BoundingBox& bb2)
+		{
+			mMin = Vector3(Math::Min(bb1.mMin.x, bb2.mMin.x), Math::Min(bb1.mMin.y, bb2.mMin.y), Math::Min(bb1.mMin.z, bb2.mMin.z));
+			mMax = Vector3(Math::Max(bb1.mMax.x, bb2.mMax.x), Math::Max(bb1.mMax.y, bb2.mMax.y), Math::Max(bb1.mMax.z, bb2.mMax.z));
+		}
+
+		Vector3 BoundingBox::GetCenter() const
+		{
+			return (mMin + mMax) * 0.5f;
+		}
+
+		float BoundingBox::GetSurfaceArea() const
+		{
+			Vector3 size = mMax - mMin;
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		bool BoundingBox::IsOverlapWith(const BoundingBox& other) const
+		{
+			return mMin.x <= other.mMax.x && mMax.x >= other.mMin.x
+				&& mMin.y <= other.mMax.y && mMax.y >= other.mMin.y
+				&& mMin.z <= other.mMax.z && mMax.z >= other.mMin.z;
+		}
+
+		bool BoundingBox::IsContain(const BoundingBox& other) const
+		{
+			return mMin.x <= other.mMin.x && mMax.x >= other.mMax.x
+				&& mMin.y <= other.mMin.y && mMax.y >= other.mMax.y
+				&& mMin.z <= other.mMin.z && mMax.z >= other.mMax.z;
+		}
+
+		BoundingBox BoundingBox::GetEnlarged(float margin) const
+		{
+			Vector3 offset(margin, margin, margin);
+			return BoundingBox(mMin - offset, mMax + offset);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include "../../pubh.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		// 轴对齐包围盒(Axis-Aligned Bounding Box)
+		class BoundingBox
+		{
+		public:
+			Vector3 mMin;
+			Vector3 mMax;
+
+			BoundingBox() {};
+			BoundingBox(const Vector3& min, const Vector3& max);
+			BoundingBox(const BoundingBox& bb1, const BoundingBox& bb2);
+			~BoundingBox() {};
+
+			Vector3 GetCenter() const;
+			// 获取包围盒表面积，用于衡量BVH的质量(SAH)
+			float GetSurfaceArea() const;
+			// 与另一个包围盒是否相交
+			bool IsOverlapWith(const BoundingBox& other) const;
+			// 是否完全包含另一个包围盒
+			bool IsContain(const BoundingBox& other) const;
+			// 获取向每个方向扩大margin后的包围盒
+			BoundingBox GetEnlarged(float margin) const;
+		};
+	}
+}
\ No newline at end of file
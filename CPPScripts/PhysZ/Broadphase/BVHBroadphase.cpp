@@ -0,0 +1,70 @@
+#include "BVHBroadphase.h"
+#include "../BVHNode.h"
+#include "../RigidBody.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		BVHBroadphase::~BVHBroadphase()
+		{
+			if (mRoot)
+				delete mRoot;
+		}
+
+		BroadphaseType BVHBroadphase::GetType() const
+		{
+			return BroadphaseType::BVH;
+		}
+
+		bool BVHBroadphase::IsEmpty() const
+		{
+			return mRoot == nullptr;
+		}
+
+		void BVHBroadphase::Insert(RigidBody* body, const BoundingBox& bounds)
+		{
+			// 用能包住AABB的球作为包围球
+			BoundingSphere boundingVolume(bounds.GetCenter(), (bounds.mMax - bounds.mMin).GetMagnitude() * 0.5f);
+
+			if (mRoot)
+				mRoot->Insert(boundingVolume, body);
+			else
+				mRoot = new BVHNode(nullptr, boundingVolume, body);
+		}
+
+		void BVHBroadphase::Remove(RigidBody* body)
+		{
+			BVHNode* node = body->mBVHNode;
+			if (node == nullptr)
+				return;
+
+			// 只有根节点是叶子节点时，刚体才会直接挂在根节点上
+			// 其它情况下BVHNode的析构函数会把兄弟节点合并到父节点上
+			if (node == mRoot)
+				mRoot = nullptr;
+
+			delete node;
+		}
+
+		void BVHBroadphase::Update(RigidBody* body, const BoundingBox& bounds)
+		{
+			// 目前的物理系统默认刚体的形状不会变，包围球半径保持插入时的大小，只更新位置
+			if (body->mBVHNode)
+			{
+				body->mBVHNode->mBoundingVolume.mCenter = bounds.GetCenter();
+				body->mBVHNode->UpdateBoundingVolume();
+			}
+		}
+
+		uint32_t BVHBroadphase::GetPotentialContacts(PotentialContact* contacts, uint32_t limit)
+		{
+			if (mRoot == nullptr)
+				return 0;
+
+			// BVHNode填满数组后就停止遍历了，无法得知总数，填满时返回limit + 1表示可能被截断
+			uint32_t count = mRoot->GetPotentialContacts(contacts, limit);
+			return count == limit ? limit + 1 : count;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+#include "Broadphase.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		class BVHNode;
+		// 基于包围球BVHNode的Broadphase，只插入不重建，刚体移动时只更新包围球的位置
+		class BVHBroadphase : public Broadphase
+		{
+		public:
+			BVHBroadphase() {};
+			~BVHBroadphase();
+
+			virtual BroadphaseType GetType() const;
+			virtual bool IsEmpty() const;
+
+			virtual void Insert(RigidBody* body, const BoundingBox& bounds);
+			virtual void Remove(RigidBody* body);
+			virtual void Update(RigidBody* body, const BoundingBox& bounds);
+			virtual uint32_t GetPotentialContacts(PotentialContact* contacts, uint32_t limit);
+
+		private:
+			// Bounding Volume Hierarchy (BVH)树的根节点
+			BVHNode* mRoot = nullptr;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "Broadphase.h"
+#include "BVHBroadphase.h"
+#include "DynamicAABBTree.h"
+#include "SweepAndPrune.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		Broadphase* Broadphase::Create(BroadphaseType type)
+		{
+			if (type == BroadphaseType::BVH)
+				return new BVHBroadphase();
+			else if (type == BroadphaseType::DynamicAABBTree)
+				return new DynamicAABBTree();
+			else if (type == BroadphaseType::SweepAndPrune)
+				return new SweepAndPrune();
+
+			Debug::LogError("Invalid broadphase type.");
+			return nullptr;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+#include "../../pubh.h"
+#include "../PhysZEnumStruct.h"
+#include "../BoundingVolume/BoundingBox.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		class RigidBody;
+		// 碰撞检测的粗检测阶段，负责快速找出包围盒相交的刚体对，交给CollisionDetector做精确检测
+		class Broadphase
+		{
+		public:
+			static Broadphase* Create(BroadphaseType type);
+
+		public:
+			virtual ~Broadphase() {};
+
+			virtual BroadphaseType GetType() const = 0;
+			virtual bool IsEmpty() const = 0;
+
+			// 添加刚体，bounds是刚体的碰撞体在世界空间下的包围盒
+			virtual void Insert(RigidBody* body, const BoundingBox& bounds) = 0;
+			virtual void Remove(RigidBody* body) = 0;
+			// 刚体移动后更新包围盒
+			virtual void Update(RigidBody* body, const BoundingBox& bounds) = 0;
+			// 把潜在碰撞写入contacts数组，最多写入limit个
+			// 返回找到的潜在碰撞总数，大于limit时说明数组不够大，超出的部分没有写入
+			virtual uint32_t GetPotentialContacts(PotentialContact* contacts, uint32_t limit) = 0;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,308 @@
+#include "DynamicAABBTree.h"
+#include "../RigidBody.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		DynamicAABBTree::DynamicAABBTree(float margin) :
+			mMargin(margin)
+		{}
+
+		BroadphaseType DynamicAABBTree::GetType() const
+		{
+			return BroadphaseType::DynamicAABBTree;
+		}
+
+		bool DynamicAABBTree::IsEmpty() const
+		{
+			return mRoot == UINT32_MAX;
+		}
+
+		int32_t DynamicAABBTree::GetHeight() const
+		{
+			return mRoot == UINT32_MAX ? 0 : mNodes[mRoot].mHeight;
+		}
+
+		void DynamicAABBTree::Insert(RigidBody* body, const BoundingBox& bounds)
+		{
+			uint32_t leaf = AllocateNode();
+			mNodes[leaf].mBounds = bounds.GetEnlarged(mMargin);
+			mNodes[leaf].mRigidBody = body;
+			mNodes[leaf].mHeight = 0;
+			body->mBroadphaseID = leaf;
+
+			InsertLeaf(leaf);
+		}
+
+		void DynamicAABBTree::Remove(RigidBody* body)
+		{
+			uint32_t leaf = body->mBroadphaseID;
+			if (leaf == UINT32_MAX)
+				return;
+
+			RemoveLeaf(leaf);
+			FreeNode(leaf);
+			body->mBroadphaseID = UINT32_MAX;
+		}
+
+		void DynamicAABBTree::Update(RigidBody* body, const BoundingBox& bounds)
+		{
+			uint32_t leaf = body->mBroadphaseID;
+			if (leaf == UINT32_MAX)
+				return;
+
+			// 还在胖包围盒里面就不需要动树
+			if (mNodes[leaf].mBounds.IsContain(bounds))
+				return;
+
+			RemoveLeaf(leaf);
+			mNodes[leaf].mBounds = bounds.GetEnlarged(mMargin);
+			InsertLeaf(leaf);
+		}
+
+		uint32_t DynamicAABBTree::GetPotentialContacts(PotentialContact* contacts, uint32_t limit)
+		{
+			if (mRoot == UINT32_MAX)
+				return 0;
+
+			uint32_t count = 0;
+			uint32_t nodeNum = static_cast<uint32_t>(mNodes.size());
+			// 每个叶子节点去树里查询相交的叶子节点，只记录下标比自己大的，避免同一对刚体记录两次
+			for (uint32_t leaf = 0; leaf < nodeNum; leaf++)
+			{
+				if (mNodes[leaf].mHeight != 0)
+					continue;
+
+				const BoundingBox& bounds = mNodes[leaf].mBounds;
+
+				mStack.clear();
+				mStack.push_back(mRoot);
+				while (!mStack.empty())
+				{
+					uint32_t id = mStack.back();
+					mStack.pop_back();
+
+					const TreeNode& node = mNodes[id];
+					if (!node.mBounds.IsOverlapWith(bounds))
+						continue;
+
+					if (node.IsLeaf())
+					{
+						if (id > leaf)
+						{
+							// 超出数组长度后只计数，让调用方知道需要多大的数组
+							if (count < limit)
+							{
+								contacts[count].mRigidBodies[0] = mNodes[leaf].mRigidBody;
+								contacts[count].mRigidBodies[1] = node.mRigidBody;
+							}
+							count++;
+						}
+					}
+					else
+					{
+						mStack.push_back(node.mChildren[0]);
+						mStack.push_back(node.mChildren[1]);
+					}
+				}
+			}
+
+			return count;
+		}
+
+		uint32_t DynamicAABBTree::AllocateNode()
+		{
+			if (mFreeList == UINT32_MAX)
+			{
+				mNodes.emplace_back();
+				return static_cast<uint32_t>(mNodes.size() - 1);
+			}
+
+			uint32_t id = mFreeList;
+			mFreeList = mNodes[id].mParent;
+			mNodes[id] = TreeNode();
+			return id;
+		}
+
+		void DynamicAABBTree::FreeNode(uint32_t id)
+		{
+			mNodes[id].mRigidBody = nullptr;
+			mNodes[id].mHeight = -1;
+			mNodes[id].mParent = mFreeList;
+			mFreeList = id;
+		}
+
+		void DynamicAABBTree::InsertLeaf(uint32_t leaf)
+		{
+			if (mRoot == UINT32_MAX)
+			{
+				mRoot = leaf;
+				mNodes[leaf].mParent = UINT32_MAX;
+				return;
+			}
+
+			// 用表面积启发式(SAH)向下找最合适的兄弟节点
+			BoundingBox leafBounds = mNodes[leaf].mBounds;
+			uint32_t index = mRoot;
+			while (!mNodes[index].IsLeaf())
+			{
+				uint32_t child0 = mNodes[index].mChildren[0];
+				uint32_t child1 = mNodes[index].mChildren[1];
+
+				float area = mNodes[index].mBounds.GetSurfaceArea();
+				float combinedArea = BoundingBox(mNodes[index].mBounds, leafBounds).GetSurfaceArea();
+
+				// 在当前节点处新建父节点的代价
+				float cost = 2.0f * combinedArea;
+				// 继续往下走需要付出的最小代价(祖先节点包围盒的增长)
+				float inheritanceCost = 2.0f * (combinedArea - area);
+
+				auto GetDescendCost = [&](uint32_t child)
+				{
+					BoundingBox bounds(leafBounds, mNodes[child].mBounds);
+					if (mNodes[child].IsLeaf())
+						return bounds.GetSurfaceArea() + inheritanceCost;
+					else
+						return bounds.GetSurfaceArea() - mNodes[child].mBounds.GetSurfaceArea() + inheritanceCost;
+				};
+				float cost0 = GetDescendCost(child0);
+				float cost1 = GetDescendCost(child1);
+
+				if (cost < cost0 && cost < cost1)
+					break;
+
+				index = cost0 < cost1 ? child0 : child1;
+			}
+
+			// 新建一个父节点，把找到的兄弟节点和新叶子节点挂在下面
+			uint32_t sibling = index;
+			uint32_t oldParent = mNodes[sibling].mParent;
+			uint32_t newParent = AllocateNode();
+			mNodes[newParent].mParent = oldParent;
+			mNodes[newParent].mBounds = BoundingBox(leafBounds, mNodes[sibling].mBounds);
+			mNodes[newParent].mHeight = mNodes[sibling].mHeight + 1;
+			mNodes[newParent].mChildren[0] = sibling;
+			mNodes[newParent].mChildren[1] = leaf;
+			mNodes[sibling].mParent = newParent;
+			mNodes[leaf].mParent = newParent;
+
+			if (oldParent == UINT32_MAX)
+			{
+				mRoot = newParent;
+			}
+			else
+			{
+				if (mNodes[oldParent].mChildren[0] == sibling)
+					mNodes[oldParent].mChildren[0] = newParent;
+				else
+					mNodes[oldParent].mChildren[1] = newParent;
+			}
+
+			Refit(mNodes[leaf].mParent);
+		}
+
+		void DynamicAABBTree::RemoveLeaf(uint32_t leaf)
+		{
+			if (leaf == mRoot)
+			{
+				mRoot = UINT32_MAX;
+				return;
+			}
+
+			// 删掉父节点，让兄弟节点顶替父节点的位置
+			uint32_t parent = mNodes[leaf].mParent;
+			uint32_t grandParent = mNodes[parent].mParent;
+			uint32_t sibling = mNodes[parent].mChildren[0] == leaf ? mNodes[parent].mChildren[1] : mNodes[parent].mChildren[0];
+
+			if (grandParent == UINT32_MAX)
+			{
+				mRoot = sibling;
+				mNodes[sibling].mParent = UINT32_MAX;
+			}
+			else
+			{
+				if (mNodes[grandParent].mChildren[0] == parent)
+					mNodes[grandParent].mChildren[0] = sibling;
+				else
+					mNodes[grandParent].mChildren[1] = sibling;
+				mNodes[sibling].mParent = grandParent;
+
+				Refit(grandParent);
+			}
+
+			FreeNode(parent);
+		}
+
+		void DynamicAABBTree::Refit(uint32_t id)
+		{
+			while (id != UINT32_MAX)
+			{
+				id = Balance(id);
+
+				uint32_t child0 = mNodes[id].mChildren[0];
+				uint32_t child1 = mNodes[id].mChildren[1];
+				mNodes[id].mHeight = 1 + std::max(mNodes[child0].mHeight, mNodes[child1].mHeight);
+				mNodes[id].mBounds = BoundingBox(mNodes[child0].mBounds, mNodes[child1].mBounds);
+
+				id = mNodes[id].mParent;
+			}
+		}
+
+		uint32_t DynamicAABBTree::Balance(uint32_t a)
+		{
+			TreeNode& nodeA = mNodes[a];
+			if (nodeA.IsLeaf() || nodeA.mHeight < 2)
+				return a;
+
+			uint32_t b = nodeA.mChildren[0];
+			uint32_t c = nodeA.mChildren[1];
+			int32_t balance = mNodes[c].mHeight - mNodes[b].mHeight;
+
+			// 较高的子树往上提一层，a变成它的子节点
+			// rise是被提上来的节点，sink是原来的另一个子节点
+			auto Rotate = [&](uint32_t rise, uint32_t sink)
+			{
+				TreeNode& nodeRise = mNodes[rise];
+				uint32_t f = nodeRise.mChildren[0];
+				uint32_t g = nodeRise.mChildren[1];
+
+				// rise顶替a的位置
+				nodeRise.mChildren[0] = a;
+				nodeRise.mParent = nodeA.mParent;
+				nodeA.mParent = rise;
+
+				if (nodeRise.mParent == UINT32_MAX)
+					mRoot = rise;
+				else if (mNodes[nodeRise.mParent].mChildren[0] == a)
+					mNodes[nodeRise.mParent].mChildren[0] = rise;
+				else
+					mNodes[nodeRise.mParent].mChildren[1] = rise;
+
+				// rise较高的子节点留在rise下，较低的挂到a下
+				if (mNodes[f].mHeight < mNodes[g].mHeight)
+					std::swap(f, g);
+
+				nodeRise.mChildren[1] = f;
+				nodeA.mChildren[0] = sink;
+				nodeA.mChildren[1] = g;
+				mNodes[g].mParent = a;
+
+				nodeA.mBounds = BoundingBox(mNodes[sink].mBounds, mNodes[g].mBounds);
+				nodeRise.mBounds = BoundingBox(nodeA.mBounds, mNodes[f].mBounds);
+
+				nodeA.mHeight = 1 + std::max(mNodes[sink].mHeight, mNodes[g].mHeight);
+				nodeRise.mHeight = 1 + std::max(nodeA.mHeight, mNodes[f].mHeight);
+
+				return rise;
+			};
+
+			if (balance > 1)
+				return Rotate(c, b);
+			if (balance < -1)
+				return Rotate(b, c);
+
+			return a;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#include "Broadphase.h"
+
+// 叶子节点的胖包围盒向每个方向扩大的距离，刚体的包围盒没有超出胖包围盒时不需要更新树
+#define DYNAMIC_AABB_TREE_MARGIN 0.1f
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		// 动态AABB树，节点存放在连续数组里，用下标互相引用
+		// 叶子节点存的是扩大后的胖包围盒，刚体移出胖包围盒时才会移除再重新插入
+		// 插入和删除后通过旋转保持树的平衡，任意节点两个子树的高度差不超过1
+		class DynamicAABBTree : public Broadphase
+		{
+		public:
+			DynamicAABBTree(float margin = DYNAMIC_AABB_TREE_MARGIN);
+			~DynamicAABBTree() {};
+
+			virtual BroadphaseType GetType() const;
+			virtual bool IsEmpty() const;
+
+			virtual void Insert(RigidBody* body, const BoundingBox& bounds);
+			virtual void Remove(RigidBody* body);
+			virtual void Update(RigidBody* body, const BoundingBox& bounds);
+			virtual uint32_t GetPotentialContacts(PotentialContact* contacts, uint32_t limit);
+
+			// 获取树的高度，叶子节点高度为0
+			int32_t GetHeight() const;
+
+		private:
+			struct TreeNode
+			{
+				// 叶子节点为胖包围盒，非叶子节点为两个子节点的合并包围盒
+				BoundingBox mBounds;
+				// 叶子节点对应的刚体
+				RigidBody* mRigidBody = nullptr;
+				// 父节点，节点空闲时用来记录空闲链表中的下一个节点
+				uint32_t mParent = UINT32_MAX;
+				uint32_t mChildren[2] = { UINT32_MAX, UINT32_MAX };
+				// 叶子节点为0，空闲节点为-1
+				int32_t mHeight = -1;
+
+				bool IsLeaf() const { return mChildren[0] == UINT32_MAX; }
+			};
+
+			float mMargin;
+			uint32_t mRoot = UINT32_MAX;
+			uint32_t mFreeList = UINT32_MAX;
+			vector<TreeNode> mNodes;
+			// 遍历时用的栈，每次查询复用
+			vector<uint32_t> mStack;
+
+			uint32_t AllocateNode();
+			void FreeNode(uint32_t id);
+
+			void InsertLeaf(uint32_t leaf);
+			void RemoveLeaf(uint32_t leaf);
+			// 如果节点a的两个子树高度差超过1就做一次旋转，返回旋转后该位置的新节点
+			uint32_t Balance(uint32_t a);
+			// 从节点开始向上更新包围盒和高度，并在路径上做平衡
+			void Refit(uint32_t id);
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,333 @@
+#include "SweepAndPrune.h"
+#include "../RigidBody.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		BroadphaseType SweepAndPrune::GetType() const
+		{
+			return BroadphaseType::SweepAndPrune;
+		}
+
+		bool SweepAndPrune::IsEmpty() const
+		{
+			return mProxyNum == 0;
+		}
+
+		uint32_t SweepAndPrune::GetPairNum() const
+		{
+			return static_cast<uint32_t>(mPairs.size());
+		}
+
+		void SweepAndPrune::Insert(RigidBody* body, const BoundingBox& bounds)
+		{
+			uint32_t id = AllocateProxy();
+			auto& proxy = mProxies[id];
+			proxy.mRigidBody = body;
+			proxy.mBounds = bounds;
+			body->mBroadphaseID = id;
+
+			mPendingProxies.push_back(id);
+			mProxyNum++;
+		}
+
+		void SweepAndPrune::Remove(RigidBody* body)
+		{
+			uint32_t id = body->mBroadphaseID;
+			if (id == UINT32_MAX)
+				return;
+
+			FlushPendingProxies();
+
+			for (uint32_t axis = 0; axis < 3; axis++)
+			{
+				auto& endpoints = mEndpoints[axis];
+				uint32_t minIndex = mProxies[id].mMin[axis];
+				uint32_t maxIndex = mProxies[id].mMax[axis];
+
+				// 最大值端点一定在最小值端点后面，先删后面的
+				endpoints.erase(endpoints.begin() + maxIndex);
+				endpoints.erase(endpoints.begin() + minIndex);
+
+				uint32_t endpointNum = static_cast<uint32_t>(endpoints.size());
+				for (uint32_t i = minIndex; i < endpointNum; i++)
+					SetEndpointIndex(axis, i);
+			}
+
+			// 从后往前遍历，RemovePair会把最后一个元素换到当前位置
+			for (size_t i = mPairs.size(); i > 0; i--)
+			{
+				auto& pair = mPairs[i - 1];
+				if (pair.mProxies[0] == id || pair.mProxies[1] == id)
+					RemovePair(pair.mProxies[0], pair.mProxies[1]);
+			}
+
+			FreeProxy(id);
+			body->mBroadphaseID = UINT32_MAX;
+			mProxyNum--;
+		}
+
+		void SweepAndPrune::Update(RigidBody* body, const BoundingBox& bounds)
+		{
+			uint32_t id = body->mBroadphaseID;
+			if (id == UINT32_MAX)
+				return;
+
+			FlushPendingProxies();
+
+			BoundingBox oldBounds = mProxies[id].mBounds;
+			// 先更新包围盒，产生重叠开始事件时需要用新的包围盒判断三个轴是否都重叠
+			mProxies[id].mBounds = bounds;
+
+			for (uint32_t axis = 0; axis < 3; axis++)
+			{
+				uint32_t minIndex = mProxies[id].mMin[axis];
+				uint32_t maxIndex = mProxies[id].mMax[axis];
+				mEndpoints[axis][minIndex].mValue = bounds.mMin[axis];
+				mEndpoints[axis][maxIndex].mValue = bounds.mMax[axis];
+
+				float deltaMin = bounds.mMin[axis] - oldBounds.mMin[axis];
+				float deltaMax = bounds.mMax[axis] - oldBounds.mMax[axis];
+
+				// 先处理扩大的方向再处理缩小的方向，保证最小值端点和最大值端点不会互相越过
+				if (deltaMin < 0.0f)
+					SortDown(axis, mProxies[id].mMin[axis], true);
+				if (deltaMax > 0.0f)
+					SortUp(axis, mProxies[id].mMax[axis], true);
+				if (deltaMin > 0.0f)
+					SortUp(axis, mProxies[id].mMin[axis], true);
+				if (deltaMax < 0.0f)
+					SortDown(axis, mProxies[id].mMax[axis], true);
+			}
+		}
+
+		uint32_t SweepAndPrune::GetPotentialContacts(PotentialContact* contacts, uint32_t limit)
+		{
+			FlushPendingProxies();
+
+			uint32_t count = Math::Min(static_cast<uint32_t>(mPairs.size()), limit);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				contacts[i].mRigidBodies[0] = mProxies[mPairs[i].mProxies[0]].mRigidBody;
+				contacts[i].mRigidBodies[1] = mProxies[mPairs[i].mProxies[1]].mRigidBody;
+			}
+			return static_cast<uint32_t>(mPairs.size());
+		}
+
+		uint32_t SweepAndPrune::AllocateProxy()
+		{
+			if (mFreeList == UINT32_MAX)
+			{
+				mProxies.push_back(Proxy());
+				return static_cast<uint32_t>(mProxies.size() - 1);
+			}
+
+			uint32_t id = mFreeList;
+			mFreeList = mProxies[id].mMin[0];
+			mProxies[id] = Proxy();
+			return id;
+		}
+
+		void SweepAndPrune::FreeProxy(uint32_t id)
+		{
+			mProxies[id].mRigidBody = nullptr;
+			mProxies[id].mMin[0] = mFreeList;
+			mFreeList = id;
+		}
+
+		void SweepAndPrune::FlushPendingProxies()
+		{
+			if (mPendingProxies.empty())
+				return;
+
+			// 新端点单独排好序后和原来的数组归并，代价是O(n + m log m)，逐个插入排序是O(n * m)
+			auto isLess = [](const Endpoint& a, const Endpoint& b) { return a.IsLess(b); };
+			for (uint32_t axis = 0; axis < 3; axis++)
+			{
+				auto& endpoints = mEndpoints[axis];
+				size_t oldNum = endpoints.size();
+				for (auto id : mPendingProxies)
+				{
+					Endpoint minPoint;
+					minPoint.mValue = mProxies[id].mBounds.mMin[axis];
+					minPoint.mData = id << 1;
+					endpoints.push_back(minPoint);
+
+					Endpoint maxPoint;
+					maxPoint.mValue = mProxies[id].mBounds.mMax[axis];
+					maxPoint.mData = (id << 1) | 1;
+					endpoints.push_back(maxPoint);
+				}
+
+				std::sort(endpoints.begin() + oldNum, endpoints.end(), isLess);
+				std::inplace_merge(endpoints.begin(), endpoints.begin() + oldNum, endpoints.end(), isLess);
+
+				uint32_t endpointNum = static_cast<uint32_t>(endpoints.size());
+				for (uint32_t i = 0; i < endpointNum; i++)
+					SetEndpointIndex(axis, i);
+			}
+
+			// 沿x轴扫描一遍，只检查至少有一个是新Proxy的刚体对，原有的刚体对已经在集合里了
+			vector<bool> isPending(mProxies.size(), false);
+			for (auto id : mPendingProxies)
+				isPending[id] = true;
+
+			// 当前在x轴上处于区间内的Proxy，新的和原有的分开记录
+			vector<uint32_t> activeProxies[2];
+			vector<uint32_t> activeSlots(mProxies.size(), UINT32_MAX);
+			for (auto& point : mEndpoints[0])
+			{
+				uint32_t id = point.GetProxy();
+				auto& active = activeProxies[isPending[id] ? 1 : 0];
+
+				if (point.IsMax())
+				{
+					// 把最后一个换到被删除的位置
+					uint32_t slot = activeSlots[id];
+					active[slot] = active.back();
+					activeSlots[active[slot]] = slot;
+					active.pop_back();
+					continue;
+				}
+
+				const BoundingBox& bounds = mProxies[id].mBounds;
+				for (auto other : activeProxies[1])
+				{
+					if (mProxies[other].mBounds.IsOverlapWith(bounds))
+						AddPair(id, other);
+				}
+				if (isPending[id])
+				{
+					for (auto other : activeProxies[0])
+					{
+						if (mProxies[other].mBounds.IsOverlapWith(bounds))
+							AddPair(id, other);
+					}
+				}
+
+				activeSlots[id] = static_cast<uint32_t>(active.size());
+				active.push_back(id);
+			}
+
+			mPendingProxies.clear();
+		}
+
+		void SweepAndPrune::SortDown(uint32_t axis, uint32_t index, bool sendEvent)
+		{
+			auto& endpoints = mEndpoints[axis];
+			Endpoint point = endpoints[index];
+
+			while (index > 0 && point.IsLess(endpoints[index - 1]))
+			{
+				const Endpoint& prev = endpoints[index - 1];
+				if (sendEvent)
+				{
+					// 最小值端点越过了别人的最大值端点，这个轴上开始重叠
+					if (!point.IsMax() && prev.IsMax())
+						OnOverlapBegin(point.GetProxy(), prev.GetProxy());
+					// 最大值端点越过了别人的最小值端点，这个轴上不再重叠
+					else if (point.IsMax() && !prev.IsMax())
+						OnOverlapEnd(point.GetProxy(), prev.GetProxy());
+				}
+
+				endpoints[index] = prev;
+				SetEndpointIndex(axis, index);
+				index--;
+			}
+
+			endpoints[index] = point;
+			SetEndpointIndex(axis, index);
+		}
+
+		void SweepAndPrune::SortUp(uint32_t axis, uint32_t index, bool sendEvent)
+		{
+			auto& endpoints = mEndpoints[axis];
+			Endpoint point = endpoints[index];
+			uint32_t lastIndex = static_cast<uint32_t>(endpoints.size() - 1);
+
+			while (index < lastIndex && endpoints[index + 1].IsLess(point))
+			{
+				const Endpoint& next = endpoints[index + 1];
+				if (sendEvent)
+				{
+					// 最大值端点越过了别人的最小值端点，这个轴上开始重叠
+					if (point.IsMax() && !next.IsMax())
+						OnOverlapBegin(point.GetProxy(), next.GetProxy());
+					// 最小值端点越过了别人的最大值端点，这个轴上不再重叠
+					else if (!point.IsMax() && next.IsMax())
+						OnOverlapEnd(point.GetProxy(), next.GetProxy());
+				}
+
+				endpoints[index] = next;
+				SetEndpointIndex(axis, index);
+				index++;
+			}
+
+			endpoints[index] = point;
+			SetEndpointIndex(axis, index);
+		}
+
+		void SweepAndPrune::SetEndpointIndex(uint32_t axis, uint32_t index)
+		{
+			const Endpoint& point = mEndpoints[axis][index];
+			if (point.IsMax())
+				mProxies[point.GetProxy()].mMax[axis] = index;
+			else
+				mProxies[point.GetProxy()].mMin[axis] = index;
+		}
+
+		void SweepAndPrune::OnOverlapBegin(uint32_t proxy1, uint32_t proxy2)
+		{
+			// 这个轴上开始重叠不代表其它轴也重叠，要用完整的包围盒再判断一次
+			if (mProxies[proxy1].mBounds.IsOverlapWith(mProxies[proxy2].mBounds))
+				AddPair(proxy1, proxy2);
+		}
+
+		void SweepAndPrune::OnOverlapEnd(uint32_t proxy1, uint32_t proxy2)
+		{
+			RemovePair(proxy1, proxy2);
+		}
+
+		void SweepAndPrune::AddPair(uint32_t proxy1, uint32_t proxy2)
+		{
+			uint64_t key = GetPairKey(proxy1, proxy2);
+			// 同一对刚体可能在多个轴上都产生重叠开始事件
+			if (mPairIndices.find(key) != mPairIndices.end())
+				return;
+
+			ProxyPair pair;
+			pair.mProxies[0] = Math::Min(proxy1, proxy2);
+			pair.mProxies[1] = Math::Max(proxy1, proxy2);
+
+			mPairIndices[key] = static_cast<uint32_t>(mPairs.size());
+			mPairs.push_back(pair);
+		}
+
+		void SweepAndPrune::RemovePair(uint32_t proxy1, uint32_t proxy2)
+		{
+			auto iter = mPairIndices.find(GetPairKey(proxy1, proxy2));
+			if (iter == mPairIndices.end())
+				return;
+
+			// 把最后一个刚体对换到被删除的位置
+			uint32_t index = iter->second;
+			uint32_t lastIndex = static_cast<uint32_t>(mPairs.size() - 1);
+			if (index != lastIndex)
+			{
+				mPairs[index] = mPairs[lastIndex];
+				mPairIndices[GetPairKey(mPairs[index].mProxies[0], mPairs[index].mProxies[1])] = index;
+			}
+
+			mPairs.pop_back();
+			mPairIndices.erase(iter);
+		}
+
+		uint64_t SweepAndPrune::GetPairKey(uint32_t proxy1, uint32_t proxy2)
+		{
+			uint64_t low = Math::Min(proxy1, proxy2);
+			uint64_t high = Math::Max(proxy1, proxy2);
+			return (high << 32) | low;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+#include "Broadphase.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		// 增量式的扫描排序(Sweep and Prune)
+		// 每个轴上维护一个按坐标排好序的端点数组，刚体移动后用插入排序把端点移到新位置
+		// 端点交换时产生重叠开始或结束的事件，用来维护一个持久的刚体对集合
+		// 大部分刚体静止或者移动很少时，每帧只需要很少的交换，适合堆叠和堆积的场景
+		// 新插入的刚体先暂存起来，下一次Update，Remove或者查询时一起排序合并到端点数组里，加载大量刚体时不会变成O(n^2)
+		class SweepAndPrune : public Broadphase
+		{
+		public:
+			SweepAndPrune() {};
+			~SweepAndPrune() {};
+
+			virtual BroadphaseType GetType() const;
+			virtual bool IsEmpty() const;
+
+			virtual void Insert(RigidBody* body, const BoundingBox& bounds);
+			virtual void Remove(RigidBody* body);
+			virtual void Update(RigidBody* body, const BoundingBox& bounds);
+			virtual uint32_t GetPotentialContacts(PotentialContact* contacts, uint32_t limit);
+
+			// 当前持久保存的刚体对数量
+			uint32_t GetPairNum() const;
+
+		private:
+			struct Endpoint
+			{
+				float mValue = 0.0f;
+				// 高31位是Proxy下标，最低位为1表示是最大值端点
+				uint32_t mData = 0;
+
+				uint32_t GetProxy() const { return mData >> 1; }
+				bool IsMax() const { return (mData & 1) != 0; }
+				// 坐标相同时最小值端点排在前面，这样排序结果和BoundingBox::IsOverlapWith的判断一致
+				bool IsLess(const Endpoint& other) const { return mValue < other.mValue || (mValue == other.mValue && !IsMax() && other.IsMax()); }
+			};
+
+			struct Proxy
+			{
+				RigidBody* mRigidBody = nullptr;
+				BoundingBox mBounds;
+				// 在每个轴的端点数组里的下标，Proxy空闲时mMin[0]用来记录空闲链表中的下一个Proxy
+				uint32_t mMin[3] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+				uint32_t mMax[3] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+			};
+
+			struct ProxyPair
+			{
+				uint32_t mProxies[2] = { UINT32_MAX, UINT32_MAX };
+			};
+
+			uint32_t mProxyNum = 0;
+			uint32_t mFreeList = UINT32_MAX;
+			vector<Proxy> mProxies;
+			vector<Endpoint> mEndpoints[3];
+			// 已经插入但是还没有合并到端点数组里的Proxy
+			vector<uint32_t> mPendingProxies;
+
+			// 持久的刚体对集合，用数组保存保证遍历顺序是确定的，用哈希表记录每个刚体对在数组里的下标
+			vector<ProxyPair> mPairs;
+			unordered_map<uint64_t, uint32_t> mPairIndices;
+
+			uint32_t AllocateProxy();
+			void FreeProxy(uint32_t id);
+			// 把暂存的Proxy合并到端点数组里，并生成和它们有关的刚体对
+			void FlushPendingProxies();
+
+			// 把端点数组里的某个端点移动到排好序的位置，sendEvent为false时只排序不产生重叠事件
+			void SortDown(uint32_t axis, uint32_t index, bool sendEvent);
+			void SortUp(uint32_t axis, uint32_t index, bool sendEvent);
+			// 交换后更新Proxy里记录的端点下标
+			void SetEndpointIndex(uint32_t axis, uint32_t index);
+
+			// 重叠开始事件，两个包围盒在三个轴上都重叠时添加刚体对
+			void OnOverlapBegin(uint32_t proxy1, uint32_t proxy2);
+			// 重叠结束事件，只要有一个轴不重叠了就移除刚体对
+			void OnOverlapEnd(uint32_t proxy1, uint32_t proxy2);
+
+			void AddPair(uint32_t proxy1, uint32_t proxy2);
+			void RemovePair(uint32_t proxy1, uint32_t proxy2);
+			static uint64_t GetPairKey(uint32_t proxy1, uint32_t proxy2);
+		};
+	}
+}
\ No newline at end of file
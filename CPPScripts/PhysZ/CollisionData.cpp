@@ -7,23 +7,21 @@ namespace ZXEngine
 	{
 		CollisionData::CollisionData(uint32_t maxContacts)
 		{
-			mMaxContactCount = maxContacts;
+			mContactArena    = new FrameArena<Contact>(maxContacts);
 			mCurContactCount = 0;
-			mContactArray    = new Contact[maxContacts];
-			mContactsLeft    = maxContacts;
-			mCurContact      = mContactArray;
+			UpdatePointers();
 		}
 
 		CollisionData::~CollisionData()
 		{
-			delete[] mContactArray;
+			delete mContactArena;
 		}
 
 		void CollisionData::Reset()
 		{
+			mContactArena->Tune(mCurContactCount);
 			mCurContactCount = 0;
-			mContactsLeft = mMaxContactCount;
-			mCurContact = mContactArray;
+			UpdatePointers();
 		}
 
 		bool CollisionData::IsFull() const
@@ -37,5 +35,22 @@ namespace ZXEngine
 			mCurContactCount += count;
 			mCurContact      += count;
 		}
+
+		bool CollisionData::Reserve(uint32_t count)
+		{
+			if (!mContactArena->Reserve(mCurContactCount + count, mCurContactCount))
+				return false;
+
+			UpdatePointers();
+			return true;
+		}
+
+		void CollisionData::UpdatePointers()
+		{
+			mContactArray    = mContactArena->GetData();
+			mMaxContactCount = mContactArena->GetCapacity();
+			mContactsLeft    = mMaxContactCount - mCurContactCount;
+			mCurContact      = mContactArray + mCurContactCount;
+		}
 	}
 }
\ No newline at end of file
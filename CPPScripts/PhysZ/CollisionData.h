@@ -1,5 +1,6 @@
 #pragma once
 #include "../pubh.h"
+#include "FrameArena.h"
 
 namespace ZXEngine
 {
@@ -9,23 +10,31 @@ namespace ZXEngine
 		class CollisionData
 		{
 		public:
-			// ײ
+			// 碰撞数组
 			Contact* mContactArray;
-			// 鳤
+			// 数组长度
 			uint32_t mMaxContactCount;
-			// ǰײ(һײҪλ)
+			// 当前碰撞(下一个碰撞数据要填入的位置)
 			Contact* mCurContact;
-			// ײʣռ
+			// 碰撞数组剩余空间
 			uint32_t mContactsLeft;
-			// ײ鵱ǰС
+			// 碰撞数组当前大小
 			uint32_t mCurContactCount;
 
 			CollisionData(uint32_t maxContacts);
 			~CollisionData();
 
+			// 清空碰撞数据，并根据上一帧的碰撞数量调整数组长度
 			void Reset();
 			bool IsFull() const;
 			void AddContacts(uint32_t count);
+			// 确保剩余空间不少于count，扩容后之前获取的Contact指针都会失效，发生了扩容返回true
+			bool Reserve(uint32_t count);
+
+		private:
+			FrameArena<Contact>* mContactArena;
+
+			void UpdatePointers();
 		};
 	}
 }
\ No newline at end of file
@@ -69,8 +69,8 @@ namespace ZXEngine
 			return 0;
 		}
 
-		// ڸBoxBoxײ
-		// ڷ㷨ĳǷصСصСͶӦķ
+		// 用于辅助Box和Box的碰撞检测
+		// 基于分离轴算法，返回在某个轴上是否重叠，并更新最小重叠大小和对应的分离轴索引
 		static inline bool TryAxis(
 			const CollisionBox& box1, 
 			const CollisionBox& box2, 
@@ -80,21 +80,21 @@ namespace ZXEngine
 			float& smallestPenetration, 
 			uint32_t& smallestCase)
 		{
-			// ǰķģӽ0˵Box(ԼֲϵXYZ֮һ)˳ķ
-			// ἸƽУַ᲻
+			// 如果当前检测的分离轴的模长接近0，说明是由两个Box的两条轴(自己局部坐标系的XYZ轴之一)叉乘出来的分离轴
+			// 并且这两条轴几乎平行，跳过这种分离轴不检测
 			if (axis.GetMagnitudeSquared() < 0.0001f)
 				return true;
 
 			axis.Normalize();
 
-			// Boxaxisϵص
+			// 计算两个Box在axis上的重叠长度
 			float penetration = IntersectionDetector::GetPenetrationOnAxis(box1, box2, axis, centerLine);
 
-			// صС0˵Boxaxisûصཻ
+			// 如果重叠长度小于0，说明两个Box在axis上没有重叠，不相交
 			if (penetration < 0.0f)
 				return false;
 
-			// ¼СصȺͷ
+			// 记录最小重叠长度和分离轴索引
 			if (penetration < smallestPenetration)
 			{
 				smallestPenetration = penetration;
@@ -104,8 +104,8 @@ namespace ZXEngine
 			return true;
 		}
 
-		// ڸBoxBoxײ
-		// Box2һBox1ڲʱһײ
+		// 用于辅助Box和Box的碰撞检测
+		// 当Box2的一个顶点在Box1的内部时，添加一个点面碰撞
 		static void FillPointFaceContact(
 			const CollisionBox& box1,
 			const CollisionBox& box2,
@@ -114,32 +114,45 @@ namespace ZXEngine
 			uint32_t axisIdx,
 			float penetration)
 		{
-			// ײΪBox1Ӧķ
+			// 碰撞法线为Box1对应面的法线
 			Vector3 normal = box1.mTransform.GetColumn(axisIdx);
-			// ײ߷ʼǴBox2Box1
+			// 这里是让碰撞法线方向始终是从Box2到Box1的
 			if (Math::Dot(normal, centerLine) > 0.0f)
 				normal = normal * -1.0f;
 
-			// Box2ĸ㷢ײ
+			// 计算具体是Box2的哪个顶点发生了碰撞
 			Vector3 vertex = box2.mHalfSize;
-			// Box2Box1࣬ôBox2ĶXΪBox2İ볤
+			// 用三个轴的正负号标记是哪个顶点
+			uint32_t vertexIdx = 0;
+			// 如果Box2在Box1的左侧，那么Box2的顶点的X坐标为Box2的半长
 			if (Math::Dot(Vector3(box2.mTransform.GetColumn(0)), normal) < 0.0f)
+			{
 				vertex.x = -vertex.x;
-			// Box2Box1²࣬ôBox2ĶYΪBox2İ
+				vertexIdx |= 1;
+			}
+			// 如果Box2在Box1的下侧，那么Box2的顶点的Y坐标为Box2的半宽
 			if (Math::Dot(Vector3(box2.mTransform.GetColumn(1)), normal) < 0.0f)
+			{
 				vertex.y = -vertex.y;
-			// Box2Box1ĺ࣬ôBox2ĶZΪBox2İ
+				vertexIdx |= 2;
+			}
+			// 如果Box2在Box1的后侧，那么Box2的顶点的Z坐标为Box2的半高
 			if (Math::Dot(Vector3(box2.mTransform.GetColumn(2)), normal) < 0.0f)
+			{
 				vertex.z = -vertex.z;
+				vertexIdx |= 4;
+			}
 
-			// ǰҪдײ
+			// 当前要写入的碰撞
 			Contact* contact = data->mCurContact;
-			// ײ
+			// 碰撞法线
 			contact->mContactNormal = normal;
-			// ײ(Box2任ϵ)
+			// 碰撞点(Box2顶点变换到世界坐标系)
 			contact->mContactPoint = box2.mTransform * vertex;
-			// ײ
+			// 碰撞深度
 			contact->mPenetration = penetration;
+			// 特征ID由Box1的面和Box2的顶点组成
+			contact->mFeatureID = (axisIdx << 3) | vertexIdx;
 			contact->SetRigidBodies(box1.mRigidBody, box2.mRigidBody);
 		}
 
@@ -149,11 +162,11 @@ namespace ZXEngine
 		{
 			Vector3 centerLine = box2.mTransform.GetColumn(3) - box1.mTransform.GetColumn(3);
 
-			// ڼ¼СصȺͶӦķ
+			// 用于记录最小重叠长度和对应的分离轴索引
 			float penetration = FLT_MAX;
 			uint32_t axisIdx = 0xFF;
 
-			// ֱBox
+			// 分别检测两个Box的三条轴
 			CHECK_OVERLAP(box1.mTransform.GetColumn(0), 0);
 			CHECK_OVERLAP(box1.mTransform.GetColumn(1), 1);
 			CHECK_OVERLAP(box1.mTransform.GetColumn(2), 2);
@@ -162,7 +175,7 @@ namespace ZXEngine
 			CHECK_OVERLAP(box2.mTransform.GetColumn(1), 4);
 			CHECK_OVERLAP(box2.mTransform.GetColumn(2), 5);
 
-			// BoxĲ
+			// 计算两个Box的三条轴的叉乘轴
 			CHECK_OVERLAP(Math::Cross(box1.mTransform.GetColumn(0), box2.mTransform.GetColumn(0)), 6);
 			CHECK_OVERLAP(Math::Cross(box1.mTransform.GetColumn(0), box2.mTransform.GetColumn(1)), 7);
 			CHECK_OVERLAP(Math::Cross(box1.mTransform.GetColumn(0), box2.mTransform.GetColumn(2)), 8);
@@ -179,25 +192,25 @@ namespace ZXEngine
 				return 0;
 			}
 
-			// Box2һײBox1һ
+			// Box2的一个顶点碰撞到Box1的一个面
 			if (axisIdx < 3)
 			{
 				FillPointFaceContact(box1, box2, centerLine, data, axisIdx, penetration);
 				data->AddContacts(1);
 				return 1;
 			}
-			// Box1һײBox2һ
+			// Box1的一个顶点碰撞到Box2的一个面
 			else if (axisIdx < 6)
 			{
-				// Box1Box2centerLineȡ
+				// 交换Box1和Box2，centerLine取反
 				FillPointFaceContact(box2, box1, centerLine * -1.0f, data, axisIdx - 3, penetration);
 				data->AddContacts(1);
 				return 1;
 			}
-			// Box1Box2һײԷһ
+			// Box1和Box2的一个边碰撞到对方的一个边
 			else
 			{
-				// ȡ
+				// 获取分离轴
 				axisIdx -= 6;
 				uint32_t box1AxisIdx = axisIdx / 3;
 				uint32_t box2AxisIdx = axisIdx % 3;
@@ -206,12 +219,12 @@ namespace ZXEngine
 				Vector3 axis = Math::Cross(axis1, axis2);
 				axis.Normalize();
 
-				// ȷBox1ָBox2
+				// 确保分离轴从Box1指向Box2
 				if (Math::Dot(axis, centerLine) > 0.0f)
 					axis = axis * -1.0f;
 
-				// Box1Box2ϸ4ߺͷᴹֱҪλཻ2
-				// ȼ4ߵеһBox
+				// Box1和Box2上各自有4条边和分离轴垂直，需要定位相交的2条边
+				// 这里先计算各自4条边的中点里，离另一个Box最近的
 				Vector3 midPoint1 = box1.mHalfSize;
 				Vector3 midPoint2 = box2.mHalfSize;
 				for (uint32_t i = 0; i < 3; ++i)
@@ -227,25 +240,27 @@ namespace ZXEngine
 						midPoint2[i] = -midPoint2[i];
 				}
 
-				// еתϵ
+				// 把这两个中点转换到世界坐标系下
 				midPoint1 = box1.mTransform * Vector4(midPoint1, 1.0f);
 				midPoint2 = box2.mTransform * Vector4(midPoint2, 1.0f);
 
-				// ȡ߶εĽ
+				// 获取两条线段的交点
 				Vector3 contactPoint;
 				IntersectionDetector::DetectLineSegmentContact(
 					midPoint1, axis1, box1.mHalfSize[box1AxisIdx], 
 					midPoint2, axis2, box2.mHalfSize[box2AxisIdx],
 					contactPoint, axisIdx > 2);
 
-				// ǰҪдײ
+				// 当前要写入的碰撞
 				Contact* contact = data->mCurContact;
-				// ײ
+				// 碰撞法线
 				contact->mContactNormal = axis;
-				// ײ
+				// 碰撞点
 				contact->mContactPoint = contactPoint;
-				// ײ
+				// 碰撞深度
 				contact->mPenetration = penetration;
+				// 特征ID由两条边组成，和点面碰撞的ID区分开
+				contact->mFeatureID = 0x40 | axisIdx;
 				contact->SetRigidBodies(box1.mRigidBody, box2.mRigidBody);
 
 				data->AddContacts(1);
@@ -255,16 +270,16 @@ namespace ZXEngine
 
 		uint32_t CollisionDetector::Detect(const CollisionBox& box, const CollisionSphere& sphere, CollisionData* data)
 		{
-			// ʣײҪż
+			// 还有剩余碰撞需要检测才继续
 			if (data->IsFull()) 
 				return 0;
 
-			// ϵµ
+			// 世界坐标系下的球心
 			Vector3 gSphereCenter = sphere.mTransform.GetColumn(3);
-			// Boxϵµ
+			// Box坐标系下的球心
 			Vector3 lSphereCenter = Math::Inverse(box.mTransform) * Vector4(gSphereCenter, 1.0f);
 
-			// жǷཻ(ĿܣûҪȷཻ)
+			// 粗略判断是否相交(目的是提高性能，所以没必要做精确的相交检测)
 			if (fabsf(lSphereCenter.x) - sphere.mRadius > box.mHalfSize.x ||
 				fabsf(lSphereCenter.y) - sphere.mRadius > box.mHalfSize.y ||
 				fabsf(lSphereCenter.z) - sphere.mRadius > box.mHalfSize.z)
@@ -272,12 +287,12 @@ namespace ZXEngine
 				return 0;
 			}
 
-			// Boxĵ
+			// Box上离球心最近的点
 			Vector3 closestPoint(0.0f, 0.0f, 0.0f);
-			// ʱ
+			// 临时变量
 			float distance;
 
-			// 
+			// 分轴计算最近点
 			distance = lSphereCenter.x;
 			if (distance >  box.mHalfSize.x) distance =  box.mHalfSize.x;
 			if (distance < -box.mHalfSize.x) distance = -box.mHalfSize.x;
@@ -293,22 +308,23 @@ namespace ZXEngine
 			if (distance < -box.mHalfSize.z) distance = -box.mHalfSize.z;
 			closestPoint.z = distance;
 
-			// жǷཻ
+			// 判断是否相交
 			distance = (closestPoint - lSphereCenter).GetMagnitudeSquared();
 			if (distance > sphere.mRadius * sphere.mRadius)
 				return 0;
 
-			// 任ϵ
+			// 变换到世界坐标系
 			closestPoint = box.mTransform * Vector4(closestPoint, 1.0f);
 
-			// ǰҪдײ
+			// 当前要写入的碰撞
 			Contact* contact = data->mCurContact;
-			// ײ
+			// 碰撞法线
 			contact->mContactNormal = (closestPoint - gSphereCenter).GetNormalized();
-			// ײ
+			// 碰撞点
 			contact->mContactPoint = closestPoint;
-			// ײ
+			// 碰撞深度
 			contact->mPenetration = sphere.mRadius - sqrtf(distance);
+			contact->mFeatureID = 0;
 			contact->SetRigidBodies(box.mRigidBody, sphere.mRigidBody);
 
 			data->AddContacts(1);
@@ -317,31 +333,32 @@ namespace ZXEngine
 
 		uint32_t CollisionDetector::Detect(const CollisionSphere& sphere1, const CollisionSphere& sphere2, CollisionData* data)
 		{
-			// ʣײҪż
+			// 还有剩余碰撞需要检测才继续
 			if (data->IsFull()) 
 				return 0;
 
-			// ײλ
+			// 两个碰撞球的位置
 			Vector3 pos1 = sphere1.mTransform.GetColumn(3);
 			Vector3 pos2 = sphere2.mTransform.GetColumn(3);
 
 			Vector3 centerLine = pos1 - pos2;
 			float distance = centerLine.GetMagnitude();
 
-			// ײľ߰뾶֮ײ
+			// 两个碰撞球的距离大于两者半径之和则不碰撞
 			if (distance <= 0.0f || distance >= sphere1.mRadius + sphere2.mRadius)
 			{
 				return 0;
 			}
 
-			// ǰҪдײ
+			// 当前要写入的碰撞
 			Contact* contact = data->mCurContact;
-			// ײ
+			// 碰撞法线
 			contact->mContactNormal = centerLine.GetNormalized();
-			// ײ(һ߽)
+			// 碰撞点(第一个球的球面和球心连线交点)
 			contact->mContactPoint = pos1 - contact->mContactNormal * sphere1.mRadius;
-			// ײ
+			// 碰撞深度
 			contact->mPenetration = (sphere1.mRadius + sphere2.mRadius) - distance;
+			contact->mFeatureID = 0;
 			contact->SetRigidBodies(sphere1.mRigidBody, sphere2.mRigidBody);
 
 			data->AddContacts(1);
@@ -355,11 +372,11 @@ namespace ZXEngine
 		};
 		uint32_t CollisionDetector::Detect(const CollisionBox& box, const CollisionPlane& plane, CollisionData* data, bool isHalfSpace)
 		{
-			// ʣײҪż
+			// 还有剩余碰撞需要检测才继续
 			if (data->IsFull())
 				return 0;
 
-			// һཻ
+			// 先做一个相交测试
 			if (!IntersectionDetector::Detect(box, plane))
 				return 0;
 
@@ -367,26 +384,28 @@ namespace ZXEngine
 			uint32_t contactNum = 0;
 			for (size_t i = 0; i < 8; i++)
 			{
-				// ϵµBox
+				// 世界坐标系下的Box顶点
 				Vector3 vertexPos = box.mTransform * Vector4(boxVertex[i] * box.mHalfSize, 1.0f);
-				// ƽ淨߷ϵԭľ
+				// 顶点沿平面法线方向到世界坐标系原点的距离
 				float distance = Math::Dot(vertexPos, plane.mNormal);
 
 				if (distance <= plane.mDistance)
 				{
-					// ײֱƽ淨
+					// 碰撞法线直接用平面法线
 					contact->mContactNormal = plane.mNormal;
-					// ײ(ƽ)
+					// 碰撞点(在平面上)
 					contact->mContactPoint = vertexPos + plane.mNormal * (plane.mDistance - distance);
-					// ײ(ײ㵽ƽľ)
+					// 碰撞深度(碰撞点到平面的距离)
 					contact->mPenetration = plane.mDistance - distance;
+					// 特征ID为Box的顶点索引
+					contact->mFeatureID = static_cast<uint32_t>(i);
 					contact->SetRigidBodies(box.mRigidBody, nullptr);
 					
-					// ָ
+					// 指针后移
 					contact++;
 					contactNum++;
 
-					// ײѾˣֱӷ
+					// 碰撞数据已经满了，直接返回
 					if (contactNum == data->mContactsLeft)
 					{
 						data->AddContacts(contactNum);
@@ -409,23 +428,23 @@ namespace ZXEngine
 
 		uint32_t CollisionDetector::DetectSphereAndPlane(const CollisionSphere& sphere, const CollisionPlane& plane, CollisionData* data)
 		{
-			// ʣײҪż
+			// 还有剩余碰撞需要检测才继续
 			if (data->IsFull())
 				return 0;
 
-			// ײλ
+			// 碰撞球的位置
 			Vector3 pos = sphere.mTransform.GetColumn(3);
 
-			// ײĵײƽľ
+			// 碰撞球球心到碰撞平面的距离
 			float distance = Math::Dot(plane.mNormal, pos) - plane.mDistance;
 
-			// ײײƽľײ뾶ײ
+			// 碰撞球球心与碰撞平面的距离大于碰撞球半径则不碰撞
 			if (abs(distance) >= sphere.mRadius)
 				return 0;
 
 			Vector3 normal = plane.mNormal;
 			float penetration = -distance;
-			// Ϊ˵ƽı棬ȡ
+			// 距离为负说明球在平面的背面，数据取反
 			if (distance < 0.0f)
 			{
 				normal *= -1.0f;
@@ -433,14 +452,15 @@ namespace ZXEngine
 			}
 			penetration += sphere.mRadius;
 
-			// ǰҪдײ
+			// 当前要写入的碰撞
 			Contact* contact = data->mCurContact;
-			// ײ
+			// 碰撞法线
 			contact->mContactNormal = normal;
-			// ײ(ƽ)
+			// 碰撞点(在平面上)
 			contact->mContactPoint = pos - plane.mNormal * distance;
-			// ײ(ײ㵽ƽľ)
+			// 碰撞深度(碰撞点到平面的距离)
 			contact->mPenetration = penetration;
+			contact->mFeatureID = 0;
 			contact->SetRigidBodies(sphere.mRigidBody, nullptr);
 
 			data->AddContacts(1);
@@ -449,28 +469,29 @@ namespace ZXEngine
 
 		uint32_t CollisionDetector::DetectSphereAndHalfSpace(const CollisionSphere& sphere, const CollisionPlane& plane, CollisionData* data)
 		{
-			// ʣײҪż
+			// 还有剩余碰撞需要检测才继续
 			if (data->IsFull())
 				return 0;
 
-			// ײλ
+			// 碰撞球的位置
 			Vector3 pos = sphere.mTransform.GetColumn(3);
 
-			// ײײƽľ
+			// 碰撞球到碰撞平面的距离
 			float distance = Math::Dot(plane.mNormal, pos) - sphere.mRadius - plane.mDistance;
 
-			// ײײƽľ0ײ
+			// 碰撞球与碰撞平面的距离大于0则不碰撞
 			if (distance >= 0.0f)
 				return 0;
 
-			// ǰҪдײ
+			// 当前要写入的碰撞
 			Contact* contact = data->mCurContact;
-			// ײ
+			// 碰撞法线
 			contact->mContactNormal = plane.mNormal;
-			// ײ(ƽ)
+			// 碰撞点(在平面上)
 			contact->mContactPoint = pos - plane.mNormal * (distance + sphere.mRadius);
-			// ײ(ײ㵽ƽľ)
+			// 碰撞深度(碰撞点到平面的距离)
 			contact->mPenetration = -distance;
+			contact->mFeatureID = 0;
 			contact->SetRigidBodies(sphere.mRigidBody, nullptr);
 
 			data->AddContacts(1);
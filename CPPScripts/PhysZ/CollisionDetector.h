@@ -23,9 +23,9 @@ namespace ZXEngine
 			static uint32_t Detect(const CollisionSphere& sphere, const CollisionPlane& plane, CollisionData* data, bool isHalfSpace = true);
 
 		private:
-			// ƽײ(һάƽײ涼ײ)
+			// 球与平面碰撞检测(与一个真正的无体积二维平面碰撞，从正反两面都可以碰撞)
 			static uint32_t DetectSphereAndPlane(const CollisionSphere& sphere, const CollisionPlane& plane, CollisionData* data);
-			// ƽײ(ƽ浱һռ仮ֻ֣ܴײȫڱΪǶƽڣȻײ)
+			// 球与平面碰撞检测(把平面当作一个空间划分，只能从正面碰撞，如果完全在背面视为嵌入平面内，依然产生碰撞)
 			static uint32_t DetectSphereAndHalfSpace(const CollisionSphere& sphere, const CollisionPlane& plane, CollisionData* data);
 		};
 	}
@@ -20,7 +20,7 @@ namespace ZXEngine
 
 		Matrix3 CollisionBox::GetInertiaTensor(float mass) const
 		{
-			// halfSizeҪȳ2ƽдΪ*4
+			// 由于是halfSize，所以要先乘2再平方，简写为*4
 			float x2 = mHalfSize.x * mHalfSize.x * 4.0f;
 			float y2 = mHalfSize.y * mHalfSize.y * 4.0f;
 			float z2 = mHalfSize.z * mHalfSize.z * 4.0f;
@@ -36,11 +36,11 @@ namespace ZXEngine
 
 		float CollisionBox::GetHalfProjectedLength(const Vector3& axis) const
 		{
-			// Ȱռ任Boxľֲռ(ת)
+			// 先把轴从世界空间变换到Box的局部空间(仅考虑旋转即可)
 			Vector3 axisProjected = Math::Transpose(Matrix3(mTransform)) * axis;
-			// mHalfSizeŵͬһ
+			// 和mHalfSize放到同一个象限内
 			axisProjected.Absolutize();
-			// ȻBoxϵͶӰ
+			// 然后计算Box在这个轴上的投影长度
 			return Math::Dot(mHalfSize, axisProjected);
 		}
 
@@ -51,7 +51,7 @@ namespace ZXEngine
 
 		Matrix3 CollisionPlane::GetInertiaTensor(float mass) const
 		{
-			// Զƽ治ģ⣬
+			// 无限远平面不当作刚体来模拟，惯性张量无意义
 			return Matrix3();
 		}
 
@@ -10,49 +10,49 @@ namespace ZXEngine
 		class CollisionPrimitive
 		{
 		public:
-			// ײӦĸ
+			// 碰撞体所对应的刚体
 			RigidBody* mRigidBody = nullptr;
-			// ײڸƫ(ȫʹõλ󼴿)
+			// 碰撞体相对于刚体的偏移(若二者完全对齐则使用单位矩阵即可)
 			Matrix4 mOffset;
-			// ײı任
+			// 碰撞体相对于世界的变换矩阵
 			Matrix4 mTransform;
-			// Ħϵ
+			// 摩擦系数
 			float mFriction = 0.4f;
-			// صϵ
+			// 回弹系数
 			float mBounciness = 0.0f;
-			// ĦϵϷʽ
+			// 摩擦系数组合方式
 			CombineType mFrictionCombine = CombineType::Average;
-			// صϵϷʽ
+			// 回弹系数组合方式
 			CombineType mBounceCombine = CombineType::Average;
 
 			virtual ~CollisionPrimitive();
 
-			// ȡײ
+			// 获取碰撞体类型
 			virtual ColliderType GetType() const = 0;
-			// ɶӦ״ľʹ
+			// 生成对应形状的均质惯性张量
 			virtual Matrix3 GetInertiaTensor(float mass) const = 0;
 		};
 
 		class CollisionBox : public CollisionPrimitive
 		{
 		public:
-			// Box3ϵĳȰ뾶
+			// Box在3个轴上的长度半径
 			Vector3 mHalfSize;
 
 			virtual ColliderType GetType() const;
 			virtual Matrix3 GetInertiaTensor(float mass) const;
 
-			// ȡBoxͶӰĳϵĳȵһ
+			// 获取Box投影到某个轴上的长度的一半
 			float GetHalfProjectedLength(const Vector3& axis) const;
 		};
 
-		// ײƽ(ͨʾһƶǽ棬Ǹ壬ûм̳CollisionPrimitive)
+		// 碰撞平面(通常表示场景中一个不可移动的墙或地面，而不是刚体，所以没有继承CollisionPrimitive)
 		class CollisionPlane : public CollisionPrimitive
 		{
 		public:
-			// ײƽ淨
+			// 碰撞平面法线
 			Vector3 mNormal;
-			// ײƽ浽ԭľ
+			// 碰撞平面到原点的距离
 			float mDistance;
 
 			virtual ColliderType GetType() const;
@@ -62,7 +62,7 @@ namespace ZXEngine
 		class CollisionSphere : public CollisionPrimitive
 		{
 		public:
-			// ײ뾶
+			// 碰撞球半径
 			float mRadius;
 
 			virtual ColliderType GetType() const;
@@ -71,9 +71,9 @@ namespace ZXEngine
 
 		struct CollisionVolume
 		{
-			// ײ
+			// 碰撞体类型
 			ColliderType mType;
-			// ײָ
+			// 碰撞体指针
 			union
 			{
 				CollisionBox* mBox;
@@ -1,6 +1,11 @@
 #pragma once
 #include "../pubh.h"
 
+// 顺序冲量法用偏移速度消除相交，每帧消除(相交深度 - 容差)的多少比例
+#define SEQUENTIAL_IMPULSE_BAUMGARTE 0.2f
+// 顺序冲量法允许的相交深度，小于这个值不产生偏移速度，避免静止堆叠时来回抖动
+#define SEQUENTIAL_IMPULSE_SLOP 0.01f
+
 namespace ZXEngine
 {
 	namespace PhysZ
@@ -10,62 +15,86 @@ namespace ZXEngine
 		{
 			friend class ContactResolver;
 		public:
-			// ײ
+			// 碰撞点坐标
 			Vector3 mContactPoint;
-			// ײ
+			// 碰撞法线
 			Vector3 mContactNormal;
-			// ײ(ײཻʱ)
+			// 碰撞深度(有碰撞或相交时是正数)
 			float mPenetration = 0.0f;
-			// ָϵ
+			// 恢复系数
 			float mRestitution = 0.0f;
-			// Ħϵ
+			// 摩擦系数
 			float mFriction = 0.0f;
+			// 碰撞特征ID，用来区分同一对刚体之间的不同接触点(比如Box的不同顶点)，帧之间通过这个匹配同一个接触点
+			uint32_t mFeatureID = 0;
 
 			Contact(RigidBody* rigidBody1 = nullptr, RigidBody* rigidBody2 = nullptr);
 
 			void SetRigidBodies(RigidBody* rigidBody1, RigidBody* rigidBody2);
 
 		private:
-			// ײӦĸ
+			// 碰撞所对应的刚体
 			RigidBody* mRigidBodies[2];
-			// ײϵϵת
+			// 从碰撞坐标系到世界坐标系的旋转矩阵
 			Matrix3 mContactToWorld;
 
-			// ײλ
+			// 碰撞点相对于两个刚体的位置
 			Vector3 mRelativeContactPosition[2];
-			// ײıպٶ(໥ӽٶȣײռ)
+			// 碰撞点的闭合速度(即两个对象相互接近的速度，碰撞空间)
 			Vector3 mContactVelocity;
-			// ǰײٶȱ仯(պٶײϵı仯)
+			// 当前碰撞所产生的期望速度变化量(闭合速度在碰撞法线上的变化量)
 			float mDesiredDeltaVelocity = 0.0f;
 
-			// Ħϵͻָϵ
+			// 以下数据只在顺序冲量法中使用
+			// 累计冲量(碰撞空间)，x是法线方向，yz是两个切线方向
+			Vector3 mAccumulatedImpulse;
+			// 碰撞空间三个轴方向上的有效质量，即单位冲量产生的速度变化的倒数
+			Vector3 mEffectiveMass;
+			// 处理后法线方向上期望达到的分离速度，包括恢复系数带来的反弹和消除相交的偏移速度
+			float mTargetNormalVelocity = 0.0f;
+
+			// 更新摩擦系数和恢复系数
 			void UpdateCoefficient();
-			// 壬ͬʱײȡ(ǲرҪֶUpdateInternalDatas)
+			// 交换两个刚体，同时将碰撞法线取反(但是不会更新其它相关变量，如果需要更新手动调用UpdateInternalDatas)
 			void SwapRigidBodies();
-			// ײеĸ״̬һAwakeһҲAwake
+			// 更新碰撞中的刚体状态，如果其中一个刚体是Awake，另一个也必须Awake
 			void MatchAwakeState();
 
-			// ײ͸ͨƶת壬󲻽
-			// ȻͨǰָشϢ
-			// PS: ˺ȻڴཻҲıλúת״̬ǲֱӸımPenetrationɵõĵطȥmPenetration
+			// 处理碰撞穿透，通过移动和旋转两个刚体，尽量让两个对象不交叉
+			// 然后通过前两个指针参数返回处理信息
+			// PS: 此函数虽然是在处理相交，也会改变刚体的位置和旋转状态，但是并不会直接改变mPenetration，而是由调用的地方去调整mPenetration
 			void ResolvePenetration(Vector3 linearChange[2], Vector3 angularChange[2], float penetration);
-			// ײеٶȱ仯ٶȱ仯Ȼͨ
+			// 处理碰撞中的速度变化，计算两个刚体的速度变化量，然后通过参数返回
 			void ResolveVelocityChange(Vector3 linearVelocityChange[2], Vector3 angularVelocityChange[2]);
 
-			// Ħµĳ
+			// 计算有摩擦力情况下的冲量
 			Vector3 CalculateFrictionImpulse(Matrix3* inverseInertiaTensor);
-			// Ħµĳ
+			// 计算无摩擦力情况下的冲量
 			Vector3 CalculateFrictionlessImpulse(Matrix3* inverseInertiaTensor);
 
-			// µǰײĸڲ
+			// 更新当前碰撞点的各项内部数据
 			void UpdateInternalDatas(float duration);
-			// ײϵϵת
+			// 更新碰撞坐标系到世界坐标系的旋转矩阵
 			void UpdateOrthogonalBasis();
-			// 㵱ǰײٶȱ仯(պٶ)
+			// 计算当前碰撞所产生的期望速度变化量(闭合速度)
 			void UpdateDesiredDeltaVelocity(float duration);
 			
-			// indexײٶ
+			// 计算第index个刚体相对于碰撞点的速度
 			Vector3 CalculateLocalVelocity(uint32_t index, float duration);
+
+			// 顺序冲量法，需要先调用UpdateInternalDatas
+			// 计算有效质量和目标速度，然后用上一帧的累计冲量预热，warmStartImpulse是世界空间的冲量
+			void PrepareSequentialImpulse(float duration, const Vector3& warmStartImpulse);
+			// 做一次迭代，分别处理法线方向和两个切线方向，累计冲量会被限制在非穿透和摩擦力的约束范围内
+			void SolveSequentialImpulse();
+			// 获取世界空间的累计冲量，用于下一帧预热
+			Vector3 GetAccumulatedImpulseWorld() const;
+			// 计算两个刚体在碰撞点的相对速度(碰撞空间)，不包括加速度带来的变化
+			Vector3 CalculateRelativeVelocity() const;
+			// 把碰撞空间的冲量作用到两个刚体上
+			void ApplyImpulse(const Vector3& impulseContact);
+			// 计算沿世界空间方向direction作用单位冲量时，碰撞点在该方向上的速度变化量
+			float CalculateVelocityPerUnitImpulse(const Vector3& direction) const;
 		};
 	}
 }
\ No newline at end of file
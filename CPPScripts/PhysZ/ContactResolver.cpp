@@ -1,5 +1,7 @@
 #include "ContactResolver.h"
 #include "Contact.h"
+#include "RigidBody.h"
+#include "../Concurrent/JobSystem.h"
 
 namespace ZXEngine
 {
@@ -47,19 +49,266 @@ namespace ZXEngine
 			mPositionEpsilon = positionEpsilon;
 		}
 
+		void ContactResolver::SetSolverType(ContactSolverType type)
+		{
+			mSolverType = type;
+			mImpulseCache.clear();
+		}
+
+		ContactSolverType ContactResolver::GetSolverType() const
+		{
+			return mSolverType;
+		}
+
+		void ContactResolver::SetSequentialImpulseIterations(uint32_t iterations)
+		{
+			mSequentialImpulseIterations = iterations;
+		}
+
 		void ContactResolver::ResolveContacts(Contact* contacts, uint32_t numContacts, float duration)
 		{
 			if (numContacts == 0)
+			{
+				mImpulseCache.clear();
 				return;
+			}
 			if (!IsValid())
 				return;
 
-			// ׼ײ
-			PrepareContacts(contacts, numContacts, duration);
-			// ײཻ
-			AdjustPositions(contacts, numContacts, duration);
-			// ײٶȱ仯
-			AdjustVelocities(contacts, numContacts, duration);
+			BuildIslands(contacts, numContacts);
+
+			auto jobSystem = JobSystem::GetInstance();
+			uint32_t islandNum = static_cast<uint32_t>(mIslands.size());
+			if (jobSystem == nullptr || islandNum == 1 || numContacts < CONTACT_RESOLVER_PARALLEL_MIN_CONTACTS)
+			{
+				for (auto& island : mIslands)
+					ResolveIsland(island, contacts, duration);
+			}
+			else
+			{
+				jobSystem->ParallelFor(islandNum, 1, [this, contacts, duration](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; i++)
+						ResolveIsland(mIslands[i], contacts, duration);
+				});
+			}
+
+			mCurPositionIterations = 0;
+			mCurVelocityIterations = 0;
+			for (auto& island : mIslands)
+			{
+				mCurPositionIterations += island.mPositionIterations;
+				mCurVelocityIterations += island.mVelocityIterations;
+			}
+
+			if (mSolverType == ContactSolverType::SequentialImpulse)
+				UpdateImpulseCache(contacts);
+
+			UpdateIslandSleepState(contacts);
+		}
+
+		void ContactResolver::BuildIslands(Contact* contacts, uint32_t numContacts)
+		{
+			mIslands.clear();
+			mParents.clear();
+			mBodyIndices.clear();
+			mContactIslands.resize(numContacts);
+
+			// 合并每个碰撞中的两个刚体，地面这类非刚体对象为空，不会把站在上面的刚体连起来
+			// 无限质量的刚体虽然不会动，但是处理碰撞时还是会写入它的数据，所以也要参与合并，避免被多个线程同时写入
+			// 这里还没有执行PrepareContacts，非刚体对象不一定在第二个位置，所以用GetIslandBody取刚体
+			for (uint32_t i = 0; i < numContacts; i++)
+			{
+				uint32_t root0 = FindRoot(GetBodyIndex(GetIslandBody(contacts[i])));
+				if (contacts[i].mRigidBodies[0] && contacts[i].mRigidBodies[1])
+				{
+					uint32_t root1 = FindRoot(GetBodyIndex(contacts[i].mRigidBodies[1]));
+					// 统一让下标大的指向下标小的，保证结果和合并顺序无关
+					if (root0 < root1)
+						mParents[root1] = root0;
+					else if (root1 < root0)
+						mParents[root0] = root1;
+				}
+			}
+
+			// 按岛屿第一次出现的顺序编号，统计每个岛屿的碰撞数量
+			vector<uint32_t> rootToIsland(mParents.size(), UINT32_MAX);
+			for (uint32_t i = 0; i < numContacts; i++)
+			{
+				uint32_t root = FindRoot(mBodyIndices[GetIslandBody(contacts[i])]);
+				if (rootToIsland[root] == UINT32_MAX)
+				{
+					rootToIsland[root] = static_cast<uint32_t>(mIslands.size());
+					mIslands.emplace_back();
+				}
+
+				auto& island = mIslands[rootToIsland[root]];
+				island.mCount++;
+				for (uint32_t j = 0; j < 2; j++)
+				{
+					if (contacts[i].mRigidBodies[j] && contacts[i].mRigidBodies[j]->GetAwake())
+						island.mIsAwake = true;
+				}
+				mContactIslands[i] = rootToIsland[root];
+			}
+
+			if (mIslands.size() == 1)
+				return;
+
+			// 计数排序，把同一个岛屿的碰撞排到一起
+			uint32_t offset = 0;
+			for (auto& island : mIslands)
+			{
+				island.mBegin = offset;
+				offset += island.mCount;
+			}
+
+			mSortedContacts.resize(numContacts);
+			vector<uint32_t> cursors(mIslands.size());
+			for (size_t i = 0; i < mIslands.size(); i++)
+				cursors[i] = mIslands[i].mBegin;
+			for (uint32_t i = 0; i < numContacts; i++)
+				mSortedContacts[cursors[mContactIslands[i]]++] = contacts[i];
+			for (uint32_t i = 0; i < numContacts; i++)
+				contacts[i] = mSortedContacts[i];
+		}
+
+		void ContactResolver::UpdateIslandSleepState(Contact* contacts)
+		{
+			for (auto& island : mIslands)
+			{
+				if (!island.mIsAwake)
+					continue;
+
+				// 无限质量的刚体不会动，不影响岛屿能否休眠
+				bool ready = true;
+				for (uint32_t i = island.mBegin; i < island.mBegin + island.mCount && ready; i++)
+				{
+					for (uint32_t j = 0; j < 2; j++)
+					{
+						RigidBody* body = contacts[i].mRigidBodies[j];
+						if (body && !body->IsInfiniteMass() && !body->IsReadyToSleep())
+						{
+							ready = false;
+							break;
+						}
+					}
+				}
+
+				if (ready)
+					continue;
+
+				// 岛屿里还有在运动的刚体，整个岛屿都不能休眠，否则压在上面的刚体会悬空
+				for (uint32_t i = island.mBegin; i < island.mBegin + island.mCount; i++)
+				{
+					for (uint32_t j = 0; j < 2; j++)
+					{
+						if (contacts[i].mRigidBodies[j])
+							contacts[i].mRigidBodies[j]->SetReadyToSleep(false);
+					}
+				}
+			}
+		}
+
+		const RigidBody* ContactResolver::GetIslandBody(const Contact& contact)
+		{
+			return contact.mRigidBodies[0] ? contact.mRigidBodies[0] : contact.mRigidBodies[1];
+		}
+
+		uint32_t ContactResolver::GetBodyIndex(const RigidBody* rigidBody)
+		{
+			auto iter = mBodyIndices.find(rigidBody);
+			if (iter != mBodyIndices.end())
+				return iter->second;
+
+			uint32_t index = static_cast<uint32_t>(mParents.size());
+			mParents.push_back(index);
+			mBodyIndices[rigidBody] = index;
+			return index;
+		}
+
+		uint32_t ContactResolver::FindRoot(uint32_t index)
+		{
+			while (mParents[index] != index)
+			{
+				// 路径减半，让路径上的节点指向祖父节点
+				mParents[index] = mParents[mParents[index]];
+				index = mParents[index];
+			}
+			return index;
+		}
+
+		void ContactResolver::ResolveIsland(ContactIsland& island, Contact* contacts, float duration)
+		{
+			// 整个岛屿都在休眠就不需要处理
+			if (!island.mIsAwake)
+				return;
+
+			Contact* islandContacts = contacts + island.mBegin;
+			// 准备碰撞数据
+			PrepareContacts(islandContacts, island.mCount, duration);
+
+			if (mSolverType == ContactSolverType::SequentialImpulse)
+			{
+				island.mVelocityIterations = SolveSequentialImpulse(islandContacts, island.mCount, duration);
+				return;
+			}
+
+			// 处理碰撞相交
+			island.mPositionIterations = AdjustPositions(islandContacts, island.mCount, duration);
+			// 处理碰撞速度变化
+			island.mVelocityIterations = AdjustVelocities(islandContacts, island.mCount, duration);
+		}
+
+		uint32_t ContactResolver::SolveSequentialImpulse(Contact* contacts, uint32_t numContacts, float duration)
+		{
+			// 用上一帧同一个接触点的累计冲量预热，堆叠的物体一开始就有接近平衡的冲量，迭代次数少也能稳定
+			for (uint32_t i = 0; i < numContacts; i++)
+			{
+				auto iter = mImpulseCache.find(GetCacheKey(contacts[i]));
+				contacts[i].PrepareSequentialImpulse(duration, iter == mImpulseCache.end() ? Vector3() : iter->second);
+			}
+
+			for (uint32_t iteration = 0; iteration < mSequentialImpulseIterations; iteration++)
+			{
+				for (uint32_t i = 0; i < numContacts; i++)
+					contacts[i].SolveSequentialImpulse();
+			}
+
+			return mSequentialImpulseIterations;
+		}
+
+		void ContactResolver::UpdateImpulseCache(const Contact* contacts)
+		{
+			mNextImpulseCache.clear();
+			for (auto& island : mIslands)
+			{
+				for (uint32_t i = island.mBegin; i < island.mBegin + island.mCount; i++)
+				{
+					ContactCacheKey key = GetCacheKey(contacts[i]);
+					if (island.mIsAwake)
+					{
+						mNextImpulseCache[key] = contacts[i].GetAccumulatedImpulseWorld();
+					}
+					else
+					{
+						auto iter = mImpulseCache.find(key);
+						if (iter != mImpulseCache.end())
+							mNextImpulseCache[key] = iter->second;
+					}
+				}
+			}
+			// 这一帧没有出现的接触点直接丢弃
+			std::swap(mImpulseCache, mNextImpulseCache);
+		}
+
+		ContactResolver::ContactCacheKey ContactResolver::GetCacheKey(const Contact& contact)
+		{
+			ContactCacheKey key;
+			key.mRigidBodies[0] = GetIslandBody(contact);
+			key.mRigidBodies[1] = contact.mRigidBodies[0] ? contact.mRigidBodies[1] : nullptr;
+			key.mFeatureID = contact.mFeatureID;
+			return key;
 		}
 
 		void ContactResolver::PrepareContacts(Contact* contacts, uint32_t numContacts, float duration)
@@ -71,26 +320,26 @@ namespace ZXEngine
 			}
 		}
 
-		void ContactResolver::AdjustPositions(Contact* contacts, uint32_t numContacts, float duration)
+		uint32_t ContactResolver::AdjustPositions(Contact* contacts, uint32_t numContacts, float duration)
 		{
-			// ֱƶ
+			// 沿直线移动距离
 			Vector3 linearChange[2];
-			// תǶ
+			// 转动角度
 			Vector3 angularChange[2];
-			// ཻ
+			// 最大相交深度
 			float maxPenetration;
 
-			// ײλñ仯(ǰѭȻջƵ)
+			// 碰撞点的位置变化量(在这里提前声明，避免后面在循环中声明变量，然后在栈上频繁创建和销毁)
 			Vector3 deltaPosition;
-			// ǰײ
+			// 当前处理的碰撞索引
 			uint32_t idx;
 
-			mCurPositionIterations = 0;
-			while (mCurPositionIterations < mMaxPositionIterations)
+			uint32_t iterations = 0;
+			while (iterations < mMaxPositionIterations)
 			{
 				idx = numContacts;
 				maxPenetration = mPositionEpsilon;
-				// ҵཻײ
+				// 找到相交最深的碰撞
 				for (uint32_t i = 0; i < numContacts; i++)
 				{
 					if (contacts[i].mPenetration > maxPenetration)
@@ -100,40 +349,40 @@ namespace ZXEngine
 					}
 				}
 
-				// ˵ûҪཻˣֱ˳
+				// 说明没有需要处理的相交了，直接退出
 				if (idx == numContacts)
 					break;
 
-				// ѿܴ״̬ĸ
+				// 唤醒可能处于休眠状态的刚体
 				contacts[idx].MatchAwakeState();
 
-				// ཻȡཻϢʵʸıλúת״̬
+				// 处理相交，并获取相交处理信息，这里会实际改变两个刚体的位置和旋转状态
 				contacts[idx].ResolvePenetration(linearChange, angularChange, maxPenetration);
 
-				// ȻеײѯཻܻӰ쵽ײ
-				// ΪཻıĸͬʱཻԿܻӰײеཻ״̬
+				// 然后遍历所有的碰撞，查询本次相交处理可能会影响到的碰撞
+				// 因为本次相交处理所改变的刚体可能同时还有其它相交，所以可能还会影响其它碰撞中的相交状态
 				for (uint32_t i = 0; i < numContacts; i++)
 				{
-					// jǰײеĸ
+					// j代表当前遍历到的碰撞中的刚体索引
 					for (uint32_t j = 0; j < 2; j++)
 					{
-						// ǰײڸż
+						// 如果当前遍历到的碰撞对象存在刚体才继续
 						if (contacts[i].mRigidBodies[j])
 						{
-							// kཻıײеĸ
+							// k代表本次相交处理所改变的碰撞中的刚体索引
 							for (uint32_t k = 0; k < 2; k++)
 							{
-								// ǰײеĸ뱾ཻıײеĸͬ
-								// ôҪµǰײཻϢ˵ཻmPenetration
-								// Ϊһײеཻĸλת״̬仯ܻӰײཻ
+								// 如果当前遍历到的碰撞中的刚体与本次相交处理所改变的碰撞中的刚体相同
+								// 那么就需要更新当前遍历到的这个碰撞的相交信息，具体来说就是相交深度mPenetration
+								// 因为对一次碰撞中的相交处理所带来的刚体位置旋转状态变化，可能会影响多个碰撞的相交深度
 								if (contacts[i].mRigidBodies[j] == contacts[idx].mRigidBodies[k])
 								{
-									// 㵱ǰײλñ仯ɸ˶ͽ˶һ
+									// 计算当前这个刚体碰撞点的位置变化，由刚体的线性运动和角运动一起产生
 									deltaPosition = linearChange[k] + Math::Cross(angularChange[k], contacts[i].mRelativeContactPosition[j]);
-									// λñ仯ͶӰײ߷ϣõײϵı仯ҲǶཻȵӰ
-									// Ȼ仯ӵǰײϣҲǱཻԵǰײཻӰ
-									// mPenetration - deltamPenetrationǴײеĵһӽ
-									// ҪжϷţǰڵǰײдڵһλþǼڵڶλþ͸Ҫ
+									// 把这个位置变化投影到碰撞法线方向上，得到在碰撞法线上的变化情况，也就是对相交深度的影响
+									// 然后把这个变化量添加到当前遍历到的这个碰撞上，也就是本次相交处理对当前这个碰撞的相交深度所产生的影响
+									// 这里是mPenetration - delta，由于mPenetration是从碰撞中的第一个刚体的视角来看的
+									// 所以要判断符号，如果当前这个刚体在当前这个碰撞中处于第一个位置就是减，但是如果处于第二个位置就负负得正需要加
 									contacts[i].mPenetration += Math::Dot(deltaPosition, contacts[i].mContactNormal) * (j ? 1.0f : -1.0f);
 								}
 							}
@@ -141,31 +390,33 @@ namespace ZXEngine
 					}
 				}
 
-				// 굱ǰײཻı仯󣬵һȻѰҸºཻײཻ
-				mCurPositionIterations++;
+				// 更新完当前碰撞的相交处理带来的变化后，迭代次数加一，然后继续寻找更新后相交深度最深的碰撞，继续做相交处理
+				iterations++;
 			}
+
+			return iterations;
 		}
 
-		void ContactResolver::AdjustVelocities(Contact* contacts, uint32_t numContacts, float duration)
+		uint32_t ContactResolver::AdjustVelocities(Contact* contacts, uint32_t numContacts, float duration)
 		{
-			// ٶȸı
+			// 线性速度改变量
 			Vector3 linearVelocityChange[2];
-			// ٶȸı
+			// 角速度改变量
 			Vector3 angularVelocityChange[2];
-			// 
+			// 最大速率
 			float maxSpeed;
 
-			// ײıպٶȱ仯(ǰѭȻջƵ)
+			// 碰撞点的闭合速度变化量(在这里提前声明，避免后面在循环中声明变量，然后在栈上频繁创建和销毁)
 			Vector3 deltaVelocity;
-			// ǰײ
+			// 当前处理的碰撞索引
 			uint32_t idx;
 
-			mCurVelocityIterations = 0;
-			while (mCurVelocityIterations < mMaxVelocityIterations)
+			uint32_t iterations = 0;
+			while (iterations < mMaxVelocityIterations)
 			{
 				idx = numContacts;
 				maxSpeed = mVelocityEpsilon;
-				// ҵٶȸıײȴΪٶȱ仯ԽЧӰҲԽ
+				// 找到速度改变最大的碰撞，优先处理，因为速度变化越大对整体效果影响也越大
 				for (uint32_t i = 0; i < numContacts; i++)
 				{
 					if (contacts[i].mDesiredDeltaVelocity > maxSpeed)
@@ -175,17 +426,17 @@ namespace ZXEngine
 					}
 				}
 
-				// ˵ûҪٶȱ仯ˣֱ˳
+				// 说明没有需要处理的速度变化了，直接退出
 				if (idx == numContacts)
 					break;
 
-				// ѿܴ״̬ĸ
+				// 唤醒可能处于休眠状态的刚体
 				contacts[idx].MatchAwakeState();
 
-				// ٶȱ仯ȡٶȱ仯Ϣʵʸıٶ״̬
+				// 处理速度变化，并获取速度变化信息，这里会实际改变两个刚体的速度状态
 				contacts[idx].ResolveVelocityChange(linearVelocityChange, angularVelocityChange);
 
-				// ѭ߼ͬAdjustPositions
+				// 这里的循环逻辑同AdjustPositions
 				for (uint32_t i = 0; i < numContacts; i++)
 				{
 					for (uint32_t j = 0; j < 2; j++)
@@ -196,11 +447,11 @@ namespace ZXEngine
 							{
 								if (contacts[i].mRigidBodies[j] == contacts[idx].mRigidBodies[k])
 								{
-									// ٶȸıͽٶȸıײıպٶȱ仯
+									// 结合线性速度改变量和角速度改变量，计算碰撞点的闭合速度变化量
 									deltaVelocity = linearVelocityChange[k] + Math::Cross(angularVelocityChange[k], contacts[i].mRelativeContactPosition[j]);
-									// 仯תײռ䣬Ȼӵλײռıպٶ
+									// 将变化量转换到碰撞空间，然后加到位于碰撞空间的闭合速度上
 									contacts[i].mContactVelocity += Math::Transpose(contacts[i].mContactToWorld) * deltaVelocity * (j ? -1.0f : 1.0f);
-									// ٶȱ仯
+									// 更新期望速度变化量
 									contacts[i].UpdateDesiredDeltaVelocity(duration);
 								}
 							}
@@ -208,9 +459,11 @@ namespace ZXEngine
 					}
 				}
 
-				// һѰٶȱ仯ײٶȱ仯
-				mCurVelocityIterations++;
+				// 迭代次数加一，继续寻找速度变化最大的碰撞，继续做速度变化处理
+				iterations++;
 			}
+
+			return iterations;
 		}
 	}
 }
\ No newline at end of file
@@ -1,17 +1,26 @@
 #pragma once
 #include "../pubh.h"
+#include "PhysZEnumStruct.h"
+
+// 碰撞数量少于这个值时不拆分Job，直接在当前线程处理所有岛屿
+#define CONTACT_RESOLVER_PARALLEL_MIN_CONTACTS 64
+// 顺序冲量法每帧的默认迭代次数
+#define SEQUENTIAL_IMPULSE_ITERATIONS 10
 
 namespace ZXEngine
 {
 	namespace PhysZ
 	{
 		class Contact;
+		class RigidBody;
+		// 处理碰撞时先用并查集把通过碰撞互相关联的刚体分成若干个岛屿，不同岛屿之间没有共享的刚体，可以在多个线程上独立处理
+		// 每个岛屿的处理结果只和岛屿内的碰撞顺序有关，和线程数量以及执行顺序无关，所以结果是确定的
 		class ContactResolver
 		{
 		public:
-			// ǰٶѾĵĴ
+			// 上一次处理中所有岛屿处理速度的迭代次数之和
 			uint32_t mCurVelocityIterations;
-			// ǰλѾĵĴ
+			// 上一次处理中所有岛屿处理位置的迭代次数之和
 			uint32_t mCurPositionIterations;
 
 			ContactResolver(uint32_t maxIterations, float velocityEpsilon = 0.01f, float positionEpsilon = 0.01f);
@@ -22,25 +31,93 @@ namespace ZXEngine
 			void SetMaxIterations(uint32_t maxIterations);
 			void SetVelocityEpsilon(float velocityEpsilon);
 			void SetPositionEpsilon(float positionEpsilon);
+			void SetSolverType(ContactSolverType type);
+			ContactSolverType GetSolverType() const;
+			void SetSequentialImpulseIterations(uint32_t iterations);
 
 			void ResolveContacts(Contact* contacts, uint32_t numContacts, float duration);
 
 		private:
 			float mVelocityEpsilon;
-			// ײʱཻСֵΪײ
-			// ֵ̫Сᵼ¶̫˻ᵼۿɼĶཻ
+			// 两个对象碰撞时的相交深度如果小于这个值，则认为不碰撞
+			// 这个值如果太小，会导致抖动，太大了会导致肉眼可见的对象相交
 			float mPositionEpsilon;
-			// ٶʱ
+			// 处理速度时的最大迭代次数
 			uint32_t mMaxVelocityIterations;
-			// λʱ
+			// 处理位置时的最大迭代次数
 			uint32_t mMaxPositionIterations;
+			ContactSolverType mSolverType = ContactSolverType::Iterative;
+			// 顺序冲量法每帧的迭代次数，和上面的最大迭代次数不同，每次都会执行满
+			uint32_t mSequentialImpulseIterations = SEQUENTIAL_IMPULSE_ITERATIONS;
+
+			// 用两个刚体和碰撞特征ID标识帧之间的同一个接触点
+			struct ContactCacheKey
+			{
+				const RigidBody* mRigidBodies[2] = { nullptr, nullptr };
+				uint32_t mFeatureID = 0;
+
+				bool operator== (const ContactCacheKey& other) const
+				{
+					return mRigidBodies[0] == other.mRigidBodies[0] && mRigidBodies[1] == other.mRigidBodies[1] && mFeatureID == other.mFeatureID;
+				}
+			};
+			struct ContactCacheKeyHash
+			{
+				size_t operator() (const ContactCacheKey& key) const
+				{
+					size_t hash = std::hash<const RigidBody*>()(key.mRigidBodies[0]);
+					hash ^= std::hash<const RigidBody*>()(key.mRigidBodies[1]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+					hash ^= std::hash<uint32_t>()(key.mFeatureID) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+					return hash;
+				}
+			};
+			// 上一帧每个接触点的累计冲量(世界空间)，处理时多个线程只读，处理完后在当前线程更新
+			unordered_map<ContactCacheKey, Vector3, ContactCacheKeyHash> mImpulseCache;
+			unordered_map<ContactCacheKey, Vector3, ContactCacheKeyHash> mNextImpulseCache;
+
+			// 互相之间有碰撞的刚体组成的岛屿，岛屿内的碰撞在数组中是连续的
+			struct ContactIsland
+			{
+				uint32_t mBegin = 0;
+				uint32_t mCount = 0;
+				// 岛屿内只要有一个刚体是Awake的就需要处理
+				bool mIsAwake = false;
+				uint32_t mPositionIterations = 0;
+				uint32_t mVelocityIterations = 0;
+			};
+
+			// 以下数据每次处理时重新生成，保留下来是为了复用内存
+			vector<ContactIsland> mIslands;
+			// 并查集，每个刚体对应一个元素，记录父节点的下标
+			vector<uint32_t> mParents;
+			unordered_map<const RigidBody*, uint32_t> mBodyIndices;
+			// 每个碰撞所在的岛屿
+			vector<uint32_t> mContactIslands;
+			// 按岛屿重新排列碰撞时用的临时数组
+			vector<Contact> mSortedContacts;
+
+			// 把碰撞按岛屿分组，并按岛屿重新排列碰撞数组，岛屿内碰撞的相对顺序不变
+			void BuildIslands(Contact* contacts, uint32_t numContacts);
+			// 获取碰撞中用来代表所在岛屿的刚体，优先取第一个，第一个为空时取第二个
+			static const RigidBody* GetIslandBody(const Contact& contact);
+			uint32_t GetBodyIndex(const RigidBody* rigidBody);
+			uint32_t FindRoot(uint32_t index);
+			void ResolveIsland(ContactIsland& island, Contact* contacts, float duration);
+			// 用顺序冲量法处理一个岛屿，返回迭代次数
+			uint32_t SolveSequentialImpulse(Contact* contacts, uint32_t numContacts, float duration);
+			// 处理完所有岛屿后保存这一帧的累计冲量，休眠岛屿的接触点保留之前的数据
+			void UpdateImpulseCache(const Contact* contacts);
+			// 岛屿里只要有一个刚体不能休眠，就取消整个岛屿所有刚体的休眠标记，保证岛屿整体一起休眠
+			void UpdateIslandSleepState(Contact* contacts);
+			// 碰撞在处理前后刚体顺序可能被交换，这里统一让非空的刚体在前面
+			static ContactCacheKey GetCacheKey(const Contact& contact);
 
-			// ײǰȸײ
+			// 处理碰撞前先更新碰撞数据
 			void PrepareContacts(Contact* contacts, uint32_t numContacts, float duration);
-			// ײཻ
-			void AdjustPositions(Contact* contacts, uint32_t numContacts, float duration);
-			// ײٶȱ仯
-			void AdjustVelocities(Contact* contacts, uint32_t numContacts, float duration);
+			// 处理碰撞相交，返回迭代次数
+			uint32_t AdjustPositions(Contact* contacts, uint32_t numContacts, float duration);
+			// 处理碰撞速度变化，返回迭代次数
+			uint32_t AdjustVelocities(Contact* contacts, uint32_t numContacts, float duration);
 		};
 	}
 }
\ No newline at end of file
@@ -12,11 +12,11 @@ namespace ZXEngine
 
 		void FGGravity::UpdateForce(RigidBody* rigidBody, float duration)
 		{
-			// ޴ʾ
+			// 如果质量无限大表示不受力
 			if (rigidBody->IsInfiniteMass()) 
 				return;
 
-			// 
+			// 添加重力
 			rigidBody->AddForce(mGravity * rigidBody->GetMass());
 		}
 	}
@@ -17,20 +17,20 @@ namespace ZXEngine
 
         void FGSpring::UpdateForce(RigidBody* rigidBody, float duration)
         {
-            // ӵϵµλ
+            // 弹簧链接的两端在世界坐标系下的位置
             Vector3 lws = rigidBody->GetTransform() * mConnectionPoint;
             Vector3 ows = mOther->GetTransform() * mOtherConnectionPoint;
-            // 
+            // 间距
             Vector3 dis = lws - ows;
-            // ɵǰ
+            // 弹簧当前长度
             float length = dis.GetMagnitude();
-            // 
+            // 弹簧伸缩长度
             float delta = length - mRestLength;
-            // С
+            // 弹力大小
             float forceScalar = delta * mSpringConstant;
-            // 
+            // 弹力向量
             Vector3 force = -forceScalar * dis.GetNormalized();
-            // ʩӵǰ
+            // 施加到当前刚体上
             rigidBody->AddForceAtPoint(force, lws);
         }
 	}
@@ -13,15 +13,15 @@ namespace ZXEngine
 			virtual void UpdateForce(RigidBody* rigidBody, float duration);
 
 		private:
-			// ڵǰϵӵ(ľֲռ)
+			// 弹簧在当前对象上的连接点(对象的局部空间)
 			Vector4 mConnectionPoint;
-			// һϵӵ(һľֲռ)
+			// 弹簧在另一个对象上的连接点(另一个对象的局部空间)
 			Vector4 mOtherConnectionPoint;
-			// һ˵ĸ
+			// 弹簧另一端的刚体
 			RigidBody* mOther;
-			// ϵ
+			// 弹簧系数
 			float mSpringConstant;
-			// ɲʱĳ
+			// 弹簧不受外力时的长度
 			float mRestLength;
 		};
 	}
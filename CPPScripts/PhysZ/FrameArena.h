@@ -0,0 +1,63 @@
+#pragma once
+#include "../pubh.h"
+
+// 根据上一帧峰值调整容量时预留的余量倍数
+#define FRAME_ARENA_HEADROOM 1.5f
+// 容量超过上一帧峰值的这个倍数时才缩小，避免在峰值附近反复分配
+#define FRAME_ARENA_SHRINK_RATIO 4
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		// 物理每帧重复使用的一块连续内存，每帧开始时根据上一帧的使用峰值调整容量
+		// 帧内容量不够时扩容并保留已写入的数据，所以扩容后之前拿到的指针都会失效
+		template<typename T>
+		class FrameArena
+		{
+		public:
+			FrameArena(uint32_t capacity) : mMinCapacity(Math::Max(capacity, 1u)) { Reallocate(mMinCapacity, 0); };
+			~FrameArena() { delete[] mData; };
+			FrameArena(const FrameArena& other) = delete;
+			FrameArena& operator= (const FrameArena& other) = delete;
+
+			T* GetData() const { return mData; };
+			uint32_t GetCapacity() const { return mCapacity; };
+
+			// 确保容量不少于required，扩容时保留前used个元素，发生了扩容返回true
+			bool Reserve(uint32_t required, uint32_t used)
+			{
+				if (required <= mCapacity)
+					return false;
+
+				Reallocate(Math::Max(required, mCapacity * 2), used);
+				return true;
+			}
+
+			// 帧开始时调用，peak是上一帧实际用到的数量，调用后数据都视为无效
+			void Tune(uint32_t peak)
+			{
+				uint32_t target = Math::Max(static_cast<uint32_t>(peak * FRAME_ARENA_HEADROOM), mMinCapacity);
+				if (target > mCapacity || (mCapacity > mMinCapacity && mCapacity > peak * FRAME_ARENA_SHRINK_RATIO))
+					Reallocate(target, 0);
+			}
+
+		private:
+			T* mData = nullptr;
+			uint32_t mCapacity = 0;
+			// 构造时传入的容量，缩小时不会低于这个值
+			uint32_t mMinCapacity = 0;
+
+			void Reallocate(uint32_t capacity, uint32_t used)
+			{
+				T* data = new T[capacity];
+				for (uint32_t i = 0; i < used; i++)
+					data[i] = mData[i];
+
+				delete[] mData;
+				mData = data;
+				mCapacity = capacity;
+			}
+		};
+	}
+}
\ No newline at end of file
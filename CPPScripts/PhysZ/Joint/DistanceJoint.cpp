@@ -39,6 +39,8 @@ namespace ZXEngine
 				contact->mPenetration = currentDistance - mDistance;
 				contact->mRestitution = 0.0f;
 				contact->mFriction = 1.0f;
+				// 和碰撞产生的接触点区分开
+				contact->mFeatureID = UINT32_MAX;
 				contact->SetRigidBodies(mBodys[0], mBodys[1]);
 
 				data->AddContacts(1);
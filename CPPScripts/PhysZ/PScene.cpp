@@ -1,258 +1,252 @@
 #include "PScene.h"
-#include "BVHNode.h"
+#include "Broadphase/Broadphase.h"
 #include "Contact.h"
 #include "RigidBody.h"
+#include "RigidBodyStore.h"
 #include "CollisionData.h"
 #include "CollisionDetector.h"
 #include "ContactResolver.h"
-#include "BoundingVolume/BoundingSphere.h"
+#include "CollisionPrimitive.h"
 #include "Joint/Joint.h"
-#include "../GameObject.h"
-#include "../DynamicMesh.h"
+#include <chrono>
 
 namespace ZXEngine
 {
 	namespace PhysZ
 	{
-		PScene::PScene(uint32_t maxContacts, uint32_t iterations) 
+		// 返回从timePoint到现在经过的微秒数，并把timePoint更新为现在，用于连续统计多个阶段的耗时
+		static float GetElapsedMicroseconds(std::chrono::steady_clock::time_point& timePoint)
 		{
-			mCollisionData = new CollisionData(1000);
+			auto now = std::chrono::steady_clock::now();
+			float elapsed = std::chrono::duration<float, std::micro>(now - timePoint).count();
+			timePoint = now;
+			return elapsed;
+		}
+
+		PScene::PScene(uint32_t maxContacts, uint32_t iterations, BroadphaseType broadphaseType, ContactSolverType solverType) 
+		{
+			mBroadphase = Broadphase::Create(broadphaseType);
+			// maxContacts只是初始长度，实际长度会根据每帧的碰撞数量调整
+			mCollisionData = new CollisionData(maxContacts);
 			mContactResolver = new ContactResolver(iterations);
-			mPotentialContacts = new PotentialContact[mMaxPotentialContacts];
+			mContactResolver->SetSolverType(solverType);
+			mPotentialContacts = new FrameArena<PotentialContact>(maxContacts);
 		};
 
 		PScene::~PScene() 
 		{
 			delete mCollisionData;
 			delete mContactResolver;
-			delete[] mPotentialContacts;
-
-			if (mBVHRoot)
-				delete mBVHRoot;
+			delete mPotentialContacts;
+			delete mBroadphase;
 		};
 
 		void PScene::BeginFrame()
 		{
-			if (mBVHRoot == nullptr)
+			if (mBroadphase->IsEmpty())
 				return;
 
-			// ײ
+			// 重置碰撞数据
 			mCollisionData->Reset();
-
-			for (auto& iter : mAllRigidBodyGO)
-			{
-				// һ֡ۼƵ
-				iter.second->ClearAccumulators();
-				// ¸һ֡
-				iter.second->CalculateDerivedData();
-			}
-
-			for (auto cloth : mAllCloths)
-			{
-				for (auto& iter : cloth->mParticles)
-				{
-					iter.first->ClearAccumulators();
-					iter.first->CalculateDerivedData();
-				}
-			}
+			mPotentialContacts->Tune(mStats.mPotentialContactNum);
+
+			// 休眠的刚体没有受力，位置和旋转也没有变化，这一帧只处理醒着的刚体
+			auto store = RigidBodyStore::GetInstance();
+			store->GatherAwake(mRigidBodyIndices.data(), static_cast<uint32_t>(mRigidBodyIndices.size()), mAwakeBodyIndices);
+			uint32_t awakeNum = static_cast<uint32_t>(mAwakeBodyIndices.size());
+			// 清除刚体在上一帧累计的力和力矩
+			store->ClearAccumulators(mAwakeBodyIndices.data(), awakeNum);
+			// 更新刚体在这一帧的相关数据
+			store->CalculateDerivedData(mAwakeBodyIndices.data(), awakeNum);
 		}
 
 		void PScene::Update(float deltaTime)
 		{
-			if (mBVHRoot == nullptr)
+			if (mBroadphase->IsEmpty())
 				return;
 
-			for (auto& iter : mAllRigidBodyGO)
-			{
-				// ¸λúת
-				iter.second->Integrate(deltaTime);
-			}
+			auto timePoint = std::chrono::steady_clock::now();
 
-			for (auto cloth : mAllCloths)
+			// 更新刚体的位置和旋转
+			RigidBodyStore::GetInstance()->Integrate(mAwakeBodyIndices.data(), static_cast<uint32_t>(mAwakeBodyIndices.size()), deltaTime);
+			mStats.mIntegrateTime = GetElapsedMicroseconds(timePoint);
+
+			// 生成潜在碰撞，数组不够大时扩容后重新获取
+			uint32_t potentialContactCount = mBroadphase->GetPotentialContacts(mPotentialContacts->GetData(), mPotentialContacts->GetCapacity());
+			while (potentialContactCount > mPotentialContacts->GetCapacity())
 			{
-				for (auto& iter : cloth->mParticles)
-				{
-					iter.first->Integrate(deltaTime);
-				}
+				mStats.mPotentialContactRegrowNum++;
+				mPotentialContacts->Reserve(potentialContactCount, 0);
+				potentialContactCount = mBroadphase->GetPotentialContacts(mPotentialContacts->GetData(), mPotentialContacts->GetCapacity());
 			}
-
-			// Ǳײ
-			uint32_t potentialContactCount = mBVHRoot->GetPotentialContacts(mPotentialContacts, mMaxPotentialContacts);
+			mStats.mBroadphaseTime = GetElapsedMicroseconds(timePoint);
 			
-			// Ǳײмײ
+			// 从潜在碰撞中检测碰撞
+			PotentialContact* potentialContacts = mPotentialContacts->GetData();
+			mStats.mSleepingPairSkipNum = 0;
 			uint32_t i = 0;
 			while (i < potentialContactCount)
 			{
+				// 两个刚体都不会动时不需要检测，其中一个醒着时照常检测，处理碰撞时会唤醒另一个
+				if (!IsMoving(potentialContacts[i].mRigidBodies[0]) && !IsMoving(potentialContacts[i].mRigidBodies[1]))
+				{
+					mStats.mSleepingPairSkipNum++;
+					i++;
+					continue;
+				}
+
+				// 每次检测前保证剩余空间足够，这里扩容不会让检测函数里的Contact指针失效
+				if (mCollisionData->Reserve(PHYSZ_MAX_CONTACTS_PER_PAIR))
+					mStats.mContactRegrowNum++;
+
 				uint32_t collisionCount = CollisionDetector::Detect(
-					mPotentialContacts[i].mRigidBodies[0]->mCollisionVolume, 
-					mPotentialContacts[i].mRigidBodies[1]->mCollisionVolume, 
+					potentialContacts[i].mRigidBodies[0]->mCollisionVolume, 
+					potentialContacts[i].mRigidBodies[1]->mCollisionVolume, 
 					mCollisionData
 				);
 				i++;
 			}
+			mStats.mNarrowphaseTime = GetElapsedMicroseconds(timePoint);
 
-			// ؽ
+			// 处理关节
 			for (auto joint : Joint::allJoints)
 			{
+				if (mCollisionData->Reserve(PHYSZ_MAX_CONTACTS_PER_PAIR))
+					mStats.mContactRegrowNum++;
+
 				joint->Resolve(mCollisionData);
 			}
+			mStats.mJointTime = GetElapsedMicroseconds(timePoint);
+
+			mStats.mPotentialContactNum = potentialContactCount;
+			mStats.mPeakPotentialContactNum = Math::Max(mStats.mPeakPotentialContactNum, potentialContactCount);
+			mStats.mPotentialContactCapacity = mPotentialContacts->GetCapacity();
+			mStats.mContactNum = mCollisionData->mCurContactCount;
+			mStats.mPeakContactNum = Math::Max(mStats.mPeakContactNum, mCollisionData->mCurContactCount);
+			mStats.mContactCapacity = mCollisionData->mMaxContactCount;
 
-			// ײ
+			// 处理碰撞
 			mContactResolver->ResolveContacts(mCollisionData->mContactArray, mCollisionData->mCurContactCount, deltaTime);
+			mStats.mResolveTime = GetElapsedMicroseconds(timePoint);
 		}
 
 		void PScene::EndFrame()
 		{
-			if (mBVHRoot == nullptr)
+			if (mBroadphase->IsEmpty())
 				return;
 
-			for (auto& iter : mAllRigidBodyGO)
-			{
-				auto transform = iter.first->GetComponent<Transform>();
-				transform->SetPosition(iter.second->GetPosition());
-				transform->SetRotation(iter.second->GetRotation());
-
-				// BVλ
-				if (iter.second->mBVHNode)
-				{
-					iter.second->mBVHNode->mBoundingVolume.mCenter = iter.second->GetPosition();
-					iter.second->mBVHNode->UpdateBoundingVolume();
-				}
-			}
+			auto timePoint = std::chrono::steady_clock::now();
 
-			for (auto cloth : mAllCloths)
+			auto store = RigidBodyStore::GetInstance();
+			for (auto index : mRigidBodyIndices)
 			{
-				Vector3 wPos = cloth->gameObject->GetComponent<Transform>()->GetPosition();
-
-				for (size_t i = 0; i < cloth->mParticles.size(); i++)
-				{
-					Vector3 pPos = cloth->mParticles[i].first->GetPosition();
-					Vector3 lPos = pPos - wPos;
+				// 休眠的刚体位置没有变化，不需要更新包围盒，平面不会动
+				auto rigidBody = store->GetBody(index);
+				if (rigidBody->GetAwake() && rigidBody->mCollisionVolume && rigidBody->mCollisionVolume->GetType() != ColliderType::Plane)
+					mBroadphase->Update(rigidBody, GetBoundingBox(rigidBody));
+			}
 
-					cloth->mDynamicMesh->mVertices[i].Position = lPos;
+#ifndef ZX_HEADLESS
+			// 把结果写回GameObject，这部分和引擎相关的代码在PSceneGameObject.cpp里，独立编译的物理库不包含
+			SyncGameObjects();
+#endif
+			mStats.mSyncTime = GetElapsedMicroseconds(timePoint);
 
-					// BVλ
-					if (cloth->mParticles[i].first->mBVHNode)
-					{
-						cloth->mParticles[i].first->mBVHNode->mBoundingVolume.mCenter = pPos;
-						cloth->mParticles[i].first->mBVHNode->UpdateBoundingVolume();
-					}
-				}
+			// 写回结果后再让可以休眠的刚体进入休眠，保证休眠前最后一帧的位置被写回
+			store->ApplySleep(mAwakeBodyIndices.data(), static_cast<uint32_t>(mAwakeBodyIndices.size()));
 
-				// (Z)
-				size_t row = 11;
-				// (X)
-				size_t col = 11;
-				// Ӻǰ
-				for (size_t i = 1; i < (row - 1); i++)
-				{
-					// 
-					for (size_t j = 1; j < (col - 1); j++)
-					{
-						// 
-						size_t pLeft = i * col + j - 1;
-						// 
-						size_t pRight = i * col + j + 1;
-						// 
-						size_t pBack = (i - 1) * col + j;
-						// ǰ
-						size_t pFront = (i + 1) * col + j;
-
-						if (i == 0)
-							pBack = i * col + j;
-						else if (i == (row - 1))
-							pFront = i * col + j;
-
-						if (j == 0)
-							pLeft = i * col + j;
-						else if (j == (col - 1))
-							pRight = i * col + j;
-
-						Vector3 normal = Math::Cross(
-							cloth->mDynamicMesh->mVertices[pLeft].Position - cloth->mDynamicMesh->mVertices[pRight].Position,
-							cloth->mDynamicMesh->mVertices[pBack].Position - cloth->mDynamicMesh->mVertices[pFront].Position
-						);
-						normal.Normalize();
-
-						cloth->mDynamicMesh->mVertices[i * col + j].Normal = normal;
-					}
-				}
+			store->GatherAwake(mRigidBodyIndices.data(), static_cast<uint32_t>(mRigidBodyIndices.size()), mAwakeBodyIndices);
+			mStats.mAwakeBodyNum = static_cast<uint32_t>(mAwakeBodyIndices.size());
+			mStats.mSleepingBodyNum = static_cast<uint32_t>(mRigidBodyIndices.size()) - mStats.mAwakeBodyNum;
+		}
 
-				cloth->mDynamicMesh->UpdateData();
-			}
+		void PScene::AddRigidBody(RigidBody* rigidBody)
+		{
+			// 包围盒要用碰撞体在世界空间的变换计算，所以先更新一次刚体数据
+			rigidBody->CalculateDerivedData();
+			mRigidBodyIndices.push_back(rigidBody->GetStoreIndex());
+			mBroadphase->Insert(rigidBody, GetBoundingBox(rigidBody));
 		}
 
-		void PScene::AddGameObject(GameObject* gameObject)
+		void PScene::AddRigidBody(RigidBody* rigidBody, const BoundingBox& boundingBox)
 		{
-			auto rigidBodyComp = gameObject->GetComponent<ZRigidBody>();
-			auto rigidBody = rigidBodyComp ? rigidBodyComp->mRigidBody : nullptr;
+			rigidBody->CalculateDerivedData();
+			mRigidBodyIndices.push_back(rigidBody->GetStoreIndex());
+			mBroadphase->Insert(rigidBody, boundingBox);
+		}
 
-			if (rigidBody)
-				mAllRigidBodyGO.push_back(pair(gameObject, rigidBody));
+		const PSceneStats& PScene::GetStats() const
+		{
+			return mStats;
+		}
 
-			if (gameObject->mColliderType == PhysZ::ColliderType::Box)
-			{
-				auto boxCollider = gameObject->GetComponent<BoxCollider>();
-				if (boxCollider)
-				{
-					float radius = boxCollider->mCollider->mHalfSize.GetMagnitude();
-					Vector3 pos = gameObject->GetComponent<Transform>()->GetPosition();
-					BoundingSphere bv(pos, radius);
-					AddBoundingVolume(bv, rigidBody);
-				}
-			}
-			else if (gameObject->mColliderType == PhysZ::ColliderType::Plane)
+		uint64_t PScene::ComputeStateChecksum() const
+		{
+			// FNV-1a，直接对浮点数的二进制位做哈希，任何一位不同都会改变结果
+			uint64_t checksum = 14695981039346656037ull;
+			auto accumulate = [&checksum](float value)
 			{
-				auto planeCollider = gameObject->GetComponent<PlaneCollider>();
-				if (planeCollider)
+				uint32_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+				for (uint32_t i = 0; i < 4; i++)
 				{
-					auto transform = gameObject->GetComponent<Transform>();
-					auto scale = transform->GetLocalScale();
-					// ʱƽ泤Ϊ10
-					float radius = sqrtf(scale.x * scale.x * 100.0f + scale.z * scale.z * 100.0f);
-					Vector3 pos = transform->GetPosition();
-					BoundingSphere bv(pos, radius);
-					AddBoundingVolume(bv, rigidBody);
+					checksum ^= (bits >> (i * 8)) & 0xFF;
+					checksum *= 1099511628211ull;
 				}
-			}
-			else if (gameObject->mColliderType == PhysZ::ColliderType::Sphere)
+			};
+
+			auto store = RigidBodyStore::GetInstance();
+			for (auto index : mRigidBodyIndices)
 			{
-				auto sphereCollider = gameObject->GetComponent<SphereCollider>();
-				if (sphereCollider)
-				{
-					float radius = sphereCollider->mCollider->mRadius;
-					Vector3 pos = gameObject->GetComponent<Transform>()->GetPosition();
-					BoundingSphere bv(pos, radius);
-					AddBoundingVolume(bv, rigidBody);
-				}
+				auto rigidBody = store->GetBody(index);
+				Vector3 position = rigidBody->GetPosition();
+				Quaternion rotation = rigidBody->GetRotation();
+				Vector3 velocity = rigidBody->GetVelocity();
+				Vector3 angularVelocity = rigidBody->GetAngularVelocity();
+
+				accumulate(position.x); accumulate(position.y); accumulate(position.z);
+				accumulate(rotation.x); accumulate(rotation.y); accumulate(rotation.z); accumulate(rotation.w);
+				accumulate(velocity.x); accumulate(velocity.y); accumulate(velocity.z);
+				accumulate(angularVelocity.x); accumulate(angularVelocity.y); accumulate(angularVelocity.z);
 			}
-			else if (gameObject->mColliderType == PhysZ::ColliderType::Cloth)
-			{
-				auto cloth = gameObject->GetComponent<Cloth>();
 
-				for (auto& iter : cloth->mParticles)
-				{
-					float radius = iter.second->mHalfSize.GetMagnitude();
-					Vector3 pos = iter.first->GetPosition();
-					BoundingSphere bv(pos, radius);
-					AddBoundingVolume(bv, iter.first);
-				}
+			return checksum;
+		}
 
-				mAllCloths.push_back(cloth);
-			}
+		bool PScene::IsMoving(const RigidBody* rigidBody)
+		{
+			return rigidBody->GetAwake() && !rigidBody->IsInfiniteMass();
+		}
+
+		BoundingBox PScene::GetBoundingBox(const RigidBody* rigidBody) const
+		{
+			const CollisionPrimitive* collider = rigidBody->mCollisionVolume;
+			const Matrix4& transform = collider->mTransform;
+			Vector3 center = transform.GetColumn(3);
 
-			for (auto child : gameObject->children)
+			if (collider->GetType() == ColliderType::Sphere)
 			{
-				AddGameObject(child);
+				float radius = static_cast<const CollisionSphere*>(collider)->mRadius;
+				Vector3 extents(radius, radius, radius);
+				return BoundingBox(center - extents, center + extents);
+			}
+			else if (collider->GetType() == ColliderType::Box)
+			{
+				// 旋转后的Box在每个世界轴上的投影半径，等于旋转矩阵每一行的绝对值和半边长的点积
+				const Vector3& halfSize = static_cast<const CollisionBox*>(collider)->mHalfSize;
+				Vector4 row0 = transform.GetRow(0);
+				Vector4 row1 = transform.GetRow(1);
+				Vector4 row2 = transform.GetRow(2);
+				Vector3 extents(
+					fabsf(row0.x) * halfSize.x + fabsf(row0.y) * halfSize.y + fabsf(row0.z) * halfSize.z,
+					fabsf(row1.x) * halfSize.x + fabsf(row1.y) * halfSize.y + fabsf(row1.z) * halfSize.z,
+					fabsf(row2.x) * halfSize.x + fabsf(row2.y) * halfSize.y + fabsf(row2.z) * halfSize.z
+				);
+				return BoundingBox(center - extents, center + extents);
 			}
-		}
 
-		void PScene::AddBoundingVolume(const BoundingSphere& boundingVolume, RigidBody* rigidBody)
-		{
-			if (mBVHRoot)
-				mBVHRoot->Insert(boundingVolume, rigidBody);
-			else
-				mBVHRoot = new BVHNode(nullptr, boundingVolume, rigidBody);
+			Debug::LogWarning("Unsupported collider type for bounding box.");
+			return BoundingBox(center, center);
 		}
 	}
 }
@@ -1,6 +1,11 @@
 #pragma once
 #include "../pubh.h"
-#include "BVHNode.h"
+#include "PhysZEnumStruct.h"
+#include "BoundingVolume/BoundingBox.h"
+#include "FrameArena.h"
+
+// 一对碰撞体最多产生的碰撞数量(Box和平面最多8个顶点接触)
+#define PHYSZ_MAX_CONTACTS_PER_PAIR 8
 
 namespace ZXEngine
 {
@@ -8,7 +13,7 @@ namespace ZXEngine
 	class GameObject;
 	namespace PhysZ
 	{
-		class BoundingSphere;
+		class Broadphase;
 		class Contact;
 		class RigidBody;
 		class CollisionData;
@@ -16,35 +21,53 @@ namespace ZXEngine
 		class PScene
 		{
 		public:
-			PScene(uint32_t maxContacts, uint32_t iterations = 0);
+			PScene(uint32_t maxContacts, uint32_t iterations = 0, BroadphaseType broadphaseType = BroadphaseType::DynamicAABBTree, ContactSolverType solverType = ContactSolverType::Iterative);
 			~PScene();
 
 			void BeginFrame();
 			void Update(float deltaTime);
 			void EndFrame();
 
+			// 添加GameObject及其子节点上的刚体和布料，实现在PSceneGameObject.cpp里
 			void AddGameObject(GameObject* gameObject);
+			// 直接添加不属于任何GameObject的刚体，用于在代码里搭建物理场景，不会写回Transform
+			// 刚体需要已经设置好碰撞体，Box和Sphere会根据碰撞体计算包围盒
+			void AddRigidBody(RigidBody* rigidBody);
+			// 用指定的包围盒添加刚体，平面这类无限大的碰撞体需要调用这个接口
+			void AddRigidBody(RigidBody* rigidBody, const BoundingBox& boundingBox);
+
+			const PSceneStats& GetStats() const;
+			// 按添加顺序计算所有刚体位置，旋转和速度的校验值，用于比较两次模拟的结果是否完全一致
+			uint64_t ComputeStateChecksum() const;
 
 		private:
-			// ǰев
+			// 当前场景中的所有布料
 			vector<Cloth*> mAllCloths;
-			// ǰеи
-			vector<pair<GameObject*, RigidBody*>> mAllRigidBodyGO;
-			// Bounding Volume Hierarchy (BVH)ĸڵ
-			BVHNode* mBVHRoot = nullptr;
+			// 挂在GameObject上的刚体，每帧需要把位置和旋转写回Transform
+			vector<pair<GameObject*, RigidBody*>> mGameObjectBodies;
+			// 所有刚体和布料粒子在RigidBodyStore中的下标，用来批量积分和更新数据
+			vector<uint32_t> mRigidBodyIndices;
+			// 这一帧开始时醒着的刚体下标，只有这些刚体参与积分
+			vector<uint32_t> mAwakeBodyIndices;
+			// 碰撞检测的粗检测阶段
+			Broadphase* mBroadphase = nullptr;
 
-			// ײ
+			// 碰撞数据
 			CollisionData* mCollisionData;
-			// Ǳײ
-			PotentialContact* mPotentialContacts;
-			// Ǳײĳ
-			uint32_t mMaxPotentialContacts = 1000;
+			// 潜在碰撞数组，每帧根据上一帧的数量调整长度
+			FrameArena<PotentialContact>* mPotentialContacts;
+			// 运行统计数据
+			PSceneStats mStats;
 
-			// ײ
+			// 碰撞处理器
 			ContactResolver* mContactResolver;
 
-			// 򳡾µײ
-			void AddBoundingVolume(const BoundingSphere& boundingVolume, RigidBody* rigidBody);
+			// 醒着并且质量不是无穷大的刚体才会移动
+			static bool IsMoving(const RigidBody* rigidBody);
+			// 获取刚体的碰撞体在世界空间下的包围盒
+			BoundingBox GetBoundingBox(const RigidBody* rigidBody) const;
+			// 把醒着的刚体和布料粒子的模拟结果写回Transform和布料网格
+			void SyncGameObjects();
 		};
 	}
 }
\ No newline at end of file
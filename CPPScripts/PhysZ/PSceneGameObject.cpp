@@ -0,0 +1,164 @@
+#include "PScene.h"
+#include "RigidBody.h"
+#include "Broadphase/Broadphase.h"
+#include "../GameObject.h"
+#include "../DynamicMesh.h"
+
+// PScene和GameObject，Transform，布料组件之间的衔接代码，只在引擎里编译
+// 独立编译的物理库(定义了ZX_HEADLESS)不包含这个文件，只能通过AddRigidBody搭建场景
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		void PScene::AddGameObject(GameObject* gameObject)
+		{
+			auto rigidBodyComp = gameObject->GetComponent<ZRigidBody>();
+			auto rigidBody = rigidBodyComp ? rigidBodyComp->mRigidBody : nullptr;
+
+			if (rigidBody)
+			{
+				mGameObjectBodies.push_back(pair(gameObject, rigidBody));
+				mRigidBodyIndices.push_back(rigidBody->GetStoreIndex());
+			}
+
+			if (gameObject->mColliderType == PhysZ::ColliderType::Box)
+			{
+				auto boxCollider = gameObject->GetComponent<BoxCollider>();
+				if (boxCollider)
+				{
+					rigidBody->CalculateDerivedData();
+					mBroadphase->Insert(rigidBody, GetBoundingBox(rigidBody));
+				}
+			}
+			else if (gameObject->mColliderType == PhysZ::ColliderType::Plane)
+			{
+				auto planeCollider = gameObject->GetComponent<PlaneCollider>();
+				if (planeCollider)
+				{
+					// 碰撞检测把平面当作无限大，这里临时按照平面模型在局部空间XZ平面上长宽为10计算
+					// 用模型矩阵把这个薄片变换到世界空间，得到的AABB比之前的包围球紧很多
+					Matrix4 model = gameObject->GetComponent<Transform>()->GetModelMatrix();
+					Vector3 center = model.GetColumn(3);
+					Vector4 row0 = model.GetRow(0);
+					Vector4 row1 = model.GetRow(1);
+					Vector4 row2 = model.GetRow(2);
+					Vector3 extents(
+						(fabsf(row0.x) + fabsf(row0.z)) * 5.0f,
+						(fabsf(row1.x) + fabsf(row1.z)) * 5.0f,
+						(fabsf(row2.x) + fabsf(row2.z)) * 5.0f
+					);
+					mBroadphase->Insert(rigidBody, BoundingBox(center - extents, center + extents));
+				}
+			}
+			else if (gameObject->mColliderType == PhysZ::ColliderType::Sphere)
+			{
+				auto sphereCollider = gameObject->GetComponent<SphereCollider>();
+				if (sphereCollider)
+				{
+					rigidBody->CalculateDerivedData();
+					mBroadphase->Insert(rigidBody, GetBoundingBox(rigidBody));
+				}
+			}
+			else if (gameObject->mColliderType == PhysZ::ColliderType::Cloth)
+			{
+				auto cloth = gameObject->GetComponent<Cloth>();
+
+				for (auto& iter : cloth->mParticles)
+				{
+					mRigidBodyIndices.push_back(iter.first->GetStoreIndex());
+					iter.first->CalculateDerivedData();
+					mBroadphase->Insert(iter.first, GetBoundingBox(iter.first));
+				}
+
+				mAllCloths.push_back(cloth);
+			}
+
+			for (auto child : gameObject->children)
+			{
+				AddGameObject(child);
+			}
+		}
+
+		void PScene::SyncGameObjects()
+		{
+			for (auto& iter : mGameObjectBodies)
+			{
+				// 休眠的刚体位置没有变化，不需要写回Transform
+				if (!iter.second->GetAwake())
+					continue;
+
+				auto transform = iter.first->GetComponent<Transform>();
+				transform->SetPosition(iter.second->GetPosition());
+				transform->SetRotation(iter.second->GetRotation());
+			}
+
+			for (auto cloth : mAllCloths)
+			{
+				// 所有粒子都在休眠时布料网格不需要更新
+				bool anyAwake = false;
+				for (auto& iter : cloth->mParticles)
+				{
+					if (iter.first->GetAwake())
+					{
+						anyAwake = true;
+						break;
+					}
+				}
+				if (!anyAwake)
+					continue;
+
+				Vector3 wPos = cloth->gameObject->GetComponent<Transform>()->GetPosition();
+
+				for (size_t i = 0; i < cloth->mParticles.size(); i++)
+				{
+					Vector3 pPos = cloth->mParticles[i].first->GetPosition();
+					Vector3 lPos = pPos - wPos;
+
+					cloth->mDynamicMesh->mVertices[i].Position = lPos;
+				}
+
+				// 行数(Z)
+				size_t row = 11;
+				// 列数(X)
+				size_t col = 11;
+				// 从后向前
+				for (size_t i = 1; i < (row - 1); i++)
+				{
+					// 从左向右
+					for (size_t j = 1; j < (col - 1); j++)
+					{
+						// 左
+						size_t pLeft = i * col + j - 1;
+						// 右
+						size_t pRight = i * col + j + 1;
+						// 后
+						size_t pBack = (i - 1) * col + j;
+						// 前
+						size_t pFront = (i + 1) * col + j;
+
+						if (i == 0)
+							pBack = i * col + j;
+						else if (i == (row - 1))
+							pFront = i * col + j;
+
+						if (j == 0)
+							pLeft = i * col + j;
+						else if (j == (col - 1))
+							pRight = i * col + j;
+
+						Vector3 normal = Math::Cross(
+							cloth->mDynamicMesh->mVertices[pLeft].Position - cloth->mDynamicMesh->mVertices[pRight].Position,
+							cloth->mDynamicMesh->mVertices[pBack].Position - cloth->mDynamicMesh->mVertices[pFront].Position
+						);
+						normal.Normalize();
+
+						cloth->mDynamicMesh->mVertices[i * col + j].Normal = normal;
+					}
+				}
+
+				cloth->mDynamicMesh->UpdateData();
+			}
+		}
+	}
+}
\ No newline at end of file
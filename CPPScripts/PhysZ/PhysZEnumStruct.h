@@ -1,12 +1,13 @@
 #pragma once
+#include <cstdint>
 
 namespace ZXEngine
 {
 	namespace PhysZ
 	{
-		// ˶ڴֵͻ״̬
-		// ߱ŻܵģֵԽԽ׽״̬̫˻ᵼģʧ
-		// ֵӦڲģʧǰ¾ܵĴ
+		// 如果刚体的运动量低于此值就会进入休眠状态
+		// 休眠本来是用于优化性能的，这个值越大越容易进入休眠状态，但是太大了会导致模拟失真
+		// 所以这个数值应该在不造成模拟失真的前提下尽可能的大
 		static float SleepMotionEpsilon = 0.01f;
 
 		enum class ColliderType
@@ -18,6 +19,21 @@ namespace ZXEngine
 			Cloth,
 		};
 
+		enum class BroadphaseType
+		{
+			BVH,
+			DynamicAABBTree,
+			SweepAndPrune,
+		};
+
+		enum class ContactSolverType
+		{
+			// 每次迭代找出相交最深或速度变化最大的碰撞优先处理
+			Iterative,
+			// 顺序冲量法(Projected Gauss-Seidel)，固定迭代次数，用上一帧的累计冲量预热
+			SequentialImpulse,
+		};
+
 		enum class CombineType
 		{
 			Average,
@@ -31,5 +47,48 @@ namespace ZXEngine
 		{
 			RigidBody* mRigidBodies[2];
 		};
+
+		// 物理场景的运行统计数据
+		struct PSceneStats
+		{
+			// 当前帧的潜在碰撞数量
+			uint32_t mPotentialContactNum = 0;
+			// 运行以来单帧潜在碰撞数量的峰值
+			uint32_t mPeakPotentialContactNum = 0;
+			// 当前潜在碰撞数组的长度
+			uint32_t mPotentialContactCapacity = 0;
+			// 潜在碰撞数组在帧内不够大而扩容重新获取的次数，不会丢失碰撞
+			uint32_t mPotentialContactRegrowNum = 0;
+
+			// 当前帧的碰撞数量(包括关节产生的)
+			uint32_t mContactNum = 0;
+			// 运行以来单帧碰撞数量的峰值
+			uint32_t mPeakContactNum = 0;
+			// 当前碰撞数组的长度
+			uint32_t mContactCapacity = 0;
+			// 碰撞数组在帧内剩余空间不够而扩容的次数
+			uint32_t mContactRegrowNum = 0;
+
+			// 当前醒着的刚体数量(包括布料粒子)
+			uint32_t mAwakeBodyNum = 0;
+			// 当前休眠的刚体数量(包括布料粒子)
+			uint32_t mSleepingBodyNum = 0;
+			// 当前帧因为两个刚体都不会动而跳过检测的潜在碰撞数量
+			uint32_t mSleepingPairSkipNum = 0;
+
+			// 当前帧各阶段的耗时(微秒)
+			// 积分
+			float mIntegrateTime = 0.0f;
+			// 粗检测，生成潜在碰撞
+			float mBroadphaseTime = 0.0f;
+			// 细检测，从潜在碰撞中生成碰撞
+			float mNarrowphaseTime = 0.0f;
+			// 关节
+			float mJointTime = 0.0f;
+			// 处理碰撞
+			float mResolveTime = 0.0f;
+			// 写回Transform，更新包围盒和布料网格
+			float mSyncTime = 0.0f;
+		};
 	}
 }
\ No newline at end of file
@@ -6,24 +6,24 @@ namespace ZXEngine
 	{
 		void PointMass::Integrate(float duration)
 		{
-			// 
+			// 若质量无穷大，则无视受力
 			if (mInverseMass <= 0.0f) return;
 
 			assert(duration > 0.0);
 
-			// ٶȸλ
+			// 用速度更新位置
 			mPosition += mVelocity * duration;
 
-			// ú¼ٶ
+			// 用合力更新加速度
 			Vector3 resultingAcc = mAcceleration + mForceAccum * mInverseMass;
 
-			// üٶȸٶ
+			// 用加速度更新速度
 			mVelocity += resultingAcc * duration;
 
-			// ٶ˥
+			// 计算阻尼带来的速度衰减
 			mVelocity *= pow(mDamping, duration);
 
-			// 
+			// 清除合力
 			ClearForce();
 		}
 
@@ -46,7 +46,7 @@ namespace ZXEngine
 		{
 			if (mass <= 0.0f)
 			{
-				// 0쳣Ϊ
+				// 质量必须大于0，否则输出异常并将质量设置为无穷大
 				Debug::LogError("Mass must be greater than zero.");
 				mInverseMass = 0.0f;
 			}
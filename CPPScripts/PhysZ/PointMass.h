@@ -11,13 +11,13 @@ namespace ZXEngine
 			PointMass() {};
 			~PointMass() {};
 
-			// ģʵ״̬
+			// 模拟积分运算更新质点状态
 			void Integrate(float duration);
-			// һ
+			// 添加一个作用力
 			void AddForce(const Vector3& force);
-			// ǰĺ
+			// 清除当前的合力
 			void ClearForce();
-			// жǷΪ
+			// 判断质量是否为无穷大
 			bool IsInfiniteMass() const;
 
 			void SetMass(float mass);
@@ -44,18 +44,18 @@ namespace ZXEngine
 			Vector3 GetAcceleration() const;
 
 		protected:
-			// ĵ
-			// 0κ
+			// 质量的倒数
+			// 0代表质量无穷大，无视任何作用力
 			float mInverseMass = 1.0f;
-			// ϵ1ʾ
+			// 阻尼系数，1表示无阻尼
 			float mDamping = 1.0f;
-			// λ
+			// 位置
 			Vector3 mPosition;
-			// ٶ
+			// 速度
 			Vector3 mVelocity;
-			// ٶ
+			// 加速度
 			Vector3 mAcceleration;
-			// 
+			// 合力
 			Vector3 mForceAccum;
 		};
 	}
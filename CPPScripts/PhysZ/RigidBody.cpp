@@ -1,4 +1,5 @@
 #include "RigidBody.h"
+#include "RigidBodyStore.h"
 #include "CollisionPrimitive.h"
 #include "Force/FGGravity.h"
 #include "Force/FGSpring.h"
@@ -7,8 +8,16 @@ namespace ZXEngine
 {
 	namespace PhysZ
 	{
+		RigidBody::RigidBody()
+		{
+			mStore = RigidBodyStore::GetInstance();
+			mStoreIndex = mStore->Allocate(this);
+		}
+
 		RigidBody::~RigidBody()
 		{
+			mStore->Free(mStoreIndex);
+
 			if (mCollisionVolume && mCollisionVolume->mRigidBody == this)
 			{
 				mCollisionVolume->mRigidBody = nullptr;
@@ -30,163 +39,110 @@ namespace ZXEngine
 
 		void RigidBody::Integrate(float duration)
 		{
-			if (!mIsAwake)
+			if (!mStore->mIsAwake[mStoreIndex])
 				return;
 
-			// 㵱ǰĺ
+			// 计算当前作用力生成器的合力
 			IntegrateForceGenerators(duration);
 
-			// ͨٶ
-			mLastAcceleration = mAcceleration;
-			mLastAcceleration += mForceAccum * mInverseMass;
-
-			// ͨؼǼٶ
-			Vector3 angularAcceleration = mWorldInverseInertiaTensor * mTorqueAccum;
-
-			// ݼٶȸٶ
-			mVelocity += mLastAcceleration * duration;
-
-			// ݽǼٶȸ½ٶ
-			mAngularVelocity += angularAcceleration * duration;
-
-			// ʩЧ
-			mVelocity *= pow(mLinearDamping, duration);
-			mAngularVelocity *= pow(mAngularDamping, duration);
-
-			// ٶƶλ
-			mPosition += mVelocity * duration;
-
-			// ݽٶȸת״̬
-			mRotation.Rotate(mAngularVelocity, duration);
-
-			// 
-			CalculateDerivedData();
-
-			// ۻ
-			ClearAccumulators();
-
-			if (mCanSleep)
-			{
-				// 㵱ǰ˶ֵ
-				float currentMotion = Math::Dot(mVelocity, mVelocity) + Math::Dot(mAngularVelocity, mAngularVelocity);
-
-				// ֮ǰ֡˶ֵۼƽ
-				float bias = powf(0.5f, duration);
-				mMotion = bias * mMotion + (1 - bias) * currentMotion;
-
-				// ۼƽ˶ֵ̫С˾͵̬󣬽״̬ԼҪ
-				if (mMotion < SleepMotionEpsilon)
-					SetAwake(false);
-				// ۼ˶ֵһֵƣһƶͻȻͣᵼmMotionܴȻҪܶ֡ܰƽֵ
-				// һʵѾֹҪȺܾòܽ״ֵ̬̫˽
-				else if (mMotion > 10 * SleepMotionEpsilon)
-					mMotion = 10 * SleepMotionEpsilon;
-			}
+			mStore->Integrate(mStoreIndex, duration);
 		}
 
 		void RigidBody::CalculateDerivedData()
 		{
-			UpdateTransform();
-			UpdateWorldInertiaTensor();
-		}
-
-		void RigidBody::UpdateTransform()
-		{
-			mTransform = mRotation.ToMatrix();
-			mTransform = Math::Translate(mTransform, mPosition);
-
-			// ײ壬ͬײTransform
-			if (mCollisionVolume)
-				mCollisionVolume->mTransform = mTransform;
-		}
-
-		void RigidBody::UpdateWorldInertiaTensor()
-		{
-			// ݵǰtransformϢ¼ϵµĹ
-			Matrix3 rot(mTransform);
-			// ı任ʽΪ: I' = R * I * R^TֻҪת任
-			mWorldInverseInertiaTensor = rot * mLocalInverseInertiaTensor * Math::Transpose(rot);
+			mStore->CalculateDerivedData(mStoreIndex);
 		}
 
 		void RigidBody::AddForce(const Vector3& force)
 		{
-			mForceAccum += force;
-			mIsAwake = true;
+			mStore->mForceAccums[mStoreIndex] += force;
+			WakeUp();
 		}
 
 		void RigidBody::AddForceAtPoint(const Vector3& force, const Vector3& point)
 		{
-			// ĵλ
-			auto pos = point - mPosition;
+			// 相对于质心的位置
+			auto pos = point - mStore->mPositions[mStoreIndex];
 
-			mForceAccum += force;
-			mTorqueAccum += Math::Cross(pos, force);
+			mStore->mForceAccums[mStoreIndex] += force;
+			mStore->mTorqueAccums[mStoreIndex] += Math::Cross(pos, force);
 
-			mIsAwake = true;
+			WakeUp();
 		}
 
 		void RigidBody::AddForceAtLocalPoint(const Vector3& force, const Vector3& point)
 		{
-			AddForceAtPoint(force, mTransform * Vector4(point, 1.0f));
+			AddForceAtPoint(force, mStore->mTransforms[mStoreIndex] * Vector4(point, 1.0f));
 		}
 
 		void RigidBody::AddTorque(const Vector3& torque)
 		{
-			mTorqueAccum += torque;
-			mIsAwake = true;
+			mStore->mTorqueAccums[mStoreIndex] += torque;
+			WakeUp();
 		}
 
 		void RigidBody::ClearAccumulators()
 		{
-			mForceAccum.Clear();
-			mTorqueAccum.Clear();
+			mStore->ClearAccumulators(mStoreIndex);
 		}
 
 		bool RigidBody::IsInfiniteMass() const
 		{
-			return mInverseMass <= FLT_EPSILON;
+			return mStore->mInverseMasses[mStoreIndex] <= FLT_EPSILON;
 		}
 
 		void RigidBody::SetAwake(bool awake)
 		{
-			if (awake)
-			{
-				mIsAwake = true;
-
-				// Ѻһ˶ֹ̽˯״̬
-				mMotion = SleepMotionEpsilon * 2.0f;
-			}
-			else
-			{
-				mIsAwake = false;
-
-				// ״̬ĸ岻Ӧκٶ
-				mVelocity.Clear();
-				mAngularVelocity.Clear();
-			}
+			mStore->SetAwake(mStoreIndex, awake);
 		}
 
 		bool RigidBody::GetAwake() const
 		{
-			return mIsAwake;
+			return mStore->mIsAwake[mStoreIndex];
 		}
 		
 		void RigidBody::SetCanSleep(bool canSleep)
 		{
-			mCanSleep = canSleep;
+			mStore->mCanSleep[mStoreIndex] = canSleep;
 
-			if (!canSleep && !mIsAwake)
-				SetAwake(true);
+			if (!canSleep)
+			{
+				mStore->mSleepReady[mStoreIndex] = 0;
+				if (!mStore->mIsAwake[mStoreIndex])
+					SetAwake(true);
+			}
 		}
 
 		bool RigidBody::GetCanSleep() const
 		{
-			return mCanSleep;
+			return mStore->mCanSleep[mStoreIndex];
+		}
+
+		bool RigidBody::IsReadyToSleep() const
+		{
+			return mStore->mSleepReady[mStoreIndex];
+		}
+
+		void RigidBody::SetReadyToSleep(bool ready)
+		{
+			mStore->mSleepReady[mStoreIndex] = ready;
+		}
+
+		void RigidBody::WakeUp()
+		{
+			// 已经醒着的刚体不能调用SetAwake，否则会重置运动量，每帧都受力的刚体就永远无法休眠了
+			if (!mStore->mIsAwake[mStoreIndex])
+				mStore->SetAwake(mStoreIndex, true);
+		}
+
+		uint32_t RigidBody::GetStoreIndex() const
+		{
+			return mStoreIndex;
 		}
 
 		const Matrix4& RigidBody::GetTransform() const
 		{
-			return mTransform;
+			return mStore->mTransforms[mStoreIndex];
 		}
 
 		void RigidBody::AddForceGenerator(ForceGenerator* generator)
@@ -206,184 +162,184 @@ namespace ZXEngine
 		{
 			if (mass <= 0.0f)
 			{
-				// 0쳣Ϊ
+				// 质量必须大于0，否则输出异常并将质量设置为无穷大
 				Debug::LogError("Mass must be greater than zero.");
-				mInverseMass = 0.0f;
+				mStore->mInverseMasses[mStoreIndex] = 0.0f;
 			}
 			else
 			{
-				mInverseMass = 1.0f / mass;
+				mStore->mInverseMasses[mStoreIndex] = 1.0f / mass;
 			}
 		}
 
 		float RigidBody::GetMass() const
 		{
-			return 1.0f / mInverseMass;
+			return 1.0f / mStore->mInverseMasses[mStoreIndex];
 		}
 
 		void RigidBody::SetInverseMass(float inverseMass)
 		{
-			mInverseMass = inverseMass;
+			mStore->mInverseMasses[mStoreIndex] = inverseMass;
 		}
 
 		float RigidBody::GetInverseMass() const
 		{
-			return mInverseMass;
+			return mStore->mInverseMasses[mStoreIndex];
 		}
 
 		void RigidBody::SetLinearDamping(float damping)
 		{
-			mLinearDamping = damping;
+			mStore->mLinearDampings[mStoreIndex] = damping;
 		}
 
 		float RigidBody::GetLinearDamping() const
 		{
-			return mLinearDamping;
+			return mStore->mLinearDampings[mStoreIndex];
 		}
 
 		void RigidBody::SetPosition(const Vector3& position)
 		{
-			mPosition = position;
+			mStore->mPositions[mStoreIndex] = position;
 		}
 
 		void RigidBody::GetPosition(Vector3& position) const
 		{
-			position = mPosition;
+			position = mStore->mPositions[mStoreIndex];
 		}
 
 		Vector3 RigidBody::GetPosition() const
 		{
-			return mPosition;
+			return mStore->mPositions[mStoreIndex];
 		}
 
 		void RigidBody::SetVelocity(const Vector3& velocity)
 		{
-			mVelocity = velocity;
+			mStore->mVelocities[mStoreIndex] = velocity;
 		}
 
 		void RigidBody::GetVelocity(Vector3& velocity) const
 		{
-			velocity = mVelocity;
+			velocity = mStore->mVelocities[mStoreIndex];
 		}
 
 		Vector3 RigidBody::GetVelocity() const
 		{
-			return mVelocity;
+			return mStore->mVelocities[mStoreIndex];
 		}
 
 		void RigidBody::AddVelocity(const Vector3& deltaVelocity)
 		{
-			mVelocity += deltaVelocity;
+			mStore->mVelocities[mStoreIndex] += deltaVelocity;
 		}
 
 		void RigidBody::SetAcceleration(const Vector3& acceleration)
 		{
-			mAcceleration = acceleration;
+			mStore->mAccelerations[mStoreIndex] = acceleration;
 		}
 
 		void RigidBody::GetAcceleration(Vector3& acceleration) const
 		{
-			acceleration = mAcceleration;
+			acceleration = mStore->mAccelerations[mStoreIndex];
 		}
 
 		Vector3 RigidBody::GetAcceleration() const
 		{
-			return mAcceleration;
+			return mStore->mAccelerations[mStoreIndex];
 		}
 
 		void RigidBody::GetLastAcceleration(Vector3& acceleration) const
 		{
-			acceleration = mLastAcceleration;
+			acceleration = mStore->mLastAccelerations[mStoreIndex];
 		}
 
 		Vector3 RigidBody::GetLastAcceleration() const
 		{
-			return mLastAcceleration;
+			return mStore->mLastAccelerations[mStoreIndex];
 		}
 
 		void RigidBody::SetInertiaTensor(const Matrix3& inertiaTensor)
 		{
-			mLocalInverseInertiaTensor = Math::Inverse(inertiaTensor);
+			mStore->mLocalInverseInertiaTensors[mStoreIndex] = Math::Inverse(inertiaTensor);
 		}
 
 		void RigidBody::GetInertiaTensor(Matrix3& inertiaTensor) const
 		{
-			inertiaTensor = Math::Inverse(mLocalInverseInertiaTensor);
+			inertiaTensor = Math::Inverse(mStore->mLocalInverseInertiaTensors[mStoreIndex]);
 		}
 
 		Matrix3 RigidBody::GetInertiaTensor() const
 		{
-			return Math::Inverse(mLocalInverseInertiaTensor);
+			return Math::Inverse(mStore->mLocalInverseInertiaTensors[mStoreIndex]);
 		}
 
 		void RigidBody::SetInverseInertiaTensor(const Matrix3& inverseInertiaTensor)
 		{
-			mLocalInverseInertiaTensor = inverseInertiaTensor;
+			mStore->mLocalInverseInertiaTensors[mStoreIndex] = inverseInertiaTensor;
 		}
 
 		void RigidBody::GetInverseInertiaTensor(Matrix3& inverseInertiaTensor) const
 		{
-			inverseInertiaTensor = mLocalInverseInertiaTensor;
+			inverseInertiaTensor = mStore->mLocalInverseInertiaTensors[mStoreIndex];
 		}
 
 		Matrix3 RigidBody::GetInverseInertiaTensor() const
 		{
-			return mLocalInverseInertiaTensor;
+			return mStore->mLocalInverseInertiaTensors[mStoreIndex];
 		}
 
 		void RigidBody::GetInverseInertiaTensorWorld(Matrix3& inverseInertiaTensor) const
 		{
-			inverseInertiaTensor = mWorldInverseInertiaTensor;
+			inverseInertiaTensor = mStore->mWorldInverseInertiaTensors[mStoreIndex];
 		}
 
 		Matrix3 RigidBody::GetInverseInertiaTensorWorld() const
 		{
-			return mWorldInverseInertiaTensor;
+			return mStore->mWorldInverseInertiaTensors[mStoreIndex];
 		}
 
 		void RigidBody::SetAngularDamping(float damping)
 		{
-			mAngularDamping = damping;
+			mStore->mAngularDampings[mStoreIndex] = damping;
 		}
 
 		float RigidBody::GetAngularDamping() const
 		{
-			return mAngularDamping;
+			return mStore->mAngularDampings[mStoreIndex];
 		}
 
 		void RigidBody::SetRotation(const Quaternion& rotation)
 		{
-			mRotation = rotation;
+			mStore->mRotations[mStoreIndex] = rotation;
 		}
 
 		void RigidBody::GetRotation(Quaternion& rotation) const
 		{
-			rotation = mRotation;
+			rotation = mStore->mRotations[mStoreIndex];
 		}
 
 		Quaternion RigidBody::GetRotation() const
 		{
-			return mRotation;
+			return mStore->mRotations[mStoreIndex];
 		}
 
 		void RigidBody::SetAngularVelocity(const Vector3& angularVelocity)
 		{
-			mAngularVelocity = angularVelocity;
+			mStore->mAngularVelocities[mStoreIndex] = angularVelocity;
 		}
 
 		void RigidBody::GetAngularVelocity(Vector3& angularVelocity) const
 		{
-			angularVelocity = mAngularVelocity;
+			angularVelocity = mStore->mAngularVelocities[mStoreIndex];
 		}
 
 		Vector3 RigidBody::GetAngularVelocity() const
 		{
-			return mAngularVelocity;
+			return mStore->mAngularVelocities[mStoreIndex];
 		}
 
 		void RigidBody::AddAngularVelocity(const Vector3& deltaAngularVelocity)
 		{
-			mAngularVelocity += deltaAngularVelocity;
+			mStore->mAngularVelocities[mStoreIndex] += deltaAngularVelocity;
 		}
 	}
 }
\ No newline at end of file
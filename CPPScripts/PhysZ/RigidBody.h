@@ -9,44 +9,59 @@ namespace ZXEngine
 		class BVHNode;
 		class ForceGenerator;
 		class CollisionPrimitive;
+		class RigidBodyStore;
+		// 刚体的运动数据存放在RigidBodyStore里，这个对象只是一个句柄，记录数据在RigidBodyStore中的下标
 		class RigidBody
 		{
+			friend class RigidBodyStore;
 		public:
-			// ӦBVHڵ
+			// 对应的BVH节点
 			BVHNode* mBVHNode = nullptr;
-			// Ӧײ
+			// 在Broadphase中对应的节点ID(BVH用的是mBVHNode)
+			uint32_t mBroadphaseID = UINT32_MAX;
+			// 对应的碰撞体
 			CollisionPrimitive* mCollisionVolume = nullptr;
 
-			RigidBody() {};
+			RigidBody();
 			~RigidBody();
+			RigidBody(const RigidBody& other) = delete;
+			RigidBody& operator= (const RigidBody& other) = delete;
 
-			// ¸λúת
+			// 在RigidBodyStore中的下标
+			uint32_t GetStoreIndex() const;
+
+			// 更新刚体的位置和旋转
 			void Integrate(float duration);
-			// Ҫ仯仯
+			// 计算需要跟随刚体变化而变化的相关数据
 			void CalculateDerivedData();
-			// ֱһ(ϵ)
+			// 直接在质心添加一个作用力(世界坐标系)
 			void AddForce(const Vector3& force);
-			// ĳ(ϵ)(ϵ)
+			// 在某个点(世界坐标系)上添加作用力(世界坐标系)
 			void AddForceAtPoint(const Vector3& force, const Vector3& point);
-			// ĳ(ֲϵ)(ϵ)
+			// 在某个点(局部坐标系)上添加作用力(世界坐标系)
 			void AddForceAtLocalPoint(const Vector3& force, const Vector3& point);
-			// һ(ϵ)
+			// 添加一个力矩(世界坐标系)
 			void AddTorque(const Vector3& torque);
-			// ǰۼƵ
+			// 清除当前累计的作用力和力矩
 			void ClearAccumulators();
-			// жǷΪ
+			// 判断质量是否为无穷大
 			bool IsInfiniteMass() const;
 
 			void SetAwake(bool awake);
 			bool GetAwake() const;
 			void SetCanSleep(bool canSleep);
 			bool GetCanSleep() const;
+			// 积分后运动量低于阈值的刚体会标记为可以休眠，但是要等所在岛屿的刚体都可以休眠时才真正进入休眠
+			bool IsReadyToSleep() const;
+			void SetReadyToSleep(bool ready);
+			// 如果在休眠就唤醒，作用力和外部修改会调用这个接口
+			void WakeUp();
 			
 			const Matrix4& GetTransform() const;
 
 			void AddForceGenerator(ForceGenerator* generator);
 
-			// ---------- ˶ ----------
+			// ---------- 线性运动 ----------
 
 			void SetMass(float mass);
 			float GetMass() const;
@@ -72,7 +87,7 @@ namespace ZXEngine
 			void GetLastAcceleration(Vector3& acceleration) const;
 			Vector3 GetLastAcceleration() const;
 
-			// ---------- ת˶ ----------
+			// ---------- 旋转运动 ----------
 
 			void SetInertiaTensor(const Matrix3& inertiaTensor);
 			void GetInertiaTensor(Matrix3& inertiaTensor) const;
@@ -96,52 +111,13 @@ namespace ZXEngine
 			void AddAngularVelocity(const Vector3& deltaAngularVelocity);
 
 		private:
-			// ˸ϵб
+			// 此刚体上的作用力生成器列表
 			vector<ForceGenerator*> mForceGenerators;
 
-			// ĵ(0κ)
-			float mInverseMass = 1.0f;
-			// ˶ϵ(1ʾ)
-			float mLinearDamping = 1.0f;
-			// λ
-			Vector3 mPosition;
-			// ٶ
-			Vector3 mVelocity;
-			// ٶ
-			Vector3 mAcceleration;
-			// һ֡ļٶ
-			Vector3 mLastAcceleration;
-			// ۻ
-			Vector3 mForceAccum;
-
-			// Local(Ծʽ,洢󷽱)
-			Matrix3 mLocalInverseInertiaTensor;
-			// World(Ծʽ,洢󷽱)
-			Matrix3 mWorldInverseInertiaTensor;
-			// ת˶ϵ(1ʾ)
-			float mAngularDamping = 0.95f;
-			// ת
-			Quaternion mRotation;
-			// ٶ
-			Vector3 mAngularVelocity;
-			// ۻ
-			Vector3 mTorqueAccum;
-
-			// localworldռı任
-			Matrix4 mTransform;
-
-			// ˯״̬ĸ岻
-			bool mIsAwake = true;
-			// ǷԽ˯״̬
-			// һĬΪtrueĳЩ󣬱ҲٿصģʱֶĶΪfalse
-			bool mCanSleep = true;
-			// 嵱ǰ˶ٶȺͽٶȣʵ壬˶״̬
-			float mMotion = SleepMotionEpsilon * 2.0f;
+			RigidBodyStore* mStore = nullptr;
+			uint32_t mStoreIndex = UINT32_MAX;
 
 			void IntegrateForceGenerators(float duration);
-
-			void UpdateTransform();
-			void UpdateWorldInertiaTensor();
 		};
 	}
 }
\ No newline at end of file
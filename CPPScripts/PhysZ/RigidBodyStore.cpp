@@ -0,0 +1,277 @@
+#include "RigidBodyStore.h"
+#include "RigidBody.h"
+#include "CollisionPrimitive.h"
+#include "../Concurrent/JobSystem.h"
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		RigidBodyStore* RigidBodyStore::mInstance = nullptr;
+
+		void RigidBodyStore::Create()
+		{
+			mInstance = new RigidBodyStore();
+		}
+
+		RigidBodyStore* RigidBodyStore::GetInstance()
+		{
+			return mInstance;
+		}
+
+		uint32_t RigidBodyStore::Allocate(RigidBody* body)
+		{
+			uint32_t index;
+			if (mFreeSlots.empty())
+			{
+				index = static_cast<uint32_t>(mBodies.size());
+				size_t size = static_cast<size_t>(index) + 1;
+
+				mBodies.resize(size);
+				mInverseMasses.resize(size);
+				mLinearDampings.resize(size);
+				mPositions.resize(size);
+				mVelocities.resize(size);
+				mAccelerations.resize(size);
+				mLastAccelerations.resize(size);
+				mForceAccums.resize(size);
+				mLocalInverseInertiaTensors.resize(size);
+				mWorldInverseInertiaTensors.resize(size);
+				mAngularDampings.resize(size);
+				mRotations.resize(size);
+				mAngularVelocities.resize(size);
+				mTorqueAccums.resize(size);
+				mTransforms.resize(size);
+				mIsAwake.resize(size);
+				mCanSleep.resize(size);
+				mMotions.resize(size);
+				mSleepReady.resize(size);
+			}
+			else
+			{
+				index = mFreeSlots.back();
+				mFreeSlots.pop_back();
+			}
+
+			mBodies[index] = body;
+			ResetSlot(index);
+			return index;
+		}
+
+		void RigidBodyStore::Free(uint32_t index)
+		{
+			mBodies[index] = nullptr;
+			mFreeSlots.push_back(index);
+		}
+
+		uint32_t RigidBodyStore::GetCapacity() const
+		{
+			return static_cast<uint32_t>(mBodies.size());
+		}
+
+		RigidBody* RigidBodyStore::GetBody(uint32_t index) const
+		{
+			return mBodies[index];
+		}
+
+		void RigidBodyStore::ResetSlot(uint32_t index)
+		{
+			mInverseMasses[index] = 1.0f;
+			mLinearDampings[index] = 1.0f;
+			mPositions[index] = Vector3();
+			mVelocities[index] = Vector3();
+			mAccelerations[index] = Vector3();
+			mLastAccelerations[index] = Vector3();
+			mForceAccums[index] = Vector3();
+			mLocalInverseInertiaTensors[index] = Matrix3();
+			mWorldInverseInertiaTensors[index] = Matrix3();
+			mAngularDampings[index] = 0.95f;
+			mRotations[index] = Quaternion();
+			mAngularVelocities[index] = Vector3();
+			mTorqueAccums[index] = Vector3();
+			mTransforms[index] = Matrix4();
+			mIsAwake[index] = 1;
+			mCanSleep[index] = 1;
+			mMotions[index] = SleepMotionEpsilon * 2.0f;
+			mSleepReady[index] = 0;
+		}
+
+		void RigidBodyStore::ClearAccumulators(const uint32_t* indices, uint32_t count)
+		{
+			ForEach(count, [this, indices](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+					ClearAccumulators(indices[i]);
+			});
+		}
+
+		void RigidBodyStore::CalculateDerivedData(const uint32_t* indices, uint32_t count)
+		{
+			ForEach(count, [this, indices](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+					CalculateDerivedData(indices[i]);
+			});
+		}
+
+		void RigidBodyStore::Integrate(const uint32_t* indices, uint32_t count, float duration)
+		{
+			// 作用力生成器只会读取其它刚体的位置，修改自己的累积作用力，所以要在所有刚体积分前全部算完
+			ForEach(count, [this, indices, duration](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					uint32_t index = indices[i];
+					if (mIsAwake[index])
+						mBodies[index]->IntegrateForceGenerators(duration);
+				}
+			});
+
+			ForEach(count, [this, indices, duration](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+					Integrate(indices[i], duration);
+			});
+		}
+
+		void RigidBodyStore::GatherAwake(const uint32_t* indices, uint32_t count, vector<uint32_t>& awakeIndices) const
+		{
+			awakeIndices.clear();
+			for (uint32_t i = 0; i < count; i++)
+			{
+				if (mIsAwake[indices[i]])
+					awakeIndices.push_back(indices[i]);
+			}
+		}
+
+		uint32_t RigidBodyStore::ApplySleep(const uint32_t* indices, uint32_t count)
+		{
+			uint32_t sleepNum = 0;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint32_t index = indices[i];
+				if (mIsAwake[index] && mSleepReady[index])
+				{
+					SetAwake(index, false);
+					sleepNum++;
+				}
+			}
+			return sleepNum;
+		}
+
+		void RigidBodyStore::ClearAccumulators(uint32_t index)
+		{
+			mForceAccums[index].Clear();
+			mTorqueAccums[index].Clear();
+		}
+
+		void RigidBodyStore::CalculateDerivedData(uint32_t index)
+		{
+			Matrix4& transform = mTransforms[index];
+			transform = mRotations[index].ToMatrix();
+			transform = Math::Translate(transform, mPositions[index]);
+
+			// 如果有碰撞体，同步碰撞体的Transform
+			auto collisionVolume = mBodies[index]->mCollisionVolume;
+			if (collisionVolume)
+				collisionVolume->mTransform = transform;
+
+			// 根据当前的transform信息，重新计算世界坐标系下的惯性张量
+			Matrix3 rot(transform);
+			// 惯性张量的变换公式为: I' = R * I * R^T，只需要考虑旋转变换即可
+			mWorldInverseInertiaTensors[index] = rot * mLocalInverseInertiaTensors[index] * Math::Transpose(rot);
+		}
+
+		void RigidBodyStore::Integrate(uint32_t index, float duration)
+		{
+			if (!mIsAwake[index])
+				return;
+
+			Vector3& velocity = mVelocities[index];
+			Vector3& angularVelocity = mAngularVelocities[index];
+
+			// 通过合力计算加速度
+			Vector3& lastAcceleration = mLastAccelerations[index];
+			lastAcceleration = mAccelerations[index];
+			lastAcceleration += mForceAccums[index] * mInverseMasses[index];
+
+			// 通过合力矩计算角加速度
+			Vector3 angularAcceleration = mWorldInverseInertiaTensors[index] * mTorqueAccums[index];
+
+			// 根据加速度更新速度
+			Vector3 lastVelocity = velocity;
+			velocity += lastAcceleration * duration;
+
+			// 根据角加速度更新角速度
+			angularVelocity += angularAcceleration * duration;
+
+			// 施加阻尼效果
+			velocity *= pow(mLinearDampings[index], duration);
+			angularVelocity *= pow(mAngularDampings[index], duration);
+
+			// 根据速度移动位置
+			mPositions[index] += velocity * duration;
+
+			// 根据角速度更新旋转状态
+			mRotations[index].Rotate(angularVelocity, duration);
+
+			// 更新其它数据
+			CalculateDerivedData(index);
+
+			// 清除累积的作用力和力矩
+			ClearAccumulators(index);
+
+			if (mCanSleep[index])
+			{
+				// 计算当前的运动值
+				// 静止接触时重力这类持续作用力在一帧内产生的速度会被碰撞处理抵消，但是不同的碰撞求解器抵消的时机不同
+				// 迭代求解器在积分后抵消，积分前的速度接近0，顺序冲量求解器提前抵消，积分后的速度接近0，所以取两者中较小的
+				float linearMotion = Math::Min(Math::Dot(lastVelocity, lastVelocity), Math::Dot(velocity, velocity));
+				float currentMotion = linearMotion + Math::Dot(angularVelocity, angularVelocity);
+
+				// 与之前的帧的运动值数据做累计平均
+				float& motion = mMotions[index];
+				float bias = powf(0.5f, duration);
+				motion = bias * motion + (1 - bias) * currentMotion;
+
+				// 如果累计平均运动值太小了就当作静态对象，标记为可以休眠，节约不必要的物理计算
+				// 这里不直接休眠，处理完碰撞后如果同一个岛屿里还有在运动的刚体，会取消这个标记
+				mSleepReady[index] = motion < SleepMotionEpsilon;
+				// 对累计运动值做一个最大值限制，如果一个高速移动物体突然停下来，会导致mMotion很大，然后需要很多帧才能把数据平均值拉下来
+				// 导致一个实际已经静止的物体要等很久才能进入休眠状态，所以这里如果值太大了进行限制
+				if (motion > 10 * SleepMotionEpsilon)
+					motion = 10 * SleepMotionEpsilon;
+			}
+		}
+
+		void RigidBodyStore::SetAwake(uint32_t index, bool awake)
+		{
+			if (awake)
+			{
+				mIsAwake[index] = 1;
+
+				// 唤醒后添加一点运动量，防止又立刻进入睡眠状态
+				mMotions[index] = SleepMotionEpsilon * 2.0f;
+				mSleepReady[index] = 0;
+			}
+			else
+			{
+				mIsAwake[index] = 0;
+				mSleepReady[index] = 0;
+
+				// 休眠状态的刚体不应该有任何速度
+				mVelocities[index].Clear();
+				mAngularVelocities[index].Clear();
+			}
+		}
+
+		void RigidBodyStore::ForEach(uint32_t count, const std::function<void(uint32_t, uint32_t)>& func)
+		{
+			auto jobSystem = JobSystem::GetInstance();
+			if (jobSystem == nullptr || count < RIGID_BODY_STORE_PARALLEL_MIN_COUNT)
+				func(0, count);
+			else
+				jobSystem->ParallelFor(count, RIGID_BODY_STORE_JOB_SIZE, func);
+		}
+	}
+}
\ No newline at end of file
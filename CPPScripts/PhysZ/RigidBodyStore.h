@@ -0,0 +1,107 @@
+#pragma once
+#include "../pubh.h"
+#include "PhysZEnumStruct.h"
+
+// 批量处理的刚体数量超过这个值时拆分到JobSystem上并行执行
+#define RIGID_BODY_STORE_PARALLEL_MIN_COUNT 1024
+// 并行执行时每个Job处理的刚体数量
+#define RIGID_BODY_STORE_JOB_SIZE 256
+
+namespace ZXEngine
+{
+	namespace PhysZ
+	{
+		class RigidBody;
+		// 所有刚体的运动数据按字段分别存放在连续的数组里(SoA)，RigidBody对象只是一个指向这里的句柄
+		// 积分和更新派生数据时按刚体下标批量遍历，同一个字段在内存里是连续的，避免逐个刚体跳转指针
+		// 分配和释放只能在主线程，并且不能和物理更新同时进行，扩容会让之前拿到的字段引用失效
+		class RigidBodyStore
+		{
+			friend class RigidBody;
+		public:
+			static void Create();
+			static RigidBodyStore* GetInstance();
+
+		private:
+			static RigidBodyStore* mInstance;
+
+		public:
+			// 分配一个槽位，返回刚体在数组中的下标，释放的槽位会被重复使用
+			uint32_t Allocate(RigidBody* body);
+			void Free(uint32_t index);
+
+			// 当前已分配的槽位数量(包括已释放等待重用的)
+			uint32_t GetCapacity() const;
+			// 获取下标对应的刚体，已释放的槽位返回nullptr
+			RigidBody* GetBody(uint32_t index) const;
+
+			// 以下批量接口的indices是需要处理的刚体下标
+			// 清除累计的作用力和力矩
+			void ClearAccumulators(const uint32_t* indices, uint32_t count);
+			// 计算Transform和世界空间的惯性张量，并同步到碰撞体上
+			void CalculateDerivedData(const uint32_t* indices, uint32_t count);
+			// 先计算所有刚体的作用力生成器，再统一积分，睡眠状态的刚体不处理
+			void Integrate(const uint32_t* indices, uint32_t count, float duration);
+			// 把indices中醒着的刚体下标放进awakeIndices
+			void GatherAwake(const uint32_t* indices, uint32_t count, vector<uint32_t>& awakeIndices) const;
+			// 让标记为可以休眠的刚体进入休眠状态，返回进入休眠的数量
+			uint32_t ApplySleep(const uint32_t* indices, uint32_t count);
+
+		private:
+			// 下标对应的刚体句柄，空闲的槽位为nullptr
+			vector<RigidBody*> mBodies;
+			// 空闲槽位列表
+			vector<uint32_t> mFreeSlots;
+
+			// 质量的倒数(0代表质量无穷大，无视任何作用力)
+			vector<float> mInverseMasses;
+			// 线性运动阻尼系数(1表示无阻尼)
+			vector<float> mLinearDampings;
+			// 位置
+			vector<Vector3> mPositions;
+			// 速度
+			vector<Vector3> mVelocities;
+			// 加速度
+			vector<Vector3> mAccelerations;
+			// 上一帧的加速度
+			vector<Vector3> mLastAccelerations;
+			// 累积作用力
+			vector<Vector3> mForceAccums;
+
+			// Local惯性张量(以矩阵形式表达,存储逆矩阵方便计算)
+			vector<Matrix3> mLocalInverseInertiaTensors;
+			// World惯性张量(以矩阵形式表达,存储逆矩阵方便计算)
+			vector<Matrix3> mWorldInverseInertiaTensors;
+			// 旋转运动阻尼系数(1表示无阻尼)
+			vector<float> mAngularDampings;
+			// 旋转
+			vector<Quaternion> mRotations;
+			// 角速度
+			vector<Vector3> mAngularVelocities;
+			// 累积力矩
+			vector<Vector3> mTorqueAccums;
+
+			// local到world空间的变换
+			vector<Matrix4> mTransforms;
+
+			// 睡眠状态的刚体不进行物理更新(不用vector<bool>，并行写入不同元素时不安全)
+			vector<uint8_t> mIsAwake;
+			// 刚体是否可以进入睡眠状态
+			vector<uint8_t> mCanSleep;
+			// 刚体当前的运动量，包含线性速度和角速度，无实际物理意义，仅用于评估运动状态
+			vector<float> mMotions;
+			// 运动量已经低于阈值，等待所在岛屿一起进入休眠
+			vector<uint8_t> mSleepReady;
+
+			void ResetSlot(uint32_t index);
+
+			void ClearAccumulators(uint32_t index);
+			void CalculateDerivedData(uint32_t index);
+			void Integrate(uint32_t index, float duration);
+			void SetAwake(uint32_t index, bool awake);
+
+			// 按数量决定直接执行还是拆分到JobSystem上并行执行，func的参数是indices中的区间
+			static void ForEach(uint32_t count, const std::function<void(uint32_t, uint32_t)>& func);
+		};
+	}
+}
\ No newline at end of file
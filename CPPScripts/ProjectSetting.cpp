@@ -10,10 +10,12 @@ namespace ZXEngine
 	string ProjectSetting::projectPath;
 	RenderPipelineType ProjectSetting::renderPipelineType;
 	bool ProjectSetting::enableDynamicBatch;
+	bool ProjectSetting::enableStaticBatch;
 	bool ProjectSetting::preserveIntermediateShader;
 	bool ProjectSetting::enableGraphicsDebug;
 	bool ProjectSetting::logToFile;
 	bool ProjectSetting::stablePhysics;
+	bool ProjectSetting::animationCompression;
 
 	// Editor
 	unsigned int ProjectSetting::hierarchyWidth;
@@ -41,10 +43,12 @@ namespace ZXEngine
 		GlobalData::srcHeight = data["WindowSize"][1];
 		defaultScene = Resources::JsonStrToString(data["DefaultScene"]);
 		enableDynamicBatch = data["DynamicBatch"];
+		enableStaticBatch = data["StaticBatch"].is_null() ? false : (bool)data["StaticBatch"];
 		preserveIntermediateShader = data["PreserveIntermediateShader"];
 		enableGraphicsDebug = data["EnableGraphicsDebug"];
 		logToFile = data["LogToFile"];
 		stablePhysics = data["StablePhysics"];
+		animationCompression = data["AnimationCompression"].is_null() ? false : (bool)data["AnimationCompression"];
 
 #ifdef ZX_EDITOR
 		SetWindowSize(200, 200, 200);
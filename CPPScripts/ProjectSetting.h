@@ -12,10 +12,12 @@ namespace ZXEngine
 		static string projectPath;
 		static RenderPipelineType renderPipelineType;
 		static bool enableDynamicBatch;
+		static bool enableStaticBatch;
 		static bool preserveIntermediateShader;
 		static bool enableGraphicsDebug;
 		static bool logToFile;
 		static bool stablePhysics;
+		static bool animationCompression;
 
 		// Editor
 		static unsigned int hierarchyWidth;
@@ -286,9 +286,41 @@ namespace ZXEngine
 		END,
 	};
 
+	enum class CachedAssetType
+	{
+		Texture, CubeMap, Shader, Model, Count,
+	};
+
+	enum class AsyncLoadPriority
+	{
+		Low, Normal, High,
+	};
+
+	enum class BlendTreeType
+	{
+		Simple1D,   // 按一个参数在相邻的两个动画之间插值
+		Freeform2D, // 按两个参数在平面上任意摆放的多个动画之间插值
+	};
+
+	enum class AnimationLayerBlendMode
+	{
+		Override, // 按权重覆盖下面的层
+		Additive, // 把相对第一帧的变化量叠加到下面的层上
+	};
+
+	// Animator在一帧里的更新方式
+	enum class AnimatorLOD
+	{
+		Full,      // 每帧更新全部骨骼，正常混合
+		Reduced,   // 距离较远，只更新靠近根节点的骨骼，不做混合
+		Offscreen, // 不在任何相机视野内，降频更新，这一帧有更新
+		Skipped,   // 不在任何相机视野内，这一帧跳过更新
+		Count,
+	};
+
 	enum class EventType
 	{
-		PLACE_HOLDER = 0, // һռλΪLuaҲһEventTypeҪ룬Lua±Ǵ1ʼ
+		PLACE_HOLDER = 0, // 这里加一个占位符，因为Lua也有一份EventType需要和这里对齐，但是Lua下标是从1开始的
 		GAME_START,
 		UPDATE_MOUSE_POS,
 
@@ -5,8 +5,12 @@
 #include "PublicEnum.h"
 #include "Debug.h"
 
-// 4
+// 顶点最多关联4个骨骼
 #define MAX_NUM_BONES_PER_VERTEX 4
+// GPU Instancing单次绘制最多的实例数量
+#define MAX_INSTANCE_NUM 512
+// 逐实例模型矩阵在顶点输入中的起始location，按列占用连续4个location
+#define INSTANCE_MODEL_LOCATION 6
 
 using std::string;
 using std::vector;
@@ -19,7 +23,7 @@ namespace ZXEngine
 		Vector2 TexCoords = {};
 		Vector3 Normal    = {};
 		Vector3 Tangent   = {};
-		// Ƥ
+		// 骨骼蒙皮数据
 		float    Weights[MAX_NUM_BONES_PER_VERTEX] = {};
 		uint32_t BoneIDs[MAX_NUM_BONES_PER_VERTEX] = {};
 
@@ -62,15 +66,18 @@ namespace ZXEngine
 	};
 
 	class Mesh;
+	class Skeleton;
 	class AnimationController;
 	struct ModelData
 	{
 		vector<Mesh*> pMeshes;
 		uint32_t boneNum = 0;
-		BoneNode* pRootBoneNode = nullptr;
+		Skeleton* pSkeleton = nullptr;
 		AnimationController* pAnimationController = nullptr;
 		vector<AnimBriefInfo> animBriefInfos;
 		bool isConstructed = false;
+		// 是否由AssetCache管理，是的话Mesh被所有引用者共享，要通过AssetCache::ReleaseModel释放
+		bool isCached = false;
 	};
 
 	struct KeyFrame
@@ -102,12 +109,12 @@ namespace ZXEngine
 	struct ShaderProperty
 	{
 		string name = "";
-		uint32_t size = 0;        // ԴС(ĴС)
-		uint32_t align = 0;       // ԵĶ׼
-		uint32_t offset = 0;      // Uniform Buffer(Vulkan)Constant Buffer(D3D12)еƫ
-		uint32_t binding = 0;     // VulkanдUniform Bufferlayout bindingD3D12дregister(t)
-		uint32_t arrayLength = 0; // 鳤
-		uint32_t arrayOffset = 0; // Ļһڵƫ
+		uint32_t size = 0;        // 整个属性大小(如果是数组则代表整个数组的大小)
+		uint32_t align = 0;       // 单个属性的对齐标准
+		uint32_t offset = 0;      // 属性在Uniform Buffer(Vulkan)或Constant Buffer(D3D12)中的偏移量
+		uint32_t binding = 0;     // 在Vulkan中代表Uniform Buffer和纹理的layout binding，在D3D12中代表纹理的register(t)索引
+		uint32_t arrayLength = 0; // 属性数组长度
+		uint32_t arrayOffset = 0; // 如果是数组的话，一个属性在数组内的偏移量
 		ShaderPropertyType type = ShaderPropertyType::FLOAT;
 	};
 
@@ -117,13 +124,22 @@ namespace ZXEngine
 		vector<ShaderProperty> textureProperties;
 	};
 
-	// Shaderм¼ϢĽṹ
+	// 索引缓冲区中的一段连续区间
+	struct IndexRange
+	{
+		uint32_t offset = 0;
+		uint32_t count = 0;
+	};
+
+	// Shader类中记录信息的结构体
 	struct ShaderInfo
 	{
 		LightType lightType   = LightType::None;
 		ShadowType shadowType = ShadowType::None;
 		ShaderStateSet stateSet;
 		ShaderStageFlags stages = 0;
+		// 顶点输入里声明了INSTANCE语义的逐实例模型矩阵，只能通过GPU Instancing绘制
+		bool instancing = false;
 		ShaderPropertiesInfo vertProperties;
 		ShaderPropertiesInfo geomProperties;
 		ShaderPropertiesInfo fragProperties;
@@ -17,7 +17,7 @@ namespace ZXEngine
 		static RenderAPI* mInstance;
 
 		/// <summary>
-		/// ׼RenderAPIӿ
+		/// 标准RenderAPI接口
 		/// </summary>
 	public:
 		RenderAPI() {};
@@ -26,7 +26,7 @@ namespace ZXEngine
 		virtual void BeginFrame() = 0;
 		virtual void EndFrame() = 0;
 
-		// Ⱦ״̬
+		// 渲染状态
 		virtual void OnWindowSizeChange(uint32_t width, uint32_t height) = 0;
 		virtual void SetRenderState(RenderStateSetting* state) = 0;
 		virtual void SetViewPort(unsigned int width, unsigned int height, unsigned int xOffset = 0, unsigned int yOffset = 0) = 0;
@@ -39,7 +39,7 @@ namespace ZXEngine
 		virtual FrameBufferObject* CreateFrameBufferObject(FrameBufferType type, const ClearInfo& clearInfo, unsigned int width = 0, unsigned int height = 0) = 0;
 		virtual void DeleteFrameBufferObject(FrameBufferObject* FBO) = 0;
 
-		// 
+		// 纹理
 		virtual unsigned int LoadTexture(const char* path, int& width, int& height) = 0;
 		virtual unsigned int LoadCubeMap(const vector<string>& faces) = 0;
 		virtual unsigned int CreateTexture(TextureFullData* data) = 0;
@@ -52,7 +52,7 @@ namespace ZXEngine
 		virtual ShaderReference* SetUpShader(const string& path, const string& shaderCode, FrameBufferType type) = 0;
 		virtual void DeleteShader(uint32_t id) = 0;
 
-		// 
+		// 材质
 		virtual uint32_t CreateMaterialData() = 0;
 		virtual void SetUpMaterial(Material* material) = 0;
 		virtual void UseMaterialData(uint32_t ID) = 0;
@@ -61,8 +61,17 @@ namespace ZXEngine
 		// Draw
 		virtual uint32_t AllocateDrawCommand(CommandType commandType) = 0;
 		virtual void Draw(uint32_t VAO) = 0;
+		// 使用instanceBuffer中的逐实例模型矩阵，一次绘制instanceNum个实例
+		virtual void Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer) = 0;
+		// 只绘制索引缓冲区中从indexOffset开始的indexCount个索引
+		virtual void DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount) = 0;
 		virtual void GenerateDrawCommand(uint32_t id) = 0;
 
+		// Instance Buffer
+		virtual uint32_t CreateInstanceBuffer(uint32_t instanceNum) = 0;
+		virtual void UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum) = 0;
+		virtual void DeleteInstanceBuffer(uint32_t id) = 0;
+
 		// Mesh
 		virtual void DeleteMesh(unsigned int VAO) = 0;
 		virtual void SetUpStaticMesh(unsigned int& VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices) = 0;
@@ -70,7 +79,7 @@ namespace ZXEngine
 		virtual void UpdateDynamicMesh(unsigned int VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices) = 0;
 		virtual void GenerateParticleMesh(unsigned int& VAO) = 0;
 
-		// Shader
+		// Shader参数
 		virtual void UseShader(unsigned int ID) = 0;
 		virtual void SetShaderScalar(Material* material, const string& name, bool value, bool allBuffer = false) = 0;
 		virtual void SetShaderScalar(Material* material, const string& name, float value, bool allBuffer = false) = 0;
@@ -93,7 +102,7 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// ׼RayTracingӿ
+		/// 标准RayTracing接口
 		/// </summary>
 	public:
 		// Pipeline
@@ -105,7 +114,7 @@ namespace ZXEngine
 		virtual void SetUpRayTracingMaterialData(Material* material) = 0;
 		virtual void DeleteRayTracingMaterialData(uint32_t id) = 0;
 
-		// ݸ
+		// 数据更新
 		virtual void SetRayTracingSkyBox(uint32_t textureID) = 0;
 		virtual void PushRayTracingMaterialData(Material* material) = 0;
 		virtual void PushAccelerationStructure(uint32_t VAO, uint32_t hitGroupIdx, uint32_t rtMaterialDataID, const Matrix4& transform) = 0;
@@ -77,7 +77,7 @@ namespace ZXEngine
 
 		ThrowIfFailed(CreateDXGIFactory2(dxgiFactoryFlags, IID_PPV_ARGS(&mDXGIFactory)));
 
-		// һʵԿӲ
+		// 找一个合适的显卡硬件
 		UINT adapterIndex = 0;
 		UINT bestAdapterIndex = UINT_MAX;
 		IDXGIAdapter1* pAdapter = nullptr;
@@ -86,7 +86,7 @@ namespace ZXEngine
 			DXGI_ADAPTER_DESC1 adapterDesc;
 			pAdapter->GetDesc1(&adapterDesc);
 
-			// 0x8086IntelжûжԿ
+			// 0x8086代表Intel，这个判断是在找有没有独立显卡
 			if (adapterDesc.VendorId != 0x8086 && !(adapterDesc.Flags & DXGI_ADAPTER_FLAG_SOFTWARE))
 				bestAdapterIndex = adapterIndex;
 
@@ -96,21 +96,21 @@ namespace ZXEngine
 			adapterIndex++;
 		}
 
-		// ûҵʵԿifpAdapterᱣΪ
+		// 如果没找到合适的显卡，不会进这个if，pAdapter会保持为空
 		if (bestAdapterIndex != UINT_MAX)
 			mDXGIFactory->EnumAdapters1(bestAdapterIndex, &pAdapter);
 
-		// ʹӲ豸ûҵʵԿpAdapterʱΪnullptrָʾԶһʵ
+		// 优先使用硬件设备，如果没找到合适的显卡，pAdapter此时为nullptr，这里允许空指针参数，表示自动找一个合适的
 		HRESULT hardwareResult = D3D12CreateDevice(pAdapter, D3D_FEATURE_LEVEL_12_1, IID_PPV_ARGS(&mD3D12Device));
 
-		// ҵ˺ʵԿҪֶͷһAdapter
+		// 如果找到了合适的显卡，要手动释放一下Adapter
 		if (bestAdapterIndex != UINT_MAX)
 		{
 			pAdapter->Release();
 			pAdapter = nullptr;
 		}
 
-		// Ӳ֧֣ʹWARP豸(Windows Advanced Rasterization Platform΢ģĹդӲԿ)
+		// 如果硬件条件不支持，使用WARP设备(Windows Advanced Rasterization Platform，微软用软件模拟的光栅化硬件显卡)
 		if (FAILED(hardwareResult))
 		{
 			ComPtr<IDXGIAdapter> pWarpAdapter;
@@ -118,14 +118,14 @@ namespace ZXEngine
 			ThrowIfFailed(D3D12CreateDevice(pWarpAdapter.Get(), D3D_FEATURE_LEVEL_12_1, IID_PPV_ARGS(&mD3D12Device)));
 		}
 
-		// Debugɸѡ
+		// 设置Debug输出筛选
 		if (ProjectSetting::enableGraphicsDebug)
 		{
-			// ȡ豸Ϣ
+			// 获取设备的信息队列
 			ComPtr<ID3D12InfoQueue> pInfoQueue;
 			mD3D12Device->QueryInterface(IID_PPV_ARGS(&pInfoQueue));
 			
-			// ҪϢ
+			// 设置要允许的消息类别
 			D3D12_MESSAGE_CATEGORY categories[] = 
 			{ 
 				D3D12_MESSAGE_CATEGORY_APPLICATION_DEFINED,
@@ -141,7 +141,7 @@ namespace ZXEngine
 				D3D12_MESSAGE_CATEGORY_SHADER
 			};
 
-			// ҪϢ
+			// 设置要允许的消息严重性
 			D3D12_MESSAGE_SEVERITY severities[] = 
 			{ 
 				D3D12_MESSAGE_SEVERITY_CORRUPTION,
@@ -159,21 +159,21 @@ namespace ZXEngine
 
 			pInfoQueue->PushStorageFilter(&filter);
 
-			// дʱֱBreak
+			// 有错误时直接Break
 			pInfoQueue->SetBreakOnSeverity(D3D12_MESSAGE_SEVERITY_CORRUPTION, TRUE);
 			pInfoQueue->SetBreakOnSeverity(D3D12_MESSAGE_SEVERITY_ERROR, TRUE);
 			pInfoQueue->SetBreakOnSeverity(D3D12_MESSAGE_SEVERITY_WARNING, TRUE);
 		}
 
-		// 
+		// 创建命令队列
 		D3D12_COMMAND_QUEUE_DESC queueDesc = {};
 		queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
 		queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
 		ThrowIfFailed(mD3D12Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&mCommandQueue)));
 		
-		// GPUѣShader VisibleӲƣ: https://learn.microsoft.com/en-us/windows/win32/direct3d12/shader-visible-descriptor-heaps
-		// ΢ĵ˵һӲShader Visibleѿڴ96MBң A one million member descriptor heap, with 32byte descriptors, would use up 32MB, for example.
-		// һ˵֧300Ȳô
+		// 创建GPU描述符堆，Shader Visible描述符堆在硬件上有数量限制，见: https://learn.microsoft.com/en-us/windows/win32/direct3d12/shader-visible-descriptor-heaps
+		// 微软文档说一般硬件Shader Visible描述符堆可用内存在96MB左右， A one million member descriptor heap, with 32byte descriptors, would use up 32MB, for example.
+		// 所以一般来说，差不多能支持300万个描述符，不过这里先不用那么多
 		D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
 		heapDesc.NumDescriptors = 65536;
 		heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
@@ -186,7 +186,7 @@ namespace ZXEngine
 			mD3D12Device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&mDynamicDescriptorHeaps[i]));
 		}
 
-		// ʼ׷ض
+		// 初始化光追相关对象
 		InitDXR();
 	}
 
@@ -196,7 +196,7 @@ namespace ZXEngine
 		mDsvDescriptorSize = mD3D12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
 		mCbvSrvUavDescriptorSize = mD3D12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-		// ȡ4X MSAAȼ
+		// 获取4X MSAA质量等级
 		D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS msQualityLevels = {};
 		msQualityLevels.Format = mPresentBufferFormat;
 		msQualityLevels.SampleCount = 4;
@@ -209,10 +209,10 @@ namespace ZXEngine
 
 	void RenderAPID3D12::CreateSwapChain()
 	{
-		// ´ҲReset
+		// 重新创建交换链也会调这个函数，所以先Reset
 		mSwapChain.Reset();
 
-		// ĴʽοDear ImGui DX12Demo https://www.3dgep.com/ Ľ̳
+		// 这里的创建方式参考了Dear ImGui DX12的Demo和 https://www.3dgep.com/ 的教程
 		DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
 		swapChainDesc.Width = ProjectSetting::srcWidth;
 		swapChainDesc.Height = ProjectSetting::srcHeight;
@@ -236,7 +236,7 @@ namespace ZXEngine
 
 	void RenderAPID3D12::CreateSwapChainBuffers()
 	{
-		// ´ʱ¹㣬ҪӵһPresent Bufferʼʹ
+		// 新创建时重新归零，要从第一个Present Buffer开始使用
 		mCurPresentIdx = 0;
 		mPresentFBOIdx = GetNextFBOIndex();
 		uint32_t colorBufferIdx = GetNextRenderBufferIndex();
@@ -300,7 +300,7 @@ namespace ZXEngine
 
 	void RenderAPID3D12::SetRenderState(RenderStateSetting* state)
 	{
-		// D3D12Ҫʵӿ
+		// D3D12不需要实现这个接口
 	}
 
 	void RenderAPID3D12::SetViewPort(unsigned int width, unsigned int height, unsigned int xOffset, unsigned int yOffset)
@@ -309,7 +309,7 @@ namespace ZXEngine
 		mViewPortInfo.height = height;
 		mViewPortInfo.xOffset = xOffset;
 
-		// Ĳǰ0½ǵı׼ģVulkan0Ͻǣƫ(༭ģʽ)ĻYƫҪ¼һ
+		// 传入的参数是按0点在左下角的标准来的，Vulkan的0点在左上角，如果有偏移(编辑器模式)的话，Y轴偏移量要重新计算一下
 		if (xOffset == 0 && yOffset == 0)
 			mViewPortInfo.yOffset = yOffset;
 		else
@@ -332,7 +332,7 @@ namespace ZXEngine
 
 	void RenderAPID3D12::ClearFrameBuffer()
 	{
-		// D3D12Ҫʵӿ
+		// D3D12不需要实现这个接口
 	}
 
 	FrameBufferObject* RenderAPID3D12::CreateFrameBufferObject(FrameBufferType type, unsigned int width, unsigned int height)
@@ -368,7 +368,7 @@ namespace ZXEngine
 
 			for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				// Color Buffer
+				// 创建Color Buffer
 				CD3DX12_HEAP_PROPERTIES colorBufferProps(D3D12_HEAP_TYPE_DEFAULT);
 
 				D3D12_RESOURCE_DESC colorBufferDesc = {};
@@ -416,7 +416,7 @@ namespace ZXEngine
 
 				colorBuffer->renderBuffers[i] = CreateZXD3D12Texture(colorBufferResource, colorSrvDesc, colorRtvDesc);
 
-				// Depth Buffer
+				// 创建Depth Buffer
 				CD3DX12_HEAP_PROPERTIES depthBufferProps(D3D12_HEAP_TYPE_DEFAULT);
 
 				D3D12_RESOURCE_DESC depthBufferDesc = {};
@@ -480,7 +480,7 @@ namespace ZXEngine
 
 			for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				// Color Buffer
+				// 创建Color Buffer
 				CD3DX12_HEAP_PROPERTIES colorBufferProps(D3D12_HEAP_TYPE_DEFAULT);
 
 				D3D12_RESOURCE_DESC colorBufferDesc = {};
@@ -546,7 +546,7 @@ namespace ZXEngine
 
 			for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				// Depth Buffer
+				// 创建Depth Buffer
 				CD3DX12_HEAP_PROPERTIES depthBufferProps(D3D12_HEAP_TYPE_DEFAULT);
 
 				D3D12_RESOURCE_DESC depthBufferDesc = {};
@@ -610,7 +610,7 @@ namespace ZXEngine
 
 			for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				// Depth Buffer
+				// 创建Depth Buffer
 				CD3DX12_HEAP_PROPERTIES depthBufferProps(D3D12_HEAP_TYPE_DEFAULT);
 
 				D3D12_RESOURCE_DESC depthBufferDesc = {};
@@ -676,7 +676,7 @@ namespace ZXEngine
 
 			for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				// Color Buffer
+				// 创建Color Buffer
 				CD3DX12_HEAP_PROPERTIES colorBufferProps(D3D12_HEAP_TYPE_DEFAULT);
 
 				D3D12_RESOURCE_DESC colorBufferDesc = {};
@@ -733,7 +733,7 @@ namespace ZXEngine
 		int nrComponents;
 		stbi_uc* pixels = stbi_load(path, &width, &height, &nrComponents, STBI_rgb_alpha);
 
-		// Դ
+		// 创建纹理资源
 		CD3DX12_HEAP_PROPERTIES textureProps(D3D12_HEAP_TYPE_DEFAULT);
 		CD3DX12_RESOURCE_DESC textureDesc(CD3DX12_RESOURCE_DESC::Tex2D(mDefaultImageFormat, width, height, 1, 1));
 		ComPtr<ID3D12Resource> textureResource;
@@ -746,7 +746,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&textureResource)
 		));
 
-		// ϴ
+		// 创建纹理上传堆
 		UINT64 uploadHeapSize;
 		mD3D12Device->GetCopyableFootprints(&textureDesc, 0, 1, 0, nullptr, nullptr, nullptr, &uploadHeapSize);
 		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
@@ -761,7 +761,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&uploadHeap)
 		));
 
-		// ϴ
+		// 上传纹理数据
 		ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 		{
 			D3D12_SUBRESOURCE_DATA subresourceData = {};
@@ -774,7 +774,7 @@ namespace ZXEngine
 				uploadHeap.Get(),
 				0, 0, 1, &subresourceData);
 
-			// ת״̬
+			// 转换纹理状态
 			CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
 				textureResource.Get(),
 				D3D12_RESOURCE_STATE_COPY_DEST,
@@ -809,7 +809,7 @@ namespace ZXEngine
 				Debug::LogError("Failed to load texture file: " + faces[i]);
 		}
 
-		// CubeMapԴ
+		// 创建CubeMap资源
 		CD3DX12_HEAP_PROPERTIES cubeMapHeapProps(D3D12_HEAP_TYPE_DEFAULT);
 
 		D3D12_RESOURCE_DESC cubeMapDesc = {};
@@ -835,7 +835,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&cubeMapResource)
 		));
 
-		// CubeMapϴ
+		// 创建CubeMap上传堆
 		UINT64 uploadHeapSize;
 		mD3D12Device->GetCopyableFootprints(&cubeMapDesc, 0, 6, 0, nullptr, nullptr, nullptr, &uploadHeapSize);
 		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
@@ -850,7 +850,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&uploadHeap)
 		));
 
-		// ϴ
+		// 上传纹理数据
 		ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 		{
 			D3D12_SUBRESOURCE_DATA cubeMapData[6] = {};
@@ -866,7 +866,7 @@ namespace ZXEngine
 				uploadHeap.Get(),
 				0, 0, 6, cubeMapData);
 
-			// ת״̬
+			// 转换纹理状态
 			CD3DX12_RESOURCE_BARRIER copyFinishBarrier = CD3DX12_RESOURCE_BARRIER::Transition(
 				cubeMapResource.Get(), 
 				D3D12_RESOURCE_STATE_COPY_DEST, 
@@ -893,7 +893,7 @@ namespace ZXEngine
 
 	unsigned int RenderAPID3D12::CreateTexture(TextureFullData* data)
 	{
-		// Դ
+		// 创建纹理资源
 		CD3DX12_HEAP_PROPERTIES textureProps(D3D12_HEAP_TYPE_DEFAULT);
 		CD3DX12_RESOURCE_DESC textureDesc(CD3DX12_RESOURCE_DESC::Tex2D(mDefaultImageFormat, data->width, data->height, 1, 1));
 		ComPtr<ID3D12Resource> textureResource;
@@ -906,7 +906,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&textureResource)
 		));
 
-		// ϴ
+		// 创建纹理上传堆
 		UINT64 uploadHeapSize;
 		mD3D12Device->GetCopyableFootprints(&textureDesc, 0, 1, 0, nullptr, nullptr, nullptr, &uploadHeapSize);
 		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
@@ -921,7 +921,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&uploadHeap)
 		));
 
-		// ϴ
+		// 上传纹理数据
 		ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 		{
 			D3D12_SUBRESOURCE_DATA subresourceData = {};
@@ -934,7 +934,7 @@ namespace ZXEngine
 				uploadHeap.Get(),
 				0, 0, 1, &subresourceData);
 
-			// ת״̬
+			// 转换纹理状态
 			CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
 				textureResource.Get(),
 				D3D12_RESOURCE_STATE_COPY_DEST,
@@ -957,7 +957,7 @@ namespace ZXEngine
 
 	unsigned int RenderAPID3D12::CreateCubeMap(CubeMapFullData* data)
 	{
-		// CubeMapԴ
+		// 创建CubeMap资源
 		CD3DX12_HEAP_PROPERTIES cubeMapHeapProps(D3D12_HEAP_TYPE_DEFAULT);
 
 		D3D12_RESOURCE_DESC cubeMapDesc = {};
@@ -983,7 +983,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&cubeMapResource)
 		));
 
-		// CubeMapϴ
+		// 创建CubeMap上传堆
 		UINT64 uploadHeapSize;
 		mD3D12Device->GetCopyableFootprints(&cubeMapDesc, 0, 6, 0, nullptr, nullptr, nullptr, &uploadHeapSize);
 		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
@@ -998,7 +998,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&uploadHeap)
 		));
 
-		// ϴ
+		// 上传纹理数据
 		ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 		{
 			D3D12_SUBRESOURCE_DATA cubeMapData[6] = {};
@@ -1014,7 +1014,7 @@ namespace ZXEngine
 				uploadHeap.Get(),
 				0, 0, 6, cubeMapData);
 
-			// ת״̬
+			// 转换纹理状态
 			CD3DX12_RESOURCE_BARRIER copyFinishBarrier = CD3DX12_RESOURCE_BARRIER::Transition(
 				cubeMapResource.Get(),
 				D3D12_RESOURCE_STATE_COPY_DEST,
@@ -1037,7 +1037,7 @@ namespace ZXEngine
 
 	unsigned int RenderAPID3D12::GenerateTextTexture(unsigned int width, unsigned int height, unsigned char* data)
 	{
-		// Դ
+		// 创建纹理资源
 		CD3DX12_HEAP_PROPERTIES textureProps(D3D12_HEAP_TYPE_DEFAULT);
 		CD3DX12_RESOURCE_DESC textureDesc(CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8_UNORM, width, height, 1, 1));
 		ComPtr<ID3D12Resource> textureResource;
@@ -1050,7 +1050,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&textureResource)
 		));
 
-		// ϴ
+		// 创建纹理上传堆
 		UINT64 uploadHeapSize;
 		mD3D12Device->GetCopyableFootprints(&textureDesc, 0, 1, 0, nullptr, nullptr, nullptr, &uploadHeapSize);
 		CD3DX12_HEAP_PROPERTIES uploadHeapProps(D3D12_HEAP_TYPE_UPLOAD);
@@ -1065,7 +1065,7 @@ namespace ZXEngine
 			IID_PPV_ARGS(&uploadHeap)
 		));
 
-		// ϴ
+		// 上传纹理数据
 		ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 		{
 			D3D12_SUBRESOURCE_DATA subresourceData = {};
@@ -1078,7 +1078,7 @@ namespace ZXEngine
 				uploadHeap.Get(),
 				0, 0, 1, &subresourceData);
 
-			// ת״̬
+			// 转换纹理状态
 			CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
 				textureResource.Get(),
 				D3D12_RESOURCE_STATE_COPY_DEST,
@@ -1119,7 +1119,7 @@ namespace ZXEngine
 		if (ProjectSetting::enableGraphicsDebug)
 			compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
 
-		// Vertex Shader
+		// 编译Vertex Shader
 		ComPtr<ID3DBlob> vertCode = nullptr;
 		if (shaderInfo.stages & ZX_SHADER_STAGE_VERTEX_BIT)
 		{
@@ -1130,7 +1130,7 @@ namespace ZXEngine
 				Debug::LogError((char*)errors->GetBufferPointer());
 			ThrowIfFailed(res);
 		}
-		// Geometry Shader
+		// 编译Geometry Shader
 		ComPtr<ID3DBlob> geomCode = nullptr;
 		if (shaderInfo.stages & ZX_SHADER_STAGE_GEOMETRY_BIT)
 		{
@@ -1141,7 +1141,7 @@ namespace ZXEngine
 				Debug::LogError((char*)errors->GetBufferPointer());
 			ThrowIfFailed(res);
 		}
-		// Fragment(Pixel) Shader
+		// 编译Fragment(Pixel) Shader
 		ComPtr<ID3DBlob> fragCode = nullptr;
 		if (shaderInfo.stages & ZX_SHADER_STAGE_FRAGMENT_BIT)
 		{
@@ -1153,16 +1153,16 @@ namespace ZXEngine
 			ThrowIfFailed(res);
 		}
 
-		// ׼D3D12
+		// 准备创建D3D12管线数据
 		D3D12_GRAPHICS_PIPELINE_STATE_DESC pipelineStateDesc = {};
 
-		// ͳ
+		// 统计纹理数量
 		UINT textureNum = static_cast<UINT>(
 			shaderInfo.vertProperties.textureProperties.size() +
 			shaderInfo.geomProperties.textureProperties.size() +
 			shaderInfo.fragProperties.textureProperties.size());
 
-		// ǩ
+		// 创建根签名
 		ComPtr<ID3D12RootSignature> rootSignature;
 		{
 			vector<CD3DX12_ROOT_PARAMETER> rootParameters = {};
@@ -1197,7 +1197,7 @@ namespace ZXEngine
 			pipelineStateDesc.pRootSignature = rootSignature.Get();
 		}
 
-		// Shader
+		// 填充Shader
 		if (shaderInfo.stages & ZX_SHADER_STAGE_VERTEX_BIT)
 			pipelineStateDesc.VS = { reinterpret_cast<BYTE*>(vertCode->GetBufferPointer()), vertCode->GetBufferSize() };
 		if (shaderInfo.stages & ZX_SHADER_STAGE_GEOMETRY_BIT)
@@ -1213,14 +1213,20 @@ namespace ZXEngine
 			{ "NORMAL",   0, DXGI_FORMAT_R32G32B32_FLOAT,    0, offsetof(Vertex, Normal),    D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
 			{ "TANGENT",  0, DXGI_FORMAT_R32G32B32_FLOAT,    0, offsetof(Vertex, Tangent),   D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
 			{ "WEIGHT",   0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, offsetof(Vertex, Weights),   D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-			{ "BONEID",   0, DXGI_FORMAT_R32G32B32A32_UINT,  0, offsetof(Vertex, BoneIDs),   D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+			{ "BONEID",   0, DXGI_FORMAT_R32G32B32A32_UINT,  0, offsetof(Vertex, BoneIDs),   D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			// GPU Instancing的逐实例模型矩阵，在1号Slot，每列一个元素，只有Instancing的Shader才声明
+			{ "INSTANCE", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0,                           D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+			{ "INSTANCE", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16,                          D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+			{ "INSTANCE", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32,                          D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+			{ "INSTANCE", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48,                          D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 }
 		};
-		pipelineStateDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
+		UINT inputElementNum = static_cast<UINT>(shaderInfo.instancing ? _countof(inputElementDescs) : _countof(inputElementDescs) - 4);
+		pipelineStateDesc.InputLayout = { inputElementDescs, inputElementNum };
 
 		// Blend Config
 		D3D12_BLEND_DESC blendDesc = {};
 		blendDesc.AlphaToCoverageEnable = FALSE;
-		blendDesc.IndependentBlendEnable = FALSE; // Render TargetҪҪֿûϷʽ
+		blendDesc.IndependentBlendEnable = FALSE; // 多个Render Target要不要分开配置混合方式
 		blendDesc.RenderTarget[0].BlendEnable = TRUE;
 		blendDesc.RenderTarget[0].LogicOpEnable = FALSE;
 		blendDesc.RenderTarget[0].SrcBlend = dxBlendFactorMap[shaderInfo.stateSet.srcFactor];
@@ -1232,7 +1238,7 @@ namespace ZXEngine
 		blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
 		pipelineStateDesc.BlendState = blendDesc;
 
-		// դ׶
+		// 光栅化阶段
 		D3D12_RASTERIZER_DESC rasterizerDesc = {};
 		rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
 		rasterizerDesc.CullMode = dxFaceCullOptionMap[shaderInfo.stateSet.cull];
@@ -1276,15 +1282,15 @@ namespace ZXEngine
 		pipelineStateDesc.RTVFormats[0] = mDefaultImageFormat;
 		pipelineStateDesc.SampleDesc.Count = 1;
 		pipelineStateDesc.SampleDesc.Quality = 0;
-		pipelineStateDesc.NodeMask = 0; // GPUõģʱù
+		pipelineStateDesc.NodeMask = 0; // 给多GPU用的，暂时不用管
 
-		// DSVʽҪΪUNKNOWN
+		// 如果不用DSV，格式需要设置为UNKNOWN
 		if (type == FrameBufferType::Present || type == FrameBufferType::Color)
 			pipelineStateDesc.DSVFormat = DXGI_FORMAT_UNKNOWN;
 		else
 			pipelineStateDesc.DSVFormat = DXGI_FORMAT_D16_UNORM;
 
-		// D3D12
+		// 创建D3D12管线
 		ComPtr<ID3D12PipelineState> PSO;
 		ThrowIfFailed(mD3D12Device->CreateGraphicsPipelineState(&pipelineStateDesc, IID_PPV_ARGS(&PSO)));
 
@@ -1322,7 +1328,7 @@ namespace ZXEngine
 		auto shaderReference = material->shader->reference;
 		auto materialDataZXD3D12 = GetMaterialDataByIndex(material->data->GetID());
 
-		// Constant BufferС
+		// 计算Constant Buffer大小
 		UINT64 bufferSize = 0;
 		if (shaderReference->shaderInfo.fragProperties.baseProperties.size() > 0)
 			bufferSize = static_cast<UINT64>(shaderReference->shaderInfo.fragProperties.baseProperties.back().offset + shaderReference->shaderInfo.fragProperties.baseProperties.back().size);
@@ -1331,11 +1337,11 @@ namespace ZXEngine
 		else if (shaderReference->shaderInfo.vertProperties.baseProperties.size() > 0)
 			bufferSize = static_cast<UINT64>(shaderReference->shaderInfo.vertProperties.baseProperties.back().offset + shaderReference->shaderInfo.vertProperties.baseProperties.back().size);
 
-		// ȡ256(ǱҪ)
+		// 向上取256整数倍(不是必要操作)
 		bufferSize = (bufferSize + 255) & ~255;
 		for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 		{
-			// Constant Buffer
+			// 创建Constant Buffer
 			if (bufferSize > 0)
 				materialDataZXD3D12->constantBuffers.push_back(CreateBuffer(bufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, true));
 
@@ -1377,7 +1383,7 @@ namespace ZXEngine
 			materialDataZXD3D12->textureSets.push_back(materialTextureSet);
 		}
 
-		// ò
+		// 设置材质数据
 		for (auto& property : material->data->vec2Datas)
 			SetShaderVector(material, property.first, property.second, true);
 		for (auto& property : material->data->vec3Datas)
@@ -1418,7 +1424,7 @@ namespace ZXEngine
 			ThrowIfFailed(mD3D12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, drawCmd->allocators[i].Get(), nullptr,
 				IID_PPV_ARGS(drawCmd->commandLists[i].GetAddressOf())));
 
-			// ʹCommandListʱResetResetʱҪClose״̬
+			// 使用CommandList的时候会先Reset，Reset时要求处于Close状态
 			drawCmd->commandLists[i]->Close();
 		}
 
@@ -1432,13 +1438,23 @@ namespace ZXEngine
 		mDrawIndexes.push_back({ .VAO = VAO, .pipelineID = mCurPipeLineIdx, .materialDataID = mCurMaterialDataIdx });
 	}
 
+	void RenderAPID3D12::Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer)
+	{
+		mDrawIndexes.push_back({ .VAO = VAO, .pipelineID = mCurPipeLineIdx, .materialDataID = mCurMaterialDataIdx, .instanceNum = instanceNum, .instanceBufferID = instanceBuffer });
+	}
+
+	void RenderAPID3D12::DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount)
+	{
+		mDrawIndexes.push_back({ .VAO = VAO, .pipelineID = mCurPipeLineIdx, .materialDataID = mCurMaterialDataIdx, .indexOffset = indexOffset, .indexCount = indexCount });
+	}
+
 	void RenderAPID3D12::GenerateDrawCommand(uint32_t id)
 	{
 		auto drawCommand = GetDrawCommandByIndex(id);
 		auto& allocator = drawCommand->allocators[mCurrentFrame];
 		auto& drawCommandList = drawCommand->commandLists[mCurrentFrame];
 
-		// Command List
+		// 重置Command List
 		ThrowIfFailed(allocator->Reset());
 		ThrowIfFailed(drawCommandList->Reset(allocator.Get(), nullptr));
 
@@ -1448,11 +1464,11 @@ namespace ZXEngine
 
 		if (curFBO->bufferType == FrameBufferType::Normal)
 		{
-			// ȡȾĿBuffer
+			// 获取渲染目标Buffer
 			colorBuffer = GetTextureByIndex(GetRenderBufferByIndex(curFBO->colorBufferIdx)->renderBuffers[GetCurFrameBufferIndex()]);
 			depthBuffer = GetTextureByIndex(GetRenderBufferByIndex(curFBO->depthBufferIdx)->renderBuffers[GetCurFrameBufferIndex()]);
 			
-			// лΪд״̬
+			// 切换为写入状态
 			auto colorBufferTransition = CD3DX12_RESOURCE_BARRIER::Transition(colorBuffer->texture.Get(),
 				D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_RENDER_TARGET);
 			drawCommandList->ResourceBarrier(1, &colorBufferTransition);
@@ -1460,12 +1476,12 @@ namespace ZXEngine
 				D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_DEPTH_WRITE);
 			drawCommandList->ResourceBarrier(1, &depthBufferTransition);
 
-			// лĿBuffer
+			// 切换目标Buffer
 			auto rtv = ZXD3D12DescriptorManager::GetInstance()->GetCPUDescriptorHandle(colorBuffer->handleRTV);
 			auto dsv = ZXD3D12DescriptorManager::GetInstance()->GetCPUDescriptorHandle(depthBuffer->handleDSV);
 			drawCommandList->OMSetRenderTargets(1, &rtv, false, &dsv);
 
-			// 
+			// 清理缓冲区
 			auto& clearInfo = curFBO->clearInfo;
 			const float clearColor[] = { clearInfo.color.r, clearInfo.color.g, clearInfo.color.b, clearInfo.color.a };
 			drawCommandList->ClearRenderTargetView(rtv, clearColor, 0, nullptr);
@@ -1512,7 +1528,7 @@ namespace ZXEngine
 			drawCommandList->OMSetRenderTargets(1, &rtv, false, nullptr);
 		}
 
-		// Viewport
+		// 设置Viewport
 		D3D12_VIEWPORT viewPort = {};
 		viewPort.Width    = static_cast<FLOAT>(mViewPortInfo.width);
 		viewPort.Height   = static_cast<FLOAT>(mViewPortInfo.height);
@@ -1521,7 +1537,7 @@ namespace ZXEngine
 		viewPort.MinDepth = 0.0f;
 		viewPort.MaxDepth = 1.0f;
 		drawCommandList->RSSetViewports(1, &viewPort);
-		// Scissor
+		// 设置Scissor
 		D3D12_RECT scissor = {};
 		scissor.left   = mViewPortInfo.xOffset;
 		scissor.top    = mViewPortInfo.yOffset;
@@ -1529,16 +1545,16 @@ namespace ZXEngine
 		scissor.bottom = mViewPortInfo.yOffset + mViewPortInfo.height;
 		drawCommandList->RSSetScissorRects(1, &scissor);
 
-		// ͼԪ
+		// 设置图元类型
 		drawCommandList->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-		// õǰ֡Ķ̬
+		// 设置当前帧的动态描述符堆
 		ID3D12DescriptorHeap* curDescriptorHeaps[] = { mDynamicDescriptorHeaps[mCurrentFrame].Get() };
 		drawCommandList->SetDescriptorHeaps(_countof(curDescriptorHeaps), curDescriptorHeaps);
 
-		// ȡǰ֡Ķ̬Handle
+		// 获取当前帧的动态描述符堆Handle
 		CD3DX12_CPU_DESCRIPTOR_HANDLE dynamicDescriptorHandle(mDynamicDescriptorHeaps[mCurrentFrame]->GetCPUDescriptorHandleForHeapStart());
-		// ƫƵǰλ
+		// 偏移到当前位置
 		dynamicDescriptorHandle.Offset(mDynamicDescriptorOffsets[mCurrentFrame], mCbvSrvUavDescriptorSize);
 
 		for (auto& iter : mDrawIndexes)
@@ -1553,36 +1569,40 @@ namespace ZXEngine
 			if (!materialData->constantBuffers.empty())
 				drawCommandList->SetGraphicsRootConstantBufferView(0, materialData->constantBuffers[mCurrentFrame].gpuAddress);
 
-			// ShaderԴ
+			// 如果Shader有纹理，绑定纹理资源
 			if (pipeline->textureNum > 0)
 			{
-				// ǰƶڶ̬еƫ
+				// 当前绘制对象在动态描述符堆中的偏移起点
 				UINT curDynamicDescriptorOffset = mDynamicDescriptorOffsets[mCurrentFrame];
-				// ̬
+				// 遍历纹理并拷贝到动态描述符堆
 				for (auto& iter : materialData->textureSets[mCurrentFrame].textureHandles)
 				{
-					// ȡCPU Handle
+					// 获取纹理的CPU Handle
 					auto cpuHandle = ZXD3D12DescriptorManager::GetInstance()->GetCPUDescriptorHandle(iter);
-					// ̬
+					// 拷贝到动态描述符堆
 					mD3D12Device->CopyDescriptorsSimple(1, dynamicDescriptorHandle, cpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-					// ̬Handleһλ
+					// 动态描述符堆Handle后移一位
 					dynamicDescriptorHandle.Offset(1, mCbvSrvUavDescriptorSize);
 					mDynamicDescriptorOffsets[mCurrentFrame]++;
 				}
-				// ȡ̬ѵGPU Handle
+				// 获取动态描述符堆的GPU Handle
 				CD3DX12_GPU_DESCRIPTOR_HANDLE dynamicGPUHandle(mDynamicDescriptorHeaps[mCurrentFrame]->GetGPUDescriptorHandleForHeapStart());
-				// ƫƵǰƶʼλ
+				// 偏移到当前绘制对象的起始位置
 				dynamicGPUHandle.Offset(curDynamicDescriptorOffset, mCbvSrvUavDescriptorSize);
-				// õǰƶĶ̬
+				// 设置当前绘制对象的动态描述符堆
 				drawCommandList->SetGraphicsRootDescriptorTable(1, dynamicGPUHandle);
 			}
 
 			drawCommandList->IASetIndexBuffer(&VAO->indexBufferView);
 			drawCommandList->IASetVertexBuffers(0, 1, &VAO->vertexBufferView);
-			drawCommandList->DrawIndexedInstanced(VAO->indexCount, 1, 0, 0, 0);
+			// 逐实例数据绑定在1号Slot上
+			if (iter.instanceBufferID != UINT32_MAX)
+				drawCommandList->IASetVertexBuffers(1, 1, &GetInstanceBufferByIndex(iter.instanceBufferID)->bufferViews[mCurrentFrame]);
+			UINT indexCount = iter.indexCount == UINT32_MAX ? VAO->indexCount : iter.indexCount;
+			drawCommandList->DrawIndexedInstanced(indexCount, iter.instanceNum, iter.indexOffset, 0, 0);
 		}
 
-		// ״̬лȥ
+		// 把状态切回去
 		if (curFBO->bufferType == FrameBufferType::Normal)
 		{
 			if (colorBuffer != nullptr)
@@ -1626,7 +1646,7 @@ namespace ZXEngine
 			}
 		}
 
-		// ύCommand List
+		// 结束并提交Command List
 		ThrowIfFailed(drawCommandList->Close());
 		ID3D12CommandList* cmdsLists[] = { drawCommandList.Get() };
 		mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
@@ -1646,21 +1666,21 @@ namespace ZXEngine
 		meshBuffer->indexCount = static_cast<UINT>(indices.size());
 		meshBuffer->vertexCount = static_cast<UINT>(vertices.size());
 
-		// Vertex Buffer
+		// 创建Vertex Buffer
 		UINT vertexBufferSize = static_cast<UINT>(sizeof(Vertex) * vertices.size());
 		meshBuffer->vertexBuffer = CreateBuffer(vertexBufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_COMMON, D3D12_HEAP_TYPE_DEFAULT, false, true, vertices.data());
 		meshBuffer->vertexBufferView.SizeInBytes = vertexBufferSize;
 		meshBuffer->vertexBufferView.StrideInBytes = sizeof(Vertex);
 		meshBuffer->vertexBufferView.BufferLocation = meshBuffer->vertexBuffer.gpuAddress;
 
-		// Index Buffer
+		// 创建Index Buffer
 		UINT indexBufferSize = static_cast<UINT>(sizeof(uint32_t) * indices.size());
 		meshBuffer->indexBuffer = CreateBuffer(indexBufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_COMMON, D3D12_HEAP_TYPE_DEFAULT, false, true, indices.data());
 		meshBuffer->indexBufferView.Format = DXGI_FORMAT_R32_UINT;
 		meshBuffer->indexBufferView.SizeInBytes = indexBufferSize;
 		meshBuffer->indexBufferView.BufferLocation = meshBuffer->indexBuffer.gpuAddress;
 
-		// ǹ׷ߣҪһBLAS( Bottom Level Acceleration Structure )
+		// 如果是光追管线，还要创建一个BLAS( Bottom Level Acceleration Structure )
 		if (ProjectSetting::renderPipelineType == RenderPipelineType::RayTracing)
 		{
 			BuildBottomLevelAccelerationStructure(VAO, true);
@@ -1676,14 +1696,14 @@ namespace ZXEngine
 		meshBuffer->indexCount = static_cast<UINT>(indexSize);
 		meshBuffer->vertexCount = static_cast<UINT>(vertexSize);
 
-		// ̬Vertex Buffer
+		// 创建动态Vertex Buffer
 		UINT vertexBufferSize = static_cast<UINT>(sizeof(Vertex) * vertexSize);
 		meshBuffer->vertexBuffer = CreateBuffer(vertexBufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, true, nullptr);
 		meshBuffer->vertexBufferView.SizeInBytes = vertexBufferSize;
 		meshBuffer->vertexBufferView.StrideInBytes = sizeof(Vertex);
 		meshBuffer->vertexBufferView.BufferLocation = meshBuffer->vertexBuffer.gpuAddress;
 
-		// ̬Index Buffer
+		// 创建动态Index Buffer
 		UINT indexBufferSize = static_cast<UINT>(sizeof(uint32_t) * indexSize);
 		meshBuffer->indexBuffer = CreateBuffer(indexBufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, true, nullptr);
 		meshBuffer->indexBufferView.Format = DXGI_FORMAT_R32_UINT;
@@ -1720,6 +1740,46 @@ namespace ZXEngine
 		SetUpStaticMesh(VAO, vertices, indices);
 	}
 
+	uint32_t RenderAPID3D12::CreateInstanceBuffer(uint32_t instanceNum)
+	{
+		uint32_t id = GetNextInstanceBufferIndex();
+		auto instanceBuffer = GetInstanceBufferByIndex(id);
+		instanceBuffer->size = instanceNum;
+
+		UINT bufferSize = static_cast<UINT>(instanceNum * 16 * sizeof(float));
+		for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
+		{
+			auto buffer = CreateBuffer(bufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, true, nullptr);
+
+			D3D12_VERTEX_BUFFER_VIEW bufferView = {};
+			bufferView.SizeInBytes = bufferSize;
+			bufferView.StrideInBytes = static_cast<UINT>(16 * sizeof(float));
+			bufferView.BufferLocation = buffer.gpuAddress;
+
+			instanceBuffer->buffers.push_back(buffer);
+			instanceBuffer->bufferViews.push_back(bufferView);
+		}
+
+		instanceBuffer->inUse = true;
+		return id;
+	}
+
+	void RenderAPID3D12::UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum)
+	{
+		auto instanceBuffer = GetInstanceBufferByIndex(id);
+		instanceNum = Math::Min(instanceNum, instanceBuffer->size);
+
+		// HLSL代码里声明了column_major，按列主序写入
+		float* address = static_cast<float*>(instanceBuffer->buffers[mCurrentFrame].cpuAddress);
+		for (uint32_t i = 0; i < instanceNum; i++)
+			data[i].ToColumnMajorArray(address + i * 16);
+	}
+
+	void RenderAPID3D12::DeleteInstanceBuffer(uint32_t id)
+	{
+		mInstanceBuffersToDelete.insert(pair(id, DX_MAX_FRAMES_IN_FLIGHT));
+	}
+
 	void RenderAPID3D12::DeleteMesh(unsigned int VAO)
 	{
 		mMeshsToDelete.insert(pair(VAO, DX_MAX_FRAMES_IN_FLIGHT));
@@ -2163,23 +2223,23 @@ namespace ZXEngine
 		mRTPipelines.push_back(rtPipeline);
 		uint32_t rtPipelineID = static_cast<uint32_t>(mRTPipelines.size() - 1);
 
-		// ׼ǩ
+		// 准备根签名参数
 		vector<D3D12_DESCRIPTOR_RANGE> dTableParams(ZX_D3D12_RT_ROOT_PARAMETER_NUM);
 		// register(t0, space0) TLAS
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_TLAS]				= { D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0, 0, mRTRootParamOffsetInDescriptorHeapTLAS };
-		// register(u0, space0) ͼ
+		// register(u0, space0) 输出图像
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_OUTPUT_IMAGE]		= { D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 0, mRTRootParamOffsetInDescriptorHeapOutputImage };
-		// register(t0, space1) Buffer
+		// register(t0, space1) 顶点索引Buffer
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_INDEX_BUFFER]		= { D3D12_DESCRIPTOR_RANGE_TYPE_SRV, mRTSceneRenderObjectNum, 0, 1, mRTRootParamOffsetInDescriptorHeapIndexBuffer };
-		// register(t0, space2) Buffer
+		// register(t0, space2) 顶点Buffer
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_VERTEX_BUFFER]		= { D3D12_DESCRIPTOR_RANGE_TYPE_SRV, mRTSceneRenderObjectNum, 0, 2, mRTRootParamOffsetInDescriptorHeapVertexBuffer };
-		// register(t0, space3) Buffer
+		// register(t0, space3) 材质数据Buffer
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_MATERIAL_DATA]		= { D3D12_DESCRIPTOR_RANGE_TYPE_SRV, mRTSceneRenderObjectNum, 0, 3, mRTRootParamOffsetInDescriptorHeapMaterialData };
-		// register(t0, space4) 2D
+		// register(t0, space4) 2D纹理数组
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_TEXTURE_2D]			= { D3D12_DESCRIPTOR_RANGE_TYPE_SRV, mRTSceneTextureNum, 0, 4, mRTRootParamOffsetInDescriptorHeapTexture2DArray };
-		// register(t0, space5) CubeMap
+		// register(t0, space5) CubeMap纹理数组
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_TEXTURE_CUBE]		= { D3D12_DESCRIPTOR_RANGE_TYPE_SRV, mRTSceneCubeMapNum, 0, 5, mRTRootParamOffsetInDescriptorHeapTextureCubeArray };
-		// register(b0, space0) Buffer (Vulkan PushConstants)
+		// register(b0, space0) 常量Buffer (Vulkan PushConstants)
 		dTableParams[ZX_D3D12_RT_ROOT_PARAMETER_CONSTANT_BUFFER]	= { D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0, 0, mRTRootParamOffsetInDescriptorHeapConstantBuffer };
 		
 		vector<CD3DX12_ROOT_PARAMETER> rootParameters(1);
@@ -2190,11 +2250,11 @@ namespace ZXEngine
 		rootSignatureDesc.Init(
 			static_cast<UINT>(rootParameters.size()), rootParameters.data(),
 			static_cast<UINT>(samplers.size()), samplers.data(),
-			// ׷ShaderĸǩһĬ϶ҪLOCAL־Ҫ͹դ߼߻ʹ
+			// 光追Shader的根签名一般默认都要带上LOCAL标志，除非要和光栅或者计算管线混合使用
 			D3D12_ROOT_SIGNATURE_FLAG_LOCAL_ROOT_SIGNATURE
 		);
 
-		// лǩ
+		// 序列化根签名
 		ComPtr<ID3DBlob> error;
 		ComPtr<ID3DBlob> serializedRootSignature;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &serializedRootSignature, &error);
@@ -2202,20 +2262,20 @@ namespace ZXEngine
 			Debug::LogError((char*)error->GetBufferPointer());
 		ThrowIfFailed(hr);
 
-		// ǩ(ֻһǩShaderҲԸÿShaderĸǩShaderܴµܸܿ)
+		// 创建根签名(这里只创建了一个根签名，所有Shader共享，不过也可以给每个Shader创建单独的根签名，在Shader根参数差异很大的情况下单独创建性能可能更好)
 		ThrowIfFailed(mD3D12Device->CreateRootSignature(0, serializedRootSignature->GetBufferPointer(), serializedRootSignature->GetBufferSize(), IID_PPV_ARGS(&rtPipeline->rootSignature)));
 
-		// HLSLﵼShader
+		// 从HLSL代码里导出的Shader
 		vector<ZXD3D12ShaderBlob> shaderBlobs;
 		// Hit Groups
 		vector<ZXD3D12HitGroupDesc> hitGroups;
-		// Ray GenMissHit Group
+		// 导出的Ray Gen，Miss和Hit Group的名字
 		vector<wstring> allExportNames;
-		// DXIL Library
-		// һHLSLļһDXIL LibraryһDXIL Library԰Shader
-		// һRayGen ShaderһMiss Shader߶Hit Shaderȵ
-		// ߵʱҪҪõShaderDXIL Library浼ŵD3D12_DXIL_LIBRARY_DESCD3D12_EXPORT_DESC* pExports
-		// ׷ߵддһHLSLļ棬ȻһDXIL LibraryShader
+		// 创建DXIL Library
+		// 一个HLSL代码文件会编译成一个DXIL Library，一个DXIL Library可以包含多个Shader
+		// 比如一个RayGen Shader和一个Miss Shader，或者多个Hit Shader等等
+		// 创建管线的时候需要把要用到的Shader从DXIL Library里面导出，放到D3D12_DXIL_LIBRARY_DESC的D3D12_EXPORT_DESC* pExports参数中
+		// 所以理论上整个光追管线的所有代码可以写到一个HLSL文件里面，然后编译成一个DXIL Library，导出所有Shader
 		vector<ZXD3D12DXILLibraryDesc> dxilLibraries;
 		for (size_t i = 0; i < rtShaderPathGroup.rGenPaths.size(); i++)
 		{
@@ -2291,17 +2351,17 @@ namespace ZXEngine
 				hitGroups.back().desc.IntersectionShaderImport = hitGroups.back().intersectionShaderName.c_str();
 		}
 
-		// D3D12RayTracingState SubObjectɵģDXIL LibraryHit GroupShader ConfigRoot Signatureȵ
+		// D3D12的RayTracing管线是由State SubObject构成的，包括DXIL Library，Hit Group，Shader Config，Root Signature等等
 		UINT64 subObjectCount = 
 			dxilLibraries.size() +	// DXIL Library
-			hitGroups.size() +		// Hit Group
+			hitGroups.size() +		// Hit Group声明
 			1 +						// Shader Config
 			1 +						// Associate the set of shaders with config
-			2 +						// ǩӦExports Association(жǩΪ2*)
+			2 +						// 根签名及其对应的Exports Association(如果有多个根签名，这里为2*数量)
 			2 +						// Empty Global and Local Root Signature
 			1;						// Pipeline Config
 
-		// State SubObject
+		// 创建State SubObject
 		vector<D3D12_STATE_SUBOBJECT> subObjects(subObjectCount);
 		UINT64 index = 0;
 
@@ -2352,8 +2412,8 @@ namespace ZXEngine
 		index++;
 
 		// ------------------------------ Root Signature Association ------------------------------
-		// ǰShader ConfigеShaderǵǩ
-		// ʱֻһȫָǰ棬һ
+		// 前面Shader Config那里关联的是整个管线所有的Shader，这里关联的是单个根签名的
+		// 不过暂时只有一个全局根前面，所以这里关联的是一样的
 		vector<wstring> allExportNamesCopy = allExportNames;
 		vector<LPCWSTR> rootSignatureExports;
 		for (auto& exportName : allExportNamesCopy)
@@ -2389,18 +2449,18 @@ namespace ZXEngine
 		subObjects[index].Type = D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG;
 		subObjects[index].pDesc = &pipelineConfig;
 
-		// 
+		// 创建管线
 		D3D12_STATE_OBJECT_DESC stateObjectDesc = {};
 		stateObjectDesc.Type = D3D12_STATE_OBJECT_TYPE_RAYTRACING_PIPELINE;
 		stateObjectDesc.NumSubobjects = static_cast<UINT>(subObjects.size());
 		stateObjectDesc.pSubobjects = subObjects.data();
 		ThrowIfFailed(mD3D12Device->CreateStateObject(&stateObjectDesc, IID_PPV_ARGS(&rtPipeline->pipeline)));
 
-		// ȡߵ
+		// 获取管线的属性
 		ComPtr<ID3D12StateObjectProperties> stateObjectProperties;
 		ThrowIfFailed(rtPipeline->pipeline->QueryInterface(IID_PPV_ARGS(&stateObjectProperties)));
 
-		// ׷ݵ
+		// 创建光追管线数据的描述符堆
 		D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDesc = {};
 		descriptorHeapDesc.NumDescriptors = mRTRootParamOffsetInDescriptorHeapSize;
 		descriptorHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
@@ -2410,31 +2470,31 @@ namespace ZXEngine
 		for (int i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			ThrowIfFailed(mD3D12Device->CreateDescriptorHeap(&descriptorHeapDesc, IID_PPV_ARGS(&rtPipeline->descriptorHeaps[i])));
 
-		// SBTС
-		// SBTEntry˹̶һShader IdentifierRoot Arguments
-		// ǰShaderǹ̶rootArgumentsNumSBTҪ64λַһС8ֽڣrootArgumentsNum * 8
+		// 计算SBT大小
+		// SBT的Entry包括了固定一个Shader Identifier和Root Arguments
+		// 当前管线所有Shader都是固定rootArgumentsNum个参数，SBT需要存参数的64位地址，所以一个参数大小是8字节，这里就是rootArgumentsNum * 8
 		static const UINT64 rootArgumentsNum = 1;
 		UINT64 rootArgumentsSize = static_cast<UINT64>(rootArgumentsNum * 8);
-		// жRay GenerationĲСRay Generation
+		// 如果有多个Ray Generation，这里的参数大小按照最大的Ray Generation参数数量来算
 		rtPipeline->SBT.rayGenEntrySize = Math::AlignUpPOT(D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES + rootArgumentsSize, (UINT64)D3D12_RAYTRACING_SHADER_RECORD_BYTE_ALIGNMENT);
 		rtPipeline->SBT.rayGenSectionSize = Math::AlignUpPOT(rtPipeline->SBT.rayGenEntrySize * rtShaderPathGroup.rGenPaths.size(), (UINT64)D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT);
-		// MissHitGroup㷽ʽͬﶼһ
+		// Miss和HitGroup计算方式同理，不过在这里都是一样大的
 		rtPipeline->SBT.missEntrySize = Math::AlignUpPOT(D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES + rootArgumentsSize, (UINT64)D3D12_RAYTRACING_SHADER_RECORD_BYTE_ALIGNMENT);
 		rtPipeline->SBT.missSectionSize = Math::AlignUpPOT(rtPipeline->SBT.missEntrySize * rtShaderPathGroup.rMissPaths.size(), (UINT64)D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT);
 		rtPipeline->SBT.hitGroupEntrySize = Math::AlignUpPOT(D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES + rootArgumentsSize, (UINT64)D3D12_RAYTRACING_SHADER_RECORD_BYTE_ALIGNMENT);
 		rtPipeline->SBT.hitGroupSectionSize = Math::AlignUpPOT(rtPipeline->SBT.hitGroupEntrySize * rtShaderPathGroup.rHitGroupPaths.size(), (UINT64)D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT);
 		UINT64 sbtSize = Math::AlignUpPOT(rtPipeline->SBT.rayGenSectionSize + rtPipeline->SBT.missSectionSize + rtPipeline->SBT.hitGroupSectionSize, (UINT64)256);
 
-		// SBT Buffer
+		// 创建SBT Buffer
 		rtPipeline->SBT.buffers.resize(DX_MAX_FRAMES_IN_FLIGHT);
 		for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 		{
 			rtPipeline->SBT.buffers[i] = CreateBuffer(sbtSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, true);
 		}
 
-		// SBT Buffer
-		// ЩݲҪÿ֡£Root ArgumentsҪ¸ǩֻҪ϶Ӧ
-		// SBTϵЩĵַSBTϵַݱҪ£൱ֻҪSBTϴĵַָ
+		// 填充SBT Buffer数据
+		// 这些数据不需要每帧更新，包括Root Arguments，如果要更新根签名参数，只需要更新描述符堆上对应描述符即可
+		// SBT上的数据是这些描述符的地址，所以SBT上的描述符地址数据本身不需要更新，相当于只需要更新SBT上存的地址指向的数据
 		for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 		{
 			// Root Arguments GPU Handle
@@ -2442,10 +2502,10 @@ namespace ZXEngine
 
 			// Root Arguments
 			vector<void*> rootArguments(rootArgumentsNum);
-			// һDescriptor Tableһ
+			// 一个Descriptor Table算一个参数
 			rootArguments[0] = reinterpret_cast<void*>(gpuHandle.ptr);
 
-			// дָ
+			// 数据写入指针
 			char* pSBT = static_cast<char*>(rtPipeline->SBT.buffers[i].cpuAddress);
 
 			char* pRayGen = pSBT;
@@ -2491,16 +2551,16 @@ namespace ZXEngine
 			}
 		}
 
-		// ʼTLAS
+		// 初始化TLAS数组
 		rtPipeline->tlasIdx = GetNextTLASGroupIndex();
 		auto tlasGroup = GetTLASGroupByIndex(rtPipeline->tlasIdx);
 		tlasGroup->asGroup.resize(DX_MAX_FRAMES_IN_FLIGHT);
 		tlasGroup->inUse = true;
-		// ʼTLASмBuffer
+		// 初始化构建TLAS的中间Buffer
 		mTLASScratchBuffers.resize(DX_MAX_FRAMES_IN_FLIGHT);
 		mTLASInstanceBuffers.resize(DX_MAX_FRAMES_IN_FLIGHT);
 
-		// ׷ߺͳԴ
+		// 创建光追管线和场景相关数据资源，并绑定
 		CreateRTPipelineData(rtPipelineID);
 		CreateRTSceneData(rtPipelineID);
 
@@ -2540,7 +2600,7 @@ namespace ZXEngine
 		{
 			for (uint32_t i = 0; i < DX_MAX_FRAMES_IN_FLIGHT; i++)
 			{
-				// BufferһԴ޸ĵģԿŻD3D12_HEAP_TYPE_DEFAULT
+				// 这个Buffer可能是一次性创建不再修改的，可以考虑优化成D3D12_HEAP_TYPE_DEFAULT
 				rtMaterialData->buffers[i] = CreateBuffer(bufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, false);
 			}
 		}
@@ -2564,14 +2624,14 @@ namespace ZXEngine
 
 	void RenderAPID3D12::SetRayTracingSkyBox(uint32_t textureID)
 	{
-		// պĬǵǰһ֡ĵһCubeMap
+		// 天空盒纹理默认是当前这一帧的第一个CubeMap
 		mCurRTSceneCubeMapIndexMap[textureID] = 0;
 		mCurRTSceneCubeMapIndexes.push_back(textureID);
 	}
 
 	void RenderAPID3D12::PushRayTracingMaterialData(Material* material)
 	{
-		// ʹõӵǰ׷еб
+		// 把这个材质使用的纹理添加到当前光追场景中的总纹理列表中
 		for (auto& iter : material->data->textures)
 		{
 			auto textureID = iter.second->GetID();
@@ -2593,7 +2653,7 @@ namespace ZXEngine
 			}
 		}
 
-		// ׷ӵǰ׷еܹ׷б
+		// 把这个光追材质添加到当前光追场景中的总光追材质列表中
 		auto rtMaterialDataID = material->data->GetRTID();
 		if (mCurRTSceneRTMaterialDataMap.find(rtMaterialDataID) == mCurRTSceneRTMaterialDataMap.end())
 		{
@@ -2601,7 +2661,7 @@ namespace ZXEngine
 			mCurRTSceneRTMaterialDatas.emplace_back(rtMaterialDataID);
 		}
 
-		// дBuffer
+		// 遍历纹理，并把引用索引写入Buffer
 		for (auto& iter : material->data->textures)
 		{
 			auto textureID = iter.second->GetID();
@@ -2630,7 +2690,7 @@ namespace ZXEngine
 	{
 		auto rtPipeline = mRTPipelines[mCurRTPipelineID];
 
-		// 㻭澲ֹ֡ۻʽ׷ȾҪ
+		// 计算画面静止的帧数，累积式光追渲染需要这个数据
 		if (rtConstants.VP != mRTVPMatrix[mCurrentFrame])
 		{
 			mRTFrameCount[mCurrentFrame] = 0;
@@ -2638,37 +2698,37 @@ namespace ZXEngine
 		}
 		uint32_t frameCount = mRTFrameCount[mCurrentFrame]++;
 
-		// ȸµǰ֡͹׷߰󶨵ĳ
+		// 先更新当前帧和光追管线绑定的场景数据
 		UpdateRTSceneData(mCurRTPipelineID);
-		// µǰ֡͹׷߰󶨵Ĺ
+		// 更新当前帧和光追管线绑定的管线数据
 		UpdateRTPipelineData(mCurRTPipelineID);
 
-		// ȡǰ֡Command
+		// 获取当前帧的Command
 		auto drawCommand = GetDrawCommandByIndex(commandID);
 		auto& allocator = drawCommand->allocators[mCurrentFrame];
 		auto& drawCommandList = drawCommand->commandLists[mCurrentFrame];
 
-		// Command List
+		// 重置Command List
 		ThrowIfFailed(allocator->Reset());
 		ThrowIfFailed(drawCommandList->Reset(allocator.Get(), nullptr));
 
-		// ȡ׷Ŀͼ
+		// 获取光追管线输出的目标图像
 		auto curFBO = GetFBOByIndex(mCurFBOIdx);
 		uint32_t textureID = GetRenderBufferByIndex(curFBO->colorBufferIdx)->renderBuffers[GetCurFrameBufferIndex()];
 		auto texture = GetTextureByIndex(textureID);
 
-		// תΪ׷ʽ
+		// 转为光追输出格式
 		CD3DX12_RESOURCE_BARRIER transition = CD3DX12_RESOURCE_BARRIER::Transition(
 			texture->texture.Get(), D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 		drawCommandList->ResourceBarrier(1, &transition);
 
-		// ù׷
+		// 设置光追管线
 		drawCommandList->SetPipelineState1(rtPipeline->pipeline.Get());
-		// ù׷
+		// 设置光追描述符堆
 		vector<ID3D12DescriptorHeap*> descriptorHeaps = { rtPipeline->descriptorHeaps[mCurrentFrame].Get() };
 		drawCommandList->SetDescriptorHeaps(static_cast<UINT>(descriptorHeaps.size()), descriptorHeaps.data());
 
-		// д볣
+		// 写入常量数据
 		{
 			char* cBufferPtr = static_cast<char*>(rtPipeline->constantBuffers[mCurrentFrame].cpuAddress);
 
@@ -2708,24 +2768,24 @@ namespace ZXEngine
 		dispatchRaysDesc.HitGroupTable.StartAddress = rtPipeline->SBT.buffers[mCurrentFrame].gpuAddress + rtPipeline->SBT.rayGenSectionSize + rtPipeline->SBT.missSectionSize;
 		dispatchRaysDesc.HitGroupTable.SizeInBytes = rtPipeline->SBT.hitGroupSectionSize;
 		dispatchRaysDesc.HitGroupTable.StrideInBytes = rtPipeline->SBT.hitGroupEntrySize;
-		// Ray Generation Shader߳(ͼֱ)
+		// Ray Generation Shader的线程组数量(图像分辨率)
 		dispatchRaysDesc.Width = mViewPortInfo.width;
 		dispatchRaysDesc.Height = mViewPortInfo.height;
 		dispatchRaysDesc.Depth = 1;
 		// Ray Trace
 		drawCommandList->DispatchRays(&dispatchRaysDesc);
 
-		// תΪShaderȡʽ
+		// 转为Shader读取格式
 		transition = CD3DX12_RESOURCE_BARRIER::Transition(
 			texture->texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_GENERIC_READ);
 		drawCommandList->ResourceBarrier(1, &transition);
 
-		// ύCommand List
+		// 结束并提交Command List
 		ThrowIfFailed(drawCommandList->Close());
 		ID3D12CommandList* cmdsLists[] = { drawCommandList.Get() };
 		mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
 
-		// յǰ֡ĳ
+		// 清空当前帧的场景数据
 		mASInstanceData.clear();
 		mCurRTSceneTextureIndexes.clear();
 		mCurRTSceneTextureIndexMap.clear();
@@ -2741,32 +2801,32 @@ namespace ZXEngine
 		auto& allocator = command->allocators[mCurrentFrame];
 		auto& commandList = command->commandLists[mCurrentFrame];
 
-		// Command List
+		// 重置Command List
 		ThrowIfFailed(allocator->Reset());
 		ThrowIfFailed(commandList->Reset(allocator.Get(), nullptr));
 
-		// ȡǰ֡TLAS
+		// 获取当前帧的TLAS
 		auto& curTLAS = GetTLASGroupByIndex(mRTPipelines[mCurRTPipelineID]->tlasIdx)->asGroup[mCurrentFrame];
 		const bool isUpdate = curTLAS.isBuilt;
 
-		// TLAS
+		// 构建TLAS的输入参数
 		D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS inputs = {};
 		inputs.Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
 		inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
 		inputs.NumDescs = static_cast<UINT>(mASInstanceData.size());
 		inputs.Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
 
-		// TLASҪڴС
+		// 计算TLAS所需要的内存大小
 		D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
 		mD3D12Device->GetRaytracingAccelerationStructurePrebuildInfo(&inputs, &prebuildInfo);
 
 		// Scratch Buffer
 		UINT64 scratchSizeInBytes = Math::AlignUpPOT(prebuildInfo.ScratchDataSizeInBytes, static_cast<UINT64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT));
 		mTLASScratchBuffers[mCurrentFrame] = CreateBuffer(scratchSizeInBytes, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON, D3D12_HEAP_TYPE_DEFAULT, false, true);
-		// TLASҪõBLASBuffer
+		// 构建TLAS要用的BLAS数据Buffer
 		UINT64 instanceDescsSizeInBytes = Math::AlignUpPOT(static_cast<UINT64>(sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * mASInstanceData.size()), static_cast<UINT64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT));
 		mTLASInstanceBuffers[mCurrentFrame] = CreateBuffer(instanceDescsSizeInBytes, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, false, true);
-		// TLAS Buffer
+		// 创建TLAS Buffer
 		if (!isUpdate)
 		{
 			UINT64 resultSizeInBytes = Math::AlignUpPOT(prebuildInfo.ResultDataMaxSizeInBytes, static_cast<UINT64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT));
@@ -2776,23 +2836,23 @@ namespace ZXEngine
 				D3D12_HEAP_TYPE_DEFAULT, false, true);
 		}
 
-		// BLASBufferָ
+		// BLAS数据Buffer指针
 		D3D12_RAYTRACING_INSTANCE_DESC* instanceDescs = nullptr;
-		// Bufferӳ䵽ָ
+		// 把Buffer映射到指针
 		mTLASInstanceBuffers[mCurrentFrame].buffer->Map(0, nullptr, reinterpret_cast<void**>(&instanceDescs));
-		// ӳʧֱ׳쳣
+		// 映射失败直接抛出异常
 		if (!instanceDescs)
 			throw std::logic_error("Failed to map instanceDescsBuffer.");
 
-		// BLASʵ
+		// BLAS实例数量
 		UINT instanceCount = static_cast<UINT>(mASInstanceData.size());
 
-		// ½TLASĻȰBLASBuffer
-		// ֪һǷҪNvidiaĹ׷̳дģҲûΪʲô
+		// 新建TLAS的话先把BLAS数据Buffer清零
+		// 不知道这一步是否必要，Nvidia的光追教程里这样写的，也没解释为什么
 		if (!isUpdate)
 			memset(instanceDescs, 0, instanceDescsSizeInBytes);
 
-		// 䳡ҪȾĶʵ
+		// 填充场景中要渲染的对象实例数据
 		for (UINT i = 0; i < instanceCount; i++)
 		{
 			auto& data = mASInstanceData[i];
@@ -2821,14 +2881,14 @@ namespace ZXEngine
 		asDesc.SourceAccelerationStructureData = isUpdate ? curTLAS.as.gpuAddress : NULL;
 		asDesc.ScratchAccelerationStructureData = mTLASScratchBuffers[mCurrentFrame].gpuAddress;
 
-		// TLAS
+		// 构建TLAS
 		commandList->BuildRaytracingAccelerationStructure(&asDesc, 0, nullptr);
 
-		// ȷTLASڱʹ֮ǰѹ
+		// 确保TLAS在被使用之前已构建完成
 		auto uavBarrier = CD3DX12_RESOURCE_BARRIER::UAV(curTLAS.as.buffer.Get());
 		commandList->ResourceBarrier(1, &uavBarrier);
 
-		// ύCommand List
+		// 结束并提交Command List
 		ThrowIfFailed(commandList->Close());
 		ID3D12CommandList* cmdsLists[] = { commandList.Get() };
 		mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
@@ -2842,49 +2902,49 @@ namespace ZXEngine
 		geometryDesc.Type = D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES;
 		geometryDesc.Triangles.VertexBuffer.StartAddress = meshBuffer->vertexBuffer.gpuAddress;
 		geometryDesc.Triangles.VertexBuffer.StrideInBytes = sizeof(Vertex);
-		// ʽBLASֻĶλһ
+		// 顶点格式，BLAS只关心顶点位置这一项数据
 		geometryDesc.Triangles.VertexFormat = DXGI_FORMAT_R32G32B32_FLOAT;
 		geometryDesc.Triangles.VertexCount = meshBuffer->vertexCount;
 		geometryDesc.Triangles.IndexBuffer = meshBuffer->indexBuffer.gpuAddress;
 		geometryDesc.Triangles.IndexFormat = DXGI_FORMAT_R32_UINT;
 		geometryDesc.Triangles.IndexCount = meshBuffer->indexCount;
-		// BLASʱԶģһ任ʱҪ
+		// 构建BLAS的时候可以对模型数据做一个变换，暂时不需要
 		geometryDesc.Triangles.Transform3x4 = NULL;
 		geometryDesc.Flags = D3D12_RAYTRACING_GEOMETRY_FLAG_OPAQUE;
 
 		D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS inputs = {};
 		inputs.Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
 		inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
-		// ԴһԹBLASʱֻһ
+		// 这里可以传数组一次性构建多个BLAS，暂时只传一个
 		inputs.NumDescs = 1;
 		inputs.pGeometryDescs = &geometryDesc;
-		// ָPREFER_FAST_TRACEʱʵʱ׷ٶȸ
+		// 指定PREFER_FAST_TRACE，构建时间更长，但是实时光追速度更快
 		inputs.Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
 
-		// BLASҪڴС
+		// 计算BLAS所需要的内存大小
 		D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
 		mD3D12Device->GetRaytracingAccelerationStructurePrebuildInfo(&inputs, &prebuildInfo);
 
 		UINT64 scratchSizeInBytes = Math::AlignUpPOT(prebuildInfo.ScratchDataSizeInBytes, static_cast<UINT64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT));
 		UINT64 resultSizeInBytes = Math::AlignUpPOT(prebuildInfo.ResultDataMaxSizeInBytes, static_cast<UINT64>(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT));
 
-		// BLASscratch buffer
+		// 创建BLAS的scratch buffer
 		auto scratchBuffer = CreateBuffer(scratchSizeInBytes, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON, D3D12_HEAP_TYPE_DEFAULT, false, true);
-		// BLASĽbuffer
+		// 创建BLAS的结果buffer
 		meshBuffer->blas.as = CreateBuffer(resultSizeInBytes, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE, D3D12_HEAP_TYPE_DEFAULT, false, true);
 
 		D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC asDesc = {};
 		asDesc.Inputs = inputs;
 		asDesc.DestAccelerationStructureData = meshBuffer->blas.as.gpuAddress;
 		asDesc.ScratchAccelerationStructureData = scratchBuffer.gpuAddress;
-		// ǸBLASҪָ֮ǰBLAS
+		// 如果是更新BLAS需要指定之前的BLAS
 		asDesc.SourceAccelerationStructureData = NULL;
 
 		ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 		{
-			// BLAS
+			// 构建BLAS
 			cmdList->BuildRaytracingAccelerationStructure(&asDesc, 0, nullptr);
-			// ȷBLASڱʹ֮ǰѹ
+			// 确保BLAS在被使用之前已构建完成
 			auto uavBarrier = CD3DX12_RESOURCE_BARRIER::UAV(meshBuffer->blas.as.buffer.Get());
 			cmdList->ResourceBarrier(1, &uavBarrier);
 		});
@@ -3142,6 +3202,38 @@ namespace ZXEngine
 		return mDrawCommandArray[idx];
 	}
 
+	uint32_t RenderAPID3D12::GetNextInstanceBufferIndex()
+	{
+		uint32_t length = static_cast<uint32_t>(mInstanceBufferArray.size());
+
+		for (uint32_t i = 0; i < length; i++)
+		{
+			if (!mInstanceBufferArray[i]->inUse)
+				return i;
+		}
+
+		mInstanceBufferArray.push_back(new ZXD3D12InstanceBuffer());
+
+		return length;
+	}
+
+	ZXD3D12InstanceBuffer* RenderAPID3D12::GetInstanceBufferByIndex(uint32_t idx)
+	{
+		return mInstanceBufferArray[idx];
+	}
+
+	void RenderAPID3D12::DestroyInstanceBufferByIndex(uint32_t idx)
+	{
+		auto instanceBuffer = GetInstanceBufferByIndex(idx);
+
+		for (auto& buffer : instanceBuffer->buffers)
+			DestroyBuffer(buffer);
+		instanceBuffer->buffers.clear();
+		instanceBuffer->bufferViews.clear();
+
+		instanceBuffer->inUse = false;
+	}
+
 	void RenderAPID3D12::CheckDeleteData()
 	{
 		vector<uint32_t> deleteList = {};
@@ -3160,7 +3252,7 @@ namespace ZXEngine
 			mMaterialDatasToDelete.erase(id);
 		}
 
-		// ׷
+		// 光追材质
 		deleteList.clear();
 		for (auto& iter : rtMaterialDatasToDelete)
 		{
@@ -3219,6 +3311,21 @@ namespace ZXEngine
 			DestroyPipelineByIndex(id);
 			mShadersToDelete.erase(id);
 		}
+
+		// Instance Buffer
+		deleteList.clear();
+		for (auto& iter : mInstanceBuffersToDelete)
+		{
+			if (iter.second > 0)
+				iter.second--;
+			else
+				deleteList.push_back(iter.first);
+		}
+		for (auto id : deleteList)
+		{
+			DestroyInstanceBufferByIndex(id);
+			mInstanceBuffersToDelete.erase(id);
+		}
 	}
 
 	uint32_t RenderAPID3D12::CreateZXD3D12Texture(ComPtr<ID3D12Resource>& textureResource, const D3D12_RENDER_TARGET_VIEW_DESC& rtvDesc)
@@ -3329,9 +3436,9 @@ namespace ZXEngine
 
 			ImmediatelyExecute([=](ComPtr<ID3D12GraphicsCommandList4> cmdList)
 			{
-				// ʵֱڴdefaultBufferʱͰѳʼ״̬ΪD3D12_RESOURCE_STATE_COPY_DEST
-				// ûҪһתǴʱ D3D12_RESOURCE_STATE_COMMON ʼDebug LayerȻWarning
-				// ΪûWarningų⣬д
+				// 其实可以直接在创建defaultBuffer的时候就把初始状态设置为D3D12_RESOURCE_STATE_COPY_DEST
+				// 没必要多一步这个转换，但是创建的时候如果不是以 D3D12_RESOURCE_STATE_COMMON 初始化，Debug Layer居然会给个Warning
+				// 所以为了没有Warning干扰排除问题，这里就这样写了
 				CD3DX12_RESOURCE_BARRIER barrier1 = CD3DX12_RESOURCE_BARRIER::Transition(
 					buffer.buffer.Get(),
 					D3D12_RESOURCE_STATE_COMMON,
@@ -3450,20 +3557,20 @@ namespace ZXEngine
 
 	ComPtr<IDxcBlob> RenderAPID3D12::CompileRTShader(const string& path)
 	{
-		// ȡHLSL
+		// 读取HLSL代码
 		auto code = Resources::LoadTextFile(Resources::GetAssetFullPath(path) + ".dxr");
 
-		// HLSLBlob
+		// 创建HLSL代码的Blob
 		ComPtr<IDxcBlobEncoding> shaderBlobEncoding;
 		ThrowIfFailed(mDxcLibrary->CreateBlobWithEncodingFromPinned((LPBYTE)code.c_str(), (UINT32)code.size(), 0, &shaderBlobEncoding));
 
-		// ȡһ´֣ԺInclude
+		// 获取一下代码名字，调试和Include用
 		string name = Resources::GetAssetName(path);
 		std::wstringstream wss;
 		wss << std::wstring(name.begin(), name.end());
 		std::wstring wName = wss.str();
 
-		// HLSL
+		// 编译HLSL代码
 		ComPtr<IDxcOperationResult> operationResult;
 		ThrowIfFailed(mDxcCompiler->Compile(
 			shaderBlobEncoding.Get(),
@@ -3478,7 +3585,7 @@ namespace ZXEngine
 			&operationResult
 		));
 
-		// дϢ
+		// 检查编译结果，如果有错误就输出错误信息
 		HRESULT resultCode;
 		ThrowIfFailed(operationResult->GetStatus(&resultCode));
 		if (FAILED(resultCode))
@@ -3496,7 +3603,7 @@ namespace ZXEngine
 			ThrowIfFailed(resultCode);
 		}
 
-		// ȡر
+		// 获取并返回编译结果
 		ComPtr<IDxcBlob> shaderBlob;
 		ThrowIfFailed(operationResult->GetResult(&shaderBlob));
 		return shaderBlob;
@@ -3537,10 +3644,10 @@ namespace ZXEngine
 		{
 			auto heapAddress = rtPipeline->descriptorHeaps[i]->GetCPUDescriptorHandleForHeapStart();
 
-			// Constant Buffer (ͬVulkanеPushConstant)
+			// 创建Constant Buffer (这里的作用同于Vulkan中的PushConstant)
 			rtPipeline->constantBuffers[i] = CreateBuffer(mRTPipelineConstantBufferSize, D3D12_RESOURCE_FLAG_NONE, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_HEAP_TYPE_UPLOAD, true, true);
 
-			// Constant Buffer
+			// 绑定Constant Buffer
 			CD3DX12_CPU_DESCRIPTOR_HANDLE cBufferHandle(heapAddress);
 			cBufferHandle.Offset(static_cast<INT>(mRTRootParamOffsetInDescriptorHeapConstantBuffer), mCbvSrvUavDescriptorSize);
 
@@ -3557,7 +3664,7 @@ namespace ZXEngine
 
 		auto heapAddress = rtPipeline->descriptorHeaps[mCurrentFrame]->GetCPUDescriptorHandleForHeapStart();
 
-		// TLAS
+		// 绑定TLAS
 		CD3DX12_CPU_DESCRIPTOR_HANDLE tlasHandle(heapAddress);
 		tlasHandle.Offset(static_cast<INT>(mRTRootParamOffsetInDescriptorHeapTLAS), mCbvSrvUavDescriptorSize);
 
@@ -3570,11 +3677,11 @@ namespace ZXEngine
 		srvDesc.RaytracingAccelerationStructure.Location = curTLAS.as.gpuAddress;
 		mD3D12Device->CreateShaderResourceView(nullptr, &srvDesc, tlasHandle);
 
-		// ȡ׷Ŀͼ
+		// 获取光追管线输出的目标图像
 		auto curFBO = GetFBOByIndex(mCurFBOIdx);
 		auto colorBuffer = GetTextureByIndex(GetRenderBufferByIndex(curFBO->colorBufferIdx)->renderBuffers[GetCurFrameBufferIndex()]);
 
-		// ͼ
+		// 更新输出图像
 		CD3DX12_CPU_DESCRIPTOR_HANDLE outputHandle(heapAddress);
 		outputHandle.Offset(static_cast<INT>(mRTRootParamOffsetInDescriptorHeapOutputImage), mCbvSrvUavDescriptorSize);
 		D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
@@ -3594,7 +3701,7 @@ namespace ZXEngine
 
 		auto heapAddress = rtPipeline->descriptorHeaps[mCurrentFrame]->GetCPUDescriptorHandleForHeapStart();
 
-		// 2D
+		// 2D纹理数组
 		CD3DX12_CPU_DESCRIPTOR_HANDLE textureHandle(heapAddress);
 		textureHandle.Offset(static_cast<INT>(mRTRootParamOffsetInDescriptorHeapTexture2DArray), mCbvSrvUavDescriptorSize);
 		for (size_t i = 0; i < mCurRTSceneTextureIndexes.size(); i++)
@@ -3611,7 +3718,7 @@ namespace ZXEngine
 			textureHandle.Offset(1, mCbvSrvUavDescriptorSize);
 		}
 
-		// CubeMap
+		// CubeMap数组
 		CD3DX12_CPU_DESCRIPTOR_HANDLE cubeMapHandle(heapAddress);
 		cubeMapHandle.Offset(static_cast<INT>(mRTRootParamOffsetInDescriptorHeapTextureCubeArray), mCbvSrvUavDescriptorSize);
 		for (size_t i = 0; i < mCurRTSceneCubeMapIndexes.size(); i++)
@@ -3628,7 +3735,7 @@ namespace ZXEngine
 			cubeMapHandle.Offset(1, mCbvSrvUavDescriptorSize);
 		}
 
-		// ģͺͲ
+		// 模型和材质数据
 		CD3DX12_CPU_DESCRIPTOR_HANDLE indexHandle(heapAddress);
 		indexHandle.Offset(static_cast<INT>(mRTRootParamOffsetInDescriptorHeapIndexBuffer), mCbvSrvUavDescriptorSize);
 		CD3DX12_CPU_DESCRIPTOR_HANDLE vertexHandle(heapAddress);
@@ -3643,8 +3750,8 @@ namespace ZXEngine
 			auto meshData = GetVAOByIndex(data.VAO);
 			auto rtMaterialData = GetRTMaterialDataByIndex(data.rtMaterialDataID);
 
-			// ͲȫByteAddressBufferʽ룬ݸʽShaderԼ
-			// ByteAddressBufferҪFormat̶ΪDXGI_FORMAT_R32_TYPELESSFlagsΪD3D12_BUFFER_SRV_FLAG_RAW
+			// 索引，顶点和材质数据全部以ByteAddressBuffer的形式传入，数据格式由Shader自己解析
+			// ByteAddressBuffer需要Format固定为DXGI_FORMAT_R32_TYPELESS，Flags为D3D12_BUFFER_SRV_FLAG_RAW
 			D3D12_SHADER_RESOURCE_VIEW_DESC indexDesc = {};
 			indexDesc.Format = DXGI_FORMAT_R32_TYPELESS;
 			indexDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
@@ -3707,13 +3814,13 @@ namespace ZXEngine
 		GlobalData::srcHeight = mNewWindowHeight;
 #endif
 		
-		// ͷԭPresent Buffer
+		// 释放原Present Buffer
 		DestroyFBOByIndex(mPresentFBOIdx);
-		// ﻹиãҪͷһ£ȷöͷ
+		// 这里还有个引用，要再释放一下，确保所有引用都释放了
 		for (UINT i = 0; i < mPresentBufferCount; i++)
 			mPresentBuffers[i].Reset();
 
-		// Present BufferС
+		// 重新设置Present Buffer大小
 		ThrowIfFailed(mSwapChain->ResizeBuffers(mPresentBufferCount,
 #ifdef ZX_EDITOR
 			ProjectSetting::srcWidth, ProjectSetting::srcHeight,
@@ -3722,10 +3829,10 @@ namespace ZXEngine
 #endif
 			mPresentBufferFormat, DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH));
 
-		// ´Present Buffer
+		// 重新创建Present Buffer
 		CreateSwapChainBuffers();
 
-		// ´дСʹڱһµFBO
+		// 重新创建所有大小和窗口保持一致的FBO
 		FBOManager::GetInstance()->RecreateAllFollowWindowFBO();
 
 #ifdef ZX_EDITOR
@@ -3750,16 +3857,16 @@ namespace ZXEngine
 
 	void RenderAPID3D12::WaitForFence(ZXD3D12Fence* fence)
 	{
-		// FenceĽȻûһõĽֵͿʼȴ
-		// жϴ0ǷֹȴûSignalFence
+		// 如果Fence的进度还没到上一次设置的进度值就开始等待
+		// 判断大于0是防止等待没有Signal过的Fence
 		if (fence->currentFence > 0 && fence->fence->GetCompletedValue() < fence->currentFence)
 		{
-			// һ"ȵִոõźֵ"¼
+			// 创建一个"进度抵达刚刚设置的信号量值"的事件
 			auto event = CreateEventEx(nullptr, NULL, NULL, EVENT_ALL_ACCESS);
 			if (event)
 			{
 				ThrowIfFailed(fence->fence->SetEventOnCompletion(fence->currentFence, event));
-				// ȴ¼
+				// 等待事件
 				WaitForSingleObject(event, INFINITE);
 				CloseHandle(event);
 			}
@@ -3870,28 +3977,28 @@ namespace ZXEngine
 
 	array<const CD3DX12_STATIC_SAMPLER_DESC, 4> RenderAPID3D12::GetStaticSamplersDesc()
 	{
-		// ԲֵԵظ
+		// 线性插值采样，边缘重复
 		const CD3DX12_STATIC_SAMPLER_DESC linearWrap(0,
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR,
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // U
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // V
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP); // W
 
-		// ԲֵԵض
+		// 线性插值采样，边缘截断
 		const CD3DX12_STATIC_SAMPLER_DESC linearClamp(1,
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR,
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP,  // U
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP,  // V
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP); // W
 
-		// ԲԵظ
+		// 各向异性采样，边缘重复
 		const CD3DX12_STATIC_SAMPLER_DESC anisotropicWrap(2,
 			D3D12_FILTER_ANISOTROPIC,
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // U
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // V
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP); // W
 
-		// ԲԵض
+		// 各向异性采样，边缘截断
 		const CD3DX12_STATIC_SAMPLER_DESC anisotropicClamp(3,
 			D3D12_FILTER_ANISOTROPIC,
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP,  // U
@@ -3915,22 +4022,22 @@ namespace ZXEngine
 
 	void RenderAPID3D12::ImmediatelyExecute(std::function<void(ComPtr<ID3D12GraphicsCommandList4> cmdList)>&& function)
 	{
-		// 
+		// 重置命令
 		ThrowIfFailed(mImmediateExeAllocator->Reset());
 		ThrowIfFailed(mImmediateExeCommandList->Reset(mImmediateExeAllocator.Get(), nullptr));
 
-		// ¼
+		// 记录命令
 		function(mImmediateExeCommandList);
 
-		// ִ
+		// 立刻执行
 		ThrowIfFailed(mImmediateExeCommandList->Close());
 		ID3D12CommandList* cmdsLists[] = { mImmediateExeCommandList.Get() };
 		mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
 
-		// Fence
+		// 设置Fence
 		SignalFence(mImmediateExeFence);
 
-		// ȴFence
+		// 等待Fence
 		WaitForFence(mImmediateExeFence);
 	}
 }
\ No newline at end of file
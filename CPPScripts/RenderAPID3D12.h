@@ -10,7 +10,7 @@ namespace ZXEngine
 		friend class EditorGUIManagerDirectX12;
 		friend class ZXD3D12DescriptorAllocator;
 		/// <summary>
-		/// ׼RenderAPIӿ
+		/// 标准RenderAPI接口
 		/// </summary>
 	public:
 		RenderAPID3D12();
@@ -19,7 +19,7 @@ namespace ZXEngine
 		virtual void BeginFrame();
 		virtual void EndFrame();
 
-		// Ⱦ״̬
+		// 渲染状态
 		virtual void OnWindowSizeChange(uint32_t width, uint32_t height);
 		virtual void SetRenderState(RenderStateSetting* state);
 		virtual void SetViewPort(unsigned int width, unsigned int height, unsigned int xOffset = 0, unsigned int yOffset = 0);
@@ -32,7 +32,7 @@ namespace ZXEngine
 		virtual FrameBufferObject* CreateFrameBufferObject(FrameBufferType type, const ClearInfo& clearInfo, unsigned int width = 0, unsigned int height = 0);
 		virtual void DeleteFrameBufferObject(FrameBufferObject* FBO);
 
-		// 
+		// 纹理
 		virtual unsigned int LoadTexture(const char* path, int& width, int& height);
 		virtual unsigned int LoadCubeMap(const vector<string>& faces);
 		virtual unsigned int CreateTexture(TextureFullData* data);
@@ -45,7 +45,7 @@ namespace ZXEngine
 		virtual ShaderReference* SetUpShader(const string& path, const string& shaderCode, FrameBufferType type);
 		virtual void DeleteShader(uint32_t id);
 
-		// 
+		// 材质
 		virtual uint32_t CreateMaterialData();
 		virtual void SetUpMaterial(Material* material);
 		virtual void UseMaterialData(uint32_t ID);
@@ -54,8 +54,15 @@ namespace ZXEngine
 		// Draw
 		virtual uint32_t AllocateDrawCommand(CommandType commandType);
 		virtual void Draw(uint32_t VAO);
+		virtual void Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer);
+		virtual void DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount);
 		virtual void GenerateDrawCommand(uint32_t id);
 
+		// Instance Buffer
+		virtual uint32_t CreateInstanceBuffer(uint32_t instanceNum);
+		virtual void UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum);
+		virtual void DeleteInstanceBuffer(uint32_t id);
+
 		// Mesh
 		virtual void DeleteMesh(unsigned int VAO);
 		virtual void SetUpStaticMesh(unsigned int& VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices);
@@ -63,7 +70,7 @@ namespace ZXEngine
 		virtual void UpdateDynamicMesh(unsigned int VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices);
 		virtual void GenerateParticleMesh(unsigned int& VAO);
 
-		// Shader
+		// Shader参数
 		virtual void UseShader(unsigned int ID);
 		virtual void SetShaderScalar(Material* material, const string& name, bool value, bool allBuffer = false);
 		virtual void SetShaderScalar(Material* material, const string& name, float value, bool allBuffer = false);
@@ -86,7 +93,7 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// ׼RayTracingӿ(δʵֻDXRĹ׷)
+		/// 标准RayTracing接口(暂未实现基于DXR的光线追踪)
 		/// </summary>
 	public:
 		// Pipeline
@@ -98,7 +105,7 @@ namespace ZXEngine
 		virtual void SetUpRayTracingMaterialData(Material* material);
 		virtual void DeleteRayTracingMaterialData(uint32_t id);
 
-		// ݸ
+		// 数据更新
 		virtual void SetRayTracingSkyBox(uint32_t textureID);
 		virtual void PushRayTracingMaterialData(Material* material);
 		virtual void PushAccelerationStructure(uint32_t VAO, uint32_t hitGroupIdx, uint32_t rtMaterialDataID, const Matrix4& transform);
@@ -112,32 +119,32 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// ʱһԳʼĺD3D12ر
+		/// 仅启动时一次性初始化的核心D3D12组件及相关变量
 		/// </summary>
 	private:
-		// С
+		// 各类型描述符大小
 		UINT mRtvDescriptorSize = 0;
 		UINT mDsvDescriptorSize = 0;
 		UINT mCbvSrvUavDescriptorSize = 0;
-		// Ⱦʱ̬
+		// 渲染时动态分配的描述符堆
 		vector<UINT> mDynamicDescriptorOffsets;
 		vector<ComPtr<ID3D12DescriptorHeap>> mDynamicDescriptorHeaps;
 
-		// Ļ̨ͼʽ
+		// 屏幕后台缓冲区图像格式
 		DXGI_FORMAT mPresentBufferFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
-		// ĬϵFrameBufferɫʿռ
+		// 默认的纹理和FrameBuffer色彩空间
 		const DXGI_FORMAT mDefaultImageFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
-		// 4X MSAAȼ
+		// 4X MSAA质量等级
 		UINT m4xMSAAQuality = 0;
 		UINT msaaSamplesCount = 4;
 
-		// ǰDX_MAX_FRAMES_IN_FLIGHTеĵڼ֡
+		// 当前是DX_MAX_FRAMES_IN_FLIGHT中的第几帧
 		uint32_t mCurrentFrame = 0;
-		// ǰһ֡ҪдPresent Buffer±
+		// 当前这一帧要写入的Present Buffer下标
 		uint32_t mCurPresentIdx = 0;
-		// ȴȾɵFence
+		// 等待所有渲染操作完成的特殊Fence
 		ZXD3D12Fence* mEndRenderFence;
-		// ֮֡֡ͬõFence
+		// 帧与帧之间同步用的Fence
 		vector<ZXD3D12Fence*> mFrameFences;
 
 		ComPtr<IDXGIFactory4> mDXGIFactory;
@@ -160,7 +167,7 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// D3D12ԴԼشٽӿ
+		/// D3D12资源，以及相关创建销毁接口
 		/// </summary>
 	private:
 		vector<ZXD3D12VAO*> mVAOArray;
@@ -170,11 +177,13 @@ namespace ZXEngine
 		vector<ZXD3D12Pipeline*> mPipelineArray;
 		vector<ZXD3D12MaterialData*> mMaterialDataArray;
 		vector<ZXD3D12DrawCommand*> mDrawCommandArray;
+		vector<ZXD3D12InstanceBuffer*> mInstanceBufferArray;
 
 		map<uint32_t, uint32_t> mMeshsToDelete;
 		map<uint32_t, uint32_t> mTexturesToDelete;
 		map<uint32_t, uint32_t> mMaterialDatasToDelete;
 		map<uint32_t, uint32_t> mShadersToDelete;
+		map<uint32_t, uint32_t> mInstanceBuffersToDelete;
 
 		uint32_t GetNextVAOIndex();
 		ZXD3D12VAO* GetVAOByIndex(uint32_t idx);
@@ -196,6 +205,9 @@ namespace ZXEngine
 		void DestroyMaterialDataByIndex(uint32_t idx);
 		uint32_t GetNextDrawCommandIndex();
 		ZXD3D12DrawCommand* GetDrawCommandByIndex(uint32_t idx);
+		uint32_t GetNextInstanceBufferIndex();
+		ZXD3D12InstanceBuffer* GetInstanceBufferByIndex(uint32_t idx);
+		void DestroyInstanceBufferByIndex(uint32_t idx);
 
 		void CheckDeleteData();
 
@@ -208,81 +220,81 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// D3D12׷Դͽӿ
+		/// D3D12光线追踪相关资源和接口
 		/// </summary>
 	private:
-		// ׷Shader
+		// 光追Shader编译库
 		IDxcLibrary* mDxcLibrary = nullptr;
 		IDxcCompiler* mDxcCompiler = nullptr;
 		IDxcIncludeHandler* mDxcIncludeHandler = nullptr;
 
-		// ǰĹ׷ٹID
+		// 当前的光线追踪管线ID
 		uint32_t mCurRTPipelineID = 0;
-		// ׷ٹ
+		// 光线追踪管线
 		vector<ZXD3D12RTPipeline*> mRTPipelines;
-		// TLASмBuffer
+		// 构建TLAS的中间Buffer
 		vector<ZXD3D12Buffer> mTLASScratchBuffers;
 		vector<ZXD3D12Buffer> mTLASInstanceBuffers;
 
-		// ۻʽ׷Ужϻˢµ
+		// 在累积式光追场景中，用来判断画面刷新的数据
 		vector<Matrix4> mRTVPMatrix;
 		vector<uint32_t> mRTFrameCount;
 
-		// е
+		// 场景中的纹理数量
 		uint32_t mRTSceneTextureNum = 100;
-		// еCubeMap
+		// 场景中的CubeMap数量
 		uint32_t mRTSceneCubeMapNum = 10;
-		// еȾ
+		// 场景中的渲染对象数量
 		uint32_t mRTSceneRenderObjectNum = 100;
-		// ׷߳BufferС(6432λ)
+		// 光追管线常量Buffer大小(64个32位数据)
 		uint32_t mRTPipelineConstantBufferSize = 256;
 
-		// ǩиеƫ
+		// 根签名中各参数在描述符堆中的偏移量
 		// register(t0, space0) TLAS
 		const uint32_t mRTRootParamOffsetInDescriptorHeapTLAS = 0;
-		// register(u0, space0) ͼ
+		// register(u0, space0) 输出图像
 		const uint32_t mRTRootParamOffsetInDescriptorHeapOutputImage = 1;
-		// register(t0, space1) Buffer
+		// register(t0, space1) 顶点索引Buffer
 		const uint32_t mRTRootParamOffsetInDescriptorHeapIndexBuffer = 3;
-		// register(t0, space2) Buffer
+		// register(t0, space2) 顶点Buffer
 		const uint32_t mRTRootParamOffsetInDescriptorHeapVertexBuffer = mRTRootParamOffsetInDescriptorHeapIndexBuffer + mRTSceneRenderObjectNum;
-		// register(t0, space3) Buffer
+		// register(t0, space3) 材质数据Buffer
 		const uint32_t mRTRootParamOffsetInDescriptorHeapMaterialData = mRTRootParamOffsetInDescriptorHeapVertexBuffer + mRTSceneRenderObjectNum;
-		// register(t0, space4) 2D
+		// register(t0, space4) 2D纹理数组
 		const uint32_t mRTRootParamOffsetInDescriptorHeapTexture2DArray = mRTRootParamOffsetInDescriptorHeapMaterialData + mRTSceneRenderObjectNum;
-		// register(t0, space5) CubeMap
+		// register(t0, space5) CubeMap纹理数组
 		const uint32_t mRTRootParamOffsetInDescriptorHeapTextureCubeArray = mRTRootParamOffsetInDescriptorHeapTexture2DArray + mRTSceneTextureNum;
-		// register(b0, space0) Buffer (Vulkan PushConstants)
+		// register(b0, space0) 常量Buffer (Vulkan PushConstants)
 		const uint32_t mRTRootParamOffsetInDescriptorHeapConstantBuffer = 2;
-		// ܴС
+		// 描述符堆总大小
 		const uint32_t mRTRootParamOffsetInDescriptorHeapSize = 3 + mRTSceneTextureNum + mRTSceneCubeMapNum + mRTSceneRenderObjectNum * 3;
 
-		// ǰһ֡ҪƵĶϢ
+		// 当前这一帧要绘制的对象信息数组
 		vector<ZXD3D12ASInstanceData> mASInstanceData;
-		// ǰ
+		// 当前场景中所有纹理索引数组
 		vector<uint32_t> mCurRTSceneTextureIndexes;
-		// ǰ±ӳ
+		// 当前场景中所有纹理的索引与纹理数组下标的映射表
 		unordered_map<uint32_t, uint32_t> mCurRTSceneTextureIndexMap;
-		// ǰCubeMap
+		// 当前场景中所有CubeMap索引数组
 		vector<uint32_t> mCurRTSceneCubeMapIndexes;
-		// ǰCubeMapCubeMap±ӳ
+		// 当前场景中所有CubeMap的索引与CubeMap数组下标的映射表
 		unordered_map<uint32_t, uint32_t> mCurRTSceneCubeMapIndexMap;
-		// ǰй׷
+		// 当前场景中所有光追材质索引数组
 		vector<uint32_t> mCurRTSceneRTMaterialDatas;
-		// ǰй׷ʵ׷±ӳ
+		// 当前场景中所有光追材质的索引与光追材质数组下标的映射表
 		unordered_map<uint32_t, uint32_t> mCurRTSceneRTMaterialDataMap;
 
-		// TLAS GroupһһTLAS Group
+		// TLAS Group，一个场景有一个TLAS Group
 		vector<ZXD3D12ASGroup*> mTLASGroupArray;
-		// еĹ׷飬пܰٵģδڳе
+		// 所有的光追材质数组，其中可能包括已销毁的，未在场景中的
 		vector<ZXD3D12RTMaterialData*> mRTMaterialDataArray;
-		// ׼ٵĹ׷
+		// 准备销毁的光追材质
 		unordered_map<uint32_t, uint32_t> rtMaterialDatasToDelete;
 
 		ComPtr<ID3D12RootSignature> mEmptyLocalRootSignature;
 		ComPtr<ID3D12RootSignature> mEmptyGlobalRootSignature;
 
-		// ʼȫֵĹ׷Դ
+		// 初始化全局的光追相关资源
 		void InitDXR();
 		void InitEmptyRootSignature();
 
@@ -309,7 +321,7 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// ӿ
+		/// 其它辅助接口
 		/// </summary>
 	private:
 		bool mWindowResized = false;
@@ -45,7 +45,7 @@ namespace ZXEngine
 			return;
 		}
 
-		// ȡǰOpenGL汾
+		// 获取当前OpenGL版本并输出
 		int majorVersion;
 		int minorVersion;
 		glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
@@ -100,7 +100,7 @@ namespace ZXEngine
 
 	void RenderAPIOpenGL::WaitForRenderFinish()
 	{
-		// OpenGLΪǵ̵߳ģͬģԲҪʵӿ
+		// OpenGL的所有行为都是单线程的，同步的，所以不需要实现这个接口
 	}
 
 	void RenderAPIOpenGL::SwitchFrameBuffer(uint32_t id)
@@ -158,7 +158,7 @@ namespace ZXEngine
 			curRealState->clearDepth = depth;
 			stateDirty = true;
 		}
-		// Clear Depth֮ǰ뿪ȲԺд
+		// Clear Depth之前必须开启深度测试和写入
 		if (!curRealState->depthTest)
 		{
 			glEnable(GL_DEPTH_TEST);
@@ -297,7 +297,7 @@ namespace ZXEngine
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE); // ĵᣬͨzΪcubemap3D
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE); // 纹理的第三个轴，类似普通点坐标的z，因为cubemap是3D的纹理
 		
 		CheckError();
 
@@ -353,7 +353,7 @@ namespace ZXEngine
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE); // ĵᣬͨzΪcubemap3D
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE); // 纹理的第三个轴，类似普通点坐标的z，因为cubemap是3D的纹理
 
 		CheckError();
 
@@ -362,13 +362,13 @@ namespace ZXEngine
 
 	unsigned int RenderAPIOpenGL::GenerateTextTexture(unsigned int width, unsigned int height, unsigned char* data)
 	{
-		// ͨɵλͼһ8λҶͼÿһɫһֽʾҪλͼÿһֽڶΪɫֵ
-		// ÿһֽڶӦɫĺɫ(ɫĵһֽ)ʹһֽʾɫ
-		// OpenGLĬе4ֽڶģĴСԶ4ֽڵıΪ󲿷ĿȶΪ4ı/ÿʹ4ֽڡ
-		// ÿֻһֽڣĿȣҪѹΪ1ȷж⡣
+		// 通过字形生成的位图是一个8位灰度图，它的每一个颜色都由一个字节来表示。因此我们需要将位图缓冲的每一字节都作为纹理的颜色值。
+		// 这个纹理的每一字节都对应着纹理颜色的红色分量(颜色向量的第一个字节)，即我们使用一个字节来表示纹理的颜色。
+		// 但是OpenGL默认所有的纹理都是4字节对齐的，即纹理的大小永远是4字节的倍数，因为大部分纹理的宽度都为4的倍数并/或每像素使用4个字节。
+		// 但是现在我们每个像素只用了一个字节，它可以是任意的宽度，所以需要将纹理解压对齐参数设为1，这样才能确保不会有对齐问题。
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-		// 
+		// 配置纹理
 		unsigned int textureID;
 		glGenTextures(1, &textureID);
 		glBindTexture(GL_TEXTURE_2D, textureID);
@@ -378,7 +378,7 @@ namespace ZXEngine
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-		// ԭĬ
+		// 还原默认设置
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
 		CheckError();
@@ -473,7 +473,7 @@ namespace ZXEngine
 
 	void RenderAPIOpenGL::SetUpMaterial(Material* material)
 	{
-		// ò
+		// 设置材质数据
 		for (auto& property : material->data->vec2Datas)
 			SetShaderVector(material, property.first, property.second, true);
 		for (auto& property : material->data->vec3Datas)
@@ -550,28 +550,28 @@ namespace ZXEngine
 		{
 			unsigned int FBO_ID;
 			glGenFramebuffers(1, &FBO_ID);
-			// ColorBuffer
+			// 创建ColorBuffer
 			unsigned int colorBuffer;
 			glGenTextures(1, &colorBuffer);
 			glBindTexture(GL_TEXTURE_2D, colorBuffer);
 			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			// DepthBuffer
-			// (õRenderbufferTextureRenderbufferһڲȡֻд߸ƵbufferȻʺRenderbuffer)
+			// 创建DepthBuffer
+			// (用的Renderbuffer而不是Texture，Renderbuffer一般用于不读取，只写入或者复制的buffer，所以深度缓冲区更适合用Renderbuffer)
 			unsigned int depthBuffer;
 			glGenRenderbuffers(1, &depthBuffer);
 			glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
 			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-			// ColorBufferDepthBuffer󶨵FBO
+			// 把ColorBuffer和DepthBuffer绑定到FBO上
 			glBindFramebuffer(GL_FRAMEBUFFER, FBO_ID);
 			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorBuffer, 0);
 			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
 			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 				Debug::LogError("Framebuffer Normal not complete!");
-			// ָĬ״̬
+			// 恢复默认状态
 			glBindFramebuffer(GL_FRAMEBUFFER, 0);
-			// FBOֵ
+			// 对FBO对象赋值
 			FBO->ID = FBO_ID;
 			FBO->ColorBuffer = colorBuffer;
 			FBO->DepthBuffer = depthBuffer;
@@ -580,28 +580,28 @@ namespace ZXEngine
 		{
 			unsigned int FBO_ID;
 			glGenFramebuffers(1, &FBO_ID);
-			// ߾()ColorBuffer
+			// 创建高精度(浮点)ColorBuffer
 			unsigned int colorBuffer;
 			glGenTextures(1, &colorBuffer);
 			glBindTexture(GL_TEXTURE_2D, colorBuffer);
 			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_FLOAT, NULL);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			// DepthBuffer
-			// (õRenderbufferTextureRenderbufferһڲȡֻд߸ƵbufferȻʺRenderbuffer)
+			// 创建DepthBuffer
+			// (用的Renderbuffer而不是Texture，Renderbuffer一般用于不读取，只写入或者复制的buffer，所以深度缓冲区更适合用Renderbuffer)
 			unsigned int depthBuffer;
 			glGenRenderbuffers(1, &depthBuffer);
 			glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
 			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-			// ColorBufferDepthBuffer󶨵FBO
+			// 把ColorBuffer和DepthBuffer绑定到FBO上
 			glBindFramebuffer(GL_FRAMEBUFFER, FBO_ID);
 			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorBuffer, 0);
 			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
 			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 				Debug::LogError("Framebuffer HigthPrecision not complete!");
-			// ָĬ״̬
+			// 恢复默认状态
 			glBindFramebuffer(GL_FRAMEBUFFER, 0);
-			// FBOֵ
+			// 对FBO对象赋值
 			FBO->ID = FBO_ID;
 			FBO->ColorBuffer = colorBuffer;
 			FBO->DepthBuffer = depthBuffer;
@@ -610,21 +610,21 @@ namespace ZXEngine
 		{
 			unsigned int FBO_ID;
 			glGenFramebuffers(1, &FBO_ID);
-			// ColorBuffer
+			// 创建ColorBuffer
 			unsigned int colorBuffer;
 			glGenTextures(1, &colorBuffer);
 			glBindTexture(GL_TEXTURE_2D, colorBuffer);
 			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			// ColorBuffer󶨵FBO
+			// 把ColorBuffer绑定到FBO上
 			glBindFramebuffer(GL_FRAMEBUFFER, FBO_ID);
 			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorBuffer, 0);
 			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 				Debug::LogError("Framebuffer Color not complete!");
-			// ָĬ״̬
+			// 恢复默认状态
 			glBindFramebuffer(GL_FRAMEBUFFER, 0);
-			// FBOֵ
+			// 对FBO对象赋值
 			FBO->ID = FBO_ID;
 			FBO->ColorBuffer = colorBuffer;
 			FBO->DepthBuffer = UINT32_MAX;
@@ -633,7 +633,7 @@ namespace ZXEngine
 		{
 			unsigned int FBO_ID;
 			glGenFramebuffers(1, &FBO_ID);
-			// Map
+			// 创建深度Map
 			unsigned int depthMap;
 			glGenTextures(1, &depthMap);
 			glBindTexture(GL_TEXTURE_2D, depthMap);
@@ -644,17 +644,17 @@ namespace ZXEngine
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
 			float borderColor[] = { 1.0, 1.0, 1.0, 1.0 };
 			glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
-			// Map󶨵FBO
+			// 把深度Map绑定到FBO
 			glBindFramebuffer(GL_FRAMEBUFFER, FBO_ID);
 			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthMap, 0);
-			// ȷOpenGLFBOȾColor Buffer
+			// 明确告诉OpenGL这个FBO不会渲染到Color Buffer
 			glDrawBuffer(GL_NONE);
 			glReadBuffer(GL_NONE);
 			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 				Debug::LogError("Framebuffer ShadowMap not complete!");
-			// ָĬ״̬
+			// 恢复默认状态
 			glBindFramebuffer(GL_FRAMEBUFFER, 0);
-			// FBOֵ
+			// 对FBO对象赋值
 			FBO->ID = FBO_ID;
 			FBO->ColorBuffer = UINT32_MAX;
 			FBO->DepthBuffer = depthMap;
@@ -663,7 +663,7 @@ namespace ZXEngine
 		{
 			unsigned int FBO_ID;
 			glGenFramebuffers(1, &FBO_ID);
-			// CubeMap
+			// 创建深度CubeMap
 			unsigned int depthCubeMap;
 			glGenTextures(1, &depthCubeMap);
 			glBindTexture(GL_TEXTURE_CUBE_MAP, depthCubeMap);
@@ -674,24 +674,24 @@ namespace ZXEngine
 			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-			// CubeMap󶨵FBO
+			// 把深度CubeMap绑定到FBO
 			glBindFramebuffer(GL_FRAMEBUFFER, FBO_ID);
 			glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, depthCubeMap, 0);
-			// ȷOpenGLFBOȾColor Buffer
+			// 明确告诉OpenGL这个FBO不会渲染到Color Buffer
 			glDrawBuffer(GL_NONE);
 			glReadBuffer(GL_NONE);
 			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 				Debug::LogError("Framebuffer ShadowCubeMap not complete!");
-			// ָĬ״̬
+			// 恢复默认状态
 			glBindFramebuffer(GL_FRAMEBUFFER, 0);
-			// FBOֵ
+			// 对FBO对象赋值
 			FBO->ID = FBO_ID;
 			FBO->ColorBuffer = UINT32_MAX;
 			FBO->DepthBuffer = depthCubeMap;
 		}
 		else if (type == FrameBufferType::RayTracing)
 		{
-			// OpenGLֹ֧׷
+			// OpenGL不支持光线追踪
 		}
 		else
 		{
@@ -759,7 +759,7 @@ namespace ZXEngine
 
 	uint32_t RenderAPIOpenGL::AllocateDrawCommand(CommandType commandType)
 	{
-		// OpenGLҪӿ
+		// OpenGL不需要这个接口
 		return 0;
 	}
 
@@ -777,7 +777,66 @@ namespace ZXEngine
 		else
 			glDrawArrays(GL_TRIANGLES, 0, meshBuffer->size);
 
-		// һ(ҲУʱñ)
+		// 绘制完重置一下(不重置也行，不过及时重置避免出问题)
+		glBindVertexArray(0);
+
+		CheckError();
+#ifdef ZX_DEBUG
+		Debug::drawCallCount++;
+#endif
+	}
+
+	void RenderAPIOpenGL::Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer)
+	{
+		UpdateRenderState();
+		UpdateMaterialData();
+
+		auto meshBuffer = GetVAOByIndex(VAO);
+		auto instanceData = GetInstanceBufferByIndex(instanceBuffer);
+
+		glBindVertexArray(meshBuffer->VAO);
+
+		// 逐实例的模型矩阵按列占用4个location，每绘制一个实例前进一次
+		glBindBuffer(GL_ARRAY_BUFFER, instanceData->VBO);
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			glEnableVertexAttribArray(INSTANCE_MODEL_LOCATION + i);
+			glVertexAttribPointer(INSTANCE_MODEL_LOCATION + i, 4, GL_FLOAT, GL_FALSE, 16 * sizeof(float), (void*)(i * 4 * sizeof(float)));
+			glVertexAttribDivisor(INSTANCE_MODEL_LOCATION + i, 1);
+		}
+
+		if (meshBuffer->indexed)
+			glDrawElementsInstanced(GL_TRIANGLES, meshBuffer->size, GL_UNSIGNED_INT, 0, instanceNum);
+		else
+			glDrawArraysInstanced(GL_TRIANGLES, 0, meshBuffer->size, instanceNum);
+
+		// 关掉逐实例属性，避免影响这个VAO之后的普通绘制
+		for (uint32_t i = 0; i < 4; i++)
+			glDisableVertexAttribArray(INSTANCE_MODEL_LOCATION + i);
+
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		CheckError();
+#ifdef ZX_DEBUG
+		Debug::drawCallCount++;
+#endif
+	}
+
+	void RenderAPIOpenGL::DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount)
+	{
+		UpdateRenderState();
+		UpdateMaterialData();
+
+		auto meshBuffer = GetVAOByIndex(VAO);
+
+		glBindVertexArray(meshBuffer->VAO);
+
+		if (meshBuffer->indexed)
+			glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void*)(indexOffset * sizeof(uint32_t)));
+		else
+			glDrawArrays(GL_TRIANGLES, indexOffset, indexCount);
+
 		glBindVertexArray(0);
 
 		CheckError();
@@ -788,7 +847,52 @@ namespace ZXEngine
 
 	void RenderAPIOpenGL::GenerateDrawCommand(uint32_t id)
 	{
-		// OpenGLҪӿ
+		// OpenGL不需要这个接口
+	}
+
+	uint32_t RenderAPIOpenGL::CreateInstanceBuffer(uint32_t instanceNum)
+	{
+		uint32_t id = GetNextInstanceBufferIndex();
+		auto instanceBuffer = GetInstanceBufferByIndex(id);
+		instanceBuffer->size = instanceNum;
+
+		glGenBuffers(1, &instanceBuffer->VBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer->VBO);
+		glBufferData(GL_ARRAY_BUFFER, instanceNum * 16 * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		instanceBuffer->inUse = true;
+
+		CheckError();
+		return id;
+	}
+
+	void RenderAPIOpenGL::UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum)
+	{
+		auto instanceBuffer = GetInstanceBufferByIndex(id);
+		instanceNum = Math::Min(instanceNum, instanceBuffer->size);
+
+		// Matrix4是行主序存储的，GLSL的mat4输入是按列读取的，所以要先转成列主序
+		instanceDataCache.resize(instanceNum * 16);
+		for (uint32_t i = 0; i < instanceNum; i++)
+			data[i].ToColumnMajorArray(instanceDataCache.data() + i * 16);
+
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer->VBO);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, instanceNum * 16 * sizeof(float), instanceDataCache.data());
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		CheckError();
+	}
+
+	void RenderAPIOpenGL::DeleteInstanceBuffer(uint32_t id)
+	{
+		auto instanceBuffer = GetInstanceBufferByIndex(id);
+
+		glDeleteBuffers(1, &instanceBuffer->VBO);
+
+		instanceBuffer->inUse = false;
+
+		CheckError();
 	}
 
 	void RenderAPIOpenGL::DeleteMesh(unsigned int VAO)
@@ -847,7 +951,7 @@ namespace ZXEngine
 		glEnableVertexAttribArray(5);
 		glVertexAttribIPointer(5, 4, GL_UNSIGNED_INT, sizeof(Vertex), (void*)offsetof(Vertex, BoneIDs));
 
-		// ǵûԭһ
+		// 设置完记得还原一下
 		glBindVertexArray(0);
 
 		meshBuffer->inUse = true;
@@ -868,7 +972,7 @@ namespace ZXEngine
 
 		glBindVertexArray(meshBuffer->VAO);
 		glBindBuffer(GL_ARRAY_BUFFER, meshBuffer->VBO);
-		// ΪGL_DYNAMIC_DRAWʱʼݣͨUpdateDynamicMesh
+		// 设置为GL_DYNAMIC_DRAW，这里暂时不初始化数据，后面通过UpdateDynamicMesh更新数据
 		glBufferData(GL_ARRAY_BUFFER, vertexSize * sizeof(Vertex), NULL, GL_DYNAMIC_DRAW);
 
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshBuffer->EBO);
@@ -898,18 +1002,18 @@ namespace ZXEngine
 	{
 		auto meshBuffer = GetVAOByIndex(VAO);
 
-		// лָVAO
+		// 切换到指定VAO
 		glBindVertexArray(meshBuffer->VAO);
 
-		// VBO
+		// 更新VBO数据
 		glBindBuffer(GL_ARRAY_BUFFER, meshBuffer->VBO);
 		glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), &vertices[0]);
 
-		// EBO
+		// 更新EBO数据
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshBuffer->EBO);
 		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indices.size() * sizeof(unsigned int), &indices[0]);
 
-		// ԭ
+		// 还原
 		glBindVertexArray(0);
 
 		CheckError();
@@ -1304,7 +1408,7 @@ namespace ZXEngine
 			RealSetShaderMatrix(iter.first, iter.second.first, iter.second.second);
 		}
 
-		// OpenGLglActiveTextureglBindTextureȫֲӰShaderҪÿζһ
+		// OpenGL里glActiveTexture和glBindTexture是全局操作，会影响所有Shader，所以这里需要每次都做一下
 		for (auto& iter : materialData->textures)
 			RealSetShaderTexture(iter.first, iter.second[0], iter.second[1]);
 		for (auto& iter : materialData->cubeMaps)
@@ -1350,4 +1454,24 @@ namespace ZXEngine
 	{
 		return OpenGLMaterialDataArray[idx];
 	}
+
+	uint32_t RenderAPIOpenGL::GetNextInstanceBufferIndex()
+	{
+		uint32_t length = (uint32_t)OpenGLInstanceBufferArray.size();
+
+		for (uint32_t i = 0; i < length; i++)
+		{
+			if (!OpenGLInstanceBufferArray[i]->inUse)
+				return i;
+		}
+
+		OpenGLInstanceBufferArray.push_back(new OpenGLInstanceBuffer());
+
+		return length;
+	}
+
+	OpenGLInstanceBuffer* RenderAPIOpenGL::GetInstanceBufferByIndex(uint32_t idx)
+	{
+		return OpenGLInstanceBufferArray[idx];
+	}
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace ZXEngine
 	class RenderAPIOpenGL : public RenderAPI
 	{
 		/// <summary>
-		/// ׼RenderAPIӿ
+		/// 标准RenderAPI接口
 		/// </summary>
 	public:
 		RenderAPIOpenGL();
@@ -18,7 +18,7 @@ namespace ZXEngine
 		virtual void BeginFrame();
 		virtual void EndFrame();
 
-		// Ⱦ״̬
+		// 渲染状态
 		virtual void OnWindowSizeChange(uint32_t width, uint32_t height);
 		virtual void SetRenderState(RenderStateSetting* state);
 		virtual void SetViewPort(unsigned int width, unsigned int height, unsigned int xOffset = 0, unsigned int yOffset = 0);
@@ -31,7 +31,7 @@ namespace ZXEngine
 		virtual FrameBufferObject* CreateFrameBufferObject(FrameBufferType type, const ClearInfo& clearInfo, unsigned int width = 0, unsigned int height = 0);
 		virtual void DeleteFrameBufferObject(FrameBufferObject* FBO);
 
-		// 
+		// 纹理
 		virtual unsigned int LoadTexture(const char* path, int& width, int& height);
 		virtual unsigned int LoadCubeMap(const vector<string>& faces);
 		virtual unsigned int CreateTexture(TextureFullData* data);
@@ -44,7 +44,7 @@ namespace ZXEngine
 		virtual ShaderReference* SetUpShader(const string& path, const string& shaderCode, FrameBufferType type);
 		virtual void DeleteShader(uint32_t id);
 
-		// 
+		// 材质
 		virtual uint32_t CreateMaterialData();
 		virtual void SetUpMaterial(Material* material);
 		virtual void UseMaterialData(uint32_t ID);
@@ -53,8 +53,15 @@ namespace ZXEngine
 		// Draw
 		virtual uint32_t AllocateDrawCommand(CommandType commandType);
 		virtual void Draw(uint32_t VAO);
+		virtual void Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer);
+		virtual void DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount);
 		virtual void GenerateDrawCommand(uint32_t id);
 
+		// Instance Buffer
+		virtual uint32_t CreateInstanceBuffer(uint32_t instanceNum);
+		virtual void UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum);
+		virtual void DeleteInstanceBuffer(uint32_t id);
+
 		// Mesh
 		virtual void DeleteMesh(unsigned int VAO);
 		virtual void SetUpStaticMesh(unsigned int& VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices);
@@ -62,7 +69,7 @@ namespace ZXEngine
 		virtual void UpdateDynamicMesh(unsigned int VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices);
 		virtual void GenerateParticleMesh(unsigned int& VAO);
 
-		// Shader
+		// Shader参数
 		virtual void UseShader(unsigned int ID);
 		virtual void SetShaderScalar(Material* material, const string& name, bool value, bool allBuffer = false);
 		virtual void SetShaderScalar(Material* material, const string& name, float value, bool allBuffer = false);
@@ -85,7 +92,7 @@ namespace ZXEngine
 
 		
 		/// <summary>
-		/// ׼RayTracingӿ(OpenGLֹ֧׷)
+		/// 标准RayTracing接口(OpenGL不支持光线追踪)
 		/// </summary>
 	public:
 		// Pipeline
@@ -97,7 +104,7 @@ namespace ZXEngine
 		virtual void SetUpRayTracingMaterialData(Material* material) {};
 		virtual void DeleteRayTracingMaterialData(uint32_t id) {};
 
-		// ݸ
+		// 数据更新
 		virtual void SetRayTracingSkyBox(uint32_t textureID) {};
 		virtual void PushRayTracingMaterialData(Material* material) {};
 		virtual void PushAccelerationStructure(uint32_t VAO, uint32_t hitGroupIdx, uint32_t rtMaterialDataID, const Matrix4& transform) {};
@@ -111,7 +118,7 @@ namespace ZXEngine
 
 
 		/// <summary>
-		/// ʵֱ׼RenderAPIӿڵڲӿ
+		/// 实现标准RenderAPI接口的内部接口与变量
 		/// </summary>
 	private:
 		bool stateDirty = false;
@@ -123,6 +130,9 @@ namespace ZXEngine
 
 		vector<OpenGLVAO*> OpenGLVAOArray;
 		vector<OpenGLMaterialData*> OpenGLMaterialDataArray;
+		vector<OpenGLInstanceBuffer*> OpenGLInstanceBufferArray;
+		// 上传逐实例数据时转换成列主序用的缓存
+		vector<float> instanceDataCache;
 		unordered_map<uint32_t, OpenGLMaterialData*> materialDataInShaders;
 		unordered_map<uint32_t, ClearInfo> FBOClearInfoMap;
 
@@ -130,6 +140,8 @@ namespace ZXEngine
 		OpenGLVAO* GetVAOByIndex(uint32_t idx);
 		uint32_t GetNextMaterialDataIndex();
 		OpenGLMaterialData* GetMaterialDataByIndex(uint32_t idx);
+		uint32_t GetNextInstanceBufferIndex();
+		OpenGLInstanceBuffer* GetInstanceBufferByIndex(uint32_t idx);
 
 		void CheckError();
 		void RealCheckError();
@@ -16,8 +16,8 @@
 #endif
 
 
-// VMAĹٷĵ˵ҪһCPPļﶨ궨壬ܻ쳣
-// :https://gpuopen-librariesandsdks.github.io/VulkanMemoryAllocator/html/quick_start.html#quick_start_project_setup
+// VMA的官方文档里说需要在一个CPP文件里定义这个宏定义，否则可能会有异常
+// 见:https://gpuopen-librariesandsdks.github.io/VulkanMemoryAllocator/html/quick_start.html#quick_start_project_setup
 #define VMA_IMPLEMENTATION
 #include "vk_mem_alloc.h"
 
@@ -61,18 +61,18 @@ namespace ZXEngine
         { FrameBufferType::ShadowMap, RenderPassType::ShadowMap },
     };
 
-    // ԶDebugصVKAPI_ATTRVKAPI_CALLȷȷĺǩӶVulkan
+    // 自定义的Debug回调函数，VKAPI_ATTR和VKAPI_CALL确保了正确的函数签名，从而被Vulkan调用
     static VKAPI_ATTR VkBool32 VKAPI_CALL VkDebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageType, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void* pUserData)
     {
         std::cerr << pCallbackData->pMessage << std::endl;
 
-        // Errorж
+        // 如果是Error，立刻中断
         if (messageSeverity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) 
             std::abort();
 
-        // һֵvalidation layerϢVulkanǷӦֹ
-        // trueýVK_ERROR_VALIDATION_FAILED_EXTֹ
-        // ͨڲvalidation layersǷVK_FALSE
+        // 返回一个布尔值，表明触发validation layer消息的Vulkan调用是否应被中止
+        // 如果返回true，则调用将以VK_ERROR_VALIDATION_FAILED_EXT错误中止
+        // 这通常用于测试validation layers本身，所以我们总是返回VK_FALSE
         return VK_FALSE;
     }
 
@@ -105,13 +105,13 @@ namespace ZXEngine
         if (vkWaitForFences(device, 1, &inFlightFences[currentFrame], VK_TRUE, UINT64_MAX) != VK_SUCCESS)
 			throw std::runtime_error("Failed to wait for fence!");
 
-        // ǷҪжصԴж
-        // ʱȽϹؼΪԴCommandBufferˣôԴCommandBuffer have completed execution֮ſж
-        // дڸոWaitForFence֮󣬿Ա֤CommandBufferʱ״̬have completed executionҪ
+        // 检查是否有需要卸载的资源，并进行卸载
+        // 这个函数调用时机比较关键，因为如果有资源被CommandBuffer引用了，那么必须在引用资源的CommandBuffer have completed execution之后才可以卸载
+        // 这里写在刚刚WaitForFence之后，可以保证CommandBuffer此时的状态是满足have completed execution要求的
         CheckDeleteData();
 
         VkResult result = vkAcquireNextImageKHR(device, swapChain, UINT64_MAX, presentImageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, &curPresentImageIdx);
-        // SurfaceѾˣܼˣһǴڴС仯µ
+        // 交换链和Surface已经不兼容了，不能继续用了，一般是窗口大小变化导致的
         if (result == VK_ERROR_OUT_OF_DATE_KHR)
             RecreateSwapChain();
         else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
@@ -133,8 +133,8 @@ namespace ZXEngine
         presentInfo.pResults = VK_NULL_HANDLE;
         
         VkResult result = vkQueuePresentKHR(presentQueue, &presentInfo);
-        // VK_ERROR_OUT_OF_DATE_KHRʾSurfaceѾˣܼˣ´
-        // VK_SUBOPTIMAL_KHRʾǿԼãǺSurfaceĳЩƥòǺܺã´Ҳ
+        // VK_ERROR_OUT_OF_DATE_KHR表示交换链和Surface已经不兼容了，不能继续用了，必须重新创建交换链
+        // VK_SUBOPTIMAL_KHR表示交换链还是可以继续用，但是和Surface的某些属性匹配得不是很好，不重新创建也行
         if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || windowResized) 
             RecreateSwapChain();
         else if (result != VK_SUCCESS)
@@ -153,7 +153,7 @@ namespace ZXEngine
 
     void RenderAPIVulkan::SetRenderState(RenderStateSetting* state)
     {
-        // VulkanҪʵӿ
+        // Vulkan不需要实现这个接口
     }
 
     void RenderAPIVulkan::WaitForRenderFinish()
@@ -175,7 +175,7 @@ namespace ZXEngine
         viewPortInfo.height = height;
         viewPortInfo.xOffset = xOffset;
 
-        // Ĳǰ0½ǵı׼ģVulkan0Ͻǣƫ(༭ģʽ)ĻYƫҪ¼һ
+        // 传入的参数是按0点在左下角的标准来的，Vulkan的0点在左上角，如果有偏移(编辑器模式)的话，Y轴偏移量要重新计算一下
         if (xOffset == 0 && yOffset == 0)
             viewPortInfo.yOffset = yOffset;
         else
@@ -184,8 +184,8 @@ namespace ZXEngine
 
     void RenderAPIVulkan::ClearFrameBuffer()
     {
-        // ʵһClear Frame BufferVulkan汾ʵûеãΪVulkanClearǲ̫õ
-        // ܸõBeginRenderPassУFrameBufferʱȥClearClearˣӿֻΪ˼OpenGL
+        // 这里实现了一个立刻Clear Frame Buffer的Vulkan版本，但是实际没有调用，因为在Vulkan里这样Clear是不太好的
+        // 性能更好的做法是在BeginRenderPass中，加载FrameBuffer的时候去Clear，所以这里就无需Clear了，这个接口只是为了兼容OpenGL
 
         /*
         ImmediatelyExecute([=](VkCommandBuffer cmd)
@@ -256,9 +256,9 @@ namespace ZXEngine
         VkDeviceSize imageSize = VkDeviceSize(width * height * 4);
         VulkanBuffer stagingBuffer = CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true);
 
-        // ݿstagingBuffer
+        // 把数据拷贝到stagingBuffer
         void* data;
-        void* pixelsPtr = pixels; // Ϊmemcpyתһָ
+        void* pixelsPtr = pixels; // 为memcpy转换一下指针类型
         vmaMapMemory(vmaAllocator, stagingBuffer.allocation, &data);
         memcpy(data, pixelsPtr, static_cast<size_t>(imageSize));
         vmaUnmapMemory(vmaAllocator, stagingBuffer.allocation);
@@ -269,38 +269,38 @@ namespace ZXEngine
 
         VulkanImage image = CreateImage(width, height, mipLevels, 1, VK_SAMPLE_COUNT_1_BIT,
             defaultImageFormat, VK_IMAGE_TILING_OPTIMAL,
-            // ҪһstagingBufferݣҪдһVK_IMAGE_USAGE_TRANSFER_DST_BIT
-            // ΪҪmipmapҪԭimageݣټһVK_IMAGE_USAGE_TRANSFER_SRC_BIT
-            // ȻдһVK_IMAGE_USAGE_SAMPLED_BITʾshader
+            // 这里我们要从一个stagingBuffer接收数据，所以要写一个VK_IMAGE_USAGE_TRANSFER_DST_BIT
+            // 又因为我们要生成mipmap，需要从这个原image读数据，所以又再加一个VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+            // 然后再写一个VK_IMAGE_USAGE_SAMPLED_BIT表示会用于shader代码采样纹理
             VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
         TransitionImageLayout(image.image, 
-            // ӳʼLayoutתstagingBufferݵLayout
+            // 从初始的Layout转换到接收stagingBuffer数据的Layout
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 
-            // Ӳ̼صͼĬ϶Color
+            // 从硬盘加载的图像默认都是Color
             VK_IMAGE_ASPECT_COLOR_BIT,
-            // תֱӿʼû
+            // 转换可以直接开始，没有限制
             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
-            // ͼTransferдҪת֮
+            // 图像Transfer的写入操作需要在这个转换之后进行
             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
 
-        // ݴstagingBufferƵimage
+        // 把数据从stagingBuffer复制到image
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
             VkBufferImageCopy region{};
-            // bufferȡݵʼƫ
+            // 从buffer读取数据的起始偏移量
             region.bufferOffset = 0;
-            // ȷڴĲַʽֻǼ򵥵Ľݣ0
+            // 这两个参数明确像素在内存里的布局方式，如果我们只是简单的紧密排列数据，就填0
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
-            // 4Ҫݿimageһ
+            // 下面4个参数都是在设置我们要把数据拷贝到image的哪一部分
             region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             region.imageSubresource.mipLevel = 0;
             region.imageSubresource.baseArrayLayer = 0;
             region.imageSubresource.layerCount = 1;
-            // ҲҪͼ񿽱һ
-            // ͼƬoffsetȫ0extentֱͼ߿
+            // 这个也是在设置我们要把图像拷贝到哪一部分
+            // 如果是整张图片，offset就全是0，extent就直接是图像高宽
             region.imageOffset = { 0, 0, 0 };
             region.imageExtent = { (uint32_t)width, (uint32_t)height, 1 };
 
@@ -308,7 +308,7 @@ namespace ZXEngine
                 cmd,
                 stagingBuffer.buffer,
                 image.image,
-                // imageǰlayout
+                // image当前的layout
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 1, &region
             );
@@ -338,7 +338,7 @@ namespace ZXEngine
             VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-        // ͬLoadTexture
+        // 同LoadTexture
         TransitionImageLayout(image.image,
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             VK_IMAGE_ASPECT_COLOR_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
@@ -348,14 +348,14 @@ namespace ZXEngine
         for (uint32_t i = 0; i < 6; i++)
             stagingBuffers.push_back(CreateBuffer(singleImageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true));
         
-        // ݴstagingBufferƵimage
+        // 把数据从stagingBuffer复制到image
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
             for (uint32_t i = 0; i < 6; i++)
             {
-                // ݿstagingBuffer
+                // 把数据拷贝到stagingBuffer
                 void* data;
-                void* pixelsPtr = textureData[i]; // Ϊmemcpyתһָ
+                void* pixelsPtr = textureData[i]; // 为memcpy转换一下指针类型
                 vmaMapMemory(vmaAllocator, stagingBuffers[i].allocation, &data);
                 memcpy(data, pixelsPtr, static_cast<size_t>(singleImageSize));
                 vmaUnmapMemory(vmaAllocator, stagingBuffers[i].allocation);
@@ -363,12 +363,12 @@ namespace ZXEngine
                 stbi_image_free(textureData[i]);
 
                 VkBufferImageCopy bufferCopyRegion = {};
-                // bufferȡݵʼƫ
+                // 从buffer读取数据的起始偏移量
                 bufferCopyRegion.bufferOffset = 0;
-                // ȷڴĲַʽֻǼ򵥵Ľݣ0
+                // 这两个参数明确像素在内存里的布局方式，如果我们只是简单的紧密排列数据，就填0
                 bufferCopyRegion.bufferRowLength = 0;
                 bufferCopyRegion.bufferImageHeight = 0;
-                // 4Ҫݿimageһ
+                // 下面4个参数都是在设置我们要把数据拷贝到image的哪一部分
                 bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
                 bufferCopyRegion.imageSubresource.mipLevel = 0;
                 bufferCopyRegion.imageSubresource.baseArrayLayer = i;
@@ -379,7 +379,7 @@ namespace ZXEngine
                 vkCmdCopyBufferToImage(cmd,
                     stagingBuffers[i].buffer,
                     image.image,
-                    // imageǰlayout
+                    // image当前的layout
                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                     1, &bufferCopyRegion
                 );
@@ -406,9 +406,9 @@ namespace ZXEngine
         VkDeviceSize imageSize = VkDeviceSize(data->width * data->height * 4);
         VulkanBuffer stagingBuffer = CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true);
 
-        // ݿstagingBuffer
+        // 把数据拷贝到stagingBuffer
         void* pData;
-        void* pixelsPtr = data->data; // Ϊmemcpyתһָ
+        void* pixelsPtr = data->data; // 为memcpy转换一下指针类型
         vmaMapMemory(vmaAllocator, stagingBuffer.allocation, &pData);
         memcpy(pData, pixelsPtr, static_cast<size_t>(imageSize));
         vmaUnmapMemory(vmaAllocator, stagingBuffer.allocation);
@@ -417,38 +417,38 @@ namespace ZXEngine
 
         VulkanImage image = CreateImage(data->width, data->height, mipLevels, 1, VK_SAMPLE_COUNT_1_BIT,
             defaultImageFormat, VK_IMAGE_TILING_OPTIMAL,
-            // ҪһstagingBufferݣҪдһVK_IMAGE_USAGE_TRANSFER_DST_BIT
-            // ΪҪmipmapҪԭimageݣټһVK_IMAGE_USAGE_TRANSFER_SRC_BIT
-            // ȻдһVK_IMAGE_USAGE_SAMPLED_BITʾshader
+            // 这里我们要从一个stagingBuffer接收数据，所以要写一个VK_IMAGE_USAGE_TRANSFER_DST_BIT
+            // 又因为我们要生成mipmap，需要从这个原image读数据，所以又再加一个VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+            // 然后再写一个VK_IMAGE_USAGE_SAMPLED_BIT表示会用于shader代码采样纹理
             VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
         TransitionImageLayout(image.image,
-            // ӳʼLayoutתstagingBufferݵLayout
+            // 从初始的Layout转换到接收stagingBuffer数据的Layout
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            // Ӳ̼صͼĬ϶Color
+            // 从硬盘加载的图像默认都是Color
             VK_IMAGE_ASPECT_COLOR_BIT,
-            // תֱӿʼû
+            // 转换可以直接开始，没有限制
             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
-            // ͼTransferдҪת֮
+            // 图像Transfer的写入操作需要在这个转换之后进行
             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
 
-        // ݴstagingBufferƵimage
+        // 把数据从stagingBuffer复制到image
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
             VkBufferImageCopy region{};
-            // bufferȡݵʼƫ
+            // 从buffer读取数据的起始偏移量
             region.bufferOffset = 0;
-            // ȷڴĲַʽֻǼ򵥵Ľݣ0
+            // 这两个参数明确像素在内存里的布局方式，如果我们只是简单的紧密排列数据，就填0
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
-            // 4Ҫݿimageһ
+            // 下面4个参数都是在设置我们要把数据拷贝到image的哪一部分
             region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             region.imageSubresource.mipLevel = 0;
             region.imageSubresource.baseArrayLayer = 0;
             region.imageSubresource.layerCount = 1;
-            // ҲҪͼ񿽱һ
-            // ͼƬoffsetȫ0extentֱͼ߿
+            // 这个也是在设置我们要把图像拷贝到哪一部分
+            // 如果是整张图片，offset就全是0，extent就直接是图像高宽
             region.imageOffset = { 0, 0, 0 };
             region.imageExtent = { (uint32_t)data->width, (uint32_t)data->height, 1 };
 
@@ -456,7 +456,7 @@ namespace ZXEngine
                 cmd,
                 stagingBuffer.buffer,
                 image.image,
-                // imageǰlayout
+                // image当前的layout
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 1, &region
             );
@@ -481,7 +481,7 @@ namespace ZXEngine
             VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-        // ͬLoadTexture
+        // 同LoadTexture
         TransitionImageLayout(image.image,
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             VK_IMAGE_ASPECT_COLOR_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
@@ -491,25 +491,25 @@ namespace ZXEngine
         for (uint32_t i = 0; i < 6; i++)
             stagingBuffers.push_back(CreateBuffer(singleImageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true));
 
-        // ݴstagingBufferƵimage
+        // 把数据从stagingBuffer复制到image
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
             for (uint32_t i = 0; i < 6; i++)
             {
-                // ݿstagingBuffer
+                // 把数据拷贝到stagingBuffer
                 void* pData;
-                void* pixelsPtr = data->data[i]; // Ϊmemcpyתһָ
+                void* pixelsPtr = data->data[i]; // 为memcpy转换一下指针类型
                 vmaMapMemory(vmaAllocator, stagingBuffers[i].allocation, &pData);
                 memcpy(pData, pixelsPtr, static_cast<size_t>(singleImageSize));
                 vmaUnmapMemory(vmaAllocator, stagingBuffers[i].allocation);
 
                 VkBufferImageCopy bufferCopyRegion = {};
-                // bufferȡݵʼƫ
+                // 从buffer读取数据的起始偏移量
                 bufferCopyRegion.bufferOffset = 0;
-                // ȷڴĲַʽֻǼ򵥵Ľݣ0
+                // 这两个参数明确像素在内存里的布局方式，如果我们只是简单的紧密排列数据，就填0
                 bufferCopyRegion.bufferRowLength = 0;
                 bufferCopyRegion.bufferImageHeight = 0;
-                // 4Ҫݿimageһ
+                // 下面4个参数都是在设置我们要把数据拷贝到image的哪一部分
                 bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
                 bufferCopyRegion.imageSubresource.mipLevel = 0;
                 bufferCopyRegion.imageSubresource.baseArrayLayer = i;
@@ -520,7 +520,7 @@ namespace ZXEngine
                 vkCmdCopyBufferToImage(cmd,
                     stagingBuffers[i].buffer,
                     image.image,
-                    // imageǰlayout
+                    // image当前的layout
                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                     1, &bufferCopyRegion
                 );
@@ -544,13 +544,13 @@ namespace ZXEngine
 
     unsigned int RenderAPIVulkan::GenerateTextTexture(unsigned int width, unsigned int height, unsigned char* data)
     {
-        // һı8bit
+        // 一个文本像素8bit
         VkDeviceSize imageSize = VkDeviceSize(width * height);
         if (imageSize == 0)
             throw std::runtime_error("Can't create texture with size 0 !");
         VulkanBuffer stagingBuffer = CreateBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true);
 
-        // ݿstagingBuffer
+        // 把数据拷贝到stagingBuffer
         void* ptr;
         vmaMapMemory(vmaAllocator, stagingBuffer.allocation, &ptr);
         memcpy(ptr, data, static_cast<size_t>(imageSize));
@@ -561,7 +561,7 @@ namespace ZXEngine
             VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-        // ͬLoadTexture
+        // 同LoadTexture
         TransitionImageLayout(image.image,
             VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
             VK_IMAGE_ASPECT_COLOR_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
@@ -642,7 +642,7 @@ namespace ZXEngine
         curMaterialDataIdx = ID;
     }
 
-    // ɵͨshaderReferenceϢMaterialDataҲvkUpdateDescriptorSetsImageVkPipeline
+    // 这个函数完成的任务是通过shaderReference里的信息来配置MaterialData，也就是用vkUpdateDescriptorSets把Image与VkPipeline绑定起来
     void RenderAPIVulkan::SetUpMaterial(Material* material)
     {
         auto shaderReference = material->shader->reference;
@@ -651,7 +651,7 @@ namespace ZXEngine
         auto vulkanMaterialData = GetMaterialDataByIndex(material->data->GetID());
         vulkanMaterialData->descriptorPool = CreateDescriptorPool(shaderReference->shaderInfo);
 
-        // Uniform Buffer
+        // 创建Uniform Buffer
         for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
         {
             if (!shaderReference->shaderInfo.vertProperties.baseProperties.empty())
@@ -671,7 +671,7 @@ namespace ZXEngine
             }
         }
 
-        // Uniform Buffer󶨵DescriptorSet
+        // 把Uniform Buffer绑定到DescriptorSet上
         vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, pipeline->descriptorSetLayout);
         vulkanMaterialData->descriptorSets = CreateDescriptorSets(vulkanMaterialData->descriptorPool, layouts);
         for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
@@ -730,7 +730,7 @@ namespace ZXEngine
             vkUpdateDescriptorSets(device, static_cast<uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, nullptr);
         }
 
-        // 󶨵DescriptorSet
+        // 把纹理绑定到DescriptorSet上
         for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
         {
             vector<VkWriteDescriptorSet> writeDescriptorSets;
@@ -774,7 +774,7 @@ namespace ZXEngine
             vkUpdateDescriptorSets(device, static_cast<uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, nullptr);
         }
 
-        // ò
+        // 设置材质数据
         for (auto& property : material->data->vec2Datas)
             SetShaderVector(material, property.first, property.second, true);
         for (auto& property : material->data->vec3Datas)
@@ -794,11 +794,11 @@ namespace ZXEngine
         pipelinesToDelete.insert(pair(id, MAX_FRAMES_IN_FLIGHT));
     }
 
-    // VulkanﲻҪɾݣΪVulkanͬʱ֡ɾʱܻһ֡ڲд
-    // ֻǰѲݱΪɾȵͬʱȾ֡ȫʱɾ
+    // Vulkan里不要立刻删除材质数据，因为Vulkan会同时处理多帧，调用删除的时候可能还有一帧正在并行处理
+    // 所以这里只是把材质数据标记为删除，等到同时渲染的帧全部结束的时候再真正删除
     void RenderAPIVulkan::DeleteMaterialData(uint32_t id)
     {
-        // ڶ˼Ҫô֡ɾ
+        // 这里第二个参数的意思是这个材质要等这么多帧才能删除
         materialDatasToDelete.insert(pair(id, MAX_FRAMES_IN_FLIGHT ));
     }
 
@@ -836,8 +836,8 @@ namespace ZXEngine
 
             for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
             {
-                // ܶAttachment涼ܻShaderԶVK_IMAGE_USAGE_SAMPLED_BIT
-                // ȷᱻģԲVK_IMAGE_USAGE_SAMPLED_BITĳVK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
+                // 这里很多Attachment后面都可能会用于其它Shader采样，所以都加了VK_IMAGE_USAGE_SAMPLED_BIT
+                // 如果确定不会被用作采样的，可以不加VK_IMAGE_USAGE_SAMPLED_BIT，改成VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT提高性能
                 VulkanImage colorImage = CreateImage(width, height, 1, 1, VK_SAMPLE_COUNT_1_BIT, defaultImageFormat, VK_IMAGE_TILING_OPTIMAL,
                     VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
                 TransitionImageLayout(colorImage.image,
@@ -864,7 +864,7 @@ namespace ZXEngine
 
                 VkFramebufferCreateInfo framebufferInfo{};
                 framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-                // ָԼݵrender pass(frame bufferָrender passattachmentҪһ)
+                // 指定可以兼容的render pass(这个frame buffer和指定的render pass的attachment的数量和类型需要一致)
                 framebufferInfo.renderPass = GetRenderPass(RenderPassType::Normal);
                 framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
                 framebufferInfo.pAttachments = attachments.data();
@@ -1094,6 +1094,16 @@ namespace ZXEngine
         drawIndexes.push_back({ .VAO = VAO, .pipelineID = curPipeLineIdx, .materialDataID = curMaterialDataIdx });
     }
 
+    void RenderAPIVulkan::Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer)
+    {
+        drawIndexes.push_back({ .VAO = VAO, .pipelineID = curPipeLineIdx, .materialDataID = curMaterialDataIdx, .instanceNum = instanceNum, .instanceBufferID = instanceBuffer });
+    }
+
+    void RenderAPIVulkan::DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount)
+    {
+        drawIndexes.push_back({ .VAO = VAO, .pipelineID = curPipeLineIdx, .materialDataID = curMaterialDataIdx, .indexOffset = indexOffset, .indexCount = indexCount });
+    }
+
     void RenderAPIVulkan::GenerateDrawCommand(uint32_t id)
     {
         auto curDrawCommandObj = GetDrawCommandByIndex(id);
@@ -1114,9 +1124,9 @@ namespace ZXEngine
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
         renderPassInfo.renderPass = GetRenderPass(curFBO->renderPassType);
         renderPassInfo.framebuffer = curFBO->frameBuffers[GetCurFrameBufferIndex()];
-        // render areashaderҪغʹ洢λ
+        // 这个render area定义了shader将要加载和存储的位置
         renderPassInfo.renderArea.offset = { viewPortInfo.xOffset, viewPortInfo.yOffset };
-        // һ˵С(extend)ǺframebufferattachmentһµģС˻˷ѣ˳ȥĲһЩδֵ
+        // 一般来说大小(extend)是和framebuffer的attachment一致的，如果小了会浪费，大了超出去的部分是一些未定义数值
         renderPassInfo.renderArea.extent = { viewPortInfo.width, viewPortInfo.height };
         if (curFBO->renderPassType == RenderPassType::Normal)
         {
@@ -1166,13 +1176,21 @@ namespace ZXEngine
             VkDeviceSize offsets[] = { 0 };
             vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
 
+            // 逐实例数据绑定在1号binding上
+            if (iter.instanceBufferID != UINT32_MAX)
+            {
+                VkBuffer instanceBuffers[] = { GetInstanceBufferByIndex(iter.instanceBufferID)->buffers[currentFrame].buffer };
+                vkCmdBindVertexBuffers(commandBuffer, 1, 1, instanceBuffers, offsets);
+            }
+
             vkCmdBindIndexBuffer(commandBuffer, vulkanVAO->indexBuffer, 0, VK_INDEX_TYPE_UINT32);
 
             vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->pipeline);
 
             vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->pipelineLayout, 0, 1, &materialData->descriptorSets[currentFrame], 0, VK_NULL_HANDLE);
 
-            vkCmdDrawIndexed(commandBuffer, vulkanVAO->indexCount, 1, 0, 0, 0);
+            uint32_t indexCount = iter.indexCount == UINT32_MAX ? vulkanVAO->indexCount : iter.indexCount;
+            vkCmdDrawIndexed(commandBuffer, indexCount, iter.instanceNum, iter.indexOffset, 0, 0);
         }
 
         vkCmdEndRenderPass(commandBuffer);
@@ -1183,7 +1201,7 @@ namespace ZXEngine
         vector<VkPipelineStageFlags> waitStages = {};
         waitStages.resize(curWaitSemaphores.size(), VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT);
         vector<VkSemaphore> waitSemaphores = curWaitSemaphores;
-        // AfterEffectǵһֱдPresentBufferģҪPresentBuffer
+        // AfterEffect是第一个直接写入PresentBuffer的，所以需要等PresentBuffer可用
         if (curFBOIdx == presentFBOIdx && curDrawCommandObj->commandType == CommandType::AfterEffectRendering)
         {
             waitStages.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
@@ -1202,7 +1220,7 @@ namespace ZXEngine
 
         VkFence fence = VK_NULL_HANDLE;
 #ifndef ZX_EDITOR
-        // ڱ༭ģʽһCommand̶ǻƱ༭UIģEditorGUIManagerύFence
+        // 在编辑器模式下最后一个Command固定是绘制编辑器UI的，在EditorGUIManager里提交Fence
         if (curDrawCommandObj->commandType == CommandType::UIRendering)
             fence = inFlightFences[currentFrame];
 #endif
@@ -1210,12 +1228,42 @@ namespace ZXEngine
         if (vkQueueSubmit(graphicsQueue, 1, &submitInfo, fence) != VK_SUCCESS)
             throw std::runtime_error("failed to submit draw command buffer!");
 
-        // ǰź¸Ҫȴ
+        // 当前这个命令激发的信号量就是下个命令需要等待的
         curWaitSemaphores = curDrawCommand.signalSemaphores;
 
         drawIndexes.clear();
     }
 
+    uint32_t RenderAPIVulkan::CreateInstanceBuffer(uint32_t instanceNum)
+    {
+        uint32_t id = GetNextInstanceBufferIndex();
+        auto instanceBuffer = GetInstanceBufferByIndex(id);
+        instanceBuffer->size = instanceNum;
+
+        VkDeviceSize bufferSize = instanceNum * 16 * sizeof(float);
+        for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+            instanceBuffer->buffers.push_back(CreateBuffer(bufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true));
+
+        instanceBuffer->inUse = true;
+        return id;
+    }
+
+    void RenderAPIVulkan::UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum)
+    {
+        auto instanceBuffer = GetInstanceBufferByIndex(id);
+        instanceNum = Math::Min(instanceNum, instanceBuffer->size);
+
+        // 和Uniform Buffer里的矩阵一样，按列主序写入
+        float* address = static_cast<float*>(instanceBuffer->buffers[currentFrame].mappedAddress);
+        for (uint32_t i = 0; i < instanceNum; i++)
+            data[i].ToColumnMajorArray(address + i * 16);
+    }
+
+    void RenderAPIVulkan::DeleteInstanceBuffer(uint32_t id)
+    {
+        instanceBuffersToDelete.insert(pair(id, MAX_FRAMES_IN_FLIGHT));
+    }
+
     void RenderAPIVulkan::DeleteMesh(unsigned int VAO)
     {
         meshsToDelete.insert(pair(VAO, MAX_FRAMES_IN_FLIGHT));
@@ -1231,7 +1279,7 @@ namespace ZXEngine
         // ----------------------------------------------- Vertex Buffer -----------------------------------------------
         VkDeviceSize vertexBufferSize = sizeof(Vertex) * vertices.size();
 
-        // StagingBuffer
+        // 建立StagingBuffer
         VkBufferCreateInfo vertexStagingBufferInfo = {};
         vertexStagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         vertexStagingBufferInfo.size = vertexBufferSize;
@@ -1246,13 +1294,13 @@ namespace ZXEngine
         VmaAllocation vertexStagingBufferAlloc;
         vmaCreateBuffer(vmaAllocator, &vertexStagingBufferInfo, &vertexStagingAllocInfo, &vertexStagingBuffer, &vertexStagingBufferAlloc, nullptr);
 
-        // ݵStagingBuffer
+        // 拷贝数据到StagingBuffer
         void* vertexData;
         vmaMapMemory(vmaAllocator, vertexStagingBufferAlloc, &vertexData);
         memcpy(vertexData, vertices.data(), vertices.size() * sizeof(Vertex));
         vmaUnmapMemory(vmaAllocator, vertexStagingBufferAlloc);
 
-        // VertexBuffer
+        // 建立VertexBuffer
         VkBufferUsageFlags vertexBufferUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         if (ProjectSetting::renderPipelineType == RenderPipelineType::RayTracing)
             vertexBufferUsage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
@@ -1261,14 +1309,14 @@ namespace ZXEngine
         vertexBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         vertexBufferInfo.size = vertexBufferSize;
         vertexBufferInfo.usage = vertexBufferUsage;
-        vertexBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // ֻһдʹ
+        vertexBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // 只有一个队列簇使用
 
         VmaAllocationCreateInfo vertexBufferAllocInfo = {};
         vertexBufferAllocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
 
         vmaCreateBuffer(vmaAllocator, &vertexBufferInfo, &vertexBufferAllocInfo, &meshBuffer->vertexBuffer, &meshBuffer->vertexBufferAlloc, nullptr);
 
-        // ǹ׷ȾߣҪȡVertexBufferGPUַ
+        // 如果是光追渲染管线，需要获取VertexBuffer的GPU地址
         if (ProjectSetting::renderPipelineType == RenderPipelineType::RayTracing)
         {
             VkBufferDeviceAddressInfo addressInfo = {};
@@ -1277,7 +1325,7 @@ namespace ZXEngine
             meshBuffer->vertexBufferDeviceAddress = vkGetBufferDeviceAddress(device, &addressInfo);
         }
 
-        // StagingBufferVertexBuffer
+        // 从StagingBuffer拷贝到VertexBuffer
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
             VkBufferCopy copy = {};
@@ -1287,13 +1335,13 @@ namespace ZXEngine
             vkCmdCopyBuffer(cmd, vertexStagingBuffer, meshBuffer->vertexBuffer, 1, &copy);
         });
 
-        // StagingBuffer
+        // 销毁StagingBuffer
         vmaDestroyBuffer(vmaAllocator, vertexStagingBuffer, vertexStagingBufferAlloc);
 
         // ----------------------------------------------- Index Buffer -----------------------------------------------
         VkDeviceSize indexBufferSize = sizeof(uint32_t) * indices.size();
 
-        // StagingBuffer
+        // 建立StagingBuffer
         VkBufferCreateInfo indexStagingBufferInfo = {};
         indexStagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         indexStagingBufferInfo.size = indexBufferSize;
@@ -1308,13 +1356,13 @@ namespace ZXEngine
         VmaAllocation indexStagingBufferAlloc;
         vmaCreateBuffer(vmaAllocator, &indexStagingBufferInfo, &indexStagingAllocInfo, &indexStagingBuffer, &indexStagingBufferAlloc, nullptr);
 
-        // ݵStagingBuffer
+        // 拷贝数据到StagingBuffer
         void* indexData;
         vmaMapMemory(vmaAllocator, indexStagingBufferAlloc, &indexData);
         memcpy(indexData, indices.data(), indices.size() * sizeof(uint32_t));
         vmaUnmapMemory(vmaAllocator, indexStagingBufferAlloc);
 
-        // IndexBuffer
+        // 建立IndexBuffer
         VkBufferUsageFlags indexBufferUsage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         if (ProjectSetting::renderPipelineType == RenderPipelineType::RayTracing)
             indexBufferUsage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
@@ -1323,14 +1371,14 @@ namespace ZXEngine
         indexBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         indexBufferInfo.size = indexBufferSize;
         indexBufferInfo.usage = indexBufferUsage;
-        indexBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // ֻһдʹ
+        indexBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // 只有一个队列簇使用
 
         VmaAllocationCreateInfo indexBufferAllocInfo = {};
         indexBufferAllocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
 
         vmaCreateBuffer(vmaAllocator, &indexBufferInfo, &indexBufferAllocInfo, &meshBuffer->indexBuffer, &meshBuffer->indexBufferAlloc, nullptr);
 
-        // ǹ׷ȾߣҪȡIndexBufferGPUַ
+        // 如果是光追渲染管线，需要获取IndexBuffer的GPU地址
         if (ProjectSetting::renderPipelineType == RenderPipelineType::RayTracing)
         {
             VkBufferDeviceAddressInfo addressInfo = {};
@@ -1339,7 +1387,7 @@ namespace ZXEngine
             meshBuffer->indexBufferDeviceAddress = vkGetBufferDeviceAddress(device, &addressInfo);
         }
 
-        // StagingBufferIndexBuffer
+        // 从StagingBuffer拷贝到IndexBuffer
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
             VkBufferCopy copy = {};
@@ -1349,10 +1397,10 @@ namespace ZXEngine
             vkCmdCopyBuffer(cmd, indexStagingBuffer, meshBuffer->indexBuffer, 1, &copy);
         });
 
-        // StagingBuffer
+        // 销毁StagingBuffer
         vmaDestroyBuffer(vmaAllocator, indexStagingBuffer, indexStagingBufferAlloc);
 
-        // ǹ׷ߣҪһBLAS( Bottom Level Acceleration Structure )
+        // 如果是光追管线，还要创建一个BLAS( Bottom Level Acceleration Structure )
         if (ProjectSetting::renderPipelineType == RenderPipelineType::RayTracing)
         {
             BuildBottomLevelAccelerationStructure(VAO, true);
@@ -1431,7 +1479,7 @@ namespace ZXEngine
         VulkanRTPipeline* rtPipeline = new VulkanRTPipeline();
         rtPipeline->pipeline.name = "RayTracingPipeline";
 
-        // ׷ߵDescriptorSetLayout
+        // 创建光追管线的DescriptorSetLayout
         vector<VkDescriptorSetLayoutBinding> bindings = {};
 
         // layout(set = 0, binding = 0) TLAS
@@ -1442,7 +1490,7 @@ namespace ZXEngine
         asBinding.stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
         bindings.push_back(asBinding);
 
-        // layout(set = 0, binding = 1) ͼ
+        // layout(set = 0, binding = 1) 输出图像
         VkDescriptorSetLayoutBinding imageBinding = {};
         imageBinding.binding = 1;
         imageBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
@@ -1452,10 +1500,10 @@ namespace ZXEngine
 
         rtPipeline->pipeline.descriptorSetLayout = CreateDescriptorSetLayout(bindings);
 
-        // ԴDescriptorSetLayout
+        // 创建场景资源的DescriptorSetLayout
         bindings.clear();
 
-        // layout(set = 1, binding = 0) Buffer
+        // layout(set = 1, binding = 0) 数据索引Buffer
         VkDescriptorSetLayoutBinding dataReferencesBinding = {};
         dataReferencesBinding.binding = 0;
         dataReferencesBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -1463,25 +1511,25 @@ namespace ZXEngine
         dataReferencesBinding.stageFlags = VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
         bindings.push_back(dataReferencesBinding);
 
-        // layout(set = 1, binding = 1) 2D
+        // layout(set = 1, binding = 1) 2D纹理
         VkDescriptorSetLayoutBinding texturesBinding = {};
         texturesBinding.binding = 1;
         texturesBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        texturesBinding.descriptorCount = rtSceneTextureNum; // Todo: ӦҪ̬չ
+        texturesBinding.descriptorCount = rtSceneTextureNum; // Todo: 这个数量应该是需要动态扩展的
         texturesBinding.stageFlags = VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
         bindings.push_back(texturesBinding);
 
-        // layout(set = 1, binding = 2) CubeMap
+        // layout(set = 1, binding = 2) CubeMap纹理
         VkDescriptorSetLayoutBinding cubeMapBinding = {};
         cubeMapBinding.binding = 2;
         cubeMapBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        cubeMapBinding.descriptorCount = rtSceneCubeMapNum; // Todo: ӦҪ̬չ
+        cubeMapBinding.descriptorCount = rtSceneCubeMapNum; // Todo: 这个数量应该是需要动态扩展的
         cubeMapBinding.stageFlags = VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
         bindings.push_back(cubeMapBinding);
 
         rtPipeline->pipeline.sceneDescriptorSetLayout = CreateDescriptorSetLayout(bindings);
 
-        // PushConstant
+        // 设置PushConstant
         vector<VkPushConstantRange> pushConstantRanges = {};
         VkPushConstantRange pushConstantRange = {};
         pushConstantRange.stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
@@ -1489,11 +1537,11 @@ namespace ZXEngine
         pushConstantRange.size = sizeof(RayTracingPipelineConstants);
         pushConstantRanges.push_back(pushConstantRange);
 
-        // PipelineLayout
+        // 创建PipelineLayout
         vector<VkDescriptorSetLayout> descriptorSetLayouts = { rtPipeline->pipeline.descriptorSetLayout, rtPipeline->pipeline.sceneDescriptorSetLayout };
         rtPipeline->pipeline.pipelineLayout = CreatePipelineLayout(descriptorSetLayouts, pushConstantRanges);
 
-        // Shader ModuleShader Groups
+        // 创建Shader Module和Shader Groups
         vector<VkPipelineShaderStageCreateInfo> stages = {};
         vector<VkRayTracingShaderGroupCreateInfoKHR> shaderGroups = {};
 
@@ -1564,7 +1612,7 @@ namespace ZXEngine
 			shaderGroups.push_back(shaderGroupInfo);
         }
 
-        // Pipeline
+        // 创建Pipeline
         VkRayTracingPipelineCreateInfoKHR rayPipelineInfo{};
         rayPipelineInfo.sType = VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR;
         rayPipelineInfo.stageCount = static_cast<uint32_t>(stages.size());
@@ -1576,49 +1624,49 @@ namespace ZXEngine
         if (vkCreateRayTracingPipelinesKHR(device, VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &rayPipelineInfo, nullptr, &rtPipeline->pipeline.pipeline) != VK_SUCCESS)
 			throw std::runtime_error("Failed to create ray tracing pipeline!");
 
-        // ɺShader Module
+        // 创建完成后，立刻清理Shader Module
         for (auto& stage : stages)
 			vkDestroyShaderModule(device, stage.module, nullptr);
 
-        // ʼShader Binding Table
-        // һSBTԿ4飬ֱRay Gen, Miss, Hit, Callable4͵Shader Group
+        // 开始创建Shader Binding Table
+        // 一个SBT可以看作是4个数组，分别是Ray Gen, Miss, Hit, Callable这4种类型的Shader Group数组
 
         uint32_t rGenCount  = static_cast<uint32_t>(rtShaderPathGroup.rGenPaths.size());
         uint32_t rMissCount = static_cast<uint32_t>(rtShaderPathGroup.rMissPaths.size());
         uint32_t rHitCount  = static_cast<uint32_t>(rtShaderPathGroup.rHitGroupPaths.size());
         uint32_t shaderHandleCount = rGenCount + rMissCount + rHitCount;
 
-        // һShaderSBTϵĴС
+        // 这是一个Shader引用在SBT上的大小
         uint32_t shaderHandleSize = rtPhysicalProperties.shaderGroupHandleSize;
-        // ShaderSBTϵĶСעĴСʵʴСܲһҪѲѯʵʴСȥѯĶС
-        // пShaderʵʴСȶССᵼSBT BufferڴƬ԰ЩƬռshaderRecordEXT
-        // Shader GroupڵShaderҪ룬ͬShader Group֮ҲҪ
+        // 这是Shader引用在SBT上的对齐大小，注意这个对齐的大小和实际大小可能不一样，所以这里要把查询到的实际大小去对齐查询到的对齐大小
+        // 有可能最后Shader引用实际大小比对齐大小更小，这会导致SBT Buffer上有内存碎片，可以把这些碎片空间利用起来存放shaderRecordEXT数据
+        // 除了Shader Group内的Shader引用要按这个对齐，不同的Shader Group之间也要按这个对齐
         uint32_t shaderHandleAlignment = Math::AlignUp(shaderHandleSize, rtPhysicalProperties.shaderGroupHandleAlignment);
-        // Shader Group֮ҪС
+        // Shader Group之间要按这个大小对齐
         uint32_t shaderGroupAlignment = rtPhysicalProperties.shaderGroupBaseAlignment;
 
-        // Ray GenȽ⣬sizestrideҪһ
+        // Ray Gen比较特殊，size和stride要一致
         rtPipeline->SBT.raygenRegion.size = static_cast<VkDeviceSize>(Math::AlignUp(shaderHandleAlignment, shaderGroupAlignment));
         rtPipeline->SBT.raygenRegion.stride = rtPipeline->SBT.raygenRegion.size;
-        // Shader GroupҪVkPhysicalDeviceRayTracingPipelinePropertiesKHR::shaderGroupBaseAlignment
+        // 整个Shader Group要对齐VkPhysicalDeviceRayTracingPipelinePropertiesKHR::shaderGroupBaseAlignment
         rtPipeline->SBT.missRegion.size = static_cast<VkDeviceSize>(Math::AlignUp(shaderHandleAlignment * rMissCount, shaderGroupAlignment));
         rtPipeline->SBT.missRegion.stride = shaderHandleAlignment;
         rtPipeline->SBT.hitRegion.size = static_cast<VkDeviceSize>(Math::AlignUp(shaderHandleAlignment * rHitCount, shaderGroupAlignment));
         rtPipeline->SBT.hitRegion.stride = shaderHandleAlignment;
 
-        // ȡ󶨵׷VkPipelineϵShader Handles
+        // 获取绑定到光线追踪VkPipeline上的Shader Handles
         uint32_t dataSize = shaderHandleCount * shaderHandleSize;
         vector<uint8_t> handles(dataSize);
         if (vkGetRayTracingShaderGroupHandlesKHR(device, rtPipeline->pipeline.pipeline, 0, shaderHandleCount, dataSize, handles.data()) != VK_SUCCESS)
             throw std::runtime_error("Failed to get shader group handles!");
 
-        // SBT Buffer
+        // 创建SBT Buffer
         VkDeviceSize sbtBufferSize = rtPipeline->SBT.raygenRegion.size + rtPipeline->SBT.missRegion.size + rtPipeline->SBT.hitRegion.size;
         rtPipeline->SBT.buffer = CreateBuffer(sbtBufferSize,
             VK_BUFFER_USAGE_SHADER_BINDING_TABLE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true);
 
-        // ȡÿShader Groupʼַ
+        // 获取每个Shader Group的起始地址
         VkBufferDeviceAddressInfo sbtBufferInfo = {};
         sbtBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
         sbtBufferInfo.buffer = rtPipeline->SBT.buffer.buffer;
@@ -1627,54 +1675,54 @@ namespace ZXEngine
         rtPipeline->SBT.missRegion.deviceAddress = sbtBufferAddress + rtPipeline->SBT.raygenRegion.size;
         rtPipeline->SBT.hitRegion.deviceAddress = sbtBufferAddress + rtPipeline->SBT.raygenRegion.size + rtPipeline->SBT.missRegion.size;
 
-        // ȡеShaderַ
+        // 获取管线中的Shader地址
         uint8_t* shaderHandlePtr = handles.data();
-        // ȡSBT Bufferӳַ
+        // 获取SBT Buffer的映射地址
         uint8_t* sbtBufferPtr = static_cast<uint8_t*>(rtPipeline->SBT.buffer.mappedAddress);
-        // SBT Bufferʱָ
+        // SBT Buffer的临时指针
         uint8_t* tmpPtr = sbtBufferPtr;
-        // Ray Gen ShaderSBT Buffer
+        // 把Ray Gen Shader拷贝到SBT Buffer上
         memcpy(tmpPtr, shaderHandlePtr, shaderHandleSize);
-        // ƵһShaderַ
+        // 移到下一个Shader地址
         shaderHandlePtr += shaderHandleSize;
 
-        // ƵһShader Groupַ(Miss)
+        // 移到下一个Shader Group地址(Miss)
         tmpPtr = sbtBufferPtr + rtPipeline->SBT.raygenRegion.size;
-        // Miss ShaderSBT Buffer
+        // 遍历拷贝Miss Shader到SBT Buffer上
         for (uint32_t i = 0; i < rMissCount; ++i)
         {
             memcpy(tmpPtr, shaderHandlePtr, shaderHandleSize);
-            // ƵһShaderַ
+            // 移到下一个Shader地址
             shaderHandlePtr += shaderHandleSize;
-            // ƵǰShader Groupеһַ
+            // 移到当前Shader Group中的下一个地址
             tmpPtr += rtPipeline->SBT.missRegion.stride;
         }
 
-        // ƵһShader Groupַ(Hit)
+        // 移到下一个Shader Group地址(Hit)
         tmpPtr = sbtBufferPtr + rtPipeline->SBT.raygenRegion.size + rtPipeline->SBT.missRegion.size;
-        // Hit ShaderSBT Buffer
+        // 遍历拷贝Hit Shader到SBT Buffer上
         for (uint32_t i = 0; i < rHitCount; ++i)
         {
             memcpy(tmpPtr, shaderHandlePtr, shaderHandleSize);
-            // ƵһShaderַ
+            // 移到下一个Shader地址
             shaderHandlePtr += shaderHandleSize;
-            // ƵǰShader Groupеһַ
+            // 移到当前Shader Group中的下一个地址
             tmpPtr += rtPipeline->SBT.hitRegion.stride;
         }
 
         rtPipelines.push_back(rtPipeline);
         uint32_t rtPipelineID = static_cast<uint32_t>(rtPipelines.size() - 1);
 
-        // ҪʹõĹ̶DescriptorSet
+        // 创建管线要使用的固定DescriptorSet
         CreateRTPipelineData(rtPipelineID);
-        // ʼ׷Դ
+        // 初始化光追场景资源
         CreateRTSceneData(rtPipelineID);
-        // ʼTLAS
+        // 初始化TLAS数组
         rtPipeline->tlasIdx = GetNextTLASGroupIndex();
         auto tlasGroup = GetTLASGroupByIndex(rtPipeline->tlasIdx);
         tlasGroup->asGroup.resize(MAX_FRAMES_IN_FLIGHT);
         tlasGroup->inUse = true;
-        // ʼTLASмBuffer
+        // 初始化构建TLAS的中间Buffer
         rtTLASStagingBuffers.resize(MAX_FRAMES_IN_FLIGHT);
         rtTLASScratchBuffers.resize(MAX_FRAMES_IN_FLIGHT);
         rtTLASInstanceBuffers.resize(MAX_FRAMES_IN_FLIGHT);
@@ -1715,7 +1763,7 @@ namespace ZXEngine
         {
             for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
             {
-                // BufferһԴ޸ĵģԿŻGPU Only
+                // 这个Buffer可能是一次性创建不再修改的，可以考虑优化成GPU Only的
                 vulkanRTMaterialData->buffers[i] = CreateBuffer(bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_AUTO, true, true);
             }
         }
@@ -1739,14 +1787,14 @@ namespace ZXEngine
 
     void RenderAPIVulkan::SetRayTracingSkyBox(uint32_t textureID)
     {
-        // պĬǵǰһ֡ĵһCubeMap
+        // 天空盒纹理默认是当前这一帧的第一个CubeMap
         curRTSceneCubeMapIndexMap[textureID] = 0;
         curRTSceneCubeMapIndexes.push_back(textureID);
     }
 
     void RenderAPIVulkan::PushRayTracingMaterialData(Material* material)
     {
-        // ʹõӵǰ׷еб
+        // 把这个材质使用的纹理添加到当前光追场景中的总纹理列表中
         for (auto& iter : material->data->textures)
         {
             auto textureID = iter.second->GetID();
@@ -1768,7 +1816,7 @@ namespace ZXEngine
 			}
         }
 
-        // ׷ӵǰ׷еܹ׷б
+        // 把这个光追材质添加到当前光追场景中的总光追材质列表中
         auto rtMaterialDataID = material->data->GetRTID();
         if (curRTSceneRTMaterialDataMap.find(rtMaterialDataID) == curRTSceneRTMaterialDataMap.end())
         {
@@ -1776,12 +1824,12 @@ namespace ZXEngine
             curRTSceneRTMaterialDatas.emplace_back(rtMaterialDataID);
 		}
 
-        // µǰ֡Ĺ׷Buffer
+        // 更新当前帧的光追材质Buffer数据
         auto vulkanRTMaterialData = GetRTMaterialDataByIndex(rtMaterialDataID);
         auto& buffer = vulkanRTMaterialData->buffers[currentFrame];
         uint8_t* tmpPtr = static_cast<uint8_t*>(buffer.mappedAddress);
 
-        // дBuffer
+        // 遍历纹理，并把引用索引写入Buffer
         for (auto& iter : material->data->textures)
         {
             auto textureID = iter.second->GetID();
@@ -1810,7 +1858,7 @@ namespace ZXEngine
     {
         auto rtPipeline = rtPipelines[curRTPipelineID];
 
-        // 㻭澲ֹ֡ۻʽ׷ȾҪ
+        // 计算画面静止的帧数，累积式光追渲染需要这个数据
         if (rtConstants.VP != rtVPMatrix[currentFrame])
         {
             rtFrameCount[currentFrame] = 0;
@@ -1818,20 +1866,20 @@ namespace ZXEngine
         }
         uint32_t frameCount = rtFrameCount[currentFrame]++;
 
-        // ȸµǰ֡͹׷߰󶨵ĳ
+        // 先更新当前帧和光追管线绑定的场景数据
         UpdateRTSceneData(curRTPipelineID);
-        // µǰ֡͹׷߰󶨵Ĺ
+        // 更新当前帧和光追管线绑定的管线数据
         UpdateRTPipelineData(curRTPipelineID);
 
-        // ȡǰ֡Command Buffer
+        // 获取当前帧的Command Buffer
 		auto curDrawCommandObj = GetDrawCommandByIndex(commandID);
 		auto& curDrawCommand = curDrawCommandObj->drawCommands[currentFrame];
 		auto commandBuffer = curDrawCommand.commandBuffer;
 
-		// Command Buffer
+		// 重置Command Buffer
 		vkResetCommandBuffer(commandBuffer, 0);
 
-		// ʼ¼Command Buffer
+		// 开始记录Command Buffer
 		VkCommandBufferBeginInfo beginInfo = {};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 		beginInfo.flags = 0;
@@ -1839,26 +1887,26 @@ namespace ZXEngine
 		if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
 			throw std::runtime_error("Failed to begin recording command buffer!");
 
-        // ȡ׷Ŀͼ
+        // 获取光追管线输出的目标图像
         auto curFBO = GetFBOByIndex(curFBOIdx);
         uint32_t textureID = GetAttachmentBufferByIndex(curFBO->colorAttachmentIdx)->attachmentBuffers[currentFrame];
         auto texture = GetTextureByIndex(textureID);
 
-        // תΪ׷ʽ
+        // 转为光追输出格式
         TransitionImageLayout(commandBuffer, texture->image.image, 
             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_ASPECT_COLOR_BIT, 
             VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT, VK_ACCESS_SHADER_READ_BIT,
             VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, VK_ACCESS_SHADER_WRITE_BIT);
 
-		// 󶨹׷
+		// 绑定光追管线
 		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, rtPipeline->pipeline.pipeline);
-		// 󶨹׷
+		// 绑定光追管线描述符集
         vector<VkDescriptorSet> rtSets{ rtPipeline->pipelineData.descriptorSets[currentFrame], rtPipeline->sceneData.descriptorSets[currentFrame] };
         vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, rtPipeline->pipeline.pipelineLayout,
             0, static_cast<uint32_t>(rtSets.size()), rtSets.data(), 0, nullptr);
 
-        // תһPush Constantsݸʽstd140ڴ沼ֹ
-        // Ϊǹ̶ݣͼֶˣûUniform Bufferдһͨõĺ
+        // 转一下Push Constants数据格式，按std140内存布局规则存放
+        // 这里因为是固定数据，就简单手动处理了，没像Uniform Buffer那样写一个通用的函数
         char* ptr = static_cast<char*>(rtPushConstantBuffer);
         if (ptr != NULL)
         {
@@ -1886,7 +1934,7 @@ namespace ZXEngine
             memcpy(ptr, &rtConstants.time, sizeof(float));
         }
 
-        // 󶨹׷߳
+        // 绑定光追管线常量
         vkCmdPushConstants(commandBuffer, rtPipeline->pipeline.pipelineLayout, 
             VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR,
             0, sizeof(float) * 52, rtPushConstantBuffer);
@@ -1896,17 +1944,17 @@ namespace ZXEngine
             &rtPipeline->SBT.raygenRegion, &rtPipeline->SBT.missRegion, &rtPipeline->SBT.hitRegion, &rtPipeline->SBT.callableRegion,
             viewPortInfo.width, viewPortInfo.height, 1);
 
-        // תΪShaderȡʽ
+        // 转为Shader读取格式
         TransitionImageLayout(commandBuffer, texture->image.image, 
             VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT, 
             VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, VK_ACCESS_SHADER_WRITE_BIT,
             VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT, VK_ACCESS_SHADER_READ_BIT);
 
-		// ¼Command Buffer
+		// 结束记录Command Buffer
 		if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS)
 			throw std::runtime_error("Failed to record command buffer!");
 
-        // ύCommand Buffer
+        // 提交Command Buffer
         vector<VkPipelineStageFlags> waitStages = {};
         waitStages.resize(curWaitSemaphores.size(), VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
         VkSubmitInfo submitInfo = {};
@@ -1923,7 +1971,7 @@ namespace ZXEngine
 
         curWaitSemaphores = curDrawCommand.signalSemaphores;
 
-        // յǰ֡ĳ
+        // 清空当前帧的场景数据
         asInstanceData.clear();
         curRTSceneTextureIndexes.clear();
         curRTSceneTextureIndexMap.clear();
@@ -1935,16 +1983,16 @@ namespace ZXEngine
 
     void RenderAPIVulkan::BuildTopLevelAccelerationStructure(uint32_t commandID)
     {
-        // ȡǰ֡Command Buffer
+        // 获取当前帧的Command Buffer
         auto curDrawCommandObj = GetDrawCommandByIndex(commandID);
         auto& curDrawCommand = curDrawCommandObj->drawCommands[currentFrame];
         auto commandBuffer = curDrawCommand.commandBuffer;
 
-        // Command Buffer
+        // 重置Command Buffer
         if (vkResetCommandBuffer(commandBuffer, 0) != VK_SUCCESS)
             throw std::runtime_error("Failed to reset command buffer!");
 
-        // ʼ¼Command Buffer
+        // 开始记录Command Buffer
         VkCommandBufferBeginInfo beginInfo = {};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.flags = 0;
@@ -1955,7 +2003,7 @@ namespace ZXEngine
         auto& curTLAS = GetTLASGroupByIndex(rtPipelines[curRTPipelineID]->tlasIdx)->asGroup[currentFrame];
         const bool isUpdate = curTLAS.isBuilt;
 
-        // ҪȾĶʵ
+        // 场景中要渲染的对象实例数据
         vector<VkAccelerationStructureInstanceKHR> instances;
 
         for (size_t i = 0; i < asInstanceData.size(); i++)
@@ -1977,27 +2025,27 @@ namespace ZXEngine
         uint32_t insNum = static_cast<uint32_t>(instances.size());
         VkDeviceSize insBufferSize = sizeof(VkAccelerationStructureInstanceKHR) * insNum;
 
-        // StagingBuffer
+        // 建立StagingBuffer
         if (!isUpdate)
             rtTLASStagingBuffers[currentFrame] = CreateBuffer(insBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, true);
 
-        // ʵݵStagingBuffer
+        // 拷贝场景实例数据到StagingBuffer
         memcpy(rtTLASStagingBuffers[currentFrame].mappedAddress, instances.data(), insBufferSize);
 
-        // ųʵݵBuffer
+        // 存放场景实例数据的Buffer
         if (!isUpdate)
             rtTLASInstanceBuffers[currentFrame] = CreateBuffer(insBufferSize, 
                 VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             	VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, false, true);
 
-        // ݴstagingBufferinstancesBuffer
+        // 把数据从stagingBuffer拷贝到instancesBuffer
         VkBufferCopy copy = {};
         copy.dstOffset = 0;
         copy.srcOffset = 0;
         copy.size = insBufferSize;
         vkCmdCopyBuffer(commandBuffer, rtTLASStagingBuffers[currentFrame].buffer, rtTLASInstanceBuffers[currentFrame].buffer, 1, &copy);
 
-        // ȷTLAS֮ǰݿ
+        // 确保构建TLAS之前，数据拷贝已完成
         VkMemoryBarrier barrier = {};
         barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
         barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -2005,7 +2053,7 @@ namespace ZXEngine
         vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
             0, 1, &barrier, 0, nullptr, 0, nullptr);
 
-        // һЩװһInstances BufferݣڹTLAS
+        // 添加一些描述，包装一下上面的Instances Buffer数据，用于构建TLAS
         VkAccelerationStructureGeometryInstancesDataKHR instancesData = {};
         instancesData.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR;
         instancesData.data.deviceAddress = rtTLASInstanceBuffers[currentFrame].deviceAddress;
@@ -2014,7 +2062,7 @@ namespace ZXEngine
         tlasGeometry.geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR;
         tlasGeometry.geometry.instances = instancesData;
 
-        // TLASϢ
+        // 构建TLAS的信息
         VkAccelerationStructureBuildGeometryInfoKHR buildInfo = {};
         buildInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
         buildInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR;
@@ -2023,43 +2071,43 @@ namespace ZXEngine
         buildInfo.geometryCount = 1;
         buildInfo.pGeometries = &tlasGeometry;
 
-        // ȡTLASĹBufferС
+        // 获取TLAS的构建所需的Buffer大小
         VkAccelerationStructureBuildSizesInfoKHR sizeInfo = {};
         sizeInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR;
         vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &buildInfo, &insNum, &sizeInfo);
 
-        // ½TLAS
+        // 新建TLAS
         if (!isUpdate)
         {
-            // TLAS Buffer
+            // 创建TLAS Buffer
             curTLAS.buffer = CreateBuffer(sizeInfo.accelerationStructureSize,
                 VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                 VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, false, true);
 
-            // TLASϢ(ݣֻҪBufferSize)
+            // 创建TLAS的信息(仅创建，不填充数据，所以只需要Buffer和Size)
             VkAccelerationStructureCreateInfoKHR createInfo = {};
             createInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
             createInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR;
             createInfo.size = sizeInfo.accelerationStructureSize;
             createInfo.buffer = curTLAS.buffer.buffer;
 
-            // TLAS
+            // 创建TLAS
             if (vkCreateAccelerationStructureKHR(device, &createInfo, nullptr, &curTLAS.as) != VK_SUCCESS)
                 throw std::runtime_error("Create acceleration structure failed!");
         }
 
-        // Scratch BufferVulkanTLASҪһBufferм
+        // 创建Scratch Buffer，Vulkan构建TLAS需要一个Buffer来放中间数据
         if (!isUpdate)
             rtTLASScratchBuffers[currentFrame] = CreateBuffer(sizeInfo.buildScratchSize,
                 VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
                 VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, false, true);
 
-        // 乹TLASҪϢ
+        // 继续填充构建TLAS需要的信息
         buildInfo.srcAccelerationStructure = isUpdate ? curTLAS.as : VK_NULL_HANDLE;
         buildInfo.dstAccelerationStructure = curTLAS.as;
         buildInfo.scratchData.deviceAddress = rtTLASScratchBuffers[currentFrame].deviceAddress;
 
-        // ιTLASݷΧ
+        // 本次构建TLAS的所需的数据范围
         VkAccelerationStructureBuildRangeInfoKHR buildRangeInfo = {};
         buildRangeInfo.firstVertex = 0;
         buildRangeInfo.primitiveCount = insNum;
@@ -2067,15 +2115,15 @@ namespace ZXEngine
         buildRangeInfo.transformOffset = 0;
         const VkAccelerationStructureBuildRangeInfoKHR* pBuildRangeInfo = &buildRangeInfo;
 
-        // TLAS
+        // 构建TLAS
         vkCmdBuildAccelerationStructuresKHR(commandBuffer, 1, &buildInfo, &pBuildRangeInfo);
         curTLAS.isBuilt = true;
 
-        // Command Bufferļ¼
+        // 结束Command Buffer的记录
         if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS)
             throw std::runtime_error("failed to record command buffer!");
 
-        // ύCommand Buffer
+        // 提交Command Buffer
         vector<VkPipelineStageFlags> waitStages = {};
         waitStages.resize(curWaitSemaphores.size(), VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR);
         VkSubmitInfo submitInfo = {};
@@ -2097,12 +2145,12 @@ namespace ZXEngine
     {
         auto meshBuffer = GetVAOByIndex(VAO);
 
-        // ϢvertexFormat̶ΪVK_FORMAT_R32G32B32_SFLOATĳЩ豸float4ֱֽ׳쳣
-        // û䴦Ϊ󲿷ֵĻµfloat4ֽ
+        // 三角形信息里填的vertexFormat固定为VK_FORMAT_R32G32B32_SFLOAT，如果某些特殊设备float不是4字节这里直接抛出异常
+        // 没做适配处理，因为绝大部分的环境下的float都是4字节
         if (sizeof(float) != 4)
             throw std::runtime_error("float size is not 4");
 
-        // MeshݣҪ˶Bufferַ
+        // 三角形Mesh数据，主要包含了顶点和索引Buffer地址
         VkAccelerationStructureGeometryTrianglesDataKHR triangles = {};
         triangles.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR;
         triangles.vertexFormat = VK_FORMAT_R32G32B32_SFLOAT;
@@ -2112,55 +2160,55 @@ namespace ZXEngine
         triangles.indexType = VK_INDEX_TYPE_UINT32;
         triangles.indexData.deviceAddress = meshBuffer->indexBufferDeviceAddress;
 
-        // ģ͵ļϢҪǸMesh
+        // 模型的几何体信息，主要是引用上面那个三角形Mesh数据
         VkAccelerationStructureGeometryKHR geometry = {};
         geometry.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
         geometry.geometryType = VK_GEOMETRY_TYPE_TRIANGLES_KHR;
         geometry.flags = VK_GEOMETRY_OPAQUE_BIT_KHR;
         geometry.geometry.triangles = triangles;
 
-        // RangeInfoҪBLASõǰõĶBufferһ
+        // 这个RangeInfo在描述我们要构建的BLAS，是用的前面引用的顶点数据Buffer里的哪一段
         VkAccelerationStructureBuildRangeInfoKHR rangeInfo = {};
         rangeInfo.firstVertex = 0;
         rangeInfo.primitiveCount = meshBuffer->indexCount / 3;
         rangeInfo.primitiveOffset = 0;
         rangeInfo.transformOffset = 0;
 
-        // ҪһBLASҪϢ
+        // 这是要构建一个BLAS所需要的信息
         VkAccelerationStructureBuildGeometryInfoKHR buildInfo = {};
         buildInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
-        // ָBLASTLASﴴBLAS
+        // 指定创建的是BLAS还是TLAS，这里创建BLAS
         buildInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
-        // ȫµBLASǸеBLAS
+        // 创建全新的BLAS，还是更新现有的BLAS
         buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
         buildInfo.flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
         if (isCompact)
             buildInfo.flags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
-        // ﴫһ飬ѶŵһBLASһ˵ģͺBLASһһ
+        // 这里传一个几何体数组，允许把多个几何体放到一个BLAS里，但是一般来说模型和BLAS是一对一的
         buildInfo.pGeometries = &geometry;
         buildInfo.geometryCount = 1;
 
-        // VulkanĽӿѯǰҪBLASС
-        // һӿֻܲѯһBLASĴСԲֻһVkAccelerationStructureBuildGeometryInfoKHR
-        // 4pMaxPrimitiveCountsݵһuint32_t飬ǶӦǴVkAccelerationStructureBuildGeometryInfoKHR
-        // pGeometriesȷÿͼԪ
-        // һزѯݵ
+        // 调用Vulkan的接口来查询当前要创建的BLAS大小
+        // 调用一次这个接口只能查询一个BLAS的大小，所以参数只传递一个VkAccelerationStructureBuildGeometryInfoKHR
+        // 第4个参数pMaxPrimitiveCounts传递的是一个uint32_t数组，这个数组是对应我们传入的VkAccelerationStructureBuildGeometryInfoKHR
+        // 里面的pGeometries，明确每个几何体的图元数量
+        // 最后一个参数是用来返回查询数据的
         vector<uint32_t> maxPrimCount = { rangeInfo.primitiveCount };
         VkAccelerationStructureBuildSizesInfoKHR sizeInfo = {};
         sizeInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR;
         vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &buildInfo, maxPrimCount.data(), &sizeInfo);
 
-        // ¼Scratch BufferС϶ѯӲСټһС
-        // ΪϺȡScratch BufferַʱҪһֵ⣬ȡַʱϸ
+        // 重新计算Scratch Buffer大小，先向上对齐查询到的硬件最小对齐量，再加一个这个大小
+        // 这个计算是为了配合后面取Scratch Buffer地址时，需要处理的一个奇怪的问题，后面取地址时详细解释
         VkDeviceSize realScratchSize = Math::AlignUpPOT(sizeInfo.buildScratchSize, static_cast<VkDeviceSize>(physicalAccelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment));
         realScratchSize += physicalAccelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment;
 
-        // һScratch BufferǸVulkanBLASõʱBufferΪVulkanڴBLASĹлһЩм
-        // ʵVulkanȫԼBufferԼ٣ǳܿVulkanѡûScratch Bufferṩ
-        // ΪҪ100BLASVulkanڽӿڲԼʱBufferҪ100Buffer
-        // ûûԴһScratch BufferȻһBuffer100δBLASĽӿڣֻҪһδ
-        // VulkanʵƼжģһ𴴽BLASΪԹһScratch BufferǴһģ;ϴһBLAS
-        // ҪдBLASScratch BufferScratch BufferĴСģSize
+        // 创建一个Scratch Buffer，这个是给Vulkan创建BLAS用的临时Buffer，因为Vulkan在创建BLAS的过程中会产生一些中间数据
+        // 其实Vulkan完全可以自己创建这个Buffer用完了再自己销毁，但是出于性能考虑Vulkan选择让用户把Scratch Buffer创建好再提供给它
+        // 因为假设要创建100个BLAS，而Vulkan在接口内部自己创建和销毁临时Buffer，就要做100次Buffer创建和销毁
+        // 但是如果丢给用户创建，用户可以创建一个Scratch Buffer，然后用这一个Buffer调用100次创建BLAS的接口，这样只需要一次创建和销毁
+        // 所以这里Vulkan其实更推荐集中多个模型一起创建BLAS，因为这样可以共用一个Scratch Buffer，而不是创建一个模型就马上创建一个BLAS
+        // 如果要集中创建BLAS复用Scratch Buffer，那这个Scratch Buffer的大小按最大的模型Size来创建
         VulkanBuffer scratchBuffer = CreateBuffer(realScratchSize,
             VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
@@ -2170,45 +2218,45 @@ namespace ZXEngine
         bufferInfo.pNext = nullptr;
         VkDeviceAddress scratchAddress = vkGetBufferDeviceAddress(device, &bufferInfo);
 
-        // ȡַ϶VkPhysicalDeviceAccelerationStructurePropertiesKHR::minAccelerationStructureScratchOffsetAlignment
-        // vkCmdBuildAccelerationStructuresKHR Ҫ Scratch Buffer ַҪѯС
-        // vkGetBufferDeviceAddressӿõĵַܱ֤룬ַûҪ󣬾ͻᱨֱCrash
-        // ǣ棬صĵһǹ׷ǲģлһ׷
-        // ûôѵĴԼһʽǴ Scratch Buffer ʱ򽨴һ
-        // ҪٴһСȻ㴫 vkCmdBuildAccelerationStructuresKHR ĵַ϶С
-        // õĵַû룬൱ֶƫһȥ
-        // ĻBufferǰһСοռ޷ʹˣֱӰѯ buildScratchSize BufferȻƫһ
-        // пܵʵʿõBufferռ䲻ǰ¼ʵʹ Scratch Buffer ĴСٴһ
-        // ܱ֤ʹƫһСεַܵBufferռҲһǹõ
+        // 这里取到地址后，向上对齐VkPhysicalDeviceAccelerationStructurePropertiesKHR::minAccelerationStructureScratchOffsetAlignment
+        // vkCmdBuildAccelerationStructuresKHR 要求传入的 Scratch Buffer 地址要对齐这个查询到的最小对齐量
+        // 但是vkGetBufferDeviceAddress接口拿到的地址并不能保证这个对齐，如果地址没满足要求，就会报错直接Crash
+        // 我遇到的情况是，如果启动引擎，加载的第一个场景就是光追场景，是不会有问题的，但是如果从其它场景切换到一个光追场景，就容易遇到这个问题
+        // 网上没怎么搜到这个问题的处理方案，我自己想了一个处理方式，就是创建 Scratch Buffer 的时候建大一点
+        // 要至少大一个最小对齐量，然后这里计算传给 vkCmdBuildAccelerationStructuresKHR 的地址，向上对齐这个最小对齐量
+        // 这样如果拿到的地址没对齐，相当于手动向后偏移一点去对齐了
+        // 但是这样的话Buffer前面一小段空间就无法使用了，如果直接按查询到的 buildScratchSize 来构建Buffer，然后又向后偏移了一点
+        // 就有可能导致实际可用的Buffer空间不够，所以前面重新计算了实际构建 Scratch Buffer 的大小，至少大一个对齐量
+        // 这样就能保证即使向后偏移了一小段地址，总的Buffer空间也一定是够用的
         scratchAddress = Math::AlignUpPOT(scratchAddress, static_cast<VkDeviceAddress>(physicalAccelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment));
 
-        // һBLASݵVkBufferSizeΪǰѯģĴС
+        // 创建一个存放BLAS数据的VkBuffer，Size为前面查询到的，所需的大小
         meshBuffer->blas.buffer = CreateBuffer(sizeInfo.accelerationStructureSize,
             VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-        // һBLASҪõϢҪǴBLASBufferSize
+        // 创建一个BLAS要用到的信息，主要参数是存放BLAS的Buffer和Size
         VkAccelerationStructureCreateInfoKHR blasInfo = {};
         blasInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
         blasInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
         blasInfo.size = sizeInfo.accelerationStructureSize;
         blasInfo.buffer = meshBuffer->blas.buffer.buffer;
 
-        // BLASעﴴúֻǳʼ״̬ݻҪ
+        // 创建BLAS，注意这里创建好后只是初始化状态，真正的数据还要后续填充
         if (vkCreateAccelerationStructureKHR(device, &blasInfo, nullptr, &meshBuffer->blas.as) != VK_SUCCESS)
             throw std::runtime_error("Create acceleration structure failed!");
 
-        // 乹BLASϢ
-        // Ѹոմģڳʼ״̬BLASdstAccelerationStructureʾҪBLAS
+        // 继续填充构建BLAS所需的信息
+        // 把刚刚创建的，处于初始状态的BLAS传给dstAccelerationStructure，表示这是我们所要构建的BLAS
         buildInfo.dstAccelerationStructure = meshBuffer->blas.as;
-        // ǲǴһȫµBLASͨһеBLASµǰBLASҪ
+        // 如果我们不是创建一个全新的BLAS，而是通过一个现有的BLAS来更新当前的这个BLAS，就需要设置这个参数
         buildInfo.srcAccelerationStructure = VK_NULL_HANDLE;
-        // ǰ洴Scratch BufferṩVulkan
+        // 把前面创建的Scratch Buffer提供给Vulkan
         buildInfo.scratchData.deviceAddress = scratchAddress;
 
-        // Ⱥ湹BLASʵռõڴСܻ֮ǰҪСѡѹһBLAS
-        // ǰʵռôС´һBLASʡڴռ䣬Ȼ֮ǰBLAS
-        // ѯɺBLASʵСҪõVkQueryPool
+        // 等后面正真构建完BLAS后，实际占用的内存大小可能会比之前计算的要小，所以这里可以选择压缩一下BLAS
+        // 就是按实际占用大小再重新创建一个BLAS，节省内存空间，然后销毁之前创建的BLAS
+        // 查询构建完成后的BLAS真实大小，需要用到VkQueryPool
         VkQueryPool queryPool = VK_NULL_HANDLE;
         if (isCompact)
         {
@@ -2221,19 +2269,19 @@ namespace ZXEngine
 
         ImmediatelyExecute([=](VkCommandBuffer cmd)
         {
-            // ǰ׼ VkAccelerationStructureBuildGeometryInfoKHR 湹BLAS
-            // 2,3Ǵһ VkAccelerationStructureBuildGeometryInfoKHR 
-            // Vulkanӿһһεôʱֻһ
-            // һһ VkAccelerationStructureBuildRangeInfoKHR Ķά
-            // ĵһӦ2,3 VkAccelerationStructureBuildGeometryInfoKHR 
-            // ĵڶӦÿ VkAccelerationStructureBuildGeometryInfoKHR  pGeometries 
-            // ԶάÿһRangeInfoնӦһ VkAccelerationStructureGeometryKHR
+            // 用前面准备的 VkAccelerationStructureBuildGeometryInfoKHR 正真构建BLAS
+            // 参数2,3是传递一个 VkAccelerationStructureBuildGeometryInfoKHR 数组
+            // 和其它Vulkan接口一样，这里可以一次调用创建多个，这里暂时只传一个
+            // 这里的最后一个参数，是一个 VkAccelerationStructureBuildRangeInfoKHR 的二维数组
+            // 数组的第一层对应参数2,3的 VkAccelerationStructureBuildGeometryInfoKHR 数组
+            // 数组的第二层对应每个 VkAccelerationStructureBuildGeometryInfoKHR 里的 pGeometries 数组
+            // 所以二维数组里的每一个RangeInfo都最终对应了一个 VkAccelerationStructureGeometryKHR
             vector<VkAccelerationStructureBuildRangeInfoKHR> ranges = { rangeInfo };
             const VkAccelerationStructureBuildRangeInfoKHR* ptr = ranges.data();
             vkCmdBuildAccelerationStructuresKHR(cmd, 1, &buildInfo, &ptr);
 
-            // һԴBLASȻScratch Bufferܻждͻ⣬ӸBarrier
-            // ʱһֻһʵûҪ
+            // 如果一次性创建多个BLAS，然后共用Scratch Buffer，可能会有读写冲突问题，加个Barrier
+            // 不过这里暂时一次只创建一个，其实没必要
             VkMemoryBarrier barrier = {};
             barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
             barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
@@ -2244,7 +2292,7 @@ namespace ZXEngine
             if (isCompact)
             {
                 vkResetQueryPool(device, queryPool, 0, 1);
-                // һǸոչõBLASʵռôСѽŵqueryPool(ӿҲԴһԲ)
+                // 查一下我们刚刚构建好的BLAS实际占用大小，把结果放到queryPool里(这个接口也可以传数组一次性查多个数据)
                 vkCmdWriteAccelerationStructuresPropertiesKHR(cmd, 1, &buildInfo.dstAccelerationStructure,
                     VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, queryPool, 0);
             }
@@ -2252,32 +2300,32 @@ namespace ZXEngine
 
         if (isCompact)
         {
-            // queryPoolȡǸողBLASʵʴС
+            // 从queryPool里获取我们刚刚查的BLAS实际大小数据
             vector<VkDeviceSize> compactSizes(1);
             vkGetQueryPoolResults(device, queryPool, 0, static_cast<uint32_t>(compactSizes.size()),
                 compactSizes.size() * sizeof(VkDeviceSize), compactSizes.data(), sizeof(VkDeviceSize), VK_QUERY_RESULT_WAIT_BIT);
             sizeInfo.accelerationStructureSize = compactSizes[0];
 
-            // ʵռôС´һBLAS Buffer
+            // 用实际占用大小重新创建一个BLAS Buffer
             VulkanBuffer newBLASBuffer = CreateBuffer(sizeInfo.accelerationStructureSize,
                 VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
                 VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-            // µѹBufferSizeϢ
+            // 新的压缩过的Buffer和Size信息
             VkAccelerationStructureCreateInfoKHR newBLASInfo = {};
             newBLASInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
             newBLASInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
             newBLASInfo.size = sizeInfo.accelerationStructureSize;
             newBLASInfo.buffer = newBLASBuffer.buffer;
 
-            // µѹBLAS
+            // 创建新的压缩过的BLAS
             VkAccelerationStructureKHR newAS = {};
             if (vkCreateAccelerationStructureKHR(device, &newBLASInfo, nullptr, &newAS) != VK_SUCCESS)
                 throw std::runtime_error("Create acceleration structure failed!");
 
             ImmediatelyExecute([=](VkCommandBuffer cmd)
             {
-                // ֮ǰõBLASݣƵµģСȷ˷ѵBLAS
+                // 把之前构建好的BLAS数据，复制到新的，大小精确不浪费的BLAS上
                 VkCopyAccelerationStructureInfoKHR copyInfo = {};
                 copyInfo.sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR;
                 copyInfo.src = buildInfo.dstAccelerationStructure;
@@ -2286,23 +2334,23 @@ namespace ZXEngine
                 vkCmdCopyAccelerationStructureKHR(cmd, &copyInfo);
             });
 
-            // ֮ǰBLAS
+            // 销毁之前的BLAS
             DestroyBuffer(meshBuffer->blas.buffer);
             vkDestroyAccelerationStructureKHR(device, meshBuffer->blas.as, nullptr);
 
-            // ´BLASֵ
+            // 把新创建的BLAS赋值过来
             meshBuffer->blas.as = newAS;
             meshBuffer->blas.buffer = newBLASBuffer;
         }
 
-        // ȡBLASDevice Address
+        // 获取BLAS的Device Address
         VkAccelerationStructureDeviceAddressInfoKHR addressInfo = {};
         addressInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
         addressInfo.accelerationStructure = meshBuffer->blas.as;
         meshBuffer->blas.deviceAddress = vkGetAccelerationStructureDeviceAddressKHR(device, &addressInfo);
         meshBuffer->blas.isBuilt = true;
 
-        // BLASɺScratch Buffer
+        // BLAS创建完成后立刻销毁Scratch Buffer
         DestroyBuffer(scratchBuffer);
     }
 
@@ -2661,7 +2709,7 @@ namespace ZXEngine
         }
     }
 
-    // VulkanҪ4
+    // Vulkan不需要第4个参数
     void RenderAPIVulkan::SetShaderTexture(Material* material, const string& name, uint32_t ID, uint32_t idx, bool allBuffer, bool isBuffer)
     {
         auto vulkanMaterialData = GetMaterialDataByIndex(material->data->GetID());
@@ -2683,7 +2731,7 @@ namespace ZXEngine
                     if (name == textureProperty.name)
                         binding = textureProperty.binding;
 
-                // ûҵĻ
+                // 没找到的话继续
                 if (binding == UINT32_MAX)
                     for (auto& textureProperty : material->shader->reference->shaderInfo.fragProperties.textureProperties)
                         if (name == textureProperty.name)
@@ -2728,7 +2776,7 @@ namespace ZXEngine
                 if (name == textureProperty.name)
                     binding = textureProperty.binding;
 
-            // ûҵĻ
+            // 没找到的话继续
             if (binding == UINT32_MAX)
                 for (auto& textureProperty : material->shader->reference->shaderInfo.fragProperties.textureProperties)
                     if (name == textureProperty.name)
@@ -2919,6 +2967,37 @@ namespace ZXEngine
         return VulkanDrawCommandArray[idx];
     }
 
+    uint32_t RenderAPIVulkan::GetNextInstanceBufferIndex()
+    {
+        uint32_t length = (uint32_t)VulkanInstanceBufferArray.size();
+
+        for (uint32_t i = 0; i < length; i++)
+        {
+            if (!VulkanInstanceBufferArray[i]->inUse)
+                return i;
+        }
+
+        VulkanInstanceBufferArray.push_back(new VulkanInstanceBuffer());
+
+        return length;
+    }
+
+    VulkanInstanceBuffer* RenderAPIVulkan::GetInstanceBufferByIndex(uint32_t idx)
+    {
+        return VulkanInstanceBufferArray[idx];
+    }
+
+    void RenderAPIVulkan::DestroyInstanceBufferByIndex(uint32_t idx)
+    {
+        auto instanceBuffer = GetInstanceBufferByIndex(idx);
+
+        for (auto& buffer : instanceBuffer->buffers)
+            DestroyBuffer(buffer);
+        instanceBuffer->buffers.clear();
+
+        instanceBuffer->inUse = false;
+    }
+
     uint32_t RenderAPIVulkan::GetNextTextureIndex()
     {
         uint32_t length = (uint32_t)VulkanTextureArray.size();
@@ -3133,12 +3212,12 @@ namespace ZXEngine
     }
 
 
-    // ------------------------------------------Vulkan--------------------------------------------
+    // ------------------------------------------建立各种Vulkan对象--------------------------------------------
 
 
     void RenderAPIVulkan::CreateVkInstance()
     {
-        // ʼvolkVulkan ExtensionָģOpenGLGLADûò˹׷ߵЩVulkanչ
+        // 初始化volk，用来加载Vulkan Extension函数指针的，类似OpenGL的GLAD，没有这个用不了光追管线的那些Vulkan扩展函数
         VkResult res = volkInitialize();
         if (res != VK_SUCCESS)
 			Debug::LogError("Could not initialize volk!");
@@ -3146,7 +3225,7 @@ namespace ZXEngine
         if (ProjectSetting::enableGraphicsDebug)
             validationLayersEnabled = CheckValidationLayerSupport();
 
-        // ݿԲݿÿӲ̣Nvidiaʲôʶһ£һЩϷߺ⴦ʲô
+        // 这个数据可以不填，好像这个数据可以让开发驱动的硬件厂商，比如Nvidia什么的识别一下，给一些引擎或者游戏走后门做特殊处理什么的
         VkApplicationInfo appInfo = {};
         appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
         appInfo.pApplicationName = "ZXEngineApplication";
@@ -3159,12 +3238,12 @@ namespace ZXEngine
         createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
         createInfo.pApplicationInfo = &appInfo;
 
-        // ȡ벻ͬƽ̨ĴϵͳнչϢ
+        // 获取与不同平台的窗体系统进行交互的扩展信息
         auto extensions = GetRequiredExtensions();
         createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
         createInfo.ppEnabledExtensionNames = extensions.data();
 
-        // ֤һ
+        // 如果开了验证层就添加一下
         if (validationLayersEnabled)
         {
             createInfo.enabledLayerCount = static_cast<uint32_t>(validationLayers.size());
@@ -3178,10 +3257,10 @@ namespace ZXEngine
         if (vkCreateInstance(&createInfo, nullptr, &vkInstance) != VK_SUCCESS)
             throw std::runtime_error("failed to create instance!");
 
-        // volkVulkan Instanceĺָ
+        // 用volk加载Vulkan Instance级别的函数指针
         volkLoadInstanceOnly(vkInstance);
 
-        // ֤㣬һ½DebugϢĻص
+        // 如果开了验证层，创建一下接收Debug信息的回调
         if (validationLayersEnabled)
             CreateDebugMessenger();
     }
@@ -3200,18 +3279,18 @@ namespace ZXEngine
 
     void RenderAPIVulkan::CreatePhysicalDevice()
     {
-        // ȡǰ豸֧VulkanԿ
+        // 获取当前设备支持Vulkan的显卡数量
         uint32_t deviceCount = 0;
         vkEnumeratePhysicalDevices(vkInstance, &deviceCount, nullptr);
         if (deviceCount == 0)
             throw std::runtime_error("failed to find GPUs with Vulkan support!");
 
-        // ȡ֧VulkanԿŵdevices
+        // 获取所有支持Vulkan的显卡，存放到devices里
         vector<VkPhysicalDevice> devices(deviceCount);
         vkEnumeratePhysicalDevices(vkInstance, &deviceCount, devices.data());
 
-        // Կҵһ
-        // ʵд߳ͬʱЩԿһ
+        // 遍历所有显卡，找到第一个符合我们需求的
+        // 其实可以写个多线程同时调用这些显卡，不过现在先随便用一个
         for (const auto& device : devices)
         {
             if (IsPhysicalDeviceSuitable(device))
@@ -3229,85 +3308,85 @@ namespace ZXEngine
 
     void RenderAPIVulkan::CreateLogicalDevice()
     {
-        // ȡǰ豸Ķд
+        // 获取当前物理设备的队列簇索引
         queueFamilyIndices = GetQueueFamilyIndices(physicalDevice);
 
-        // ߼豸ҪЩQueue
+        // 逻辑设备需要哪些Queue
         vector<VkDeviceQueueCreateInfo> queueCreateInfos;
         float queuePriority = 1.0f;
         set<uint32_t> uniqueQueueFamilies = { queueFamilyIndices.graphics, queueFamilyIndices.present };
-        // ждأ
+        // 有多个队列簇，遍历创建
         for (uint32_t queueFamily : uniqueQueueFamilies)
         {
             VkDeviceQueueCreateInfo queueCreateInfo = {};
             queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-            // ǰдضӦ
+            // 当前队列簇对应的索引
             queueCreateInfo.queueFamilyIndex = queueFamily;
-            // дҪʹõĶ
+            // 队列簇中需要申请使用的队列数量
             queueCreateInfo.queueCount = 1;
-            // Vulkanʹ0.01.0֮ĸȼӰִеĵãʹֻһҲǱ
+            // Vulkan允许使用0.0到1.0之间的浮点数分配队列优先级来影响命令缓冲区执行的调用，即使只有一个队列也是必须的
             queueCreateInfo.pQueuePriorities = &queuePriority;
             queueCreateInfos.push_back(queueCreateInfo);
         }
 
-        // ȷ豸ҪʹõĹ
+        // 明确设备要使用的功能特性
         VkPhysicalDeviceFeatures2 deviceFeatures = {};
         deviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
-        // öԸԲ֧
+        // 启用对各向异性采样的支持
         deviceFeatures.features.samplerAnisotropy = VK_TRUE;
         deviceFeatures.features.geometryShader = VK_TRUE;
         deviceFeatures.features.sampleRateShading = VK_TRUE;
         deviceFeatures.features.shaderInt64 = VK_TRUE;
 
-        // ӹ׷Ҫչ
-        // Ӧչ: VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME
+        // 添加光追管线需要的扩展和特性
+        // 对应扩展: VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME
         VkPhysicalDeviceAccelerationStructureFeaturesKHR accelerationFeature = {};
         accelerationFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR;
         accelerationFeature.accelerationStructure = VK_TRUE;
         deviceFeatures.pNext = &accelerationFeature;
-        // Ӧչ: VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME
+        // 对应扩展: VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME
         VkPhysicalDeviceRayTracingPipelineFeaturesKHR rtPipelineFeature = {};
         rtPipelineFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR;
         rtPipelineFeature.rayTracingPipeline = VK_TRUE;
         accelerationFeature.pNext = &rtPipelineFeature;
 
-        // ShaderʱҪչ(׷ShaderҪ)
-        // Ӧչ: VK_KHR_SHADER_CLOCK_EXTENSION_NAME
+        // 添加Shader计时器需要的扩展(光追Shader要用)
+        // 对应扩展: VK_KHR_SHADER_CLOCK_EXTENSION_NAME
         VkPhysicalDeviceShaderClockFeaturesKHR shaderClockFeature = {};
         shaderClockFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR;
         shaderClockFeature.shaderDeviceClock = VK_TRUE;
         shaderClockFeature.shaderSubgroupClock = VK_TRUE;
         rtPipelineFeature.pNext = &shaderClockFeature;
 
-        // Vulkan 1.2
+        // 添加Vulkan 1.2的特性
         VkPhysicalDeviceVulkan12Features deviceVulkan12Features = {};
         deviceVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
-        // öDevice Address֧
+        // 启用对Device Address的支持
         deviceVulkan12Features.bufferDeviceAddress = VK_TRUE;
         deviceVulkan12Features.runtimeDescriptorArray = VK_TRUE;
         deviceVulkan12Features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
         deviceVulkan12Features.hostQueryReset = VK_TRUE;
-        // ִ֧׷ShaderModuleʱShaderĶBufferݽṹ16ֽ
+        // 支持创建光追ShaderModule时，Shader里的顶点和索引等Buffer的数据结构不对齐16字节
         deviceVulkan12Features.scalarBlockLayout = VK_TRUE;
         shaderClockFeature.pNext = &deviceVulkan12Features;
         deviceVulkan12Features.pNext = nullptr;
 
-        // ߼豸Ϣ
+        // 创建逻辑设备的信息
         VkDeviceCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        // ʹǰṹ
+        // 使用前面的两个结构体填充
         createInfo.pQueueCreateInfos = queueCreateInfos.data();
         createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
 
-        // VkDeviceչ
+        // 添加VkDevice级别的扩展和特性
         createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
         createInfo.ppEnabledExtensionNames = deviceExtensions.data();
-        // Vulkan 1.1֮pNextʽԣpEnabledFeatures
+        // Vulkan 1.1之后，用这种pNext方式添加特性，而不是pEnabledFeatures
         createInfo.pNext = &deviceFeatures;
         createInfo.pEnabledFeatures = VK_NULL_HANDLE;
 
-        // VkDevice֤
-        // ֤㣬֤Ϣӽȥ
+        // 添加VkDevice级别验证层
+        // 如果启用了验证层，把验证层信息添加进去
         if (validationLayersEnabled)
         {
             createInfo.enabledLayerCount = static_cast<uint32_t>(validationLayers.size());
@@ -3318,24 +3397,24 @@ namespace ZXEngine
             createInfo.enabledLayerCount = 0;
         }
 
-        // vkCreateDeviceʵ߼豸
-        // ߼豸VkInstanceֱӽԲֻ豸
+        // 调用vkCreateDevice函数来创建实例化逻辑设备
+        // 逻辑设备不与VkInstance直接交互，所以参数里只有物理设备
         if (vkCreateDevice(physicalDevice, &createInfo, nullptr, &device) != VK_SUCCESS)
             throw std::runtime_error("failed to create logical device!");
         
-        // volkVulkan Deviceĺָ
+        // 用volk加载Vulkan Device级别的函数指针
         volkLoadDevice(device);
 
-        // ߼豸ʱ򣬶Ҳһ𴴽ˣȡв֮
-        // ߼豸дأʹ洢ȡбָ
-        // ΪֻǴдشһУҪʹ0
+        // 逻辑设备创建的时候，队列也一起创建了，获取队列并保存下来方便之后调用
+        // 参数是逻辑设备，队列簇，队列索引和存储获取队列变量句柄的指针
+        // 因为我们只是从这个队列簇创建一个队列，所以需要使用索引0
         vkGetDeviceQueue(device, queueFamilyIndices.graphics, 0, &graphicsQueue);
         vkGetDeviceQueue(device, queueFamilyIndices.present, 0, &presentQueue);
     }
 
     void RenderAPIVulkan::CreateMemoryAllocator()
     {
-        // ΪvolkֶVulkanˣҪVMAݻȡַķVMAȷȡVulkan
+        // 因为用volk库手动加载所有Vulkan函数了，所以这里要给VMA传递获取函数地址的方法，让VMA可以正确获取Vulkan函数
         VmaVulkanFunctions vmaVkFunctions = {};
         vmaVkFunctions.vkGetInstanceProcAddr = vkGetInstanceProcAddr;
         vmaVkFunctions.vkGetDeviceProcAddr = vkGetDeviceProcAddr;
@@ -3346,7 +3425,7 @@ namespace ZXEngine
         vmaInfo.physicalDevice = physicalDevice;
         vmaInfo.device = device;
         vmaInfo.flags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
-        // ֶVulkanNULL
+        // 如果不手动加载Vulkan函数，这里可以填NULL
         vmaInfo.pVulkanFunctions = &vmaVkFunctions;
 
         vmaCreateAllocator(&vmaInfo, &vmaAllocator);
@@ -3356,12 +3435,12 @@ namespace ZXEngine
     {
         VkCommandPoolCreateInfo poolInfo{};
         poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        // flagsҪɲҪҪflagsĻ|
-        // VK_COMMAND_POOL_CREATE_TRANSIENT_BIT: ʾǳƵ¼¼(ܻıڴΪ)
-        // VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT: ¼¼û־еһ
+        // 这个flags可要可不要，如果要多个flags的话用|即可
+        // VK_COMMAND_POOL_CREATE_TRANSIENT_BIT: 提示命令缓冲区非常频繁的重新记录新命令(可能会改变内存分配行为)
+        // VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT: 允许命令缓冲区单独重新记录，没有这个标志，所有的命令缓冲区都必须一起重置
         poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        // command bufferͨһ豸ύִеģÿֻܷڵһͶύ
-        // ǽ¼ڻͼgraphicsFamily
+        // command buffer是通过在一个设备队列上提交它们来执行的，每个命令池只能分配在单一类型队列上提交的命令缓冲区
+        // 我们将记录用于绘图的命令，所以用graphicsFamily
         poolInfo.queueFamilyIndex = queueFamilyIndices.graphics;
 
         if (vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool) != VK_SUCCESS)
@@ -3369,65 +3448,65 @@ namespace ZXEngine
     }
 
     void RenderAPIVulkan::CreateSurface() {
-        // surfaceľ崴Ҫƽ̨ģֱGLFWװõĽӿ
+        // surface的具体创建过程是要区分平台的，这里直接用GLFW封装好的接口来创建
         if (glfwCreateWindowSurface(vkInstance, static_cast<GLFWwindow*>(WindowManager::GetInstance()->GetWindow()), nullptr, &surface) != VK_SUCCESS)
             throw std::runtime_error("failed to create window surface!");
     }
 
     void RenderAPIVulkan::CreateSwapChain()
     {
-        // ѯӲֵ֧Ľ
+        // 查询硬件支持的交换链设置
         SwapChainSupportDetails swapChainSupport = GetSwapChainSupportDetails(physicalDevice);
 
-        // ѡһͼʽ
+        // 选择一个图像格式
         VkSurfaceFormatKHR surfaceFormat = ChooseSwapSurfaceFormat(swapChainSupport.formats);
-        // ѡһpresentģʽ(ͼ񽻻ģʽ)
+        // 选择一个present模式(就是图像交换的模式)
         VkPresentModeKHR presentMode = ChooseSwapPresentMode(swapChainSupport.presentModes);
-        // ѡһʵͼֱ
+        // 选择一个合适的图像分辨率
         VkExtent2D extent = ChooseSwapExtent(swapChainSupport.capabilities);
 
-        // еͼΪеĳȡָʱͼСǽԴ1ͼʵػ塣
+        // 交换链中的图像数量，可以理解为交换队列的长度。它指定运行时图像的最小数量，我们将尝试大于1的图像数量，以实现三重缓冲。
         uint32_t imageCount = swapChainSupport.capabilities.minImageCount + 1;
-        // maxImageCount0ͱʾûơ0ͱʾƣôֻõmaxImageCount
+        // 如果maxImageCount等于0，就表示没有限制。如果大于0就表示有限制，那么我们最大只能设置到maxImageCount
         if (swapChainSupport.capabilities.maxImageCount > 0 && imageCount > swapChainSupport.capabilities.maxImageCount)
             imageCount = swapChainSupport.capabilities.maxImageCount;
 
-        // Ľṹ
+        // 创建交换链的结构体
         VkSwapchainCreateInfoKHR createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
-        // ǵsurface
+        // 绑定我们的surface
         createInfo.surface = surface;
-        // ǰȡ
+        // 把前面获取的数据填上
         createInfo.minImageCount = imageCount;
         createInfo.imageFormat = surfaceFormat.format;
         createInfo.imageColorSpace = surfaceFormat.colorSpace;
         createInfo.presentMode = presentMode;
         createInfo.imageExtent = extent;
 
-        // imageArrayLayersָÿͼжٲ㣬һ㶼1
+        // imageArrayLayers指定每个图像有多少层，一般都是1
         createInfo.imageArrayLayers = 1;
-        // ֶָڽжͼеľ
-        // ֱӶǽȾζΪɫ
-        // ҲȽͼȾΪͼ񣬽к
-        // ¿ʹVK_IMAGE_USAGE_TRANSFER_DST_BITֵʹڴȾͼ䵽ͼ
+        // 这个字段指定在交换链中对图像进行的具体操作
+        // 我们如果直接对它们进行渲染，这意味着它们作为颜色附件
+        // 也可以首先将图像渲染为单独的图像，进行后处理操作
+        // 在这种情况下可以使用像VK_IMAGE_USAGE_TRANSFER_DST_BIT这样的值，并使用内存操作将渲染的图像传输到交换链图像队列
         createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 
-        // ָδдصĽͼ
+        // 指定如何处理跨多个队列簇的交换链图像
         uint32_t tmpQueueFamilyIndices[] = { queueFamilyIndices.graphics, queueFamilyIndices.present };
-        // graphicsдpresentationдزͬ
-        // ǽgraphicsлƽͼȻһpresentationύ
-        // дͼַ
-        // VK_SHARING_MODE_EXCLUSIVE: ͬһʱͼֻܱһдռãдҪȨҪȷַָʽṩõ
-        // VK_SHARING_MODE_CONCURRENT: ͼԱдطʣҪȷȨϵ
-        // дزͬʱʹconcurrentģʽ⴦ͼȨϵݣΪЩ漰ٸ
+        // 如果graphics队列簇与presentation队列簇不同，会出现如下情形
+        // 我们将从graphics队列中绘制交换链的图像，然后在另一个presentation队列中提交他们
+        // 多队列处理图像有两种方法
+        // VK_SHARING_MODE_EXCLUSIVE: 同一时间图像只能被一个队列簇占用，如果其他队列簇需要其所有权需要明确指定，这种方式提供了最好的性能
+        // VK_SHARING_MODE_CONCURRENT: 图像可以被多个队列簇访问，不需要明确所有权从属关系
+        // 如果队列簇不同，暂时使用concurrent模式，避免处理图像所有权从属关系的内容，因为这些会涉及不少概念
         if (queueFamilyIndices.graphics != queueFamilyIndices.present)
         {
             createInfo.imageSharingMode = VK_SHARING_MODE_CONCURRENT;
-            // ConcurrentģʽҪԤָдȨϵͨqueueFamilyIndexCountpQueueFamilyIndicesй
+            // Concurrent模式需要预先指定队列簇所有权从属关系，通过queueFamilyIndexCount和pQueueFamilyIndices参数进行共享
             createInfo.queueFamilyIndexCount = 2;
             createInfo.pQueueFamilyIndices = tmpQueueFamilyIndices;
         }
-        // graphicsдغpresentationдͬҪʹexclusiveģʽΪconcurrentģʽҪͬĶд
+        // 如果graphics队列簇和presentation队列簇相同，我们需要使用exclusive模式，因为concurrent模式需要至少两个不同的队列簇
         else
         {
             createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
@@ -3435,35 +3514,35 @@ namespace ZXEngine
             createInfo.pQueueFamilyIndices = nullptr; // Optional
         }
 
-        // ֧(supportedTransforms in capabilities)ǿΪͼָĳЩת߼
-        // 90˳ʱתˮƽתҪκtransoformԼ򵥵ΪcurrentTransoform
+        // 如果交换链支持(supportedTransforms in capabilities)，我们可以为交换链图像指定某些转换逻辑
+        // 比如90度顺时针旋转或者水平反转。如果不需要任何transoform操作，可以简单的设置为currentTransoform
         createInfo.preTransform = swapChainSupport.capabilities.currentTransform;
 
-        // compositeAlphaֶָalphaͨǷӦĴϵͳлϲԸùܣ򵥵VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR
+        // compositeAlpha字段指定alpha通道是否应用于与其他的窗体系统进行混合操作。如果忽略该功能，简单的填VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR
         createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
 
-        // clippedԱΪVK_TRUEζǲıڱεݣĴǰʱȾĲݴڿ֮
-        // ҪȡЩػݽдԿü
+        // 如果clipped成员设置为VK_TRUE，意味着我们不关心被遮蔽的像素数据，比如由于其他的窗体置于前方时或者渲染的部分内容存在于可是区域之外
+        // 除非真的需要读取这些像素获数据进行处理，否则可以开启裁剪获得最佳性能
         createInfo.clipped = VK_TRUE;
 
-        // VulkanʱĳЩ±滻細ڵС߽Ҫ·ͼ
-        // £ʵҪ·䴴ڴֶָԾɵãԻԴ
-        // ҲԼֶپɽ´ʹ
-        // һ㣬ھɽչʾʱȻƺͼ½ҪȾɽִ꣬٣µģٻ
+        // Vulkan运行时，交换链可能在某些条件下被替换，比如窗口调整大小或者交换链需要重新分配更大的图像队列
+        // 在这种情况下，交换链实际上需要重新分配创建，可以在此字段中指定对旧的引用，用以回收资源
+        // 也可以自己手动销毁旧交换链再重新创建，不使用这个参数
+        // 但是用这个参数会好一点，好像可以在旧交换链还在展示的时候先绘制后续图像到新交换链，否则需要等旧交换链任务执行完，再销毁，创建新的，再绘制
         createInfo.oldSwapchain = VK_NULL_HANDLE;
 
-        // 
+        // 创建交换链
         if (vkCreateSwapchainKHR(device, &createInfo, nullptr, &swapChain) != VK_SUCCESS) {
             throw std::runtime_error("failed to create swap chain!");
         }
 
-        // ȡһ½ͼimageCountʼͼʵʴĲһô࣬Ҫ»ȡһ
+        // 获取一下交换链里图像的数量，这个imageCount变量最开始是我们期望的图像数量，但是实际创建的不一定是这么多，所以要重新获取一下
         vkGetSwapchainImagesKHR(device, swapChain, &imageCount, nullptr);
-        // ʵͼvectorС
+        // 根据实际图像数量重新设置vector大小
         swapChainImages.resize(imageCount);
-        // ѽϵͼ洢swapChainImages
+        // 把交换链上的图像存储到swapChainImages中
         vkGetSwapchainImagesKHR(device, swapChain, &imageCount, swapChainImages.data());
-        // һ½ͼĸʽͷֱ
+        // 存一下交换链图像的格式和分辨率
         swapChainImageFormat = surfaceFormat.format;
         swapChainExtent = extent;
     }
@@ -3504,7 +3583,7 @@ namespace ZXEngine
             framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
             framebufferInfo.width = swapChainExtent.width;
             framebufferInfo.height = swapChainExtent.height;
-            // layerָͼеĲͼǵͼ˲Ϊ1
+            // layer是指定图像数组中的层数，交换链图像是单个图像，因此层数为1
             framebufferInfo.layers = 1;
 
             if (vkCreateFramebuffer(device, &framebufferInfo, nullptr, &vulkanFBO->frameBuffers[i]) != VK_SUCCESS)
@@ -3528,20 +3607,20 @@ namespace ZXEngine
     }
 
 
-    // ----------------------------------------Vulkanĸ----------------------------------------
+    // ----------------------------------------建立Vulkan对象的辅助函数----------------------------------------
 
 
     bool RenderAPIVulkan::CheckValidationLayerSupport()
     {
-        // ȡпõLayer
+        // 获取所有可用的Layer数量
         uint32_t layerCount = 0;
         vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
 
-        // ȡпLayer
+        // 获取所有可用Layer的属性
         vector<VkLayerProperties> availableLayers(layerCount);
         vkEnumerateInstanceLayerProperties(&layerCount, availableLayers.data());
 
-        // ǵvalidationLayersеlayerǷavailableLayersб
+        // 检查我们的validationLayers中的所有layer是否存在于availableLayers列表中
         for (const char* layerName : validationLayers)
         {
             bool layerFound = false;
@@ -3562,28 +3641,28 @@ namespace ZXEngine
 
     vector<const char*> RenderAPIVulkan::GetRequiredExtensions()
     {
-        // Vulaknƽ̨APIֵ֧(ʱ)ζҪһչ벻ͬƽ̨Ĵϵͳн
-        // GLFWһúйصչϢ
+        // Vulakn对于平台特性是零API支持的(至少暂时这样)，这意味着需要一个扩展才能与不同平台的窗体系统进行交互
+        // GLFW有一个方便的内置函数，返回它有关的扩展信息
         uint32_t glfwExtensionCount = 0;
         const char** glfwExtensions;
         glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
 
         vector<const char*> extensions;
 
-        // GLFWȡչ
+        // 添加GLFW获取的扩展
         for (unsigned int i = 0; i < glfwExtensionCount; i++)
             extensions.push_back(glfwExtensions[i]);
 
-        // DebugDebugչ
+        // 如果开启了Debug，添加Debug的扩展
         if (validationLayersEnabled)
             extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 
         return extensions;
     }
 
-    // VulkanDebugչܣvkCreateDebugUtilsMessengerEXTԶ
-    // ҪͨvkGetInstanceProcAddrֶȡַ
-    // Ƿװһ»ȡvkCreateDebugUtilsMessengerEXTַĹ
+    // Vulkan的Debug是扩展功能，所以vkCreateDebugUtilsMessengerEXT并不会自动加载
+    // 想调用它需要通过vkGetInstanceProcAddr手动获取函数地址
+    // 这个函数就是封装了一下获取vkCreateDebugUtilsMessengerEXT地址并调用它的过程
     VkResult RenderAPIVulkan::CreateDebugUtilsMessengerEXT(const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pDebugMessenger)
     {
         auto func = (PFN_vkCreateDebugUtilsMessengerEXT)vkGetInstanceProcAddr(vkInstance, "vkCreateDebugUtilsMessengerEXT");
@@ -3593,7 +3672,7 @@ namespace ZXEngine
             return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
 
-    // ĺVkDebugUtilsMessengerEXTҪֶvkDestroyDebugUtilsMessengerEXT
+    // 如果用上面的函数创建了VkDebugUtilsMessengerEXT变量，需要手动调用vkDestroyDebugUtilsMessengerEXT清理
     void RenderAPIVulkan::DestroyDebugUtilsMessengerEXT(VkDebugUtilsMessengerEXT debugMessenger, const VkAllocationCallbacks* pAllocator)
     {
         auto func = (PFN_vkDestroyDebugUtilsMessengerEXT)vkGetInstanceProcAddr(vkInstance, "vkDestroyDebugUtilsMessengerEXT");
@@ -3603,41 +3682,41 @@ namespace ZXEngine
 
     bool RenderAPIVulkan::IsPhysicalDeviceSuitable(VkPhysicalDevice device)
     {
-        // name, typeԼVulkan汾Ȼ豸
+        // 获得name, type以及Vulkan版本等基本的设备属性
         VkPhysicalDeviceProperties deviceProperties;
         vkGetPhysicalDeviceProperties(device, &deviceProperties);
-        // Ҫ
+        // 需要独显
         if (deviceProperties.deviceType != VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU)
             return false;
 
-        // ѯѹ64λͶͼȾ(VRǳ)ȿѡ֧ܵ
+        // 查询对纹理压缩，64位浮点数和多视图渲染(VR非常有用)等可选功能的支持
         VkPhysicalDeviceFeatures deviceFeatures;
         vkGetPhysicalDeviceFeatures(device, &deviceFeatures);
-        // Ҫּ֧ɫ
+        // 需要支持几何着色器
         if (!deviceFeatures.geometryShader)
             return false;
 
-        // Ҫָ֧Բ
+        // 需要支持各项异性采样
         if (!deviceFeatures.samplerAnisotropy)
             return false;
 
-        // ѯĶд
+        // 查询符合条件的队列簇
         QueueFamilyIndices indices = GetQueueFamilyIndices(device);
         if (!indices.isComplete())
             return false;
 
-        // Ƿ֧Ҫչ
+        // 检查是否支持所需要的扩展
         if (!CheckDeviceExtensionSupport(device))
             return false;
 
-        // 齻Ƿ
+        // 检查交换链是否完整
         SwapChainSupportDetails swapChainSupport = GetSwapChainSupportDetails(device);
-        // ֧һͼʽһPresentģʽ
+        // 至少支持一个图像格式和一个Present模式
         bool swapChainAdequate = !swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty();
         if (!swapChainAdequate)
             return false;
 
-        // кܶԿͨӲһȨأȻѡʵ
+        // 如果有很多显卡，可以通过给各种硬件特性一个权重，然后优先选择最合适的
         return true;
     }
 
@@ -3645,32 +3724,32 @@ namespace ZXEngine
     {
         QueueFamilyIndices indices;
 
-        // ȡ豸ӵеĶд
+        // 获取设备拥有的队列簇数量
         uint32_t queueFamilyCount = 0;
         vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
 
-        // ȡждػ
+        // 获取所有队列簇获的属性
         vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
         vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
 
-        // дأȡ֧Ķд
+        // 遍历队列簇，获取支持我们需求的队列簇
         uint32_t i = 0;
         for (const auto& queueFamily : queueFamilies)
         {
-            // ǰдǷ֧ͼδ
+            // 当前队列簇是否支持图形处理
             if (queueFamily.queueCount > 0 && queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)
                 indices.graphics = i;
 
-            // Ƿ֧VkSurfaceKHR
+            // 是否支持VkSurfaceKHR
             VkBool32 presentSupport = false;
             vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
-            // ֵ֧Ļ¼һ
+            // 支持的话记录一下索引
             if (queueFamily.queueCount > 0 && presentSupport)
                 indices.present = i;
 
-            // ע֧surfacegraphicĶдزһͬһ
-            // ʹЩдص߼Ҫô̶֧surfacegraphicĶдͬ(ǲͬһ)
-            // ҪôҶдصʱȷָͬʱ֧surfacegraphicȻ󱣴ͬʱ֧ҪĶд(ܻܿõ)
+            // 注意这里支持surface和graphic的队列簇不一定是同一个
+            // 后续使用这些队列簇的逻辑，要么固定按照支持surface和graphic的队列簇是两个不同的来处理(这样无论是不是同一个都不会出错)
+            // 要么这里查找队列簇的时候，明确指定必须同时支持surface和graphic，然后保存同时支持这两个要求的队列簇索引(性能可能会好点)
 
             if (indices.isComplete())
                 break;
@@ -3678,26 +3757,26 @@ namespace ZXEngine
             i++;
         }
 
-        // ؾ߱ͼĶ
+        // 返回具备图形能力的队列
         return indices;
     }
 
     bool RenderAPIVulkan::CheckDeviceExtensionSupport(VkPhysicalDevice device) {
-        // ȡ豸ֵ֧չ
+        // 获取物理设备支持的扩展数量
         uint32_t extensionCount;
         vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
 
-        // ȡֵ֧ľϢ
+        // 获取所支持的具体信息
         vector<VkExtensionProperties> availableExtensions(extensionCount);
         vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
 
-        // ԶdeviceExtensionsתsetݽṹ(Ϊ˱2forѭeraseͬʱҲĶԭ)
+        // 把我们自定义的deviceExtensions转换成set数据结构(为了避免后面2层for循环的erase，同时也不改动原数据)
         set<string> requiredExtensions(deviceExtensions.begin(), deviceExtensions.end());
-        // 豸ֵ֧չҪչɾ
+        // 遍历物理设备所支持的扩展，逐个从我们需要的扩展集合中删除
         for (const auto& extension : availableExtensions)
             requiredExtensions.erase(extension.extensionName);
 
-        // ȫɾˣ˵Ҫչֵ֧ģ˵һЩҪչ֧
+        // 如果全部删除完了，说明我们所需要的扩展都是支持的，否则说明还有一些我们需要的扩展不被支持
         return requiredExtensions.empty();
     }
 
@@ -3705,25 +3784,25 @@ namespace ZXEngine
     {
         SwapChainSupportDetails details;
 
-        // VkPhysicalDeviceVkSurfaceKHRȡֵ֧ľ幦ܣǽĺ
+        // 根据VkPhysicalDevice和VkSurfaceKHR获取所支持的具体功能，这两个对象是交换链的核心组件
         vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device, surface, &details.capabilities);
 
-        // ѯֵ֧surfaceʽЩ
+        // 查询支持的surface格式有哪些
         uint32_t formatCount;
         vkGetPhysicalDeviceSurfaceFormatsKHR(device, surface, &formatCount, nullptr);
         if (formatCount != 0)
         {
-            // ʽ
+            // 填充格式数据
             details.formats.resize(formatCount);
             vkGetPhysicalDeviceSurfaceFormatsKHR(device, surface, &formatCount, details.formats.data());
         }
 
-        // ѯֵ֧surfaceģʽЩ
+        // 查询支持的surface模式有哪些
         uint32_t presentModeCount;
         vkGetPhysicalDeviceSurfacePresentModesKHR(device, surface, &presentModeCount, nullptr);
         if (presentModeCount != 0) {
             details.presentModes.resize(presentModeCount);
-            // ģʽ
+            // 填充模式数据
             vkGetPhysicalDeviceSurfacePresentModesKHR(device, surface, &presentModeCount, details.presentModes.data());
         }
 
@@ -3732,7 +3811,7 @@ namespace ZXEngine
 
     void RenderAPIVulkan::GetPhysicalDeviceProperties()
     {
-        // 豸Ĺ׷
+        // 物理设备的光线追踪属性
         rtPhysicalProperties = {};
         rtPhysicalProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR;
 
@@ -3745,7 +3824,7 @@ namespace ZXEngine
         physicalDeviceProperties.pNext = &rtPhysicalProperties;
         vkGetPhysicalDeviceProperties2(physicalDevice, &physicalDeviceProperties);
 
-        // ȡͬʱ֧ColorDepth
+        // 取同时支持Color和Depth的最大数量
         VkSampleCountFlags counts = physicalDeviceProperties.properties.limits.framebufferColorSampleCounts & physicalDeviceProperties.properties.limits.framebufferDepthSampleCounts;
         if (counts & VK_SAMPLE_COUNT_64_BIT) { msaaSamplesCount = VK_SAMPLE_COUNT_64_BIT; }
         else if (counts & VK_SAMPLE_COUNT_32_BIT) { msaaSamplesCount = VK_SAMPLE_COUNT_32_BIT; }
@@ -3761,7 +3840,7 @@ namespace ZXEngine
 
     VkSurfaceFormatKHR RenderAPIVulkan::ChooseSwapSurfaceFormat(const vector<VkSurfaceFormatKHR>& availableFormats)
     {
-        // һûĸʽɫʿռϣ
+        // 查一下有没有我们理想的格式和色彩空间组合，优先用这个
         for (const auto& availableFormat : availableFormats)
         {
             if (availableFormat.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR && (
@@ -3770,23 +3849,23 @@ namespace ZXEngine
                 return availableFormat;
         }
 
-        // ûĸʽֱѡһʽ
-        // ʵʱҲԱһavailableFormatsԼдһһԽϺõĳ
+        // 如果没有理想的格式，我们直接选择第一个格式
+        // 其实这个时候我们也可以遍历一下availableFormats，自己写一个规则挑一个相对较好的出来
         return availableFormats[0];
     }
 
     VkPresentModeKHR RenderAPIVulkan::ChooseSwapPresentMode(const vector<VkPresentModeKHR> availablePresentModes) {
-        // Vulkanĸģʽʹ:
-        // 1VK_PRESENT_MODE_IMMEDIATE_KHR
-        // Ӧóύͼ䵽Ļ֣ģʽܻ˺Ч
-        // 2VK_PRESENT_MODE_FIFO_KHR
-        // һУʾҪˢµʱʾ豸Ӷеǰȡͼ񣬲ҳȾɵͼеĺ档ĳȴֹģƵϷĴֱͬơʾ豸ˢʱ̱Ϊֱжϡ
-        // 3VK_PRESENT_MODE_FIFO_RELAXED_KHR
-        // ģʽһģʽвͬĵطΪӦóӳ٣һֱͬźʱпˣȴһֱͬźţǽͼֱӴܵ͡¿ɼ˺Ч
-        // 4VK_PRESENT_MODE_MAILBOX_KHR
-        // ǵڶģʽı֡ʱѡµ滻ɵͼ񣬴ӶӦóΡģʽͨʵػ׼Ĵֱͬ˫ȣЧӳٴ˺Ч
-
-        // Ĭϵģʽ
+        // 在Vulkan中有四个模式可以使用:
+        // 1，VK_PRESENT_MODE_IMMEDIATE_KHR
+        // 应用程序提交的图像被立即传输到屏幕呈现，这种模式可能会造成撕裂效果。
+        // 2，VK_PRESENT_MODE_FIFO_KHR
+        // 交换链被看作一个队列，当显示内容需要刷新的时候，显示设备从队列的前面获取图像，并且程序将渲染完成的图像插入队列的后面。如果队列是满的程序会等待。这种规模与视频游戏的垂直同步很类似。显示设备的刷新时刻被称为“垂直中断”。
+        // 3，VK_PRESENT_MODE_FIFO_RELAXED_KHR
+        // 该模式与上一个模式略有不同的地方为，如果应用程序存在延迟，即接受最后一个垂直同步信号时队列空了，将不会等待下一个垂直同步信号，而是将图像直接传送。这样做可能导致可见的撕裂效果。
+        // 4，VK_PRESENT_MODE_MAILBOX_KHR
+        // 这是第二种模式的变种。当交换链队列满的时候，选择新的替换旧的图像，从而替代阻塞应用程序的情形。这种模式通常用来实现三重缓冲区，与标准的垂直同步双缓冲相比，它可以有效避免延迟带来的撕裂效果。
+
+        // 默认的模式
         VkPresentModeKHR bestMode = VK_PRESENT_MODE_FIFO_KHR;
 
         for (const auto& availablePresentMode : availablePresentModes)
@@ -3801,9 +3880,9 @@ namespace ZXEngine
     }
 
     VkExtent2D RenderAPIVulkan::ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities) {
-        // capabilitiesͨvkGetPhysicalDeviceSurfaceCapabilitiesKHRӿڲѯ
+        // 这个capabilities数据是通过vkGetPhysicalDeviceSurfaceCapabilitiesKHR接口查询出来的
 
-        // currentExtentĸ߿һuint32ֵ˵ԼһΧֵ
+        // currentExtent的高宽如果是一个特殊的uint32最大值，就说明允许我们自己在一定范围内自由设置这个值
         if (capabilities.currentExtent.width != std::numeric_limits<uint32_t>::max())
         {
             int width, height;
@@ -3815,13 +3894,13 @@ namespace ZXEngine
                 static_cast<uint32_t>(height)
             };
 
-            // minImageExtentmaxImageExtent֮
+            // 收敛到minImageExtent和maxImageExtent之间
             actualExtent.width = Math::Max(capabilities.minImageExtent.width, Math::Min(capabilities.maxImageExtent.width, actualExtent.width));
             actualExtent.height = Math::Max(capabilities.minImageExtent.height, Math::Min(capabilities.maxImageExtent.height, actualExtent.height));
 
             return actualExtent;
         }
-        // ֻʹòѯcurrentExtent
+        // 否则我们只能使用查询到的currentExtent
         else
         {
             return capabilities.currentExtent;
@@ -3832,14 +3911,14 @@ namespace ZXEngine
     {
         int width = 0, height = 0;
         glfwGetFramebufferSize(static_cast<GLFWwindow*>(WindowManager::GetInstance()->GetWindow()), &width, &height);
-        // ڴСΪ0(С)ôȴֱµ
+        // 如果窗口大小为0(被最小化了)，那么程序就在这里等待，直到窗口重新弹出
         while (width == 0 || height == 0)
         {
             glfwGetFramebufferSize(static_cast<GLFWwindow*>(WindowManager::GetInstance()->GetWindow()), &width, &height);
             glfwWaitEvents();
         }
 
-        // ȵ߼豸ִ굱ǰָռԴ
+        // 先等逻辑设备执行完当前的所有指令，不再占用资源
         vkDeviceWaitIdle(device);
 
 #ifdef ZX_EDITOR
@@ -3852,12 +3931,12 @@ namespace ZXEngine
         GlobalData::srcHeight = newWindowHeight;
 #endif
 
-        // нԴȫ´
+        // 清理所有交换链相关资源，全部重新创建
         CleanUpSwapChain();
         CreateSwapChain();
         CreatePresentFrameBuffer();
 
-        // ´дСʹڱһµFBO
+        // 重新创建所有大小和窗口保持一致的FBO
         FBOManager::GetInstance()->RecreateAllFollowWindowFBO();
 
 #ifdef ZX_EDITOR
@@ -3931,7 +4010,7 @@ namespace ZXEngine
         }
 
         VkDeviceSize bufferSize = static_cast<VkDeviceSize>(properties[properties.size() - 1].offset + properties[properties.size() - 1].size);
-        // Uniform BufferĴСminUniformBufferOffsetAlignment룬Ҳ̫ȷǲǱҪ
+        // 让Uniform Buffer的大小和minUniformBufferOffsetAlignment对齐，我不太确定这个步骤是不是必要的
         VkDeviceSize remainder = bufferSize % minUniformBufferOffsetAlignment;
         if (remainder > 0)
             bufferSize = bufferSize - remainder + minUniformBufferOffsetAlignment;
@@ -3978,7 +4057,7 @@ namespace ZXEngine
     {
         VkFenceCreateInfo fenceInfo = {};
         fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        // ʱΪsignaled״̬(һεvkWaitForFencesԶȲ)
+        // 创建时立刻设置为signaled状态(否则第一次的vkWaitForFences永远等不到结果)
         fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
         if (vkCreateFence(device, &fenceInfo, nullptr, &fence) != VK_SUCCESS)
             throw std::runtime_error("failed to create fence objects!");
@@ -3999,26 +4078,26 @@ namespace ZXEngine
         imageInfo.imageType = VK_IMAGE_TYPE_2D;
         imageInfo.extent.width = width;
         imageInfo.extent.height = height;
-        // άȵ3DӦö1
+        // 纹理第三个维度的像素数量，如果不是3D纹理应该都是1
         imageInfo.extent.depth = 1;
         imageInfo.mipLevels = mipLevels;
         imageInfo.arrayLayers = layers;
         imageInfo.format = format;
-        // VK_IMAGE_TILING_LINEAR: texelΪΪ
-        // VK_IMAGE_TILING_OPTIMAL: texelVulkanľʵһ˳Уʵѷ
-        // layoutһһ֮ǹ̶ĲܸģCPUҪȡݣΪVK_IMAGE_TILING_LINEAR
-        // ֻGPUʹãΪVK_IMAGE_TILING_OPTIMALܸ
+        // VK_IMAGE_TILING_LINEAR: texel以行为主序排列为数组
+        // VK_IMAGE_TILING_OPTIMAL: texel按照Vulkan的具体实现来定义的一种顺序排列，以实现最佳访问
+        // 这个和layout不一样，一旦设置之后是固定的不能改，如果CPU需要读取这个数据，就设置为VK_IMAGE_TILING_LINEAR
+        // 如果只是GPU使用，就设置为VK_IMAGE_TILING_OPTIMAL性能更好
         imageInfo.tiling = tiling;
-        // ֻVK_IMAGE_LAYOUT_UNDEFINEDVK_IMAGE_LAYOUT_PREINITIALIZED
-        // VK_IMAGE_LAYOUT_UNDEFINEDζŵһtransitionݵʱݻᱻ
-        // VK_IMAGE_LAYOUT_PREINITIALIZEDǵһtransitionݵʱݻᱻ
-        // Ǻܶʲô˼һCPUдݣȻtransferVkImagestagingImageҪVK_IMAGE_LAYOUT_PREINITIALIZED
+        // 这里只能填VK_IMAGE_LAYOUT_UNDEFINED或者VK_IMAGE_LAYOUT_PREINITIALIZED
+        // VK_IMAGE_LAYOUT_UNDEFINED意味着第一次transition数据的时候数据会被丢弃
+        // VK_IMAGE_LAYOUT_PREINITIALIZED是第一次transition数据的时候数据会被保留
+        // 不是很懂这个什么意思，如果是一个用来从CPU写入数据，然后transfer到其它VkImage的stagingImage，就要用VK_IMAGE_LAYOUT_PREINITIALIZED
         imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         imageInfo.usage = usage;
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        // ֻӰ쵱attachmentsʹõVkImage(Լframe buffer֧õǸĬbuffer֧)
+        // 这个只影响当作attachments使用的VkImage(自己创建的frame buffer才支持这个，交换链用的那个默认buffer不支持)
         imageInfo.samples = numSamples;
-        // ԼһЩ־;ͼŻ3Dϡ(sparse)ͼ
+        // 可以加一些标志，给特殊用途的图像做优化，比如3D的稀疏(sparse)图像
         imageInfo.flags = layers == 6 ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
 
         VmaAllocationCreateInfo allocationInfo = {};
@@ -4036,12 +4115,12 @@ namespace ZXEngine
 
     void RenderAPIVulkan::GenerateMipMaps(VkImage image, VkFormat format, int32_t width, int32_t height, uint32_t mipLevels)
     {
-        // mipmap2ַʽ
-        // һһЩⲿĽӿڣstb_image_resizeȥÿһͼݣȻÿһ㶼ԭʼͼ
-        // һַʽvkCmdBlitImageڸƣźfilterͼݵ
-        // һѭlevel 0(ԭͼ)Сһblitlevel 1Ȼ1223
+        // 生成mipmap有2种方式
+        // 一种是用一些外部的接口，比如stb_image_resize，去生成每一层的图像数据，然后把每一层都当原始图像那样填入数据
+        // 我们这里用另一种方式，用vkCmdBlitImage来处理，这个是用于复制，缩放和filter图像数据的
+        // 在一个循环里，把level 0(原图)数据缩小一倍blit到level 1，然后1到2，2到3这样
 
-        // ȼͼʽǷ֧linear blitting
+        // 先检查图像格式是否支持linear blitting
         VkFormatProperties formatProperties;
         vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &formatProperties);
         if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
@@ -4061,74 +4140,74 @@ namespace ZXEngine
 
             int32_t mipWidth = width;
             int32_t mipHeight = height;
-            // עѭǴ1ʼ
+            // 注意循环是从1开始的
             for (uint32_t i = 1; i < mipLevels; i++)
             {
-                // Ȱѵi-1(0ԭͼ)layoutתTRANSFER_SRC_OPTIMAL
+                // 先把第i-1级(0是原图)的layout转成TRANSFER_SRC_OPTIMAL
                 barrier.subresourceRange.baseMipLevel = i - 1;
-                // ԭlayoutʵimageһʼʱÿһmipmapΪVK_IMAGE_LAYOUT_UNDEFINED
-                // ÿһmipmapΪĿͼݣΪԭͼһ
-                // i-1mipmap൱һBlitԭݣҲѭڶαʹ(һαʹΪĿͼ)
-                // ҪTRANSFER_DST_OPTIMALתTRANSFER_SRC_OPTIMAL
+                // 原layout，其实image一开始创建的时候每一级mipmap都设置为VK_IMAGE_LAYOUT_UNDEFINED了
+                // 但是每一级mipmap会先作为目标图像接收数据，再作为原图像向下一级传输数据
+                // 所以这里第i-1级mipmap，相当于是这一次Blit操作的原数据，也是这个循环里面第二次被使用(第一次被使用是作为目标图像)
+                // 所以这里要从TRANSFER_DST_OPTIMAL转换到TRANSFER_SRC_OPTIMAL
                 barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
                 barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-                // imageдӦBarrier֮ǰ
+                // 这个image的数据写入应该在这个Barrier之前完成
                 barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                // Barrier֮ͿԶimage
+                // 这个Barrier之后就可以读这个image的数据了
                 barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 
                 vkCmdPipelineBarrier(cmd,
-                    // ָӦBarrier֮ǰɵĲڹĸstage
+                    // 指定应该在Barrier之前完成的操作，在管线里的哪个stage
                     VK_PIPELINE_STAGE_TRANSFER_BIT,
-                    // ָӦõȴBarrierĲڹĸstage
+                    // 指定应该等待Barrier的操作，在管线里的哪个stage
                     VK_PIPELINE_STAGE_TRANSFER_BIT,
                     0, 0, nullptr, 0, nullptr, 1, &barrier
                 );
 
-                // BlitBlitǰͬһimagei-1mipmapСһ븴Ƶi
+                // 配置Blit操作，整个Blit操作就是把同一个image第i-1级mipmap的数据缩小一半复制到第i级
                 VkImageBlit blit{};
-                // ԭͼ(0,0)(width, height)
+                // 操作原图像的(0,0)到(width, height)
                 blit.srcOffsets[0] = { 0, 0, 0 };
                 blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
-                // ԭͼColor
+                // 操作原图像的Color
                 blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-                // ԭͼmipmapȼi-1
+                // 操作原图像mipmap等级的i-1
                 blit.srcSubresource.mipLevel = i - 1;
-                // ʱû
+                // 暂时没用
                 blit.srcSubresource.baseArrayLayer = 0;
                 blit.srcSubresource.layerCount = 1;
-                // ƵĿͼ(0,0)(width/2, height/2)С1Ļ1
+                // 复制到目标图像的(0,0)到(width/2, height/2)，如果小于1的话等于1
                 blit.dstOffsets[0] = { 0, 0, 0 };
                 blit.dstOffsets[1] = { mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1 };
-                // ĿͼColor
+                // 操作目标图像的Color
                 blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-                // ƵĿͼmipmapȼi
+                // 复制到目标图像的mipmap等级i
                 blit.dstSubresource.mipLevel = i;
-                // ʱû
+                // 暂时没用
                 blit.dstSubresource.baseArrayLayer = 0;
                 blit.dstSubresource.layerCount = 1;
 
-                // BiltָԭͼĿͼΪͬһΪͬһimageĲͬmipmap
+                // 添加Bilt操作指令，这里原图像和目标图像设置为同一个，因为是同一个image的不同mipmap层操作
                 vkCmdBlitImage(cmd,
                     image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                     image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                     1, &blit, VK_FILTER_LINEAR
                 );
 
-                // Blit֮BarrierӦi-1mipmapͽˣṩshaderȡ
-                // layoutTRANSFER_SRC_OPTIMALתSHADER_READ_ONLY_OPTIMAL
+                // Blit完之后，这个Barrier所对应的i-1级mipmap就结束任务了，可以提供给shader读取了
+                // 所以layout从TRANSFER_SRC_OPTIMAL转换到SHADER_READ_ONLY_OPTIMAL
                 barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
                 barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                // imagei-1mipmapݶȡӦBarrier֮ǰ
+                // 这个image第i-1级mipmap的数据读取操作应该在这个Barrier之前完成
                 barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
                 barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
                 vkCmdPipelineBarrier(cmd,
-                    // ǰsrcAccessMask
-                    // transfer׶εtransferȡӦBarrier֮ǰִ
+                    // 结合前面的srcAccessMask
+                    // transfer阶段的transfer读取操作应该在这个Barrier之前执行
                     VK_PIPELINE_STAGE_TRANSFER_BIT,
-                    // ǰdstAccessMask
-                    // fragment shader׶εshaderȡӦBarrierִ֮
+                    // 结合前面的dstAccessMask
+                    // fragment shader阶段的shader读取操作应该在这个Barrier之后执行
                     VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
                     0, 0, nullptr, 0, nullptr, 1, &barrier
                 );
@@ -4137,23 +4216,23 @@ namespace ZXEngine
                 if (mipHeight > 1) mipHeight /= 2;
             }
 
-            // ѭһmipmapҪ
+            // 循环结束后还有最后一级的mipmap需要处理
             barrier.subresourceRange.baseMipLevel = mipLevels - 1;
-            // ΪһֻݣҪݵطlayoutTRANSFER_DST_OPTIMAL
+            // 因为最后一级只接收数据，不需要从它复制数据到其它地方，所以最后的layout就是TRANSFER_DST_OPTIMAL
             barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            // ҪתshaderȡõSHADER_READ_ONLY_OPTIMAL
+            // 需要转换成shader读取用的SHADER_READ_ONLY_OPTIMAL
             barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            // Barrier֮ǰҪһmipmapд
+            // 这个Barrier之前需要完成最后一级mipmap的数据写入
             barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            // shaderȡҪBarrier֮ܿʼ
+            // shader读取数据需要在这个Barrier之后才能开始
             barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
             
             vkCmdPipelineBarrier(cmd,
-                // ǰsrcAccessMask
-                // transfer׶εtransferдӦBarrier֮ǰִ
+                // 结合前面的srcAccessMask
+                // transfer阶段的transfer写入操作应该在这个Barrier之前执行
                 VK_PIPELINE_STAGE_TRANSFER_BIT,
-                // ǰdstAccessMask
-                // fragment shader׶εĶȡҪBarrier֮ܿʼ
+                // 结合前面的dstAccessMask
+                // fragment shader阶段的读取操作需要在这个Barrier之后才能开始
                 VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
                 0, 0, nullptr, 0, nullptr, 1, &barrier
             );
@@ -4168,21 +4247,21 @@ namespace ZXEngine
         createInfo.viewType = viewType;
         createInfo.format = format;
 
-        // componentsֶɫͨյӳ߼
-        // 磬ǿԽɫͨӳΪɫͨʵֵɫҲԽͨӳĳֵ01
-        // Ĭϵ
+        // components字段允许调整颜色通道的最终的映射逻辑
+        // 比如，我们可以将所有颜色通道映射为红色通道，以实现单色纹理，我们也可以将通道映射具体的常量数值0和1
+        // 这里用默认的
         createInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
         createInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
         createInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
         createInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
 
-        // subresourceRangleֶͼʹĿʲôԼԱʵЧ
-        // ͼcolordepth stencil
+        // subresourceRangle字段用于描述图像的使用目标是什么，以及可以被访问的有效区域
+        // 这个图像用作填充color还是depth stencil等
         createInfo.subresourceRange.aspectMask = aspectFlags;
-        // ĬϴMipmap
+        // 默认处理所有Mipmap
         createInfo.subresourceRange.baseMipLevel = 0;
         createInfo.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
-        // ĬϴLayers
+        // 默认处理所有Layers
         createInfo.subresourceRange.baseArrayLayer = 0;
         createInfo.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
 
@@ -4206,16 +4285,16 @@ namespace ZXEngine
         samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
         samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
         samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        // filter
+        // 开启各向异性filter
         samplerInfo.anisotropyEnable = VK_TRUE;
         samplerInfo.maxAnisotropy = maxSamplerAnisotropy;
         samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
-        // false귶Χ[0, 1)trueͻ[0, texWidth)[0, texHeight)󲿷¶[0, 1)
+        // 这里填false，纹理采样坐标范围就是正常的[0, 1)，如果填true，就会变成[0, texWidth)和[0, texHeight)，绝大部分情况下都是用[0, 1)
         samplerInfo.unnormalizedCoordinates = VK_FALSE;
-        // һòĳЩshadow mappercentage-closer filteringõ
+        // 一般用不到这个，某些场景，比如shadow map的percentage-closer filtering会用到
         samplerInfo.compareEnable = VK_FALSE;
         samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
-        // mipmap
+        // mipmap设置
         samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
         samplerInfo.mipLodBias = 0.0f;
         samplerInfo.minLod = 0.0f;
@@ -4318,10 +4397,10 @@ namespace ZXEngine
             colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
             colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
             colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-            // Ǹcolordepthģstencilĵһ
+            // 上面那个设置是用于color和depth的，stencil的单独一个
             colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
             colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-            // ȾʼǰͽLayoutǸShaderȡ׼ģֻȾиĳAttachmentҪLayout
+            // 渲染开始前和结束后Layout都是给Shader读取数据准备的，只在渲染中改成Attachment需要的Layout
             colorAttachment.initialLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
             colorAttachment.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
@@ -4345,7 +4424,7 @@ namespace ZXEngine
 
             VkSubpassDescription subpassInfo = {};
             subpassInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-            // ָcolor bufferãԼ(attachment = 0)ֱӶӦƬԪɫlayout(location = 0) out vec4 outColor
+            // 指定color buffer的引用，这个引用以及它的索引(上面的attachment = 0)直接对应到片元着色器里的layout(location = 0) out vec4 outColor
             subpassInfo.pColorAttachments = &colorAttachmentRef;
             subpassInfo.colorAttachmentCount = 1;
             subpassInfo.pDepthStencilAttachment = &depthAttachmentRef;
@@ -4369,7 +4448,7 @@ namespace ZXEngine
             array<VkAttachmentDescription, 2> attachments = { colorAttachment, depthAttachment };
             VkRenderPassCreateInfo renderPassInfo{};
             renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-            // ǰ洴VkAttachmentReferenceʱǸattachmentָľpAttachments
+            // 前面创建VkAttachmentReference的时候，那个索引attachment指的就是在这个pAttachments数组里的索引
             renderPassInfo.pAttachments = attachments.data();
             renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
             renderPassInfo.pSubpasses = &subpassInfo;
@@ -4420,7 +4499,7 @@ namespace ZXEngine
             array<VkAttachmentDescription, 1> attachments = { colorAttachment };
             VkRenderPassCreateInfo renderPassInfo{};
             renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-            // ǰ洴VkAttachmentReferenceʱǸattachmentָľpAttachments
+            // 前面创建VkAttachmentReference的时候，那个索引attachment指的就是在这个pAttachments数组里的索引
             renderPassInfo.pAttachments = attachments.data();
             renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
             renderPassInfo.pSubpasses = &subpassInfo;
@@ -4470,7 +4549,7 @@ namespace ZXEngine
             array<VkAttachmentDescription, 1> attachments = { depthAttachment };
             VkRenderPassCreateInfo renderPassInfo{};
             renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-            // ǰ洴VkAttachmentReferenceʱǸattachmentָľpAttachments
+            // 前面创建VkAttachmentReference的时候，那个索引attachment指的就是在这个pAttachments数组里的索引
             renderPassInfo.pAttachments = attachments.data();
             renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
             renderPassInfo.pSubpasses = &subpassInfo;
@@ -4513,12 +4592,15 @@ namespace ZXEngine
             shaderStages.push_back(shaderStageInfo);
         }
 
-        // öʽ
-        VkVertexInputBindingDescription bindingDescription = {};
-        bindingDescription.binding = 0;
-        bindingDescription.stride = sizeof(Vertex);
-        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-        array<VkVertexInputAttributeDescription, 6> attributeDescriptions = {};
+        // 设置顶点输入格式，0号binding是顶点数据，1号binding是GPU Instancing的逐实例模型矩阵，只有Instancing的Shader才声明
+        array<VkVertexInputBindingDescription, 2> bindingDescriptions = {};
+        bindingDescriptions[0].binding = 0;
+        bindingDescriptions[0].stride = sizeof(Vertex);
+        bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        bindingDescriptions[1].binding = 1;
+        bindingDescriptions[1].stride = 16 * sizeof(float);
+        bindingDescriptions[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        array<VkVertexInputAttributeDescription, 10> attributeDescriptions = {};
         attributeDescriptions[0].binding = 0;
         attributeDescriptions[0].location = 0;
         attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
@@ -4543,33 +4625,41 @@ namespace ZXEngine
         attributeDescriptions[5].location = 5;
         attributeDescriptions[5].format = VK_FORMAT_R32G32B32A32_UINT;
         attributeDescriptions[5].offset = offsetof(Vertex, BoneIDs);
+        // 模型矩阵按列占用4个location
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            attributeDescriptions[6 + i].binding = 1;
+            attributeDescriptions[6 + i].location = INSTANCE_MODEL_LOCATION + i;
+            attributeDescriptions[6 + i].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+            attributeDescriptions[6 + i].offset = i * 4 * sizeof(float);
+        }
         VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-        vertexInputInfo.vertexBindingDescriptionCount = 1;
+        vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+        vertexInputInfo.vertexBindingDescriptionCount = shaderInfo.instancing ? 2 : 1;
         vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
-        vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+        vertexInputInfo.vertexAttributeDescriptionCount = shaderInfo.instancing ? 10 : 6;
 
-        // ͼԪ
+        // 设置图元
         VkPipelineInputAssemblyStateCreateInfo inputAssemblyInfo = GetAssemblyInfo(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
 
-        // ViewPortϢﲻֱãŪɶ̬
+        // ViewPort信息，这里不直接设置，下面弄成动态的
         VkPipelineViewportStateCreateInfo viewportStateInfo = {};
         viewportStateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
         viewportStateInfo.viewportCount = 1;
         viewportStateInfo.scissorCount = 1;
 
-        // View PortScissorΪ̬ÿ֡ʱ
+        // View Port和Scissor设置为动态，每帧绘制时决定
         vector<VkDynamicState> dynamicStates = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
         VkPipelineDynamicStateCreateInfo dynamicStateInfo = {};
         dynamicStateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
         dynamicStateInfo.pDynamicStates = dynamicStates.data();
         dynamicStateInfo.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
 
-        // ùդ׶
+        // 设置光栅化阶段
         VkPipelineRasterizationStateCreateInfo rasterizationInfo = GetRasterizationInfo(vkFaceCullOptionMap[shaderInfo.stateSet.cull]);
         
-        // ShaderMSAA(ĻϵMSAA)Ҫ߼豸ʱVkPhysicalDeviceFeaturessampleRateShadingЧʱر
+        // 设置Shader采样纹理的MSAA(不是输出到屏幕上的MSAA)，需要创建逻辑设备的时候开启VkPhysicalDeviceFeatures里的sampleRateShading才能生效，暂时关闭
         VkPipelineMultisampleStateCreateInfo multisampleInfo = GetPipelineMultisampleInfo(renderPassType == RenderPassType::Present ? msaaSamplesCount : VK_SAMPLE_COUNT_1_BIT);
 
         // Color Blend
@@ -4589,7 +4679,7 @@ namespace ZXEngine
         colorBlending.pAttachments = &colorBlendAttachment;
         colorBlending.attachmentCount = 1;
 
-        // Ⱥģ
+        // 深度和模板配置
         VkPipelineDepthStencilStateCreateInfo depthStencilInfo = {};
         depthStencilInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
         // Depth
@@ -4716,9 +4806,9 @@ namespace ZXEngine
     {
         VkShaderModuleCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        // Ҫȷuint32_tĶҪ,洢vectorУĬϷѾȷµĶҪ
+        // 这里需要确保数据满足uint32_t的对齐要求,存储在vector中，默认分配器已经确保数据满足最差情况下的对齐要求
         createInfo.codeSize = code.size();
-        // תΪVulkanҪuint32_tָ
+        // 转换为Vulkan要求的uint32_t指针
         createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
 
         VkShaderModule shaderModule;
@@ -4761,13 +4851,13 @@ namespace ZXEngine
     {
         vector<uint32_t> deleteList = {};
 
-        // 
+        // 材质数据
         for (auto& iter : materialDatasToDelete)
         {
-            // ݵĵȴ֡0ͼ1֡
+            // 如果这个材质数据的等待帧数大于0，就减1帧
             if (iter.second > 0)
                 iter.second--;
-            // ɾ
+            // 否则就删除
             else
                 deleteList.push_back(iter.first);
         }
@@ -4777,7 +4867,7 @@ namespace ZXEngine
             materialDatasToDelete.erase(id);
         }
 
-        // ׷
+        // 光追材质数据
         deleteList.clear();
         for (auto& iter : rtMaterialDatasToDelete)
         {
@@ -4836,6 +4926,21 @@ namespace ZXEngine
             DestroyPipelineByIndex(id);
             pipelinesToDelete.erase(id);
         }
+
+        // Instance Buffer
+        deleteList.clear();
+        for (auto& iter : instanceBuffersToDelete)
+        {
+            if (iter.second > 0)
+                iter.second--;
+            else
+                deleteList.push_back(iter.first);
+        }
+        for (auto id : deleteList)
+        {
+            DestroyInstanceBufferByIndex(id);
+            instanceBuffersToDelete.erase(id);
+        }
     }
 
 
@@ -4914,7 +5019,7 @@ namespace ZXEngine
     {
         auto rtPipeline = rtPipelines[id];
 
-        // DescriptorPool
+        // 创建DescriptorPool
         vector<VkDescriptorPoolSize> poolSizes = {};
 
         // Top Level Acceleration Structure
@@ -4923,7 +5028,7 @@ namespace ZXEngine
         asPoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT;
         poolSizes.push_back(asPoolSize);
 
-        // ȾStorage Image
+        // 输出渲染结果的Storage Image
         VkDescriptorPoolSize imagePoolSize = {};
         imagePoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
         imagePoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT;
@@ -4938,7 +5043,7 @@ namespace ZXEngine
         if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &rtPipeline->pipelineData.descriptorPool) != VK_SUCCESS)
             throw std::runtime_error("Failed to create descriptor pool for ray tracing!");
 
-        // DescriptorSet
+        // 创建DescriptorSet
         vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, rtPipeline->pipeline.descriptorSetLayout);
         rtPipeline->pipelineData.descriptorSets = CreateDescriptorSets(rtPipeline->pipelineData.descriptorPool, layouts);
     }
@@ -4948,7 +5053,7 @@ namespace ZXEngine
         auto rtPipeline = rtPipelines[id];
         auto& curTLAS = GetTLASGroupByIndex(rtPipeline->tlasIdx)->asGroup[currentFrame];
 
-        // TLAS
+        // 更新TLAS
         VkWriteDescriptorSetAccelerationStructureKHR writeASInfo = {};
         writeASInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
         writeASInfo.accelerationStructureCount = 1;
@@ -4962,12 +5067,12 @@ namespace ZXEngine
         writeAS.descriptorCount = 1;
         writeAS.pNext = &writeASInfo;
 
-        // ȡ׷Ŀͼ
+        // 获取光追管线输出的目标图像
         auto curFBO = GetFBOByIndex(curFBOIdx);
         uint32_t textureID = GetAttachmentBufferByIndex(curFBO->colorAttachmentIdx)->attachmentBuffers[currentFrame];
         auto texture = GetTextureByIndex(textureID);
 
-        // Ŀͼ
+        // 更新输出目标图像
         VkDescriptorImageInfo imageInfo = {};
         imageInfo.imageView = texture->imageView;
         imageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
@@ -4988,25 +5093,25 @@ namespace ZXEngine
     {
         auto rtPipeline = rtPipelines[id];
 
-        // DescriptorPool
+        // 创建DescriptorPool
         vector<VkDescriptorPoolSize> poolSizes = {};
 
-        // иĲϢ
+        // 场景中各对象的材质信息
         VkDescriptorPoolSize asPoolSize = {};
         asPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         asPoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT;
         poolSizes.push_back(asPoolSize);
 
-        // е
+        // 场景中所有的纹理
         VkDescriptorPoolSize imagePoolSize = {};
         imagePoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        imagePoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT * rtSceneTextureNum; // Todo: Ҫ̬չ
+        imagePoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT * rtSceneTextureNum; // Todo: 这个数量可能需要动态扩展
         poolSizes.push_back(imagePoolSize);
 
-        // еCubeMap
+        // 场景中的所有CubeMap
         VkDescriptorPoolSize cubeMapPoolSize = {};
         cubeMapPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        cubeMapPoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT * rtSceneCubeMapNum; // Todo: Ҫ̬չ
+        cubeMapPoolSize.descriptorCount = MAX_FRAMES_IN_FLIGHT * rtSceneCubeMapNum; // Todo: 这个数量可能需要动态扩展
         poolSizes.push_back(cubeMapPoolSize);
 
         VkDescriptorPoolCreateInfo poolInfo = {};
@@ -5018,14 +5123,14 @@ namespace ZXEngine
         if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &rtPipeline->sceneData.descriptorPool) != VK_SUCCESS)
             throw std::runtime_error("Failed to create descriptor pool for ray tracing!");
 
-        // DescriptorSet
+        // 创建DescriptorSet
         vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, rtPipeline->pipeline.sceneDescriptorSetLayout);
         rtPipeline->sceneData.descriptorSets = CreateDescriptorSets(rtPipeline->sceneData.descriptorPool, layouts);
 
-        // ȾBuffer
+        // 创建渲染对象数据索引Buffer
         vector<VkWriteDescriptorSet> writeDescriptorSets;
         rtPipeline->sceneData.dataReferenceBuffers.resize(MAX_FRAMES_IN_FLIGHT);
-        VkDeviceSize bufferSize = sizeof(VulkanRTRendererDataReference) * rtSceneRenderObjectNum; // Todo: Ҫ̬չ
+        VkDeviceSize bufferSize = sizeof(VulkanRTRendererDataReference) * rtSceneRenderObjectNum; // Todo: 这个数量可能需要动态扩展
         for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
         {
             rtPipeline->sceneData.dataReferenceBuffers[i] = CreateBuffer(bufferSize,
@@ -5045,7 +5150,7 @@ namespace ZXEngine
             writeDescriptorSet.pBufferInfo = &bufferInfo;
             writeDescriptorSets.push_back(writeDescriptorSet);
         }
-        // ѸոմȾBuffer󶨵
+        // 把刚刚创建的渲染对象数据索引Buffer绑定到描述符集上
         vkUpdateDescriptorSets(device, static_cast<uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, nullptr);
     }
 
@@ -5053,10 +5158,10 @@ namespace ZXEngine
     {
         auto rtPipeline = rtPipelines[id];
 
-        // еɶӦVkDescriptorImageInfo
+        // 遍历场景中的所有纹理，生成对应的VkDescriptorImageInfo
         vector<VkDescriptorImageInfo> imageInfos = {};
 
-        // 볡е
+        // 填入场景中的纹理
         for (auto textureID : curRTSceneTextureIndexes)
         {
             auto texture = GetTextureByIndex(textureID);
@@ -5069,10 +5174,10 @@ namespace ZXEngine
             imageInfos.push_back(imageInfo);
         }
 
-        // һ봴VkPipelineLayoutʱsceneDescriptorSetLayoutָrtSceneTextureNum
-        // Todo: ʵǹõʵʳеһµģͲ
-        // ǳеǶ̬ģõǾ̬ģҪһ£о͵ؽ
-        // һ룬оؽߺõ㣬Ҳ̫õķʲô
+        // 随便用一个纹理补齐创建VkPipelineLayout时，sceneDescriptorSetLayout中指定的rtSceneTextureNum个纹理数组
+        // Todo: 其实最理想的情况是管线设置的纹理数组数量，和实际场景中的数量是一致的，就不用这样搞了
+        // 但是场景中的纹理数量是动态的，而管线设置的纹理数组数量是静态的，如果要保持一致，感觉就得重建管线
+        // 所以这里先用一个纹理补齐，感觉这样比重建管线好点，但是我也不太清楚最好的方案是什么
         for (size_t i = curRTSceneTextureIndexes.size(); i < rtSceneTextureNum; i++)
         {
             auto texture = GetTextureByIndex(curRTSceneTextureIndexes[0]);
@@ -5085,7 +5190,7 @@ namespace ZXEngine
             imageInfos.push_back(imageInfo);
         }
 
-        // 󶨵дϢ
+        // 更新所有纹理绑定的写入信息
         VkWriteDescriptorSet writeImages = {};
         writeImages.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         writeImages.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -5094,10 +5199,10 @@ namespace ZXEngine
         writeImages.descriptorCount = static_cast<uint32_t>(imageInfos.size());
         writeImages.pImageInfo = imageInfos.data();
 
-        // еCubeMapϢ
+        // 所有的CubeMap信息
         vector<VkDescriptorImageInfo> cubeMapInfos = {};
 
-        // 볡еCubeMap
+        // 填入场景中的CubeMap
         for (auto cubeMapID : curRTSceneCubeMapIndexes)
         {
 			auto cubeMap = GetTextureByIndex(cubeMapID);
@@ -5110,7 +5215,7 @@ namespace ZXEngine
 			cubeMapInfos.push_back(cubeMapInfo);
 		}
 
-        // һCubeMap봴VkPipelineLayoutʱsceneDescriptorSetLayoutָrtSceneCubeMapNumCubeMap
+        // 随便用一个CubeMap补齐创建VkPipelineLayout时，sceneDescriptorSetLayout中指定的rtSceneCubeMapNum个CubeMap数组
         for (size_t i = curRTSceneCubeMapIndexes.size(); i < rtSceneCubeMapNum; i++)
         {
             auto cubeMap = GetTextureByIndex(curRTSceneCubeMapIndexes[0]);
@@ -5123,7 +5228,7 @@ namespace ZXEngine
             cubeMapInfos.push_back(cubeMapInfo);
         }
 
-        // CubeMap󶨵дϢ
+        // 更新所有CubeMap绑定的写入信息
         VkWriteDescriptorSet writeCubeMaps = {};
         writeCubeMaps.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         writeCubeMaps.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -5132,11 +5237,11 @@ namespace ZXEngine
         writeCubeMaps.descriptorCount = static_cast<uint32_t>(cubeMapInfos.size());
         writeCubeMaps.pImageInfo = cubeMapInfos.data();
 
-        // °
+        // 重新绑定纹理
         vector<VkWriteDescriptorSet> writeDescriptorSets = { writeImages, writeCubeMaps };
         vkUpdateDescriptorSets(device, static_cast<uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, nullptr);
 
-        // ȾBuffer
+        // 更新渲染对象的数据引用Buffer
         vector<VulkanRTRendererDataReference> dataReferences = {};
         for (auto& iter : asInstanceData)
         {
@@ -5151,7 +5256,7 @@ namespace ZXEngine
             dataReferences.push_back(dataReference);
         }
 
-        // µǰ֡ȾBuffer
+        // 更新当前帧的渲染对象数据引用Buffer
         auto dataReferencePtr = rtPipeline->sceneData.dataReferenceBuffers[currentFrame].mappedAddress;
         memcpy(dataReferencePtr, dataReferences.data(), sizeof(VulkanRTRendererDataReference) * dataReferences.size());
     }
@@ -5167,10 +5272,10 @@ namespace ZXEngine
 
     uint32_t RenderAPIVulkan::GetMipMapLevels(int width, int height)
     {
-        // mipmapȼ
-        // ͨͼƬ߿Сһһֱ
-        // maxҳ߿ȽϴģȻlog2Ա2ΣȡͼСٴ
-        // 1ΪԭͼҲҪһȼ
+        // 计算mipmap等级
+        // 通常把图片高宽缩小一半就是一级，直到缩不动
+        // 先max找出高宽像素里比较大的，然后用log2计算可以被2除几次，再向下取整就是这张图可以缩小多少次了
+        // 最后加1是因为原图也要一个等级
         return static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
     }
 
@@ -5207,7 +5312,7 @@ namespace ZXEngine
 
         VkFenceCreateInfo fenceInfo{};
         fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        // ʱΪsignaled״̬(һԶȲ)
+        // 创建时立刻设置为signaled状态(否则第一次永远等不到)
         fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
         vkCreateFence(device, &fenceInfo, nullptr, &immediateExeFence);
     }
@@ -5242,29 +5347,29 @@ namespace ZXEngine
             barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
             barrier.oldLayout = oldLayout;
             barrier.newLayout = newLayout;
-            // תдȨģǲתһҪȷVK_QUEUE_FAMILY_IGNORED
+            // 这两个参数是用于转换队列簇所有权的，如果我们不做这个转换，一定要明确填入VK_QUEUE_FAMILY_IGNORED
             barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
             barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
             barrier.image = image;
-            // Ĭϴmipmap
+            // 默认处理所有mipmap
             barrier.subresourceRange.baseMipLevel = 0;
             barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
-            // ĬϴLayer
+            // 默认处理所有Layer
             barrier.subresourceRange.baseArrayLayer = 0;
             barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
-            // Image;(Color, Depth, Stencil)
+            // Image用途(Color, Depth, Stencil)
             barrier.subresourceRange.aspectMask = aspectMask;
             barrier.srcAccessMask = srcAccessMask;
             barrier.dstAccessMask = dstAccessMask;
 
             vkCmdPipelineBarrier(cmd, srcStage, dstStage,
-                // 0VK_DEPENDENCY_BY_REGION_BITζȡĿǰΪֹдԴ
+                // 这个参数填0或者VK_DEPENDENCY_BY_REGION_BIT，后者意味着允许读取到目前为止已写入的资源部分
                 0,
-                // VkMemoryBarrier
+                // VkMemoryBarrier数组
                 0, nullptr,
-                // VkBufferMemoryBarrier
+                // VkBufferMemoryBarrier数组
                 0, nullptr,
-                // VkImageMemoryBarrier
+                // VkImageMemoryBarrier数组
                 1, &barrier
             );
         });
@@ -5276,29 +5381,29 @@ namespace ZXEngine
         barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         barrier.oldLayout = oldLayout;
         barrier.newLayout = newLayout;
-        // תдȨģǲתһҪȷVK_QUEUE_FAMILY_IGNORED
+        // 这两个参数是用于转换队列簇所有权的，如果我们不做这个转换，一定要明确填入VK_QUEUE_FAMILY_IGNORED
         barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.image = image;
-        // Ĭϴmipmap
+        // 默认处理所有mipmap
         barrier.subresourceRange.baseMipLevel = 0;
         barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
-        // ĬϴLayer
+        // 默认处理所有Layer
         barrier.subresourceRange.baseArrayLayer = 0;
         barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
-        // Image;(Color, Depth, Stencil)
+        // Image用途(Color, Depth, Stencil)
         barrier.subresourceRange.aspectMask = aspectMask;
         barrier.srcAccessMask = srcAccessMask;
         barrier.dstAccessMask = dstAccessMask;
 
         vkCmdPipelineBarrier(cmd, srcStage, dstStage,
-            // 0VK_DEPENDENCY_BY_REGION_BITζȡĿǰΪֹдԴ
+            // 这个参数填0或者VK_DEPENDENCY_BY_REGION_BIT，后者意味着允许读取到目前为止已写入的资源部分
             0,
-            // VkMemoryBarrier
+            // VkMemoryBarrier数组
             0, nullptr,
-            // VkBufferMemoryBarrier
+            // VkBufferMemoryBarrier数组
             0, nullptr,
-            // VkImageMemoryBarrier
+            // VkImageMemoryBarrier数组
             1, &barrier
         );
     }
@@ -5316,20 +5421,20 @@ namespace ZXEngine
     {
         VkPipelineRasterizationStateCreateInfo rasterizationInfo = {};
         rasterizationInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-        // depthClampEnableΪVK_TRUEԶüƬԪǶ
+        // 如果depthClampEnable设置为VK_TRUE，超过远近裁剪面的片元会进行收敛，而不是丢弃它们
         rasterizationInfo.depthClampEnable = VK_FALSE;
-        // rasterizerDiscardEnableΪVK_TRUEôͼԪԶᴫݵդ׶
-        // ǽֹκframebufferķ
+        // 如果rasterizerDiscardEnable设置为VK_TRUE，那么几何图元永远不会传递到光栅化阶段
+        // 这是禁止任何数据输出到framebuffer的方法
         rasterizationInfo.rasterizerDiscardEnable = VK_FALSE;
-        // ƬԪδӼģвFILLҪGPU feature
-        // VK_POLYGON_MODE_FILL: 
-        // VK_POLYGON_MODE_LINE: αԵ߿
-        // VK_POLYGON_MODE_POINT : ζΪ
+        // 设置片元如何从几何模型中产生，如果不是FILL，需要开启GPU feature
+        // VK_POLYGON_MODE_FILL: 多边形区域填充
+        // VK_POLYGON_MODE_LINE: 多边形边缘线框绘制
+        // VK_POLYGON_MODE_POINT : 多边形顶点作为描点绘制
         rasterizationInfo.polygonMode = VK_POLYGON_MODE_FILL;
         rasterizationInfo.lineWidth = 1.0f;
         rasterizationInfo.cullMode = cullMode;
         rasterizationInfo.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-        // ȾӰƫ
+        // 渲染阴影的偏移配置
         rasterizationInfo.depthBiasEnable = VK_FALSE;
         rasterizationInfo.depthBiasConstantFactor = 0.0f;
         rasterizationInfo.depthBiasClamp = 0.0f;
@@ -5343,7 +5448,7 @@ namespace ZXEngine
         multisampleInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
         multisampleInfo.sampleShadingEnable = (rasterizationSamples & VK_SAMPLE_COUNT_1_BIT ? VK_FALSE : VK_TRUE);
         multisampleInfo.rasterizationSamples = rasterizationSamples;
-        // ǵsampleShadingЧģԽӽ1ЧԽƽԽӽ0Խ
+        // 这个是调整sampleShading效果的，越接近1效果越平滑，越接近0性能越好
         multisampleInfo.minSampleShading = 1.0f;
         multisampleInfo.pSampleMask = VK_NULL_HANDLE;
         multisampleInfo.alphaToCoverageEnable = VK_FALSE;
@@ -11,7 +11,7 @@ namespace ZXEngine
         friend class EditorGUIManagerVulkan;
         friend class ImGuiTextureManagerVulkan;
         /// <summary>
-        /// ׼RenderAPIӿ
+        /// 标准RenderAPI接口
         /// </summary>
     public:
         RenderAPIVulkan();
@@ -20,7 +20,7 @@ namespace ZXEngine
         virtual void BeginFrame();
         virtual void EndFrame();
 
-        // Ⱦ״̬
+        // 渲染状态
         virtual void OnWindowSizeChange(uint32_t width, uint32_t height);
         virtual void SetRenderState(RenderStateSetting* state);
         virtual void SetViewPort(unsigned int width, unsigned int height, unsigned int xOffset = 0, unsigned int yOffset = 0);
@@ -33,7 +33,7 @@ namespace ZXEngine
         virtual FrameBufferObject* CreateFrameBufferObject(FrameBufferType type, const ClearInfo& clearInfo, unsigned int width = 0, unsigned int height = 0);
         virtual void DeleteFrameBufferObject(FrameBufferObject* FBO);
 
-        // 
+        // 纹理
         virtual unsigned int LoadTexture(const char* path, int& width, int& height);
         virtual unsigned int LoadCubeMap(const vector<string>& faces);
         virtual unsigned int CreateTexture(TextureFullData* data);
@@ -46,7 +46,7 @@ namespace ZXEngine
         virtual ShaderReference* SetUpShader(const string& path, const string& shaderCode, FrameBufferType type);
         virtual void DeleteShader(uint32_t id);
 
-        // 
+        // 材质
         virtual uint32_t CreateMaterialData();
         virtual void SetUpMaterial(Material* material);
         virtual void UseMaterialData(uint32_t ID);
@@ -55,8 +55,15 @@ namespace ZXEngine
         // Draw
         virtual uint32_t AllocateDrawCommand(CommandType commandType);
         virtual void Draw(uint32_t VAO);
+        virtual void Draw(uint32_t VAO, uint32_t instanceNum, uint32_t instanceBuffer);
+        virtual void DrawRange(uint32_t VAO, uint32_t indexOffset, uint32_t indexCount);
         virtual void GenerateDrawCommand(uint32_t id);
 
+        // Instance Buffer
+        virtual uint32_t CreateInstanceBuffer(uint32_t instanceNum);
+        virtual void UpdateInstanceBuffer(uint32_t id, const Matrix4* data, uint32_t instanceNum);
+        virtual void DeleteInstanceBuffer(uint32_t id);
+
         // Mesh
         virtual void DeleteMesh(unsigned int VAO);
         virtual void SetUpStaticMesh(unsigned int& VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices);
@@ -64,7 +71,7 @@ namespace ZXEngine
         virtual void UpdateDynamicMesh(unsigned int VAO, const vector<Vertex>& vertices, const vector<uint32_t>& indices);
         virtual void GenerateParticleMesh(unsigned int& VAO);
 
-        // Shader
+        // Shader参数
         virtual void UseShader(unsigned int ID);
         virtual void SetShaderScalar(Material* material, const string& name, bool value, bool allBuffer = false);
         virtual void SetShaderScalar(Material* material, const string& name, float value, bool allBuffer = false);
@@ -87,7 +94,7 @@ namespace ZXEngine
 
 
         /// <summary>
-        /// ׼RayTracingӿ
+        /// 标准RayTracing接口
         /// </summary>
     public:
         // Pipeline
@@ -99,7 +106,7 @@ namespace ZXEngine
         virtual void SetUpRayTracingMaterialData(Material* material);
         virtual void DeleteRayTracingMaterialData(uint32_t id);
 
-        // ݸ
+        // 数据更新
         virtual void SetRayTracingSkyBox(uint32_t textureID);
         virtual void PushRayTracingMaterialData(Material* material);
         virtual void PushAccelerationStructure(uint32_t VAO, uint32_t hitGroupIdx, uint32_t rtMaterialDataID, const Matrix4& transform);
@@ -113,64 +120,64 @@ namespace ZXEngine
 
 
         /// <summary>
-        /// ʱһԳʼĺVulkanر
+        /// 仅启动时一次性初始化的核心Vulkan组件及相关变量
         /// </summary>
     private:
-        // ĬϵFrameBufferɫʿռ
+        // 默认的纹理和FrameBuffer色彩空间
         const VkFormat defaultImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
-        // Ƿ֤
+        // 是否开启验证层
         bool validationLayersEnabled = false;
-        // MSAA
+        // MSAA采样点数量
         VkSampleCountFlagBits msaaSamplesCount = VK_SAMPLE_COUNT_1_BIT;
-        // Ӳֶ֧ٱĸԲ
+        // 硬件支持多少倍的各项异性采样
         float maxSamplerAnisotropy = 1.0f;
-        // ǰMAX_FRAMES_IN_FLIGHTеĵڼ֡
+        // 当前是MAX_FRAMES_IN_FLIGHT中的第几帧
         uint32_t currentFrame = 0;
-        // СUBOƫ
+        // 最小UBO对齐偏移量
         VkDeviceSize minUniformBufferOffsetAlignment = 8;
 
-        // Vulkanʵ
+        // Vulkan实例
         VkInstance vkInstance = VK_NULL_HANDLE;
-        // Debug
+        // Debug工具
         VkDebugUtilsMessengerEXT debugMessenger = VK_NULL_HANDLE;
-        // 豸
+        // 物理设备
         VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
-        // ߼豸
+        // 逻辑设备
         VkDevice device = VK_NULL_HANDLE;
-        // Vulkan Memory Allocator(AMDGPUOpenŶ:https://github.com/GPUOpen-LibrariesAndSDKs/VulkanMemoryAllocator)
+        // Vulkan Memory Allocator(来自AMD的GPUOpen团队:https://github.com/GPUOpen-LibrariesAndSDKs/VulkanMemoryAllocator)
         VmaAllocator vmaAllocator;
         // Surface
         VkSurfaceKHR surface = VK_NULL_HANDLE;
-        // ͼζ
+        // 图形队列
         VkQueue graphicsQueue = VK_NULL_HANDLE;
-        // չʾ
+        // 展示队列
         VkQueue presentQueue = VK_NULL_HANDLE;
-        // дID¼
+        // 队列簇ID记录
         QueueFamilyIndices queueFamilyIndices;
-        // ṩʾFrame Buffer
+        // 提供给交换链显示画面的Frame Buffer
         uint32_t presentFBOIdx = 0;
 
-        // 
+        // 交换链
         VkSwapchainKHR swapChain = VK_NULL_HANDLE;
-        // Image(ʱԶٽʱԶ)
+        // 交换链Image(创建交换链的时候自动创建，销毁交换链的时候自动销毁)
         vector<VkImage> swapChainImages;
-        // ImageViewֶֶ
+        // 交换链ImageView，手动创建，手动销毁
         vector<VkImageView> swapChainImageViews;
-        // ͼĸʽ
+        // 交换链上图像的格式
         VkFormat swapChainImageFormat;
-        // ͼĴС
+        // 交换链上图像的大小
         VkExtent2D swapChainExtent;
-        // ǰһ֡õImageڽ
+        // 当前这一帧所用的Image在交换链里的索引
         uint32_t curPresentImageIdx = 0;
-        // Imageõź
+        // 交换链Image可用的信号量
         vector<VkSemaphore> presentImageAvailableSemaphores;
-        // һ֡ƽFence
+        // 一帧绘制结束的Fence
         vector<VkFence> inFlightFences;
 
-        // 
+        // 命令池
         VkCommandPool commandPool = VK_NULL_HANDLE;
 
-        // ------------------------------------------Vulkan--------------------------------------------
+        // ------------------------------------------建立各种Vulkan对象--------------------------------------------
 
         void CreateVkInstance();
         void CreateDebugMessenger();
@@ -182,41 +189,41 @@ namespace ZXEngine
         void CreateSwapChain();
         void CreatePresentFrameBuffer();
 
-        // ----------------------------------------Vulkanĸ----------------------------------------
+        // ----------------------------------------建立Vulkan对象的辅助函数----------------------------------------
 
         bool CheckValidationLayerSupport();
         vector<const char*> GetRequiredExtensions();
-        // õVkDebugUtilsMessenger
+        // 创建调试用的VkDebugUtilsMessenger
         VkResult CreateDebugUtilsMessengerEXT(const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pDebugMessenger);
-        // VkDebugUtilsMessenger
+        // 销毁VkDebugUtilsMessenger
         void DestroyDebugUtilsMessengerEXT(VkDebugUtilsMessengerEXT debugMessenger, const VkAllocationCallbacks* pAllocator);
-        // 豸Ƿ
+        // 检查物理设备是否符合需求
         bool IsPhysicalDeviceSuitable(VkPhysicalDevice device);
-        // ȡ豸д
+        // 获取物理设备队列簇索引
         QueueFamilyIndices GetQueueFamilyIndices(VkPhysicalDevice device);
-        // 豸Ƿ֧Ҫչ
+        // 检查物理设备是否支持所需要的扩展
         bool CheckDeviceExtensionSupport(VkPhysicalDevice device);
-        // ȡ豸ֵ֧ĽϢ
+        // 获取物理设备所支持的交换链信息
         SwapChainSupportDetails GetSwapChainSupportDetails(VkPhysicalDevice device);
-        // ȡӲ豸
+        // 获取硬件设备属性
         void GetPhysicalDeviceProperties();
-        // ѡ񽻻ͼʽɫʿռ
+        // 选择交换链图像格式和色彩空间
         VkSurfaceFormatKHR ChooseSwapSurfaceFormat(const vector<VkSurfaceFormatKHR>& availableFormats);
-        // ѡ񽻻չʾģʽ
+        // 选择交换链的展示模式
         VkPresentModeKHR ChooseSwapPresentMode(const vector<VkPresentModeKHR> availablePresentModes);
-        // ѡ񽻻ͼֱ
+        // 选择交换链图像分辨率
         VkExtent2D ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities);
 
-        // ´
+        // 重新创建交换链
         void RecreateSwapChain();
-        // Դ
+        // 清理交换链相关资源
         void CleanUpSwapChain();
-        // PresentBuffer
+        // 销毁PresentBuffer
         void DestroyPresentFrameBuffer();
 
 
         /// <summary>
-        /// VulkanԴؽӿ(ЩӿCreateҪֶDestroy)
+        /// Vulkan资源创建相关接口(这些接口Create出来的需要手动Destroy)
         /// </summary>
     private:
         vector<VulkanVAO*> VulkanVAOArray;
@@ -226,12 +233,14 @@ namespace ZXEngine
         vector<VulkanPipeline*> VulkanPipelineArray;
         vector<VulkanMaterialData*> VulkanMaterialDataArray;
         vector<VulkanDrawCommand*> VulkanDrawCommandArray;
+        vector<VulkanInstanceBuffer*> VulkanInstanceBufferArray;
 
         vector<VkRenderPass> allVulkanRenderPass;
         map<uint32_t, uint32_t> meshsToDelete;
         map<uint32_t, uint32_t> texturesToDelete;
         map<uint32_t, uint32_t> materialDatasToDelete;
         map<uint32_t, uint32_t> pipelinesToDelete;
+        map<uint32_t, uint32_t> instanceBuffersToDelete;
 
         uint32_t GetNextVAOIndex();
         VulkanVAO* GetVAOByIndex(uint32_t idx);
@@ -253,6 +262,9 @@ namespace ZXEngine
         void DestroyMaterialDataByIndex(uint32_t idx);
         uint32_t GetNextDrawCommandIndex();
         VulkanDrawCommand* GetDrawCommandByIndex(uint32_t idx);
+        uint32_t GetNextInstanceBufferIndex();
+        VulkanInstanceBuffer* GetInstanceBufferByIndex(uint32_t idx);
+        void DestroyInstanceBufferByIndex(uint32_t idx);
 
         void* GetShaderPropertyAddress(ShaderReference* reference, uint32_t materialDataID, const string& name, uint32_t idx = 0);
         vector<void*> GetShaderPropertyAddressAllBuffer(ShaderReference* reference, uint32_t materialDataID, const string& name, uint32_t idx = 0);
@@ -297,66 +309,66 @@ namespace ZXEngine
         ShaderModuleSet CreateShaderModules(const string& path, const ShaderInfo& info);
         void DestroyShaderModules(ShaderModuleSet shaderModules);
 
-        // ǷҪӳжصԴ
+        // 检查是否有需要延迟卸载的资源
         void CheckDeleteData();
 
 
         /// <summary>
-        /// Vulkan׷Դͽӿ
+        /// Vulkan光线追踪相关资源和接口
         /// </summary>
     private:
-        // GPUӲ׷
+        // GPU硬件光追属性
         VkPhysicalDeviceRayTracingPipelinePropertiesKHR rtPhysicalProperties;
-        // GPUӲAcceleration StructureϢ
+        // GPU硬件Acceleration Structure信息
         VkPhysicalDeviceAccelerationStructurePropertiesKHR physicalAccelerationStructureProperties;
 
-        // ǰʹõTLASGroup
+        // 当前使用的TLASGroup索引
         uint32_t curTLASGroupIdx = 0;
-        // ǰĹ׷ٹID
+        // 当前的光线追踪管线ID
         uint32_t curRTPipelineID = 0;
-        // ׷ٹ
+        // 光线追踪管线
         vector<VulkanRTPipeline*> rtPipelines;
-        // TLASмBuffer
+        // 构建TLAS的中间Buffer
         vector<VulkanBuffer> rtTLASStagingBuffers;
         vector<VulkanBuffer> rtTLASScratchBuffers;
         vector<VulkanBuffer> rtTLASInstanceBuffers;
 
-        // PushConstantݵʱBuffer
+        // 存放PushConstant数据的临时Buffer
         void* rtPushConstantBuffer = nullptr;
-        // PushConstantݵʱBufferĴС(6432λ)
+        // 存放PushConstant数据的临时Buffer的大小(64个32位数据)
         uint32_t rtPushConstantBufferSize = 256;
 
-        // ۻʽ׷Ужϻˢµ
+        // 在累积式光追场景中，用来判断画面刷新的数据
         vector<Matrix4> rtVPMatrix;
         vector<uint32_t> rtFrameCount;
 
-        // е
+        // 场景中的纹理数量
         uint32_t rtSceneTextureNum = 100;
-        // еCubeMap
+        // 场景中的CubeMap数量
         uint32_t rtSceneCubeMapNum = 10;
-        // еȾ
+        // 场景中的渲染对象数量
         uint32_t rtSceneRenderObjectNum = 100;
 
-        // ǰһ֡ҪƵĶϢ
+        // 当前这一帧要绘制的对象信息数组
         vector<VulkanASInstanceData> asInstanceData;
-        // ǰ
+        // 当前场景中所有纹理索引数组
         vector<uint32_t> curRTSceneTextureIndexes;
-        // ǰ±ӳ
+        // 当前场景中所有纹理的索引与纹理数组下标的映射表
         unordered_map<uint32_t, uint32_t> curRTSceneTextureIndexMap;
-        // ǰCubeMap
+        // 当前场景中所有CubeMap索引数组
         vector<uint32_t> curRTSceneCubeMapIndexes;
-        // ǰCubeMapCubeMap±ӳ
+        // 当前场景中所有CubeMap的索引与CubeMap数组下标的映射表
         unordered_map<uint32_t, uint32_t> curRTSceneCubeMapIndexMap;
-        // ǰй׷
+        // 当前场景中所有光追材质索引数组
         vector<uint32_t> curRTSceneRTMaterialDatas;
-        // ǰй׷ʵ׷±ӳ
+        // 当前场景中所有光追材质的索引与光追材质数组下标的映射表
         unordered_map<uint32_t, uint32_t> curRTSceneRTMaterialDataMap;
 
-        // TLAS GroupһһTLAS Group
+        // TLAS Group，一个场景有一个TLAS Group
         vector<VulkanASGroup*> VulkanTLASGroupArray;
-        // еĹ׷飬пܰٵģδڳе
+        // 所有的光追材质数组，其中可能包括已销毁的，未在场景中的
         vector<VulkanRTMaterialData*> VulkanRTMaterialDataArray;
-        // ׼ĵĹ׷
+        // 准备消耗的光追材质
         map<uint32_t, uint32_t> rtMaterialDatasToDelete;
 
         uint32_t GetNextTLASGroupIndex();
@@ -379,7 +391,7 @@ namespace ZXEngine
 
 
         /// <summary>
-        /// ӿ
+        /// 其它辅助接口
         /// </summary>
     private:
         bool windowResized = false;
@@ -54,6 +54,7 @@ namespace ZXEngine
 	void RenderEngine::BeginRender()
 	{
 		RenderAPI::GetInstance()->BeginFrame();
+		RenderQueueManager::GetInstance()->BeginFrame();
 	}
 
 	void RenderEngine::Render(Camera* camera)
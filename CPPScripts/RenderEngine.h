@@ -20,7 +20,7 @@ namespace ZXEngine
 		void CloseWindow(string args);
 		int WindowShouldClose();
 
-		// 
+		// 绘制
 		void BeginRender();
 		void Render(Camera* camera);
 		void EndRender();
@@ -54,7 +54,7 @@ namespace ZXEngine
 			return;
 
 		lightPos = lights[0]->GetTransform()->GetPosition();
-		// ԴָԴģҪȡ
+		// 光源方向是指向光源的，所以要取反
 		lightDir = -lights[0]->GetTransform()->GetForward();
 		lightColor = lights[0]->color;
 		lightIntensity = lights[0]->intensity;
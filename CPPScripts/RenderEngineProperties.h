@@ -47,12 +47,12 @@ namespace ZXEngine
 
 		uint32_t shadowMap = 0;
 		Texture* emptyShadowMap;
-		// true: ShadowMapһRender Buffer, false: ShadowMapһ
+		// true: ShadowMap是一个Render Buffer, false: ShadowMap是一个纹理
 		bool isShadowMapBuffer = true;
 
 		uint32_t shadowCubeMap = 0;
 		CubeMap* emptyShadowCubeMap;
-		// true: ShadowCubeMapһRender Buffer, false: ShadowCubeMapһ
+		// true: ShadowCubeMap是一个Render Buffer, false: ShadowCubeMap是一个纹理
 		bool isShadowCubeMapBuffer = true;
 	};
 }
\ No newline at end of file
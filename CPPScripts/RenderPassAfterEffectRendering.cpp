@@ -29,29 +29,29 @@ namespace ZXEngine
 
 	void RenderPassAfterEffectRendering::Render(Camera* camera)
 	{
-		// лȾ
+		// 切换后处理渲染设置
 		RenderAPI::GetInstance()->SetRenderState(renderState);
-		// ĻıȾ
+		// 整个后处理都在这个覆盖屏幕的四边形上渲染
 
 		string finalFBO = ProjectSetting::renderPipelineType == RenderPipelineType::Rasterization ? "Forward" : "RayTracing";
 
 		if (camera->enableAfterEffects)
 		{
-			// ȡ
+			// 提取画面高亮部分
 			string res1 = BlitExtractBrightArea(finalFBO);
 
-			// ˹ģ
+			// 高斯模糊高亮区域
 			//string res2 = BlitGaussianBlur(res1, 1, 3.0f);
 
-			// Kawaseģ
+			// Kawase模糊高亮区域
 			string res2 = BlitKawaseBlur(res1, 2, 2.0f);
 
-			// ԭͼ͸ģ
+			// 混合原图和高亮模糊
 			string res3 = BlitBloomBlend(finalFBO, res2, true);
 		}
 		else
 		{
-			// ֱԭBufferͼ
+			// 直接输出原Buffer图像
 			string res = BlitCopy(ScreenBuffer, finalFBO, true);
 		}
 	}
@@ -113,7 +113,7 @@ namespace ZXEngine
 		material->SetTexture("_RenderTexture", FBOManager::GetInstance()->GetFBO(sourceFBO)->ColorBuffer, 0, false, true);
 		RenderAPI::GetInstance()->Draw(screenQuad->VAO);
 		RenderAPI::GetInstance()->GenerateDrawCommand(GetCommand(ExtractBrightArea));
-		// FBO
+		// 返回输出的FBO名字
 		return ExtractBrightArea;
 	}
 
@@ -126,8 +126,8 @@ namespace ZXEngine
 		FBOManager::GetInstance()->CreateFBO("GaussianBlurHorizontal", FrameBufferType::Color);
 	}
 
-	// blurTimes ģԽԽģӰܣ̫
-	// texOffset ƫƾ룬1ƫ1أԽԽģӰܣ̫Ч᲻
+	// blurTimes 反复模糊次数，次数越多越模糊，但是这个很影响性能，别开太高
+	// texOffset 采样偏移距离，1代表偏移1像素，越大越模糊，这个不影响性能，但是太大了效果会不正常
 	string RenderPassAfterEffectRendering::BlitGaussianBlur(string sourceFBO, int blurTimes, float texOffset, bool isFinal)
 	{
 		bool isHorizontal = true;
@@ -145,7 +145,7 @@ namespace ZXEngine
 			RenderAPI::GetInstance()->GenerateDrawCommand(GetCommand(pingpongBuffer[isHorizontal]));
 			isHorizontal = !isHorizontal;
 		}
-		// FBO
+		// 返回最终输出的FBO名字
 		return pingpongBuffer[!isHorizontal];
 	}
 
@@ -178,7 +178,7 @@ namespace ZXEngine
 			RenderAPI::GetInstance()->GenerateDrawCommand(GetCommand(pingpongBuffer[isSwitch]));
 			isSwitch = !isSwitch;
 		}
-		// FBO
+		// 返回最终输出的FBO名字
 		return pingpongBuffer[!isSwitch];
 	}
 
@@ -32,19 +32,19 @@ namespace ZXEngine
 		void CreateMaterial(string name, string path, FrameBufferType type, bool isBuiltIn = false);
 		Material* GetMaterial(string name);
 
-		// ȡ
+		// 提取画面高亮部分
 		void InitExtractBrightArea(bool isFinal = false);
 		string BlitExtractBrightArea(string sourceFBO, bool isFinal = false);
-		// ˹ģ
+		// 高斯模糊
 		void InitGaussianBlur(bool isFinal = false);
 		string BlitGaussianBlur(string sourceFBO, int blurTimes, float texOffset, bool isFinal = false);
-		// Kawaseģܱȸ˹
+		// Kawase模糊，性能比高斯好
 		void InitKawaseBlur(bool isFinal = false);
 		string BlitKawaseBlur(string sourceFBO, int blurTimes, float texOffset, bool isFinal = false);
 		// Bloom
 		void InitBloomBlend(bool isFinal = false);
 		string BlitBloomBlend(string originFBO, string blurFBO, bool isFinal = false);
-		// 򵥵ͼ
+		// 简单的图像复制
 		void InitCopy(bool isFinal = false);
 		string BlitCopy(string targetFBO, string sourceFBO, bool isFinal = false);
 	};
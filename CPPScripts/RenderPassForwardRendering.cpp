@@ -43,56 +43,63 @@ namespace ZXEngine
 	void RenderPassForwardRendering::Render(Camera* camera)
 	{
 		auto renderAPI = RenderAPI::GetInstance();
-		// лFBO
+		// 切换到主FBO
 		FBOManager::GetInstance()->SwitchFBO("Forward");
-		// ViewPortΪڴС
+		// ViewPort设置为窗口大小
 		renderAPI->SetViewPort(GlobalData::srcWidth, GlobalData::srcHeight);
-		// һ֡
+		// 清理上一帧数据
 		renderAPI->ClearFrameBuffer();
 		
-		// Ⱦպ
+		// 渲染天空盒
 		renderAPI->SetRenderState(skyBoxRenderState);
 		RenderSkyBox(camera);
 
-		// 
+		// 设置引擎参数
 		RenderEngineProperties::GetInstance()->SetCameraProperties(camera);
 		RenderEngineProperties::GetInstance()->SetLightProperties(Light::GetAllLights());
 
-		// Ⱦ͸
+		// 渲染不透明队列
 		renderAPI->SetRenderState(opaqueRenderState);
 		auto opaqueQueue = RenderQueueManager::GetInstance()->GetRenderQueue((int)RenderQueueType::Opaque);
 		opaqueQueue->Sort(camera);
 		opaqueQueue->Batch();
-		RenderBatches(opaqueQueue->GetBatches());
+		RenderBatches(opaqueQueue);
 
-		// Ⱦ͸
+		// 渲染半透明队列
 		renderAPI->SetRenderState(transparentRenderState);
 		auto transparentQueue = RenderQueueManager::GetInstance()->GetRenderQueue((int)RenderQueueType::Transparent);
 		transparentQueue->Sort(camera);
 		transparentQueue->Batch();
-		RenderBatches(transparentQueue->GetBatches());
+		RenderBatches(transparentQueue);
 
-		// Ⱦϵͳ
+		// 渲染粒子系统
 		ParticleSystemManager::GetInstance()->Render(camera);
 
 		renderAPI->GenerateDrawCommand(drawCommandID);
 
-		// ÿȾҪգ´ҪȾʱ
+		// 每次渲染完要清空，下次要渲染的时候再重新添加
 		RenderQueueManager::GetInstance()->ClearAllRenderQueue();
 	}
 
-	void RenderPassForwardRendering::RenderBatches(const map<uint32_t, vector<MeshRenderer*>>& batchs)
+	void RenderPassForwardRendering::RenderBatches(const RenderQueue* renderQueue)
 	{
 		auto engineProperties = RenderEngineProperties::GetInstance();
 		auto shadowMapID = FBOManager::GetInstance()->GetFBO("ShadowMap")->DepthBuffer;
 		auto shadowCubeMapID = FBOManager::GetInstance()->GetFBO("ShadowCubeMap")->DepthBuffer;
 
-		for (auto& batch : batchs)
+		for (size_t i = 0; i < renderQueue->GetBatchCount(); i++)
 		{
-			auto shader = batch.second[0]->mMatetrial->shader;
+			auto batch = renderQueue->GetBatch(i);
+			auto shader = batch[0]->mMatetrial->shader;
 			shader->Use();
 
-			for (auto renderer : batch.second)
+			// Instancing批次内的Renderer使用相同的Mesh和材质，只用第一个Renderer的数据绘制一次
+			uint32_t instanceBuffer = renderQueue->GetBatchInstanceBuffer(i);
+			uint32_t instanceNum = static_cast<uint32_t>(batch.size());
+			if (instanceBuffer != UINT32_MAX)
+				batch = batch.first(1);
+
+			for (auto renderer : batch)
 			{
 				auto material = renderer->mMatetrial;
 				material->SetMaterialProperties();
@@ -116,14 +123,17 @@ namespace ZXEngine
 
 				renderer->UpdateBoneTransformsForRender();
 
-				renderer->Draw();
+				if (instanceBuffer != UINT32_MAX)
+					renderer->DrawInstanced(instanceNum, instanceBuffer);
+				else
+					renderer->Draw();
 			}
 		}
 	}
 
 	void RenderPassForwardRendering::RenderSkyBox(Camera* camera)
 	{
-		// ת3x3ٻ4x4λϢȥ
+		// 先转3x3再回4x4，把相机位移信息去除
 		Matrix4 mat_V = Matrix4(Matrix3(camera->GetViewMatrix()));
 		Matrix4 mat_P = camera->GetProjectionMatrix();
 
@@ -8,6 +8,7 @@ namespace ZXEngine
 	class Camera;
 	class StaticMesh;
 	class MeshRenderer;
+	class RenderQueue;
 	class RenderStateSetting;
 	class RenderPassForwardRendering : public RenderPass
 	{
@@ -26,6 +27,6 @@ namespace ZXEngine
 		RenderStateSetting* transparentRenderState;
 
 		void RenderSkyBox(Camera* camera);
-		void RenderBatches(const map<uint32_t, vector<MeshRenderer*>>& batchs);
+		void RenderBatches(const RenderQueue* renderQueue);
 	};
 }
\ No newline at end of file
@@ -33,15 +33,15 @@ namespace ZXEngine
 		auto renderAPI = RenderAPI::GetInstance();
 		auto renderQueue = RenderQueueManager::GetInstance()->GetRenderQueue((int)RenderQueueType::Opaque);
 
-		// лFBO
+		// 切换到主FBO
 		FBOManager::GetInstance()->SwitchFBO("RayTracing");
-		// ViewPortΪڴС
+		// ViewPort设置为窗口大小
 		renderAPI->SetViewPort(GlobalData::srcWidth, GlobalData::srcHeight);
 
-		// պ
+		// 设置天空盒
 		renderAPI->SetRayTracingSkyBox(SceneManager::GetInstance()->GetCurScene()->skyBox->GetID());
 
-		// ȾУmeshVAOͲ׷
+		// 遍历渲染队列，将所有mesh的VAO和材质数据推入光追管线
 		for (auto renderer : renderQueue->GetRenderers())
 		{
 			renderAPI->PushRayTracingMaterialData(renderer->mMatetrial);
@@ -51,10 +51,10 @@ namespace ZXEngine
 			}
 		}
 
-		// TLAS
+		// 构建TLAS
 		renderAPI->BuildTopLevelAccelerationStructure(asCommandID);
 
-		// ׷߳
+		// 光追管线常量数据
 		rtConstants.VP = camera->GetProjectionMatrix() * camera->GetViewMatrix();
 		rtConstants.V_Inv = camera->GetViewMatrixInverse();
 		rtConstants.P_Inv = camera->GetProjectionMatrixInverse();
@@ -64,15 +64,15 @@ namespace ZXEngine
 		rtConstants.time = Time::curTime;
 #endif
 
-		// Դλ
+		// 光源位置
 		auto allLights = Light::GetAllLights();
 		if (allLights.size() > 0)
 			rtConstants.lightPos = Light::GetAllLights()[0]->GetTransform()->GetPosition();
 
-		// ׷Ⱦ
+		// 光追渲染
 		renderAPI->RayTrace(rtCommandID, rtConstants);
 
-		// Ⱦ
+		// 清理渲染队列
 		RenderQueueManager::GetInstance()->ClearAllRenderQueue();
 	}
 }
\ No newline at end of file
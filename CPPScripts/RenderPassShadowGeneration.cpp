@@ -40,7 +40,7 @@ namespace ZXEngine
 		if (Light::GetAllLights().empty())
 			return;
 
-		// ȾӰĹԴ
+		// 渲染阴影的光源
 		Light* light = Light::GetAllLights()[0];
 
 		if (light->type == LightType::Directional)
@@ -56,27 +56,23 @@ namespace ZXEngine
 	void RenderPassShadowGeneration::RenderShadowMap(Light* light)
 	{
 		auto renderAPI = RenderAPI::GetInstance();
-		// лshadow FBO
+		// 切换到shadow FBO
 		FBOManager::GetInstance()->SwitchFBO("ShadowMap");
-		// ViewPortĳȾShadowMap
+		// ViewPort改成渲染ShadowMap的正方形
 		renderAPI->SetViewPort(GlobalData::depthMapWidth, GlobalData::depthMapWidth);
-		// лӰȾ
+		// 切换到阴影渲染设置
 		renderAPI->SetRenderState(renderState);
-		// һ֡
+		// 清理上一帧数据
 		renderAPI->ClearFrameBuffer();
 
-		// VP
+		// 类似相机的VP矩阵
 		Matrix4 shadowTransform = light->GetProjectionMatrix() * light->GetLightMatrix();
 		RenderEngineProperties::GetInstance()->SetLightMatrix(shadowTransform);
 
-		// ȾͶӰ
-		auto renderQueue = RenderQueueManager::GetInstance()->GetRenderQueue((int)RenderQueueType::Opaque);
+		// 渲染投射阴影的物体
+		auto renderQueue = RenderQueueManager::GetInstance()->GetShadowCasterQueue();
 		for (auto renderer : renderQueue->GetRenderers())
 		{
-			// ͶӰ
-			if (!renderer->mCastShadow)
-				continue;
-
 			if (renderer->mShadowCastMaterial == nullptr)
 			{
 				if (renderer->mAnimator)
@@ -101,16 +97,16 @@ namespace ZXEngine
 	void RenderPassShadowGeneration::RenderShadowCubeMap(Light* light)
 	{
 		auto renderAPI = RenderAPI::GetInstance();
-		// лshadow FBO
+		// 切换到shadow FBO
 		FBOManager::GetInstance()->SwitchFBO("ShadowCubeMap");
-		// ViewPortĳȾCubeMap
+		// ViewPort改成渲染CubeMap的正方形
 		renderAPI->SetViewPort(GlobalData::depthCubeMapWidth, GlobalData::depthCubeMapWidth);
-		// лӰȾ
+		// 切换到阴影渲染设置
 		renderAPI->SetRenderState(renderState);
-		// һ֡
+		// 清理上一帧数据
 		renderAPI->ClearFrameBuffer();
 
-		// ϵ6ϵVP
+		// 基于左手坐标系构建6个方向上的VP矩阵
 		Vector3 lightPos = light->GetTransform()->GetPosition();
 #if defined(ZX_API_OPENGL) || defined(ZX_API_VULKAN)
 		shadowTransforms.push_back(shadowProj * Math::GetLookToMatrix(lightPos, Vector3(-1.0f,  0.0f,  0.0f), Vector3(0.0f, -1.0f,  0.0f)));
@@ -128,14 +124,10 @@ namespace ZXEngine
 		shadowTransforms.push_back(shadowProj * Math::GetLookToMatrix(lightPos, Vector3( 0.0f,  0.0f, -1.0f), Vector3(0.0f,  1.0f,  0.0f)));
 #endif
 
-		// ȾͶӰ
-		auto renderQueue = RenderQueueManager::GetInstance()->GetRenderQueue((int)RenderQueueType::Opaque);
+		// 渲染投射阴影的物体
+		auto renderQueue = RenderQueueManager::GetInstance()->GetShadowCasterQueue();
 		for (auto renderer : renderQueue->GetRenderers())
 		{
-			// ͶӰ
-			if (!renderer->mCastShadow)
-				continue;
-
 			if (renderer->mShadowCastMaterial == nullptr)
 			{
 				if (renderer->mAnimator)
@@ -157,7 +149,7 @@ namespace ZXEngine
 			renderer->Draw();
 		}
 
-		// һ֡
+		// 用完立刻清除，下一帧还会生成
 		shadowTransforms.clear();
 
 		renderAPI->GenerateDrawCommand(drawCommandID);
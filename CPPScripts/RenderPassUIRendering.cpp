@@ -18,16 +18,16 @@ namespace ZXEngine
 
 	void RenderPassUIRendering::Render(Camera* camera)
 	{
-		auto uiGameObjects = RenderQueueManager::GetInstance()->GetUIGameObjects();
+		auto& uiGameObjects = RenderQueueManager::GetInstance()->GetUIGameObjects();
 
 		for (auto uiGameObject : uiGameObjects)
 		{
-			// UIͼƬ
+			// 绘制UI图片
 			auto uiTextureRenderer = uiGameObject->GetComponent<UITextureRenderer>();
 			if (uiTextureRenderer != nullptr)
 				uiTextureRenderer->Render();
 
-			// UIı
+			// 绘制UI文本
 			auto uiTextRenderer = uiGameObject->GetComponent<UITextRenderer>();
 			if (uiTextRenderer != nullptr)
 				uiTextRenderer->Render();
@@ -4,114 +4,259 @@
 #include "ZShader.h"
 #include "ProjectSetting.h"
 #include "Material.h"
+#include "RenderAPI.h"
+#include "StaticBatch.h"
 
 namespace ZXEngine
 {
+	RenderQueue::~RenderQueue()
+	{
+		for (auto id : instanceBufferPool)
+			RenderAPI::GetInstance()->DeleteInstanceBuffer(id);
+	}
+
 	void RenderQueue::AddRenderer(MeshRenderer* meshRenderer)
 	{
 		renderers.push_back(meshRenderer);
 	}
 
-	RendererList RenderQueue::GetRenderers()
+	RendererView RenderQueue::GetRenderers() const
+	{
+		return RendererView(renderers);
+	}
+
+	size_t RenderQueue::GetBatchCount() const
+	{
+		return batches.size();
+	}
+
+	RendererView RenderQueue::GetBatch(size_t index) const
 	{
-		return renderers;
+		auto& batch = batches[index];
+		return RendererView(batchSource->data() + batch.begin, batch.count);
 	}
 
-	BatchMap RenderQueue::GetBatches()
+	uint32_t RenderQueue::GetBatchInstanceBuffer(size_t index) const
 	{
-		return batches;
+		return batches[index].instanceBuffer;
 	}
 
 	void RenderQueue::Clear()
 	{
 		renderers.clear();
-
-		for (auto& batch : batches)
-			batch.second.clear();
 		batches.clear();
+		batchedRenderers.clear();
 	}
 
-	void RenderQueue::Sort(Camera* camera)
+	void RenderQueue::ResetInstanceBuffers()
 	{
-		sort(renderers.begin(), renderers.end(), [camera](MeshRenderer* a, MeshRenderer* b)->bool {
-			auto aPos = a->gameObject->GetComponent<Transform>()->GetPosition();
-			auto bPos = b->gameObject->GetComponent<Transform>()->GetPosition();
-			auto cPos = camera->gameObject->GetComponent<Transform>()->GetPosition();
-			auto aDis = Math::Distance(aPos, cPos);
-			auto bDis = Math::Distance(bPos, cPos);
-			return aDis < bDis;
-		});
+		instanceBufferPoolIdx = 0;
 	}
 
-	void RenderQueue::Batch()
+	void RenderQueue::Sort(Camera* camera)
 	{
-		for (auto renderer : renderers)
+		auto cPos = camera->GetTransform()->GetPosition();
+		bool isTransparent = queue == (int)RenderQueueType::Transparent;
+
+		sortItems.resize(renderers.size());
+		for (size_t i = 0; i < renderers.size(); i++)
 		{
-			batches[renderer->mMatetrial->shader->GetID()].push_back(renderer);
+			auto renderer = renderers[i];
+
+			float disSquared = (renderer->GetWorldAABB().GetCenter() - cPos).GetMagnitudeSquared();
+			uint32_t shaderID = renderer->mMatetrial->shader->GetID();
+			uint32_t materialID = renderer->mMatetrial->sortID;
+			uint64_t key = isTransparent ?
+				RenderSort::GetTransparentKey(shaderID, materialID, disSquared) :
+				RenderSort::GetOpaqueKey(shaderID, materialID, renderer->mMeshSourceID, disSquared);
+
+			sortItems[i] = { key, renderer };
 		}
 
-		// ̬
-		if (ProjectSetting::enableDynamicBatch)
+		RenderSort::RadixSort(sortItems, sortBuffer);
+
+		for (size_t i = 0; i < renderers.size(); i++)
+			renderers[i] = sortItems[i].renderer;
+	}
+
+	void RenderQueue::Batch()
+	{
+		bool dynamicBatch = ProjectSetting::enableDynamicBatch;
+		batches.clear();
+		batchedRenderers.clear();
+		batchSource = dynamicBatch ? &batchedRenderers : &renderers;
+
+		ReplaceStaticBatchMembers();
+
+		if (dynamicBatch)
 		{
 			rendererPoolIdx = 0;
 			for (auto mesh : temporaryMeshPool)
 				delete mesh;
 			temporaryMeshPool.clear();
+		}
 
-			for (auto& iter : batches)
-				DynamicBatch(iter.second);
+		// 排序后相同Shader的Renderer是连续的，直接按连续区间划分批次
+		// 这里比较的是实际的Shader ID而不是排序键里截断后的位，避免不同Shader被错误地合到一起
+		size_t begin = 0;
+		while (begin < renderers.size())
+		{
+			auto shader = renderers[begin]->mMatetrial->shader;
+			uint32_t shaderID = shader->GetID();
+			size_t end = begin + 1;
+			while (end < renderers.size() && renderers[end]->mMatetrial->shader->GetID() == shaderID)
+				end++;
+
+			// 支持Instancing的Shader只能通过Instancing绘制，不做Mesh合并，批次直接引用原来的Renderer
+			if (shader->reference->shaderInfo.instancing)
+			{
+				auto batchRenderers = RendererView(renderers.data() + begin, end - begin);
+				size_t sourceBegin = begin;
+				if (dynamicBatch)
+				{
+					sourceBegin = batchedRenderers.size();
+					batchedRenderers.insert(batchedRenderers.end(), batchRenderers.begin(), batchRenderers.end());
+				}
+				InstanceBatch(batchRenderers, sourceBegin);
+			}
+			else if (dynamicBatch)
+			{
+				size_t batchBegin = batchedRenderers.size();
+				DynamicBatch(RendererView(renderers.data() + begin, end - begin));
+				batches.push_back({ static_cast<uint32_t>(batchBegin), static_cast<uint32_t>(batchedRenderers.size() - batchBegin) });
+			}
+			else
+			{
+				batches.push_back({ static_cast<uint32_t>(begin), static_cast<uint32_t>(end - begin) });
+			}
+
+			begin = end;
 		}
 	}
 
-	void RenderQueue::DynamicBatch(RendererList& batchRenderers)
+	void RenderQueue::ReplaceStaticBatchMembers()
 	{
-		// ܵĲͬShaderĶٰʷ
-		map<string, RendererList> matMap;
-		for (auto renderer : batchRenderers)
-			matMap[renderer->mMatetrial->path].push_back(renderer);
+		// 可见的静态合批成员替换成合批后的Renderer，每个合批只在第一个可见成员的位置出现一次
+		// 排序键里Mesh和深度排在合批分组之前，同一个合批的成员之间可能夹着其它Renderer，所以这里不依赖成员连续
+		// 合批的成员使用同一个材质，合批后的Renderer放在哪个成员的位置都处于同一段Shader区间里，不影响后面的批次划分
+		visibleStaticBatches.clear();
+		size_t count = 0;
+		for (auto renderer : renderers)
+		{
+			auto staticBatch = renderer->mStaticBatch;
+			if (staticBatch == nullptr)
+			{
+				renderers[count++] = renderer;
+			}
+			else if (staticBatch->AddVisibleMember(renderer))
+			{
+				renderers[count++] = staticBatch->GetRenderer();
+				visibleStaticBatches.push_back(staticBatch);
+			}
+		}
+		renderers.resize(count);
+
+		for (auto staticBatch : visibleStaticBatches)
+			staticBatch->UpdateDrawRanges();
+	}
 
-		RendererList newList;
-		for (auto& iter : matMap)
+	void RenderQueue::DynamicBatch(RendererView batchRenderers)
+	{
+		// 这里接受的参数是相同Shader的对象，排序后相同材质的对象也是连续的，按连续区间合并
+		// 合并结果直接追加到batchedRenderers里
+		size_t begin = 0;
+		while (begin < batchRenderers.size())
 		{
-			if (iter.second.size() > 1)
+			uint32_t sortID = batchRenderers[begin]->mMatetrial->sortID;
+			size_t end = begin + 1;
+			while (end < batchRenderers.size() && batchRenderers[end]->mMatetrial->sortID == sortID)
+				end++;
+
+			// 只合并顶点数少的Mesh，大Mesh，带动画的和静态合批后的直接单独绘制
+			mergeCandidates.clear();
+			for (size_t i = begin; i < end; i++)
 			{
-				// ͬʶ1кϲȻȡ֮ǰvectorб
-				auto batchedMeshRenderer = MergeMeshs(iter.second);
-				iter.second.clear();
-				iter.second.push_back(batchedMeshRenderer);
+				auto renderer = batchRenderers[i];
+				if (renderer->mVerticesNum > DYNAMIC_BATCH_MAX_VERTEX_NUM || renderer->mAnimator || !renderer->mDrawRanges.empty())
+					batchedRenderers.push_back(renderer);
+				else
+					mergeCandidates.push_back(renderer);
 			}
+
+			// 相同材质的小Mesh数量大于1，进行合并
+			if (mergeCandidates.size() > 1)
+				batchedRenderers.push_back(MergeMeshs(RendererView(mergeCandidates)));
+			else if (mergeCandidates.size() == 1)
+				batchedRenderers.push_back(mergeCandidates[0]);
+
+			begin = end;
 		}
+	}
+
+	void RenderQueue::InstanceBatch(RendererView batchRenderers, size_t sourceBegin)
+	{
+		// 排序后相同材质和Mesh的Renderer是连续的，每段连续区间作为一个Instancing批次
+		// 来源未知的Mesh和带动画的Renderer不能共用Mesh，单独作为一个实例数量为1的批次
+		size_t begin = 0;
+		while (begin < batchRenderers.size())
+		{
+			auto first = batchRenderers[begin];
+			size_t end = begin + 1;
+			if (first->mMeshSourceID != UINT32_MAX && first->mAnimator == nullptr)
+			{
+				while (end < batchRenderers.size() && end - begin < MAX_INSTANCE_NUM)
+				{
+					auto renderer = batchRenderers[end];
+					if (renderer->mMeshSourceID != first->mMeshSourceID || renderer->mMatetrial->sortID != first->mMatetrial->sortID
+						|| renderer->mReceiveShadow != first->mReceiveShadow || renderer->mAnimator != nullptr)
+						break;
+					end++;
+				}
+			}
 
-		// ѺĶб
-		for (auto& iter : matMap)
-			for (auto renderer : iter.second)
-				newList.push_back(renderer);
+			instanceMatrices.clear();
+			for (size_t i = begin; i < end; i++)
+				instanceMatrices.push_back(batchRenderers[i]->GetTransform()->GetModelMatrix());
 
-		// ôݣֱȡб
-		batchRenderers = newList;
+			uint32_t instanceBuffer = GetInstanceBuffer();
+			RenderAPI::GetInstance()->UpdateInstanceBuffer(instanceBuffer, instanceMatrices.data(), static_cast<uint32_t>(instanceMatrices.size()));
+			batches.push_back({ static_cast<uint32_t>(sourceBegin + begin), static_cast<uint32_t>(end - begin), instanceBuffer });
+
+			begin = end;
+		}
+	}
+
+	uint32_t RenderQueue::GetInstanceBuffer()
+	{
+		if (instanceBufferPoolIdx >= instanceBufferPool.size())
+			instanceBufferPool.push_back(RenderAPI::GetInstance()->CreateInstanceBuffer(MAX_INSTANCE_NUM));
+		return instanceBufferPool[instanceBufferPoolIdx++];
 	}
 
-	MeshRenderer* RenderQueue::MergeMeshs(RendererList& batchRenderers)
+	MeshRenderer* RenderQueue::MergeMeshs(RendererView batchRenderers)
 	{
-		vector<Vertex> newVertices;
-		vector<unsigned int> newIndices;
+		auto& newVertices = mergedVertices;
+		auto& newIndices = mergedIndices;
+		newVertices.clear();
+		newIndices.clear();
 
 		unsigned int idxOffset = 0;
 		for (auto renderer : batchRenderers)
 		{
 			auto mat_M = renderer->GetTransform()->GetModelMatrix();
-			auto mat_M_IT = Math::Transpose(Math::Inverse(mat_M));
 			for (auto mesh : renderer->mMeshes)
 			{
-				for (auto& vertex : mesh->mVertices)
-				{
-					Vertex newVertex;
-					newVertex.Position = mat_M * Vector4(vertex.Position, 1.0f);
-					newVertex.Normal = Matrix3(mat_M_IT) * vertex.Normal;
-					newVertex.Tangent = mat_M * Vector4(vertex.Tangent, 0.0f);
-					newVertex.TexCoords = vertex.TexCoords;
-					newVertices.push_back(newVertex);
-				}
+				size_t vertexNum = mesh->mVertices.size();
+				size_t vertexOffset = newVertices.size();
+				newVertices.resize(vertexOffset + vertexNum);
+
+				const Vertex* src = mesh->mVertices.data();
+				Vertex* dst = newVertices.data() + vertexOffset;
+				Math::TransformPoints(mat_M, &src->Position, &dst->Position, vertexNum, sizeof(Vertex), sizeof(Vertex));
+				Math::TransformNormals(mat_M, &src->Normal, &dst->Normal, vertexNum, sizeof(Vertex), sizeof(Vertex));
+				Math::TransformDirections(mat_M, &src->Tangent, &dst->Tangent, vertexNum, sizeof(Vertex), sizeof(Vertex));
+				for (size_t i = 0; i < vertexNum; i++)
+					dst[i].TexCoords = src[i].TexCoords;
 
 				for (auto idx : mesh->mIndices)
 					newIndices.push_back(idx + idxOffset);
@@ -125,7 +270,7 @@ namespace ZXEngine
 		auto newMeshRenderer = GetTemporaryRenderer();
 		newMeshRenderer->mMatetrial = batchRenderers[0]->mMatetrial;
 		newMeshRenderer->mReceiveShadow = batchRenderers[0]->mReceiveShadow;
-		// ֮ǰݣ
+		// 之前可能有数据，先清掉
 		newMeshRenderer->mMeshes.clear();
 		newMeshRenderer->mMeshes.push_back(newMesh);
 
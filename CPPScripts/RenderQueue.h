@@ -1,8 +1,13 @@
 #pragma once
 #include "pubh.h"
+#include "PublicStruct.h"
+#include "RenderSort.h"
 
 #define RendererList vector<MeshRenderer*>
-#define BatchMap map<uint32_t, RendererList>
+// 只读视图，指向RenderQueue内部每帧复用的连续数组，不产生拷贝，在下一次Clear之前有效
+#define RendererView span<MeshRenderer* const>
+// 顶点数超过这个值的Mesh不参与动态合批，CPU合并的开销会超过省下的DrawCall
+#define DYNAMIC_BATCH_MAX_VERTEX_NUM 300
 
 namespace ZXEngine
 {
@@ -10,33 +15,75 @@ namespace ZXEngine
 	class StaticMesh;
 	class MeshRenderer;
 	class RenderObject;
+	class StaticBatch;
 	class RenderQueue
 	{
 	public:
-		RenderQueue() {};
-		~RenderQueue() {};
+		RenderQueue(int queue = (int)RenderQueueType::Opaque) : queue(queue) {};
+		~RenderQueue();
 
 		int queue = 0;
 		void AddRenderer(MeshRenderer* meshRenderer);
-		RendererList GetRenderers();
-		BatchMap GetBatches();
+		RendererView GetRenderers() const;
+		size_t GetBatchCount() const;
+		// 同一个批次内的Renderer使用相同的Shader
+		RendererView GetBatch(size_t index) const;
+		// Instancing批次的逐实例数据Buffer，批次内的Renderer使用相同的Mesh和材质，只需要用第一个Renderer绘制一次
+		// 不是Instancing批次时返回UINT32_MAX
+		uint32_t GetBatchInstanceBuffer(size_t index) const;
+		// 清空本帧数据，但是保留已分配的内存给下一帧复用
 		void Clear();
+		// 每帧开始时调用，逐实例数据Buffer从头复用
+		// 同一帧内多个相机的批次依次使用不同的Buffer，避免后面的相机覆盖前面的相机还没提交给GPU的数据
+		void ResetInstanceBuffers();
+		// 按排序键做基数排序，不透明队列按Shader，材质，由近到远排序，半透明队列按由远到近排序
 		void Sort(Camera* camera);
+		// 把排序后连续的相同Shader的Renderer划分为一个批次，需要先调用Sort
+		// 支持Instancing的Shader再按Mesh和材质划分成Instancing批次
 		void Batch();
 
 	private:
+		struct BatchRange
+		{
+			uint32_t begin;
+			uint32_t count;
+			uint32_t instanceBuffer = UINT32_MAX;
+		};
+
 		RendererList renderers;
-		BatchMap batches;
-		// ںʱRendererpoolֻɾ
-		// ҲκdeleteΪõطĶʵ
+		// 每个批次在batchSource中的区间
+		vector<BatchRange> batches;
+		// 没有开启动态合批时批次直接引用renderers，开启时引用合批后的batchedRenderers
+		const RendererList* batchSource = &renderers;
+		RendererList batchedRenderers;
+		// 排序用的临时数组，只增不减
+		vector<RenderSort::Item> sortItems;
+		vector<RenderSort::Item> sortBuffer;
+		// 用于合批的临时Renderer，这个pool只增不删
+		// 并且不可以做任何delete，因为都是引用的其他地方的对象实例
 		RendererList temporaryRendererPool;
-		// ǰʹ
+		// 当前使用数量
 		int rendererPoolIdx = 0;
-		// ¼̬ʱMeshÿ֡delete
+		// 记录动态合批产生的临时Mesh，每帧delete
 		list<StaticMesh*> temporaryMeshPool;
+		// 同一材质里可以参与合并的Renderer，每帧复用
+		RendererList mergeCandidates;
+		// 合并Mesh时用的顶点和索引缓存，每帧复用
+		vector<Vertex> mergedVertices;
+		vector<uint32_t> mergedIndices;
+		// Instancing批次用的逐实例数据Buffer，只增不减，每帧从头复用，一帧内不会重复使用
+		vector<uint32_t> instanceBufferPool;
+		size_t instanceBufferPoolIdx = 0;
+		// 上传逐实例数据时用的缓存，每帧复用
+		vector<Matrix4> instanceMatrices;
+		// 本帧有成员可见的静态合批
+		vector<StaticBatch*> visibleStaticBatches;
 
-		void DynamicBatch(RendererList& batchRenderers);
-		MeshRenderer* MergeMeshs(RendererList& batchRenderers);
+		void ReplaceStaticBatchMembers();
+		void DynamicBatch(RendererView batchRenderers);
+		void InstanceBatch(RendererView batchRenderers, size_t sourceBegin);
+		uint32_t GetInstanceBuffer();
+		MeshRenderer* MergeMeshs(RendererView batchRenderers);
 		MeshRenderer* GetTemporaryRenderer();
 	};
 }
\ No newline at end of file
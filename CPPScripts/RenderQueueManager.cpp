@@ -2,6 +2,10 @@
 #include "GameObject.h"
 #include "Component/MeshRenderer.h"
 #include "Material.h"
+#include "SpatialIndex.h"
+#include "GlobalData.h"
+#include "Component/ZCamera.h"
+#include "Component/Light.h"
 
 namespace ZXEngine
 {
@@ -28,6 +32,41 @@ namespace ZXEngine
 		}
 	}
 
+	RenderQueue* RenderQueueManager::GetShadowCasterQueue()
+	{
+		return shadowCasterQueue;
+	}
+
+	void RenderQueueManager::SetCullingCamera(Camera* camera)
+	{
+		if (camera == nullptr)
+		{
+			mEnableCulling = false;
+			return;
+		}
+
+		mEnableCulling = true;
+		mCameraFrustum = Frustum(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+
+		// 和RenderPassShadowGeneration保持一致，只有第一个光源会投射阴影
+		mShadowLightType = LightType::None;
+		auto lights = Light::GetAllLights();
+		if (lights.empty())
+			return;
+
+		auto light = lights[0];
+		mShadowLightType = light->type;
+		if (light->type == LightType::Directional)
+		{
+			mShadowFrustum = Frustum(light->GetProjectionMatrix() * light->GetLightMatrix());
+		}
+		else if (light->type == LightType::Point)
+		{
+			mShadowSphereCenter = light->GetTransform()->GetPosition();
+			mShadowSphereRadius = GlobalData::shadowCubeMapFarPlane;
+		}
+	}
+
 	void RenderQueueManager::AddGameObject(GameObject* gameObject)
 	{
 		if (gameObject->layer == (int)GameObjectLayer::UI)
@@ -47,11 +86,118 @@ namespace ZXEngine
 			AddGameObject(subGameObject);
 	}
 
+	void RenderQueueManager::AddRenderers(const SpatialIndex* spatialIndex)
+	{
+		mQueryResult.clear();
+		spatialIndex->QueryFrustum(mCameraFrustum, mQueryResult);
+		for (auto renderer : mQueryResult)
+			GetRenderQueue(renderer->mMatetrial->GetRenderQueue())->AddRenderer(renderer);
+#ifdef ZX_DEBUG
+		// 和AddRenderer一样，每个Renderer在相机视锥体剔除里只会被统计一次，不是Drawn就是Culled
+		Debug::forwardDrawnCount += static_cast<int>(mQueryResult.size());
+		Debug::forwardCulledCount += static_cast<int>(spatialIndex->GetRendererCount() - mQueryResult.size());
+#endif
+
+		mQueryResult.clear();
+		if (mShadowLightType == LightType::Directional)
+			spatialIndex->QueryFrustum(mShadowFrustum, mQueryResult);
+		else if (mShadowLightType == LightType::Point)
+			spatialIndex->QuerySphere(mShadowSphereCenter, mShadowSphereRadius, mQueryResult);
+
+		size_t shadowDrawnNum = 0;
+		for (auto renderer : mQueryResult)
+		{
+			if (IsShadowCaster(renderer))
+			{
+				shadowCasterQueue->AddRenderer(renderer);
+				shadowDrawnNum++;
+			}
+		}
+#ifdef ZX_DEBUG
+		// 和相机一样直接用查询结果计算，Culled是被阴影范围剔除的物体，在阴影范围内但不投射阴影的物体不统计
+		Debug::shadowDrawnCount += static_cast<int>(shadowDrawnNum);
+		Debug::shadowCulledCount += static_cast<int>(spatialIndex->GetRendererCount() - mQueryResult.size());
+#endif
+	}
+
 	void RenderQueueManager::AddRenderer(MeshRenderer* meshRenderer)
 	{
 		int queue = meshRenderer->mMatetrial->GetRenderQueue();
-		auto renderQueue = this->GetRenderQueue(queue);
-		renderQueue->AddRenderer(meshRenderer);
+
+		// 阴影投射物体不受相机视锥体影响
+		if (IsShadowCaster(meshRenderer))
+		{
+			if (IsVisibleToShadow(meshRenderer))
+			{
+				shadowCasterQueue->AddRenderer(meshRenderer);
+#ifdef ZX_DEBUG
+				Debug::shadowDrawnCount++;
+#endif
+			}
+#ifdef ZX_DEBUG
+			else
+			{
+				Debug::shadowCulledCount++;
+			}
+#endif
+		}
+
+		if (IsVisibleToCamera(meshRenderer))
+		{
+			auto renderQueue = this->GetRenderQueue(queue);
+			renderQueue->AddRenderer(meshRenderer);
+#ifdef ZX_DEBUG
+			Debug::forwardDrawnCount++;
+#endif
+		}
+#ifdef ZX_DEBUG
+		else
+		{
+			Debug::forwardCulledCount++;
+		}
+#endif
+	}
+
+	bool RenderQueueManager::IsShadowCaster(MeshRenderer* meshRenderer) const
+	{
+		// 阴影只由不透明物体投射
+		return meshRenderer->mCastShadow && meshRenderer->mMatetrial->GetRenderQueue() == (int)RenderQueueType::Opaque;
+	}
+
+	bool RenderQueueManager::IsVisibleToCamera(MeshRenderer* meshRenderer)
+	{
+		// 骨骼动画会让顶点超出绑定姿势下的包围盒，所以带动画的物体不做剔除
+		if (!mEnableCulling || meshRenderer->mAnimator)
+			return true;
+
+		return mCameraFrustum.Intersects(meshRenderer->GetWorldAABB());
+	}
+
+	bool RenderQueueManager::IsVisibleToShadow(MeshRenderer* meshRenderer)
+	{
+		if (!mEnableCulling || meshRenderer->mAnimator)
+			return true;
+
+		if (mShadowLightType == LightType::Directional)
+		{
+			return mShadowFrustum.Intersects(meshRenderer->GetWorldAABB());
+		}
+		else if (mShadowLightType == LightType::Point)
+		{
+			auto& aabb = meshRenderer->GetWorldAABB();
+			return Math::Distance(aabb.GetCenter(), mShadowSphereCenter) <= mShadowSphereRadius + aabb.GetExtents().GetMagnitude();
+		}
+
+		return true;
+	}
+
+	void RenderQueueManager::BeginFrame()
+	{
+		for (auto& iter : renderQueues)
+		{
+			iter.second->ResetInstanceBuffers();
+		}
+		shadowCasterQueue->ResetInstanceBuffers();
 	}
 
 	void RenderQueueManager::ClearAllRenderQueue()
@@ -60,6 +206,7 @@ namespace ZXEngine
 		{
 			iter.second->Clear();
 		}
+		shadowCasterQueue->Clear();
 	}
 
 	void RenderQueueManager::AddUIGameObject(GameObject* uiGameObject)
@@ -67,7 +214,7 @@ namespace ZXEngine
 		uiGameObjectList.push_back(uiGameObject);
 	}
 
-	list<GameObject*> RenderQueueManager::GetUIGameObjects()
+	const vector<GameObject*>& RenderQueueManager::GetUIGameObjects() const
 	{
 		return uiGameObjectList;
 	}
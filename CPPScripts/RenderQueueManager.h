@@ -1,10 +1,13 @@
 #pragma once
 #include "pubh.h"
 #include "RenderQueue.h"
+#include "Culling.h"
 
 namespace ZXEngine
 {
+	class Camera;
 	class GameObject;
+	class SpatialIndex;
 	class RenderQueueManager
 	{
 	public:
@@ -14,18 +17,40 @@ namespace ZXEngine
 		static void Creat();
 		static RenderQueueManager* GetInstance();
 
+		// 每帧开始渲染前调用
+		void BeginFrame();
+		// 设置后续AddGameObject时做视锥体剔除所用的相机，传nullptr表示关闭剔除
+		void SetCullingCamera(Camera* camera);
 		void AddGameObject(GameObject* gameObject);
+		// 通过场景的SpatialIndex只把视锥体内的Renderer加入队列，需要先调用SetCullingCamera
+		void AddRenderers(const SpatialIndex* spatialIndex);
+		void AddUIGameObject(GameObject* uiGameObject);
 		RenderQueue* GetRenderQueue(int queue);
+		// 经过光源视锥体剔除后的阴影投射物体
+		RenderQueue* GetShadowCasterQueue();
 		void ClearAllRenderQueue();
-		list<GameObject*> GetUIGameObjects();
+		const vector<GameObject*>& GetUIGameObjects() const;
 		void ClearUIGameObjects();
 
 	private:
 		static RenderQueueManager* mInstance;
-		map<int, RenderQueue*> renderQueues = { {(int)RenderQueueType::Opaque, new RenderQueue()}, {(int)RenderQueueType::Transparent, new RenderQueue()} };
-		list<GameObject*> uiGameObjectList;
+		map<int, RenderQueue*> renderQueues = { {(int)RenderQueueType::Opaque, new RenderQueue((int)RenderQueueType::Opaque)}, {(int)RenderQueueType::Transparent, new RenderQueue((int)RenderQueueType::Transparent)} };
+		vector<GameObject*> uiGameObjectList;
+		RenderQueue* shadowCasterQueue = new RenderQueue();
+
+		bool mEnableCulling = false;
+		Frustum mCameraFrustum;
+		// 平行光阴影用视锥体剔除，点光源阴影用包围球剔除
+		LightType mShadowLightType = LightType::None;
+		Frustum mShadowFrustum;
+		Vector3 mShadowSphereCenter;
+		float mShadowSphereRadius = 0.0f;
+		// SpatialIndex查询结果，每次复用
+		vector<MeshRenderer*> mQueryResult;
 
+		bool IsShadowCaster(MeshRenderer* meshRenderer) const;
+		bool IsVisibleToCamera(MeshRenderer* meshRenderer);
+		bool IsVisibleToShadow(MeshRenderer* meshRenderer);
 		void AddRenderer(MeshRenderer* meshRenderer);
-		void AddUIGameObject(GameObject* uiGameObject);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "RenderSort.h"
+
+namespace ZXEngine
+{
+	void RenderSort::RadixSort(vector<Item>& items, vector<Item>& buffer)
+	{
+		size_t count = items.size();
+		if (count < 2)
+			return;
+
+		buffer.resize(count);
+
+		// 一次遍历统计出8个字节各自的直方图
+		uint32_t histograms[8][256] = {};
+		for (auto& item : items)
+			for (uint32_t pass = 0; pass < 8; pass++)
+				histograms[pass][(item.key >> (pass * 8)) & 0xFF]++;
+
+		Item* src = items.data();
+		Item* dst = buffer.data();
+		for (uint32_t pass = 0; pass < 8; pass++)
+		{
+			auto& histogram = histograms[pass];
+
+			// 所有键在这个字节上都一样，这一趟不会改变顺序，直接跳过
+			if (histogram[(src[0].key >> (pass * 8)) & 0xFF] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < 256; i++)
+			{
+				uint32_t num = histogram[i];
+				histogram[i] = offset;
+				offset += num;
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				auto& item = src[i];
+				dst[histogram[(item.key >> (pass * 8)) & 0xFF]++] = item;
+			}
+
+			std::swap(src, dst);
+		}
+
+		// 结果落在了临时数组里，交换回来
+		if (src != items.data())
+			items.swap(buffer);
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "pubh.h"
+
+namespace ZXEngine
+{
+	class MeshRenderer;
+	// 渲染队列的排序键和基数排序，只处理排序键，不访问Renderer，可以脱离渲染器单独编译测试
+	class RenderSort
+	{
+	public:
+		struct Item
+		{
+			uint64_t key;
+			MeshRenderer* renderer;
+		};
+
+		// 不透明物体优先减少状态切换，相同Mesh排在一起方便Instancing，再由近到远绘制以减少Overdraw
+		static inline uint64_t GetOpaqueKey(uint32_t shaderID, uint32_t materialID, uint32_t meshID, float disSquared);
+		// 半透明物体必须严格由远到近绘制，深度放在最高位
+		static inline uint64_t GetTransparentKey(uint32_t shaderID, uint32_t materialID, float disSquared);
+		// 按排序键从小到大排序，键相同时保持原来的顺序，buffer是排序用的临时数组
+		static void RadixSort(vector<Item>& items, vector<Item>& buffer);
+
+	private:
+		static inline uint64_t GetDepthKey(float disSquared);
+	};
+
+	uint64_t RenderSort::GetOpaqueKey(uint32_t shaderID, uint32_t materialID, uint32_t meshID, float disSquared)
+	{
+		return (static_cast<uint64_t>(shaderID & 0xFFFF) << 48) | (static_cast<uint64_t>(materialID & 0xFFFF) << 32)
+			| (static_cast<uint64_t>(meshID & 0xFF) << 24) | GetDepthKey(disSquared);
+	}
+
+	uint64_t RenderSort::GetTransparentKey(uint32_t shaderID, uint32_t materialID, float disSquared)
+	{
+		return ((0xFFFFFF - GetDepthKey(disSquared)) << 32) | (static_cast<uint64_t>(shaderID & 0xFFFF) << 16) | (materialID & 0xFFFF);
+	}
+
+	uint64_t RenderSort::GetDepthKey(float disSquared)
+	{
+		// 非负浮点数的二进制位和数值大小顺序一致，所以距离的平方可以直接拿来当深度键
+		// 去掉尾数的低8位量化成24位，精度足够排序用，还能让基数排序少一趟
+		uint32_t depthBits = 0;
+		memcpy(&depthBits, &disSquared, sizeof(float));
+		return depthBits >> 8;
+	}
+}
@@ -1,23 +1,18 @@
 #include "Resources.h"
 #include "ModelUtil.h"
 #include "ProjectSetting.h"
+#include "Concurrent/ThreadPool.h"
+#include "AssetCache.h"
 
 namespace ZXEngine
 {
 	string Resources::mAssetsPath;
 	const string Resources::mBuiltInAssetsPath = "../../../BuiltInAssets/";
-	vector<PrefabLoadHandle> Resources::mPrefabLoadHandles;
-	vector<PrefabLoadHandle> Resources::mDiscardedPrefabLoadHandles;
-	vector<MaterialLoadHandle> Resources::mMaterialLoadHandles;
-	vector<MaterialLoadHandle> Resources::mDiscardedMaterialLoadHandles;
-	vector<ModelDataLoadHandle> Resources::mModelDataLoadHandles;
-	vector<ModelDataLoadHandle> Resources::mDiscardedModelDataLoadHandles;
-#ifdef ZX_EDITOR
-	vector<MaterialLoadHandle> Resources::mEditorMaterialLoadHandles;
-	vector<MaterialLoadHandle> Resources::mDiscardedEditorMaterialLoadHandles;
-	vector<ModelDataLoadHandle> Resources::mEditorModelDataLoadHandles;
-	vector<ModelDataLoadHandle> Resources::mDiscardedEditorModelDataLoadHandles;
-#endif
+	ThreadPool* Resources::mAsyncLoadThreadPool = nullptr;
+	uint32_t Resources::mNextAsyncLoadID = 0;
+	unordered_map<uint32_t, AsyncLoadRequest> Resources::mAsyncLoadRequests;
+	unordered_set<uint32_t> Resources::mDiscardedAsyncLoads;
+	Concurrent::Queue<AsyncLoadResult> Resources::mAsyncLoadResults;
 
 	TextureStruct::~TextureStruct()
 	{
@@ -44,7 +39,12 @@ namespace ZXEngine
 			delete material;
 
 		if (modelData)
-			delete modelData;
+		{
+			if (modelData->isCached)
+				AssetCache::ReleaseModel(modelData);
+			else
+				delete modelData;
+		}
 
 		for (auto iter : children)
 			delete iter;
@@ -105,7 +105,7 @@ namespace ZXEngine
 	string Resources::JsonStrToString(const json& data)
 	{
 		string p = to_string(data);
-		// jsonַȡǰ˫ţҪȥ
+		// 这个json字符串取出来前后会有双引号，需要去掉再用
 		p = p.substr(1, p.length() - 2);
 		return p;
 	}
@@ -156,16 +156,16 @@ namespace ZXEngine
 
 	vector<char> Resources::LoadBinaryFile(const string& path)
 	{
-		// ate:ļĩβʼȡļĩβʼȡŵǿʹöȡλȷļĴС仺
+		// ate:在文件末尾开始读取，从文件末尾开始读取的优点是我们可以使用读取位置来确定文件的大小并分配缓冲区
 		ifstream file(path, std::ios::ate | std::ios::binary);
 		if (!file.is_open())
 			Debug::LogError("Failed to load binary file: " + path);
 
-		// ʹöȡλȷļĴС仺
+		// 使用读取位置来确定文件的大小并分配缓冲区
 		size_t fileSize = (size_t)file.tellg();
 		vector<char> data(fileSize);
 
-		// ļͷȡ
+		// 返回文件开头，真正读取内容
 		file.seekg(0);
 		file.read(data.data(), fileSize);
 		file.close();
@@ -190,7 +190,13 @@ namespace ZXEngine
 		if (!data["RenderPipelineType"].is_null())
 			scene->renderPipelineType = data["RenderPipelineType"];
 
-		// ʱлһȾͣprefabл
+		if (!data["Broadphase"].is_null())
+			scene->broadphaseType = data["Broadphase"];
+
+		if (!data["ContactSolver"].is_null())
+			scene->contactSolverType = data["ContactSolver"];
+
+		// 临时切换一下渲染管线类型，加载完prefab后再切回来
 		auto curPipelineType = ProjectSetting::renderPipelineType;
 		ProjectSetting::renderPipelineType = scene->renderPipelineType;
 		for (size_t i = 0; i < data["GameObjects"].size(); i++)
@@ -247,6 +253,8 @@ namespace ZXEngine
 			prefab->layer = static_cast<uint32_t>(GameObjectLayer::Default);
 		else
 			prefab->layer = data["Layer"];
+		if (!data["Static"].is_null())
+			prefab->isStatic = data["Static"];
 
 		for (unsigned int i = 0; i < data["Components"].size(); i++)
 		{
@@ -254,17 +262,17 @@ namespace ZXEngine
 
 			if (component["Type"] == "MeshRenderer")
 			{
-				// 
+				// 材质
 				string p = Resources::JsonStrToString(component["Material"]);
 				prefab->material = Resources::LoadMaterial(p);
 
-				// ģ
+				// 模型
 				if (!component["Mesh"].is_null())
 				{
 					p = Resources::JsonStrToString(component["Mesh"]);
 					p = Resources::GetAssetFullPath(p);
 
-					prefab->modelData = ModelUtil::LoadModel(p, true, async);
+					prefab->modelData = AssetCache::AcquireModel(p, async);
 				}
 			}
 
@@ -344,7 +352,9 @@ namespace ZXEngine
 			TextureStruct* textureStruct = new TextureStruct();
 			textureStruct->path = Resources::GetAssetFullPath(Resources::JsonStrToString(texture["Path"]), isBuiltIn);
 			textureStruct->uniformName = Resources::JsonStrToString(texture["UniformName"]);
-			textureStruct->data = Resources::LoadTextureFullData(textureStruct->path, isBuiltIn);
+			// 已经在缓存里的纹理不需要再解码
+			if (!AssetCache::IsCached(AssetCache::GetTextureKey(textureStruct->path)))
+				textureStruct->data = Resources::LoadTextureFullData(textureStruct->path, isBuiltIn);
 
 			matStruct->textures.push_back(textureStruct);
 		}
@@ -356,7 +366,8 @@ namespace ZXEngine
 			CubeMapStruct* cubeMapStruct = new CubeMapStruct();
 			cubeMapStruct->paths = Resources::LoadCubeMap(cubeMap, isBuiltIn);
 			cubeMapStruct->uniformName = Resources::JsonStrToString(cubeMap["UniformName"]);
-			cubeMapStruct->data = Resources::LoadCubeMapFullData(cubeMapStruct->paths, isBuiltIn);
+			if (!AssetCache::IsCached(AssetCache::GetCubeMapKey(cubeMapStruct->paths)))
+				cubeMapStruct->data = Resources::LoadCubeMapFullData(cubeMapStruct->paths, isBuiltIn);
 
 			matStruct->cubeMaps.push_back(cubeMapStruct);
 		}
@@ -412,221 +423,117 @@ namespace ZXEngine
 
 	void Resources::CheckAsyncLoad()
 	{
-		for (size_t i = 0; i < mPrefabLoadHandles.size(); i++)
-		{
-			if (mPrefabLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				PrefabStruct* prefab = mPrefabLoadHandles[i].future.get();
-				mPrefabLoadHandles[i].callback(prefab);
-				// TODO: ڴй©
-				delete prefab;
-				mPrefabLoadHandles.erase(mPrefabLoadHandles.begin() + i);
-				i--;
-			}
-		}
-		for (size_t i = 0; i < mDiscardedPrefabLoadHandles.size(); i++)
-		{
-			if (mDiscardedPrefabLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				delete mDiscardedPrefabLoadHandles[i].future.get();
-				mDiscardedPrefabLoadHandles.erase(mDiscardedPrefabLoadHandles.begin() + i);
-				i--;
-			}
-		}
+		auto begin = std::chrono::steady_clock::now();
 
-		for (size_t i = 0; i < mMaterialLoadHandles.size(); i++)
+		AsyncLoadResult result;
+		while (mAsyncLoadResults.TryPop(result))
 		{
-			if (mMaterialLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+			auto iter = mDiscardedAsyncLoads.find(result.id);
+			if (iter != mDiscardedAsyncLoads.end())
 			{
-				MaterialStruct* material = mMaterialLoadHandles[i].future.get();
-				mMaterialLoadHandles[i].callback(material);
-				delete material;
-				mMaterialLoadHandles.erase(mMaterialLoadHandles.begin() + i);
-				i--;
+				mDiscardedAsyncLoads.erase(iter);
+				result.finish(true);
 			}
-		}
-		for (size_t i = 0; i < mDiscardedMaterialLoadHandles.size(); i++)
-		{
-			if (mDiscardedMaterialLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+			else
 			{
-				delete mDiscardedMaterialLoadHandles[i].future.get();
-				mDiscardedMaterialLoadHandles.erase(mDiscardedMaterialLoadHandles.begin() + i);
-				i--;
+				mAsyncLoadRequests.erase(result.id);
+				result.finish(false);
 			}
-		}
 
-		for (size_t i = 0; i < mModelDataLoadHandles.size(); i++)
-		{
-			if (mModelDataLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				ModelData* modelData = mModelDataLoadHandles[i].future.get();
-				mModelDataLoadHandles[i].callback(modelData);
-				delete modelData;
-				mModelDataLoadHandles.erase(mModelDataLoadHandles.begin() + i);
-				i--;
-			}
-		}
-		for (size_t i = 0; i < mDiscardedModelDataLoadHandles.size(); i++)
-		{
-			if (mDiscardedModelDataLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				delete mDiscardedModelDataLoadHandles[i].future.get();
-				mDiscardedModelDataLoadHandles.erase(mDiscardedModelDataLoadHandles.begin() + i);
-				i--;
-			}
-		}
-
-#ifdef ZX_EDITOR
-		for (size_t i = 0; i < mEditorMaterialLoadHandles.size(); i++)
-		{
-			if (mEditorMaterialLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				MaterialStruct* material = mEditorMaterialLoadHandles[i].future.get();
-				mEditorMaterialLoadHandles[i].callback(material);
-				delete material;
-				mEditorMaterialLoadHandles.erase(mEditorMaterialLoadHandles.begin() + i);
-				i--;
-			}
-		}
-		for (size_t i = 0; i < mDiscardedEditorMaterialLoadHandles.size(); i++)
-		{
-			if (mDiscardedEditorMaterialLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				delete mDiscardedEditorMaterialLoadHandles[i].future.get();
-				mDiscardedEditorMaterialLoadHandles.erase(mDiscardedEditorMaterialLoadHandles.begin() + i);
-				i--;
-			}
-		}
-
-		for (size_t i = 0; i < mEditorModelDataLoadHandles.size(); i++)
-		{
-			if (mEditorModelDataLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				ModelData* modelData = mEditorModelDataLoadHandles[i].future.get();
-				mEditorModelDataLoadHandles[i].callback(modelData);
-				delete modelData;
-				mEditorModelDataLoadHandles.erase(mEditorModelDataLoadHandles.begin() + i);
-				i--;
-			}
+			// 超出预算的留到下一帧，每帧至少处理一个，保证加载一定能推进
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+			if (elapsed.count() > ASYNC_LOAD_TIME_BUDGET)
+				break;
 		}
-		for (size_t i = 0; i < mDiscardedEditorModelDataLoadHandles.size(); i++)
-		{
-			if (mDiscardedEditorModelDataLoadHandles[i].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-			{
-				delete mDiscardedEditorModelDataLoadHandles[i].future.get();
-				mDiscardedEditorModelDataLoadHandles.erase(mDiscardedEditorModelDataLoadHandles.begin() + i);
-				i--;
-			}
-		}
-#endif
 	}
 
 	void Resources::ClearAsyncLoad()
 	{
-		for (size_t i = 0; i < mPrefabLoadHandles.size(); i++)
-		{
-			mDiscardedPrefabLoadHandles.push_back(std::move(mPrefabLoadHandles[i]));
-		}
-		mPrefabLoadHandles.clear();
-
-		for (size_t i = 0; i < mMaterialLoadHandles.size(); i++)
-		{
-			mDiscardedMaterialLoadHandles.push_back(std::move(mMaterialLoadHandles[i]));
-		}
-		mMaterialLoadHandles.clear();
-
-		for (size_t i = 0; i < mModelDataLoadHandles.size(); i++)
-		{
-			mDiscardedModelDataLoadHandles.push_back(std::move(mModelDataLoadHandles[i]));
-		}
-		mModelDataLoadHandles.clear();
+		DiscardAsyncLoad(false);
 	}
 
 #ifdef ZX_EDITOR
 	void Resources::ClearEditorAsyncLoad()
 	{
-		for (size_t i = 0; i < mEditorMaterialLoadHandles.size(); i++)
-		{
-			mDiscardedEditorMaterialLoadHandles.push_back(std::move(mEditorMaterialLoadHandles[i]));
-		}
-		mEditorMaterialLoadHandles.clear();
-
-		for (size_t i = 0; i < mEditorModelDataLoadHandles.size(); i++)
-		{
-			mDiscardedEditorModelDataLoadHandles.push_back(std::move(mEditorModelDataLoadHandles[i]));
-		}
-		mEditorModelDataLoadHandles.clear();
+		DiscardAsyncLoad(true);
 	}
 #endif
 
-	void Resources::AsyncLoadPrefab(const string& path, std::function<void(PrefabStruct*)> callback, bool isBuiltIn)
+	void Resources::DiscardAsyncLoad(bool isEditor)
 	{
-		std::promise<PrefabStruct*> promise;
-		std::future<PrefabStruct*> future = promise.get_future();
-		std::thread th(DoAsyncLoadPrefab, std::move(promise), path, isBuiltIn);
-		th.detach();
+		for (auto iter = mAsyncLoadRequests.begin(); iter != mAsyncLoadRequests.end();)
+		{
+			if (iter->second.isEditor != isEditor)
+			{
+				iter++;
+				continue;
+			}
 
-		PrefabLoadHandle handle;
-		handle.future = std::move(future);
-		handle.callback = std::move(callback);
-		mPrefabLoadHandles.push_back(std::move(handle));
-	}
+			// 还在排队的直接取消，已经开始加载的等结果回来再释放
+			if (!mAsyncLoadThreadPool->Cancel(iter->second.taskID))
+				mDiscardedAsyncLoads.insert(iter->first);
 
-	void Resources::DoAsyncLoadPrefab(std::promise<PrefabStruct*>&& promise, string path, bool isBuiltIn)
-	{
-		PrefabStruct* prefab = LoadPrefab(path, isBuiltIn, true);
-		promise.set_value(prefab);
+			iter = mAsyncLoadRequests.erase(iter);
+		}
 	}
 
-	void Resources::AsyncLoadMaterial(const string& path, std::function<void(MaterialStruct*)> callback, bool isBuiltIn, bool isEditor)
+	void Resources::SubmitAsyncLoad(std::function<std::function<void(bool)>()>&& load, bool isEditor, AsyncLoadPriority priority)
 	{
-		std::promise<MaterialStruct*> promise;
-		std::future<MaterialStruct*> future = promise.get_future();
-		std::thread th(DoAsyncLoadMaterial, std::move(promise), path, isBuiltIn);
-		th.detach();
+		if (mAsyncLoadThreadPool == nullptr)
+			mAsyncLoadThreadPool = new ThreadPool(ASYNC_LOAD_THREAD_NUM);
 
-		MaterialLoadHandle handle;
-		handle.future = std::move(future);
-		handle.callback = std::move(callback);
-#ifdef ZX_EDITOR
-		if (isEditor)
-			mEditorMaterialLoadHandles.push_back(std::move(handle));
-		else
-			mMaterialLoadHandles.push_back(std::move(handle));
-#else
-		mMaterialLoadHandles.push_back(std::move(handle));
-#endif
+		uint32_t id = mNextAsyncLoadID++;
+
+		AsyncLoadRequest request;
+		request.isEditor = isEditor;
+		request.taskID = mAsyncLoadThreadPool->Submit([id, load = std::move(load)]()
+		{
+			mAsyncLoadResults.Push({ id, load() });
+		}, static_cast<int>(priority));
+
+		mAsyncLoadRequests[id] = request;
 	}
 
-	void Resources::DoAsyncLoadMaterial(std::promise<MaterialStruct*>&& promise, string path, bool isBuiltIn)
+	void Resources::AsyncLoadPrefab(const string& path, std::function<void(PrefabStruct*)> callback, bool isBuiltIn, AsyncLoadPriority priority)
 	{
-		MaterialStruct* material = LoadMaterial(path, isBuiltIn);
-		promise.set_value(material);
+		SubmitAsyncLoad([path, isBuiltIn, callback = std::move(callback)]() -> std::function<void(bool)>
+		{
+			PrefabStruct* prefab = LoadPrefab(path, isBuiltIn, true);
+			return [prefab, callback](bool discarded)
+			{
+				if (!discarded)
+					callback(prefab);
+				// TODO: 检查内存泄漏
+				delete prefab;
+			};
+		}, false, priority);
 	}
 
-	void Resources::AsyncLoadModelData(const string& path, std::function<void(ModelData*)> callback, bool isBuiltIn, bool isEditor)
+	void Resources::AsyncLoadMaterial(const string& path, std::function<void(MaterialStruct*)> callback, bool isBuiltIn, bool isEditor, AsyncLoadPriority priority)
 	{
-		std::promise<ModelData*> promise;
-		std::future<ModelData*> future = promise.get_future();
-		std::thread th(DoAsyncLoadModelData, std::move(promise), path, isBuiltIn);
-		th.detach();
-
-		ModelDataLoadHandle handle;
-		handle.future = std::move(future);
-		handle.callback = std::move(callback);
-#ifdef ZX_EDITOR
-		if (isEditor)
-			mEditorModelDataLoadHandles.push_back(std::move(handle));
-		else
-			mModelDataLoadHandles.push_back(std::move(handle));
-#else
-		mModelDataLoadHandles.push_back(std::move(handle));
-#endif
+		SubmitAsyncLoad([path, isBuiltIn, callback = std::move(callback)]() -> std::function<void(bool)>
+		{
+			MaterialStruct* material = LoadMaterial(path, isBuiltIn);
+			return [material, callback](bool discarded)
+			{
+				if (!discarded)
+					callback(material);
+				delete material;
+			};
+		}, isEditor, priority);
 	}
 
-	void Resources::DoAsyncLoadModelData(std::promise<ModelData*>&& promise, string path, bool isBuiltIn)
+	void Resources::AsyncLoadModelData(const string& path, std::function<void(ModelData*)> callback, bool isBuiltIn, bool isEditor, AsyncLoadPriority priority)
 	{
-		ModelData* modelData = ModelUtil::LoadModel(path, isBuiltIn, true);
-		promise.set_value(modelData);
+		SubmitAsyncLoad([path, isBuiltIn, callback = std::move(callback)]() -> std::function<void(bool)>
+		{
+			ModelData* modelData = ModelUtil::LoadModel(path, isBuiltIn, true);
+			return [modelData, callback](bool discarded)
+			{
+				if (!discarded)
+					callback(modelData);
+				delete modelData;
+			};
+		}, isEditor, priority);
 	}
 }
\ No newline at end of file
@@ -1,10 +1,19 @@
 #pragma once
 #include "pubh.h"
 #include "PublicStruct.h"
+#include "PhysZ/PhysZEnumStruct.h"
+#include "Concurrent/Queue.h"
 #include <stb_image.h>
 
+// 异步加载线程数
+#define ASYNC_LOAD_THREAD_NUM 4
+// 每帧处理异步加载回调的时间预算（微秒）
+#define ASYNC_LOAD_TIME_BUDGET 2000
+
 namespace ZXEngine
 {
+	class ThreadPool;
+
 	struct TextureStruct
 	{
 		string uniformName;
@@ -27,9 +36,9 @@ namespace ZXEngine
 	{
 		string name;
 		string path;
-		string shaderPath;        // դߵshader·
+		string shaderPath;        // 光栅化管线的shader路径
 		string shaderCode;
-		uint32_t hitGroupIdx = 0; // ׷ߵhitGroup
+		uint32_t hitGroupIdx = 0; // 光追管线的hitGroup索引
 
 		map<string, float> floatDatas;
 		map<string, uint32_t> uintDatas;
@@ -49,6 +58,7 @@ namespace ZXEngine
 	{
 		string name;
 		uint32_t layer = 0;
+		bool isStatic = false;
 		list<json> components;
 		PrefabStruct* parent = nullptr;
 		vector<PrefabStruct*> children;
@@ -65,43 +75,44 @@ namespace ZXEngine
 		vector<PrefabStruct*> prefabs;
 		RenderPipelineType renderPipelineType = RenderPipelineType::Rasterization;
 		RayTracingShaderPathGroup rtShaderPathGroup;
+		// 物理场景使用的粗检测算法
+		PhysZ::BroadphaseType broadphaseType = PhysZ::BroadphaseType::DynamicAABBTree;
+		// 物理场景使用的碰撞处理算法
+		PhysZ::ContactSolverType contactSolverType = PhysZ::ContactSolverType::Iterative;
 
 		~SceneStruct();
 	};
 
-	struct PrefabLoadHandle
-	{
-		std::future<PrefabStruct*> future;
-		std::function<void(PrefabStruct*)> callback;
-	};
-
-	struct MaterialLoadHandle
+	struct AsyncLoadRequest
 	{
-		std::future<MaterialStruct*> future;
-		std::function<void(MaterialStruct*)> callback;
+		// 在加载线程池里的任务ID，用于取消
+		uint32_t taskID = 0;
+		bool isEditor = false;
 	};
 
-	struct ModelDataLoadHandle
+	// 加载线程执行完后交给主线程的结果
+	struct AsyncLoadResult
 	{
-		std::future<ModelData*> future;
-		std::function<void(ModelData*)> callback;
+		uint32_t id = 0;
+		// 参数为true表示这次加载已经被丢弃了，只释放加载结果，不执行回调
+		std::function<void(bool)> finish;
 	};
 
 	class Resources
 	{
 	public:
-		// ʲ·
+		// 内置资产路径
 		static const string mBuiltInAssetsPath;
 		
 
-		// -------- ͬӿ --------
+		// -------- 同步接口 --------
 	public:
 		static void SetAssetsPath(const string& path);
-		// ȡǰAssetsļ·
+		// 获取当前工程Assets文件夹路径
 		static string GetAssetsPath();
-		// Assetsµ·תΪӲϵ·
+		// 把Assets下的路径转为硬盘上的路径
 		static string GetAssetFullPath(const string& path, bool isBuiltIn = false);
-		// Ӳϵ·תΪAssetsµ·
+		// 把硬盘上的路径转为Assets下的路径
 		static string GetAssetLocalPath(const string& path);
 		static string GetAssetName(const string& path);
 		static string GetAssetExtension(const string& path);
@@ -127,33 +138,30 @@ namespace ZXEngine
 		static PrefabStruct* ParsePrefab(json data, bool async = false);
 
 
-		// -------- 첽ӿ --------
+		// -------- 异步接口 --------
 	public:
 		static void CheckAsyncLoad();
 		static void ClearAsyncLoad();
-		static void AsyncLoadPrefab(const string& path, std::function<void(PrefabStruct*)> callback, bool isBuiltIn = false);
-		static void AsyncLoadMaterial(const string& path, std::function<void(MaterialStruct*)> callback, bool isBuiltIn = false, bool isEditor = false);
-		static void AsyncLoadModelData(const string& path, std::function<void(ModelData*)> callback, bool isBuiltIn = false, bool isEditor = false);
+		static void AsyncLoadPrefab(const string& path, std::function<void(PrefabStruct*)> callback, bool isBuiltIn = false, AsyncLoadPriority priority = AsyncLoadPriority::Normal);
+		static void AsyncLoadMaterial(const string& path, std::function<void(MaterialStruct*)> callback, bool isBuiltIn = false, bool isEditor = false, AsyncLoadPriority priority = AsyncLoadPriority::Normal);
+		static void AsyncLoadModelData(const string& path, std::function<void(ModelData*)> callback, bool isBuiltIn = false, bool isEditor = false, AsyncLoadPriority priority = AsyncLoadPriority::Normal);
 #ifdef ZX_EDITOR
 		static void ClearEditorAsyncLoad();
 #endif
 
 	private:
-		static vector<PrefabLoadHandle> mPrefabLoadHandles;
-		static vector<PrefabLoadHandle> mDiscardedPrefabLoadHandles;
-		static vector<MaterialLoadHandle> mMaterialLoadHandles;
-		static vector<MaterialLoadHandle> mDiscardedMaterialLoadHandles;
-		static vector<ModelDataLoadHandle> mModelDataLoadHandles;
-		static vector<ModelDataLoadHandle> mDiscardedModelDataLoadHandles;
-#ifdef ZX_EDITOR
-		static vector<MaterialLoadHandle> mEditorMaterialLoadHandles;
-		static vector<MaterialLoadHandle> mDiscardedEditorMaterialLoadHandles;
-		static vector<ModelDataLoadHandle> mEditorModelDataLoadHandles;
-		static vector<ModelDataLoadHandle> mDiscardedEditorModelDataLoadHandles;
-#endif
-
-		static void DoAsyncLoadPrefab(std::promise<PrefabStruct*>&& prms, string path, bool isBuiltIn);
-		static void DoAsyncLoadMaterial(std::promise<MaterialStruct*>&& prms, string path, bool isBuiltIn);
-		static void DoAsyncLoadModelData(std::promise<ModelData*>&& prms, string path, bool isBuiltIn);
+		// 所有异步加载共用一个固定线程数的线程池，避免同时加载大量资源时创建过多线程
+		static ThreadPool* mAsyncLoadThreadPool;
+		static uint32_t mNextAsyncLoadID;
+		// 还没处理完的加载请求
+		static unordered_map<uint32_t, AsyncLoadRequest> mAsyncLoadRequests;
+		// 被清理时已经开始执行，没能取消的加载请求，结果回来后直接释放
+		static unordered_set<uint32_t> mDiscardedAsyncLoads;
+		// 加载线程把结果放进这个队列，主线程在CheckAsyncLoad里按时间预算取出来处理
+		static Concurrent::Queue<AsyncLoadResult> mAsyncLoadResults;
+
+		// load在加载线程执行，返回值是主线程上的收尾函数
+		static void SubmitAsyncLoad(std::function<std::function<void(bool)>()>&& load, bool isEditor, AsyncLoadPriority priority);
+		static void DiscardAsyncLoad(bool isEditor);
 	};
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "Scene.h"
 #include "RenderEngine.h"
 #include "RenderQueueManager.h"
+#include "SpatialIndex.h"
+#include "StaticBatch.h"
 #include "CubeMap.h"
 #include "GameObject.h"
 #include "Component/ZCamera.h"
@@ -18,19 +20,20 @@ namespace ZXEngine
 {
 	Scene::Scene(SceneStruct* sceneStruct)
 	{
-		mPhyScene = new PhysZ::PScene(1000, 1000);
+		mPhyScene = new PhysZ::PScene(1000, 1000, sceneStruct->broadphaseType, sceneStruct->contactSolverType);
+		mSpatialIndex = new SpatialIndex();
 		skyBox = new CubeMap(sceneStruct->skyBox);
 		renderPipelineType = sceneStruct->renderPipelineType;
 
 		if (renderPipelineType == RenderPipelineType::RayTracing)
 			rtPipelineID = RenderAPI::GetInstance()->CreateRayTracingPipeline(sceneStruct->rtShaderPathGroup);
 
-		// ʱлȾͣΪڹ׷ģҪBLASĿǰȼسл
-		// лǰصĳӦĹߣ곡лȥ
+		// 临时切换渲染管线类型，因为用于光追场景的模型需要生成BLAS，但是目前会先加载场景再切换场景
+		// 所以这里先切换到当前加载的场景对应的管线，加载完场景再切换回去
 		auto curPipelineType = ProjectSetting::renderPipelineType;
 		ProjectSetting::renderPipelineType = renderPipelineType;
 
-		// ʱлSceneManagerĵǰΪthisΪGameObjectڹʱܻҪõǰ
+		// 临时切换SceneManager里的当前场景为this，因为GameObject在构造的时候可能会需要用到当前这个场景
 		auto tmpScene = new SceneInfo();
 		tmpScene->scene = this;
 		auto curScene = SceneManager::GetInstance()->curScene;
@@ -46,8 +49,13 @@ namespace ZXEngine
 		{
 			gameObject->EndConstruction();
 			mPhyScene->AddGameObject(gameObject);
+			RegisterGameObject(gameObject);
 		}
 
+		// 光追管线直接用原始Mesh构建加速结构，不需要静态合批
+		if (ProjectSetting::enableStaticBatch && renderPipelineType == RenderPipelineType::Rasterization)
+			StaticBatch::Build(gameObjects, mStaticBatches);
+
 		ProjectSetting::renderPipelineType = curPipelineType;
 		SceneManager::GetInstance()->curScene = curScene;
 		delete tmpScene;
@@ -57,11 +65,17 @@ namespace ZXEngine
 	{
 		delete skyBox;
 
+		// 静态合批引用了成员的材质，要在GameObject之前删除
+		for (auto staticBatch : mStaticBatches)
+			delete staticBatch;
+
 		for (auto gameObject : gameObjects)
 		{
 			delete gameObject;
 		}
 
+		delete mSpatialIndex;
+
 		Resources::ClearAsyncLoad();
 	}
 
@@ -85,15 +99,42 @@ namespace ZXEngine
 	
 	void Scene::Render()
 	{
+		// 渲染前统一刷新本帧所有变化过的Transform，后面渲染流程里获取世界矩阵都只是读缓存
+		Transform::UpdateAllDirtyTransforms();
+		auto& changedTransforms = Transform::GetChangedTransforms();
+		mSpatialIndex->Refit(changedTransforms);
+
+		// 静态物体只有被编辑过才需要重新合并
+		for (auto transform : changedTransforms)
+		{
+			auto meshRenderer = transform->gameObject->GetComponent<MeshRenderer>();
+			if (meshRenderer != nullptr && meshRenderer->mStaticBatch != nullptr)
+				meshRenderer->mStaticBatch->CheckMember(meshRenderer);
+		}
+		for (auto staticBatch : mStaticBatches)
+			staticBatch->RebuildIfDirty();
+
 		for (unsigned i = 0; i < Camera::GetAllCameras().size(); ++i)
 		{
 			auto camera = Camera::GetAllCameras()[i];
 			if (camera->cameraType != CameraType::GameCamera)
 				continue;
 
-			for (auto gameObject : gameObjects)
+			auto renderQueueMgr = RenderQueueManager::GetInstance();
+			if (renderPipelineType == RenderPipelineType::Rasterization)
+			{
+				// 只从SpatialIndex中取出视锥体内的物体
+				renderQueueMgr->SetCullingCamera(camera);
+				renderQueueMgr->AddRenderers(mSpatialIndex);
+				for (auto uiGameObject : mUIGameObjects)
+					renderQueueMgr->AddUIGameObject(uiGameObject);
+			}
+			else
 			{
-				RenderQueueManager::GetInstance()->AddGameObject(gameObject);
+				// 光追管线需要用完整的场景构建加速结构，不能做视锥体剔除
+				renderQueueMgr->SetCullingCamera(nullptr);
+				for (auto gameObject : gameObjects)
+					renderQueueMgr->AddGameObject(gameObject);
 			}
 
 			RenderEngine::GetInstance()->Render(camera);
@@ -103,6 +144,25 @@ namespace ZXEngine
 	void Scene::AddGameObject(GameObject* gameObject)
 	{
 		gameObjects.push_back(gameObject);
+		RegisterGameObject(gameObject);
+	}
+
+	void Scene::RegisterGameObject(GameObject* gameObject)
+	{
+		// 和RenderQueueManager::AddGameObject的遍历规则保持一致
+		if (gameObject->layer == (int)GameObjectLayer::UI)
+		{
+			mUIGameObjects.push_back(gameObject);
+		}
+		else
+		{
+			auto meshRenderer = gameObject->GetComponent<MeshRenderer>();
+			if (meshRenderer != nullptr)
+				mSpatialIndex->Insert(meshRenderer);
+		}
+
+		for (auto child : gameObject->children)
+			RegisterGameObject(child);
 	}
 
 	void Scene::UpdatePhysics()
@@ -112,10 +172,10 @@ namespace ZXEngine
 			long long targetFrame = Time::curTime_micro / Time::fixedDeltaTime_micro;
 			long long deltaFrame = targetFrame - mCurPhyFrame;
 
-			// ǰϷ֡Ŀ֡һ֡
+			// 当前游戏帧数高于物理引擎的目标帧数，跳过这一帧的物理更新
 			if (deltaFrame <= 0)
 				return;
-			// ǰϷ֡Ŀ֡Ҫ֡ǲ̫ܲ࣬ᵼϷ֡ʽһͣѭȻ
+			// 当前游戏帧数低于物理引擎的目标帧数，需要补物理帧，但是不能补太多，否则会导致游戏帧率进一步降低，恶性循环然后卡死
 			else if (deltaFrame > 10)
 				deltaFrame = 10;
 
@@ -127,7 +187,7 @@ namespace ZXEngine
 				mPhyScene->EndFrame();
 			}
 
-			// ûв߲֡˶֡Ѿ׷Ŀ֡
+			// 无论有没有补帧，或者补了多少帧，都当作已经追上了目标帧数
 			mCurPhyFrame = targetFrame;
 		}
 		else
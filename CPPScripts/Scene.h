@@ -6,6 +6,8 @@ namespace ZXEngine
 	class Camera;
 	class CubeMap;
 	class GameObject;
+	class SpatialIndex;
+	class StaticBatch;
 	struct SceneStruct;
 
 	namespace PhysZ
@@ -31,10 +33,17 @@ namespace ZXEngine
 	private:
 		bool mIsAwake = false;
 		vector<Camera*> mCameras;
+		// 场景中所有非UI的MeshRenderer
+		SpatialIndex* mSpatialIndex;
+		// 场景中所有UI层的GameObject，按层级遍历顺序排列
+		vector<GameObject*> mUIGameObjects;
+		// 场景加载时合并好的静态物体，运行时再添加的物体不参与
+		vector<StaticBatch*> mStaticBatches;
 
 		PhysZ::PScene* mPhyScene;
 		long long mCurPhyFrame = 0;
 
 		void UpdatePhysics();
+		void RegisterGameObject(GameObject* gameObject);
 	};
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "RenderAPI.h"
 #include "LuaManager.h"
 #include "RenderPassManager.h"
+#include "AssetCache.h"
 
 #ifdef ZX_EDITOR
 #include "Editor/EditorDialogBoxManager.h"
@@ -52,9 +53,9 @@ namespace ZXEngine
 		}
 #endif
 
-		// Ŀǰೡͬʱ⣬ҪGameLogicLightϣ¼һȫб
-		// Ȼڱʱ򣬻ڵǰĶ󣬱õڵǰLuaű
-		// ʱֵֻ֧гʱжԭ
+		// 目前多场景同时管理还有问题，主要体现在GameLogic和Light等组件上，会记录到一个全局列表里
+		// 然后在遍历这种组件的时候，会遍历到不属于当前场景的对象，比如调用到不属于当前场景的Lua脚本
+		// 所以暂时只支持单场景，切场景的时候先卸载原场景
 		DeleteAllScene();
 		string name = Resources::GetAssetName(path);
 
@@ -63,6 +64,10 @@ namespace ZXEngine
 		info->scene = new Scene(sceneStruct);
 		scenes.insert(pair<string, SceneInfo*>(name, info));
 
+#ifdef ZX_DEBUG
+		AssetCache::LogStats();
+#endif
+
 		if (switchNow)
 			SwitchScene(name);
 
@@ -114,7 +119,7 @@ namespace ZXEngine
 
 	void SceneManager::ReloadScene()
 	{
-		// ȵȴǰлƽжسͷԴ
+		// 先等待当前所有绘制结束，再卸载场景释放资源
 		RenderAPI::GetInstance()->WaitForRenderFinish();
 		delete curScene->scene;
 		curScene->scene = new Scene(Resources::LoadScene(curScene->path));
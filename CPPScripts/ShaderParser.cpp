@@ -113,11 +113,11 @@ namespace ZXEngine
 		ShaderInfo info;
 		info.stateSet = GetShaderStateSet(code);
 
-		// õstringרͣΪstringfindsubstrȲصЩͺ;뻷й
-		// رfindϺܶط˵ûҵͻ᷵-1ʵ˵׼ȷΪfindĺ巵صsize_t
-		// size_tһ޷(λȡڱ뻷)һ޷-1Ϊˣʵûҵʱصnpos
-		// ʵֱintҲУԶʽתҲ-1жǷҵбWarning
-		// Ϊڸֱ뻷²ֱӲԭеstring::size_typestring::nposյģҲWarning
+		// 这里数字类型用的是string库里的专用类型，因为string库的find，substr等操作返回的这些数据类型和具体编译环境有关
+		// 特别是find，网上很多地方说没找到就会返回-1，其实这个说法不准确，因为find的函数定义返回的类型是size_t
+		// 而size_t是一个无符号整数(具体多少位取决于编译环境)，一个无符号整数变成-1，是因为溢出了，实际上没找到的时候真正返回的是npos
+		// 其实直接用int来处理也行，会自动隐式转换，也可以用-1来判断是否找到，但是这样会有编译的Warning
+		// 为了在各种编译环境下不出错，这里直接采用原定义中的string::size_type和string::npos是最保险的，并且不会有Warning
 		string::size_type hasDirLight = code.find("ENGINE_Light_Dir");
 		string::size_type hasPointLight = code.find("ENGINE_Light_Pos");
 		if (hasDirLight != string::npos)
@@ -143,6 +143,15 @@ namespace ZXEngine
 		if (!geomCode.empty())
 			info.stages |= ZX_SHADER_STAGE_GEOMETRY_BIT;
 
+		// 顶点输入里有INSTANCE语义的变量，说明模型矩阵是逐实例输入的
+		auto vertInputLines = Utils::StringSplit(GetCodeBlock(vertCode, "Input"), '\n');
+		for (auto& line : vertInputLines)
+		{
+			auto words = Utils::ExtractWords(line);
+			if (words.size() >= 5 && words[0] != "//" && words[4] == "INSTANCE")
+				info.instancing = true;
+		}
+
 		info.vertProperties = GetProperties(vertCode);
 		info.fragProperties = GetProperties(fragCode);
 		if (!geomCode.empty())
@@ -164,8 +173,8 @@ namespace ZXEngine
 
 	PropertyAlignInfo ShaderParser::GetPropertyAlignInfoStd140(ShaderPropertyType type, uint32_t arrayLength)
 	{
-		// ҪעVulkanڴ淶: https://registry.khronos.org/vulkan/specs/1.3-extensions/html/chap15.html#interfaces-resources-layout
-		// ǰstd140׼ʵֵڴ
+		// 这里要注意Vulkan的内存对齐规范: https://registry.khronos.org/vulkan/specs/1.3-extensions/html/chap15.html#interfaces-resources-layout
+		// 这里是按照std140标准实现的内存对齐
 
 		uint32_t std_size = sizeof(float);
 		if (type == ShaderPropertyType::BOOL || type == ShaderPropertyType::INT || type == ShaderPropertyType::UINT
@@ -339,18 +348,18 @@ namespace ZXEngine
 		lines = Utils::StringSplit(programCode, '\n');
 		for (auto& line : lines)
 		{
-			// ˷
+			// 处理矩阵乘法
 			size_t pos = 0;
 			if ((pos = Utils::FindWord(line, "mul", pos)) != string::npos)
 			{
 				size_t sPos = string::npos;
 				size_t ePos = string::npos;
 				Utils::GetNextStringBlockPos(line, pos, '(', ')', sPos, ePos);
-				// ɾ mul 
+				// 删除 mul 函数和括号
 				line.replace(pos, ePos - pos + 1, line.substr(sPos + 1, ePos - sPos - 1));
 			}
 
-			// GetTextureSize
+			// 处理GetTextureSize函数
 			pos = 0;
 			if ((pos = Utils::FindWord(line, "GetTextureSize", pos)) != string::npos)
 			{
@@ -367,7 +376,7 @@ namespace ZXEngine
 			glCode += line + "\n";
 		}
 
-		// 
+		// 处理数组声明
 		size_t pos = 0;
 		while ((pos = Utils::FindWord(glCode, "array", pos)) != string::npos)
 		{
@@ -480,7 +489,7 @@ namespace ZXEngine
 		}
 		vkCode += "\n";
 
-		// UBO
+		// 处理UBO变量命名
 		string programBlock = GetCodeBlock(preprocessedCode, "Program");
 		if (!info.baseProperties.empty())
 		{
@@ -491,18 +500,18 @@ namespace ZXEngine
 		lines = Utils::StringSplit(programBlock, '\n');
 		for (auto& line : lines)
 		{
-			// ˷
+			// 处理矩阵乘法
 			size_t pos = 0;
 			if ((pos = Utils::FindWord(line, "mul", pos)) != string::npos)
 			{
 				size_t sPos = string::npos;
 				size_t ePos = string::npos;
 				Utils::GetNextStringBlockPos(line, pos, '(', ')', sPos, ePos);
-				// ɾ mul 
+				// 删除 mul 函数和括号
 				line.replace(pos, ePos - pos + 1, line.substr(sPos + 1, ePos - sPos - 1));
 			}
 
-			// GetTextureSize
+			// 处理GetTextureSize函数
 			pos = 0;
 			if ((pos = Utils::FindWord(line, "GetTextureSize", pos)) != string::npos)
 			{
@@ -519,7 +528,7 @@ namespace ZXEngine
 			vkCode += line + "\n";
 		}
 
-		// 
+		// 处理数组声明
 		size_t pos = 0;
 		while ((pos = Utils::FindWord(vkCode, "array", pos)) != string::npos)
 		{
@@ -577,10 +586,10 @@ namespace ZXEngine
 		string geomCode = GetCodeBlock(preprocessedCode, "Geometry");
 		string fragCode = GetCodeBlock(preprocessedCode, "Fragment");
 
-		// HLSLĬϵΪ
+		// 把HLSL默认的行主序矩阵改为列主序
 		string dxCode = "#pragma pack_matrix(column_major)\n\n";
 
-		// ɫṹ
+		// 顶点着色器输入结构体
 		dxCode += "struct VertexInput\n{\n";
 		string vertInputBlock = GetCodeBlock(vertCode, "Input");
 		vector<string> vertInputVariables;
@@ -596,7 +605,7 @@ namespace ZXEngine
 		}
 		dxCode += "};\n\n";
 
-		// ɫṹ
+		// 顶点着色器输出结构体
 		dxCode += "struct VertexOutput\n{\n";
 		string vertOutputBlock = GetCodeBlock(vertCode, "Output");
 		vector<string> vertOutputVariables;
@@ -644,7 +653,7 @@ namespace ZXEngine
 			dxCode += "};\n\n";
 		}
 
-		// ƬԪ()ɫṹ
+		// 片元(像素)着色器输出结构体
 		bool writeToDepth = fragCode.find("ZX_Depth") != string::npos;
 		dxCode += "struct PixelOutput\n{\n";
 		string fragOutputBlock = GetCodeBlock(fragCode, "Output");
@@ -663,7 +672,7 @@ namespace ZXEngine
 			dxCode += "    float ZX_Depth : SV_Depth;\n";
 		dxCode += "};\n\n";
 
-		// CPU˳Buffer
+		// CPU端常量Buffer
 		dxCode += "cbuffer constantBuffer : register(b0)\n{\n";
 		for (auto& property : shaderInfo.vertProperties.baseProperties)
 		{
@@ -688,7 +697,7 @@ namespace ZXEngine
 		}
 		dxCode += "};\n\n";
 
-		// 
+		// 纹理
 		uint32_t textureIdx = 0;
 		for (auto& property : shaderInfo.vertProperties.textureProperties)
 		{
@@ -716,19 +725,19 @@ namespace ZXEngine
 		}
 		dxCode += "\n";
 
-		// 
+		// 采样器
 		dxCode += "SamplerState _SampleLinearWrap       : register(s0);\n";
 		dxCode += "SamplerState _SampleLinearClamp      : register(s1);\n";
 		dxCode += "SamplerState _SampleAnisotropicWrap  : register(s2);\n";
 		dxCode += "SamplerState _SampleAnisotropicClamp : register(s3);\n\n";
 
-		// ɫ
+		// 顶点着色器
 		string vertProgramBlock = GetCodeBlock(vertCode, "Program");
 		lines = Utils::StringSplit(vertProgramBlock, '\n');
-		// мҪ﷨
+		// 逐行检测需要处理的语法
 		for (auto& line : lines)
 		{
-			// ˷
+			// 处理矩阵乘法
 			size_t pos = Utils::FindWord(line, "mul", 0);
 			if (pos != string::npos)
 			{
@@ -747,11 +756,11 @@ namespace ZXEngine
 
 					multipliers.push_back("mul(" + leftMul + ", " + rightMul + ")");
 				}
-				// ɾ mul 
+				// 删除 mul 函数和括号
 				line.replace(pos, ePos - pos + 1, multipliers[0]);
 			}
 
-			// GetTextureSize
+			// 处理GetTextureSize函数
 			pos = 0;
 			if ((pos = Utils::FindWord(line, "GetTextureSize", pos)) != string::npos)
 			{
@@ -768,14 +777,14 @@ namespace ZXEngine
 			line += "\n";
 		}
 		vertProgramBlock = Utils::ConcatenateStrings(lines);
-		// ȥmain
+		// 去掉main函数
 		for (auto& line : lines)
 		{
 			if (line.find("main") != string::npos)
 				break;
 			dxCode += line;
 		}
-		// VS main
+		// 重新生成VS main函数
 		string vertMainBlock = GetCodeBlock(vertProgramBlock, "main");
 		Utils::ReplaceAllWord(vertMainBlock, "ZX_Position", "output.ZX_Pos");
 		for (auto& varName : vertInputVariables)
@@ -789,15 +798,15 @@ namespace ZXEngine
 		dxCode += "    return output;\n";
 		dxCode += "}\n\n";
 
-		// ɫ
+		// 几何着色器
 		if (shaderInfo.stages & ZX_SHADER_STAGE_GEOMETRY_BIT)
 		{
 			string geomProgramBlock = GetCodeBlock(geomCode, "Program");
 			lines = Utils::StringSplit(geomProgramBlock, '\n');
-			// мҪ﷨
+			// 逐行检测需要处理的语法
 			for (auto& line : lines)
 			{
-				// ˷
+				// 处理矩阵乘法
 				size_t pos = Utils::FindWord(line, "mul", 0);
 				if (pos != string::npos)
 				{
@@ -816,11 +825,11 @@ namespace ZXEngine
 
 						multipliers.push_back("mul(" + leftMul + ", " + rightMul + ")");
 					}
-					// ɾ mul 
+					// 删除 mul 函数和括号
 					line.replace(pos, ePos - pos + 1, multipliers[0]);
 				}
 
-				// GetTextureSize
+				// 处理GetTextureSize函数
 				pos = 0;
 				if ((pos = Utils::FindWord(line, "GetTextureSize", pos)) != string::npos)
 				{
@@ -837,14 +846,14 @@ namespace ZXEngine
 				line += "\n";
 			}
 			geomProgramBlock = Utils::ConcatenateStrings(lines);
-			// ȥmain
+			// 去掉main函数
 			for (auto& line : lines)
 			{
 				if (line.find("main") != string::npos)
 					break;
 				dxCode += line;
 			}
-			// GS main
+			// 重新生成GS main函数
 			string geomMainBlock = GetCodeBlock(geomProgramBlock, "main");
 			Utils::ReplaceAllWord(geomMainBlock, "ZX_Position", "output.ZX_Pos");
 			Utils::ReplaceAllWord(geomMainBlock, "GS_IN_Position", "ZX_Pos");
@@ -862,13 +871,13 @@ namespace ZXEngine
 			dxCode += "}\n\n";
 		}
 
-		// ƬԪ()ɫ
+		// 片元(像素)着色器
 		string fragProgramBlock = GetCodeBlock(fragCode, "Program");
 		lines = Utils::StringSplit(fragProgramBlock, '\n');
-		// мҪ﷨
+		// 逐行检测需要处理的语法
 		for (auto& line : lines)
 		{
-			// ˷
+			// 处理矩阵乘法
 			size_t pos = Utils::FindWord(line, "mul", 0);
 			if (pos != string::npos)
 			{
@@ -887,11 +896,11 @@ namespace ZXEngine
 
 					multipliers.push_back("mul(" + leftMul + ", " + rightMul + ")");
 				}
-				// ɾ mul 
+				// 删除 mul 函数和括号
 				line.replace(pos, ePos - pos + 1, multipliers[0]);
 			}
 
-			// GetTextureSize
+			// 处理GetTextureSize函数
 			pos = 0;
 			if ((pos = Utils::FindWord(line, "GetTextureSize", pos)) != string::npos)
 			{
@@ -908,14 +917,14 @@ namespace ZXEngine
 			line += "\n";
 		}
 		fragProgramBlock = Utils::ConcatenateStrings(lines);
-		// ȥmain
+		// 去掉main函数
 		for (auto& line : lines)
 		{
 			if (line.find("main") != string::npos)
 				break;
 			dxCode += line;
 		}
-		// PS main
+		// 重新生成PS main函数
 		string fragMainBlock = GetCodeBlock(fragProgramBlock, "main");
 		for (auto& varName : fragOutputVariables)
 			Utils::ReplaceAllWord(fragMainBlock, varName, "output." + varName);
@@ -939,7 +948,7 @@ namespace ZXEngine
 		dxCode += "    return output;\n";
 		dxCode += "}\n";
 
-		// 滻﷨
+		// 替换纹理采样语法
 		size_t pos = 0;
 		while ((pos = Utils::FindWord(dxCode, "texture", pos)) != string::npos)
 		{
@@ -958,7 +967,7 @@ namespace ZXEngine
 			pos += newSentence.length();
 		}
 
-		// 
+		// 处理数组声明
 		pos = 0;
 		while ((pos = Utils::FindWord(dxCode, "array", pos)) != string::npos)
 		{
@@ -988,7 +997,7 @@ namespace ZXEngine
 			pos += newSentence.length();
 		}
 
-		// 󹹽ΪHLSLGLSLľĬһ£Ҫתһ
+		// 处理矩阵构建，因为HLSL和GLSL的矩阵默认主序不一致，这里需要转置一下
 		pos = 0;
 		while ((pos = Utils::FindWord(dxCode, "build_mat3", pos)) != string::npos)
 		{
@@ -1020,12 +1029,12 @@ namespace ZXEngine
 			pos += newSentence.length();
 		}
 
-		// ǿת
+		// 强制类型转换
 		Utils::ReplaceAllWord(dxCode, "to_vec2", "(float2)");
 		Utils::ReplaceAllWord(dxCode, "to_vec3", "(float3)");
 		Utils::ReplaceAllWord(dxCode, "to_mat3", "(float3x3)");
 
-		// 滻
+		// 替换变量类型名称
 		Utils::ReplaceAllWord(dxCode, "vec2", "float2");
 		Utils::ReplaceAllWord(dxCode, "vec3", "float3");
 		Utils::ReplaceAllWord(dxCode, "vec4", "float4");
@@ -1038,11 +1047,11 @@ namespace ZXEngine
 		Utils::ReplaceAllWord(dxCode, "mat3", "float3x3");
 		Utils::ReplaceAllWord(dxCode, "mat4", "float4x4");
 
-		// 滻ú
+		// 替换内置函数名称
 		Utils::ReplaceAllWord(dxCode, "fract", "frac");
 		Utils::ReplaceAllWord(dxCode, "mod", "fmod");
 
-		// ⴦DirectX 12OpenGL/Vulkanϵ(NDC or ϵ?)YǷģGLSL߼дģҪȡȷ
+		// 特殊处理，由于DirectX 12和OpenGL/Vulkan的坐标系(NDC or 纹理采样坐标系?)在Y轴上是反的，代码是以GLSL的逻辑写的，所以这里要取反才正确
 		Utils::ReplaceAllWord(dxCode, "ddy", " -ddy");
 
 		return dxCode;
@@ -1102,7 +1111,7 @@ namespace ZXEngine
 		if (begin == string::npos)
 			return "";
 
-		// BlockNameһĴʣ߱һ
+		// BlockName必须是一个单独的词，不是其它函数名或者变量的一部分
 		if ((begin > 0 && isalnum(code[begin - 1])) || (begin + blockName.size() < code.size() && isalnum(code[begin + blockName.size()])))
 			return "";
 
@@ -1144,7 +1153,7 @@ namespace ZXEngine
 				e = i;
 		}
 
-		// 
+		// 不是数组变量
 		if (s == 0 || e == 0)
 		{
 			name = propertyStr;
@@ -1196,7 +1205,7 @@ namespace ZXEngine
 
 	void ShaderParser::SetUpPropertiesStd140(ShaderInfo& info)
 	{
-		// ǰstd140׼ʵֵڴ
+		// 这里是按照std140标准实现的内存对齐
 		uint32_t binding = 0;
 
 		if (!info.vertProperties.baseProperties.empty())
@@ -1280,12 +1289,12 @@ namespace ZXEngine
 
 	void ShaderParser::SetUpPropertiesHLSL(ShaderInfo& info)
 	{
-		// ǰ HLSL Packing Rule ʵֵ
-		// ΢ĵ: https://learn.microsoft.com/en-us/windows/win32/direct3dhlsl/dx-graphics-hlsl-packing-rules
-		// ΢Githubĵ: https://github.com/microsoft/DirectXShaderCompiler/wiki/Buffer-Packing
-		// ֪ĵ: https://zhuanlan.zhihu.com/p/560076693
+		// 这里是按照 HLSL Packing Rule 来实现的
+		// 微软官网文档链接: https://learn.microsoft.com/en-us/windows/win32/direct3dhlsl/dx-graphics-hlsl-packing-rules
+		// 微软Github文档链接: https://github.com/microsoft/DirectXShaderCompiler/wiki/Buffer-Packing
+		// 知乎文档链接: https://zhuanlan.zhihu.com/p/560076693
 
-		// ĿǰZXEngineһHLSL ShaderֻһConstant BufferбϸVSGSPSProperties˳
+		// 目前的ZXEngine里一个HLSL Shader只有一个Constant Buffer，所有变量严格按照VS，GS，PS里的Properties声明顺序排列
 		uint32_t offset = 0;
 		if (!info.vertProperties.baseProperties.empty())
 		{
@@ -1295,17 +1304,17 @@ namespace ZXEngine
 				property.size = alignInfo.size;
 				property.align = alignInfo.align;
 				property.arrayOffset = alignInfo.arrayOffset;
-				// ǰ16ֽڼĴʣֽ
+				// 当前的16字节寄存器还剩几个字节
 				uint32_t remainder = 16 - (offset % 16);
-				// жһʣ⼸ֽڹװһݣһǾĻǿװһԪأһԪرضҪ16ֽڶ
+				// 判断一下剩的这几个字节够不够装下一个数据，下一个数据如果是矩阵或者数组的话就是看够不够装一个元素，而矩阵或数组的一个元素必定需要16字节对齐
 				if (remainder >= alignInfo.align)
-					// װĻֱӷŽȥҲoffsetֱǵǰʵռõoffset
+					// 如果够装的话，就直接放进去，也就是offset直接是当前实际占用的offset
 					property.offset = offset;
 				else
-					// װĻҪ16ֽڼĴһ16ֽڼĴҲoffsetҪremainder뵽һ16ֽڵλ
+					// 如果不够装的话，就需要跳过这个16字节寄存器，用下一个16字节寄存器，也就是offset需要加上remainder来补齐到下一个对齐16字节的位置
 					property.offset = offset + remainder;
 
-				// offsetʵռôСƫ
+				// offset根据数据实际占用大小进行偏移
 				offset = property.offset + property.size;
 			}
 		}
@@ -1344,7 +1353,7 @@ namespace ZXEngine
 			}
 		}
 
-		// bindingָHLSLregister(t)ϸVSGSPS˳
+		// 这里的binding是指纹理在HLSL里的register(t)索引，严格按照VS，GS，PS里的纹理声明顺序排列
 		uint32_t binding = 0;
 		for (auto& property : info.vertProperties.textureProperties)
 		{
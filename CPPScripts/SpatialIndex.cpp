@@ -0,0 +1,382 @@
+#include "SpatialIndex.h"
+#include "GameObject.h"
+
+namespace ZXEngine
+{
+	static AABB Union(const AABB& a, const AABB& b)
+	{
+		return AABB(
+			Vector3(Math::Min(a.min.x, b.min.x), Math::Min(a.min.y, b.min.y), Math::Min(a.min.z, b.min.z)),
+			Vector3(Math::Max(a.max.x, b.max.x), Math::Max(a.max.y, b.max.y), Math::Max(a.max.z, b.max.z))
+		);
+	}
+
+	static bool Contains(const AABB& outer, const AABB& inner)
+	{
+		return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z
+			&& outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+	}
+
+	// 用表面积作为插入代价
+	static float SurfaceArea(const AABB& aabb)
+	{
+		Vector3 size = aabb.max - aabb.min;
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	void SpatialIndex::Insert(MeshRenderer* renderer)
+	{
+		if (renderer->mSpatialIndexNode != UINT32_MAX)
+			return;
+
+		mRendererCount++;
+
+		if (renderer->mAnimator)
+		{
+			mUnboundedRenderers.push_back(renderer);
+			return;
+		}
+
+		uint32_t leaf = AllocateNode();
+		auto& aabb = renderer->GetWorldAABB();
+		mNodes[leaf].aabb = AABB(aabb.min - Vector3(mFatMargin), aabb.max + Vector3(mFatMargin));
+		mNodes[leaf].renderer = renderer;
+		mNodes[leaf].height = 0;
+		renderer->mSpatialIndexNode = leaf;
+
+		InsertLeaf(leaf);
+	}
+
+	void SpatialIndex::Remove(MeshRenderer* renderer)
+	{
+		if (renderer->mAnimator)
+		{
+			auto iter = std::find(mUnboundedRenderers.begin(), mUnboundedRenderers.end(), renderer);
+			if (iter != mUnboundedRenderers.end())
+			{
+				mUnboundedRenderers.erase(iter);
+				mRendererCount--;
+			}
+			return;
+		}
+
+		uint32_t leaf = renderer->mSpatialIndexNode;
+		if (leaf == UINT32_MAX)
+			return;
+
+		RemoveLeaf(leaf);
+		FreeNode(leaf);
+		renderer->mSpatialIndexNode = UINT32_MAX;
+		mRendererCount--;
+	}
+
+	void SpatialIndex::Refit(const vector<Transform*>& changedTransforms)
+	{
+		for (auto transform : changedTransforms)
+		{
+			auto renderer = transform->gameObject->GetComponent<MeshRenderer>();
+			if (renderer == nullptr || renderer->mSpatialIndexNode == UINT32_MAX)
+				continue;
+
+			uint32_t leaf = renderer->mSpatialIndexNode;
+			auto& aabb = renderer->GetWorldAABB();
+
+			// 还在胖包围盒里就不用动树
+			if (Contains(mNodes[leaf].aabb, aabb))
+				continue;
+
+			RemoveLeaf(leaf);
+			mNodes[leaf].aabb = AABB(aabb.min - Vector3(mFatMargin), aabb.max + Vector3(mFatMargin));
+			InsertLeaf(leaf);
+		}
+	}
+
+	void SpatialIndex::QueryFrustum(const Frustum& frustum, vector<MeshRenderer*>& result) const
+	{
+		Query([&frustum](const AABB& aabb) { return frustum.Intersects(aabb); }, result);
+	}
+
+	void SpatialIndex::QuerySphere(const Vector3& center, float radius, vector<MeshRenderer*>& result) const
+	{
+		float radiusSquared = radius * radius;
+		Query([&center, radiusSquared](const AABB& aabb)
+		{
+			// 包围盒上离球心最近的点
+			Vector3 closest(
+				Math::Clamp(center.x, aabb.min.x, aabb.max.x),
+				Math::Clamp(center.y, aabb.min.y, aabb.max.y),
+				Math::Clamp(center.z, aabb.min.z, aabb.max.z)
+			);
+			return (closest - center).GetMagnitudeSquared() <= radiusSquared;
+		}, result);
+	}
+
+	void SpatialIndex::QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance, vector<MeshRenderer*>& result) const
+	{
+		Vector3 invDir(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+		Query([&origin, &invDir, maxDistance](const AABB& aabb)
+		{
+			// Slab方法
+			float tMin = 0.0f;
+			float tMax = maxDistance;
+			for (int i = 0; i < 3; i++)
+			{
+				float t1 = (aabb.min[i] - origin[i]) * invDir[i];
+				float t2 = (aabb.max[i] - origin[i]) * invDir[i];
+				tMin = Math::Max(tMin, Math::Min(t1, t2));
+				tMax = Math::Min(tMax, Math::Max(t1, t2));
+			}
+			return tMin <= tMax;
+		}, result);
+	}
+
+	size_t SpatialIndex::GetRendererCount() const
+	{
+		return mRendererCount;
+	}
+
+	int32_t SpatialIndex::GetHeight() const
+	{
+		return mRoot == UINT32_MAX ? 0 : mNodes[mRoot].height;
+	}
+
+	uint32_t SpatialIndex::AllocateNode()
+	{
+		uint32_t id;
+		if (mFreeNodes.empty())
+		{
+			id = static_cast<uint32_t>(mNodes.size());
+			mNodes.emplace_back();
+		}
+		else
+		{
+			id = mFreeNodes.back();
+			mFreeNodes.pop_back();
+		}
+
+		mNodes[id] = Node();
+		return id;
+	}
+
+	void SpatialIndex::FreeNode(uint32_t id)
+	{
+		mNodes[id] = Node();
+		mFreeNodes.push_back(id);
+	}
+
+	void SpatialIndex::InsertLeaf(uint32_t leaf)
+	{
+		if (mRoot == UINT32_MAX)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = UINT32_MAX;
+			return;
+		}
+
+		// 从根节点往下找一个插入后表面积增长代价最小的兄弟节点
+		AABB leafAABB = mNodes[leaf].aabb;
+		uint32_t index = mRoot;
+		while (!mNodes[index].IsLeaf())
+		{
+			auto& node = mNodes[index];
+			float area = SurfaceArea(node.aabb);
+			float combinedArea = SurfaceArea(Union(node.aabb, leafAABB));
+
+			// 在这里新建父节点的代价
+			float cost = 2.0f * combinedArea;
+			// 继续往下走时，当前节点包围盒增长带来的代价
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto childCost = [&](uint32_t child)
+			{
+				float newArea = SurfaceArea(Union(leafAABB, mNodes[child].aabb));
+				if (mNodes[child].IsLeaf())
+					return newArea + inheritanceCost;
+				else
+					return newArea - SurfaceArea(mNodes[child].aabb) + inheritanceCost;
+			};
+
+			float leftCost = childCost(node.left);
+			float rightCost = childCost(node.right);
+
+			if (cost < leftCost && cost < rightCost)
+				break;
+
+			index = leftCost < rightCost ? node.left : node.right;
+		}
+
+		uint32_t sibling = index;
+		uint32_t oldParent = mNodes[sibling].parent;
+		uint32_t newParent = AllocateNode();
+		mNodes[newParent].parent = oldParent;
+		mNodes[newParent].aabb = Union(leafAABB, mNodes[sibling].aabb);
+		mNodes[newParent].height = mNodes[sibling].height + 1;
+		mNodes[newParent].left = sibling;
+		mNodes[newParent].right = leaf;
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		if (oldParent == UINT32_MAX)
+		{
+			mRoot = newParent;
+		}
+		else
+		{
+			if (mNodes[oldParent].left == sibling)
+				mNodes[oldParent].left = newParent;
+			else
+				mNodes[oldParent].right = newParent;
+		}
+
+		RefitAncestors(mNodes[leaf].parent);
+	}
+
+	void SpatialIndex::RemoveLeaf(uint32_t leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = UINT32_MAX;
+			return;
+		}
+
+		uint32_t parent = mNodes[leaf].parent;
+		uint32_t grandParent = mNodes[parent].parent;
+		uint32_t sibling = mNodes[parent].left == leaf ? mNodes[parent].right : mNodes[parent].left;
+
+		// 用兄弟节点替换掉父节点
+		if (grandParent == UINT32_MAX)
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = UINT32_MAX;
+		}
+		else
+		{
+			if (mNodes[grandParent].left == parent)
+				mNodes[grandParent].left = sibling;
+			else
+				mNodes[grandParent].right = sibling;
+			mNodes[sibling].parent = grandParent;
+			RefitAncestors(grandParent);
+		}
+
+		FreeNode(parent);
+		mNodes[leaf].parent = UINT32_MAX;
+	}
+
+	void SpatialIndex::RefitAncestors(uint32_t id)
+	{
+		while (id != UINT32_MAX)
+		{
+			id = Balance(id);
+
+			auto& node = mNodes[id];
+			node.height = 1 + Math::Max(mNodes[node.left].height, mNodes[node.right].height);
+			node.aabb = Union(mNodes[node.left].aabb, mNodes[node.right].aabb);
+
+			id = node.parent;
+		}
+	}
+
+	uint32_t SpatialIndex::Balance(uint32_t iA)
+	{
+		// 如果A的左右子树高度差超过1，就把较高的子节点旋转上来，返回旋转后这个位置上的节点
+		Node& A = mNodes[iA];
+		if (A.IsLeaf() || A.height < 2)
+			return iA;
+
+		uint32_t iB = A.left;
+		uint32_t iC = A.right;
+		int32_t balance = mNodes[iC].height - mNodes[iB].height;
+
+		if (balance > 1)
+		{
+			// C上移
+			uint32_t iF = mNodes[iC].left;
+			uint32_t iG = mNodes[iC].right;
+			Node& C = mNodes[iC];
+
+			C.left = iA;
+			C.parent = A.parent;
+			A.parent = iC;
+
+			if (C.parent != UINT32_MAX)
+			{
+				if (mNodes[C.parent].left == iA)
+					mNodes[C.parent].left = iC;
+				else
+					mNodes[C.parent].right = iC;
+			}
+			else
+			{
+				mRoot = iC;
+			}
+
+			// 把F和G中较高的留给C，较矮的给A
+			if (mNodes[iF].height > mNodes[iG].height)
+			{
+				C.right = iF;
+				A.right = iG;
+				mNodes[iG].parent = iA;
+			}
+			else
+			{
+				C.right = iG;
+				A.right = iF;
+				mNodes[iF].parent = iA;
+			}
+
+			A.aabb = Union(mNodes[A.left].aabb, mNodes[A.right].aabb);
+			A.height = 1 + Math::Max(mNodes[A.left].height, mNodes[A.right].height);
+			C.aabb = Union(A.aabb, mNodes[C.right].aabb);
+			C.height = 1 + Math::Max(A.height, mNodes[C.right].height);
+
+			return iC;
+		}
+
+		if (balance < -1)
+		{
+			// B上移
+			uint32_t iD = mNodes[iB].left;
+			uint32_t iE = mNodes[iB].right;
+			Node& B = mNodes[iB];
+
+			B.left = iA;
+			B.parent = A.parent;
+			A.parent = iB;
+
+			if (B.parent != UINT32_MAX)
+			{
+				if (mNodes[B.parent].left == iA)
+					mNodes[B.parent].left = iB;
+				else
+					mNodes[B.parent].right = iB;
+			}
+			else
+			{
+				mRoot = iB;
+			}
+
+			if (mNodes[iD].height > mNodes[iE].height)
+			{
+				B.right = iD;
+				A.left = iE;
+				mNodes[iE].parent = iA;
+			}
+			else
+			{
+				B.right = iE;
+				A.left = iD;
+				mNodes[iD].parent = iA;
+			}
+
+			A.aabb = Union(mNodes[A.left].aabb, mNodes[A.right].aabb);
+			A.height = 1 + Math::Max(mNodes[A.left].height, mNodes[A.right].height);
+			B.aabb = Union(A.aabb, mNodes[B.right].aabb);
+			B.height = 1 + Math::Max(A.height, mNodes[B.right].height);
+
+			return iB;
+		}
+
+		return iA;
+	}
+}
\ No newline at end of file
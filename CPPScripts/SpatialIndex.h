@@ -0,0 +1,102 @@
+#pragma once
+#include "pubh.h"
+#include "Culling.h"
+#include "Component/MeshRenderer.h"
+
+namespace ZXEngine
+{
+	class Transform;
+	// 场景中所有MeshRenderer世界空间包围盒的动态AABB树
+	// 叶节点存的是外扩过的"胖"包围盒，物体只有移出胖包围盒时才需要重新插入
+	class SpatialIndex
+	{
+	public:
+		SpatialIndex() {};
+		~SpatialIndex() {};
+
+		void Insert(MeshRenderer* renderer);
+		void Remove(MeshRenderer* renderer);
+		// 根据本帧变化过的Transform增量更新树
+		void Refit(const vector<Transform*>& changedTransforms);
+
+		void QueryFrustum(const Frustum& frustum, vector<MeshRenderer*>& result) const;
+		void QuerySphere(const Vector3& center, float radius, vector<MeshRenderer*>& result) const;
+		// 射线查询，返回包围盒与射线在maxDistance内相交的物体(无序)
+		void QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance, vector<MeshRenderer*>& result) const;
+
+		size_t GetRendererCount() const;
+		// 树的高度，可以用来判断树的平衡程度
+		int32_t GetHeight() const;
+
+	private:
+		struct Node
+		{
+			AABB aabb;
+			MeshRenderer* renderer = nullptr;
+			uint32_t parent = UINT32_MAX;
+			uint32_t left = UINT32_MAX;
+			uint32_t right = UINT32_MAX;
+			// 叶节点为0，空闲节点为-1
+			int32_t height = -1;
+
+			bool IsLeaf() const { return left == UINT32_MAX; }
+		};
+
+		// 胖包围盒外扩的距离
+		static constexpr float mFatMargin = 0.1f;
+
+		uint32_t mRoot = UINT32_MAX;
+		vector<Node> mNodes;
+		vector<uint32_t> mFreeNodes;
+		size_t mRendererCount = 0;
+		// 带骨骼动画的物体包围盒不可靠，不放进树里，每次查询都直接返回
+		vector<MeshRenderer*> mUnboundedRenderers;
+		// 查询时用的栈，避免每次查询都分配内存
+		mutable vector<uint32_t> mStack;
+
+		uint32_t AllocateNode();
+		void FreeNode(uint32_t id);
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+		// 从某个节点开始往上重新计算包围盒和高度，并做旋转平衡
+		void RefitAncestors(uint32_t id);
+		uint32_t Balance(uint32_t id);
+
+		template<class Predicate>
+		void Query(Predicate overlap, vector<MeshRenderer*>& result) const;
+	};
+
+	template<class Predicate>
+	void SpatialIndex::Query(Predicate overlap, vector<MeshRenderer*>& result) const
+	{
+		for (auto renderer : mUnboundedRenderers)
+			result.push_back(renderer);
+
+		if (mRoot == UINT32_MAX)
+			return;
+
+		mStack.clear();
+		mStack.push_back(mRoot);
+		while (!mStack.empty())
+		{
+			uint32_t id = mStack.back();
+			mStack.pop_back();
+
+			auto& node = mNodes[id];
+			if (!overlap(node.aabb))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				// 叶节点是胖包围盒，再用实际的包围盒判断一次
+				if (overlap(node.renderer->GetWorldAABB()))
+					result.push_back(node.renderer);
+			}
+			else
+			{
+				mStack.push_back(node.left);
+				mStack.push_back(node.right);
+			}
+		}
+	}
+}
\ No newline at end of file
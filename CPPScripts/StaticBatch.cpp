@@ -0,0 +1,155 @@
+#include "StaticBatch.h"
+#include "GameObject.h"
+#include "StaticMesh.h"
+#include "Material.h"
+#include "ZShader.h"
+
+namespace ZXEngine
+{
+	void StaticBatch::Build(const vector<GameObject*>& gameObjects, vector<StaticBatch*>& staticBatches)
+	{
+		// 材质相同并且接收阴影的设置相同才能一起绘制
+		map<pair<uint32_t, bool>, vector<MeshRenderer*>> groups;
+		for (auto gameObject : gameObjects)
+			CollectStaticRenderers(gameObject, groups);
+
+		for (auto& iter : groups)
+		{
+			// 只有一个物体的组合并了也不会减少DrawCall
+			if (iter.second.size() > 1)
+				staticBatches.push_back(new StaticBatch(iter.second));
+		}
+	}
+
+	void StaticBatch::CollectStaticRenderers(GameObject* gameObject, map<pair<uint32_t, bool>, vector<MeshRenderer*>>& groups)
+	{
+		if (gameObject->layer == (int)GameObjectLayer::UI)
+			return;
+
+		auto meshRenderer = gameObject->GetComponent<MeshRenderer>();
+		// 半透明物体需要逐个排序，带动画的Mesh每帧都会变，Instancing的Shader只能用Instancing绘制，都不参与静态合批
+		if (gameObject->isStatic && meshRenderer != nullptr && meshRenderer->mMatetrial != nullptr && !meshRenderer->mMeshes.empty()
+			&& meshRenderer->mAnimator == nullptr && meshRenderer->mMatetrial->GetRenderQueue() == (int)RenderQueueType::Opaque
+			&& !meshRenderer->mMatetrial->shader->reference->shaderInfo.instancing)
+		{
+			groups[{ meshRenderer->mMatetrial->sortID, meshRenderer->mReceiveShadow }].push_back(meshRenderer);
+		}
+
+		for (auto child : gameObject->children)
+			CollectStaticRenderers(child, groups);
+	}
+
+	StaticBatch::StaticBatch(const vector<MeshRenderer*>& members)
+	{
+		mGameObject = new GameObject();
+		mGameObject->AddComponent<Transform>();
+		mRenderer = mGameObject->AddComponent<MeshRenderer>();
+		// 材质是引用的第一个成员的，析构时不能delete
+		mRenderer->mMatetrial = members[0]->mMatetrial;
+		mRenderer->mReceiveShadow = members[0]->mReceiveShadow;
+
+		for (size_t i = 0; i < members.size(); i++)
+		{
+			members[i]->mStaticBatch = this;
+			members[i]->mStaticBatchIndex = static_cast<uint32_t>(i);
+			mMembers.push_back({ .renderer = members[i], .range = {}, .transformVersion = 0 });
+		}
+
+		Merge();
+	}
+
+	StaticBatch::~StaticBatch()
+	{
+		for (auto& member : mMembers)
+			member.renderer->mStaticBatch = nullptr;
+
+		mRenderer->mMatetrial = nullptr;
+		delete mGameObject;
+	}
+
+	MeshRenderer* StaticBatch::GetRenderer() const
+	{
+		return mRenderer;
+	}
+
+	bool StaticBatch::AddVisibleMember(MeshRenderer* member)
+	{
+		bool isFirst = mVisibleRanges.empty();
+		mVisibleRanges.push_back(mMembers[member->mStaticBatchIndex].range);
+		return isFirst;
+	}
+
+	void StaticBatch::UpdateDrawRanges()
+	{
+		std::sort(mVisibleRanges.begin(), mVisibleRanges.end(), [](const IndexRange& a, const IndexRange& b) { return a.offset < b.offset; });
+
+		// 首尾相接的区间合并成一次绘制，所有成员都可见时只需要一个DrawCall
+		auto& drawRanges = mRenderer->mDrawRanges;
+		drawRanges.clear();
+		for (auto& range : mVisibleRanges)
+		{
+			if (!drawRanges.empty() && drawRanges.back().offset + drawRanges.back().count == range.offset)
+				drawRanges.back().count += range.count;
+			else
+				drawRanges.push_back(range);
+		}
+
+		mVisibleRanges.clear();
+	}
+
+	void StaticBatch::CheckMember(MeshRenderer* member)
+	{
+		if (member->GetTransform()->GetVersion() != mMembers[member->mStaticBatchIndex].transformVersion)
+			mIsDirty = true;
+	}
+
+	void StaticBatch::RebuildIfDirty()
+	{
+		if (!mIsDirty)
+			return;
+
+		Merge();
+		mIsDirty = false;
+	}
+
+	void StaticBatch::Merge()
+	{
+		vector<Vertex> vertices;
+		vector<uint32_t> indices;
+
+		for (auto& member : mMembers)
+		{
+			auto transform = member.renderer->GetTransform();
+			auto mat_M = transform->GetModelMatrix();
+			member.transformVersion = transform->GetVersion();
+			member.range.offset = static_cast<uint32_t>(indices.size());
+
+			for (auto mesh : member.renderer->mMeshes)
+			{
+				uint32_t idxOffset = static_cast<uint32_t>(vertices.size());
+				size_t vertexNum = mesh->mVertices.size();
+				vertices.resize(idxOffset + vertexNum);
+
+				const Vertex* src = mesh->mVertices.data();
+				Vertex* dst = vertices.data() + idxOffset;
+				Math::TransformPoints(mat_M, &src->Position, &dst->Position, vertexNum, sizeof(Vertex), sizeof(Vertex));
+				Math::TransformNormals(mat_M, &src->Normal, &dst->Normal, vertexNum, sizeof(Vertex), sizeof(Vertex));
+				Math::TransformDirections(mat_M, &src->Tangent, &dst->Tangent, vertexNum, sizeof(Vertex), sizeof(Vertex));
+				for (size_t i = 0; i < vertexNum; i++)
+					dst[i].TexCoords = src[i].TexCoords;
+
+				for (auto idx : mesh->mIndices)
+					indices.push_back(idx + idxOffset);
+			}
+
+			member.range.count = static_cast<uint32_t>(indices.size()) - member.range.offset;
+		}
+
+		for (auto mesh : mRenderer->mMeshes)
+			delete mesh;
+		mRenderer->mMeshes.clear();
+		mRenderer->mMeshes.push_back(new StaticMesh(vertices, indices));
+		mRenderer->mVerticesNum = vertices.size();
+		mRenderer->mTrianglesNum = indices.size() / 3;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include "pubh.h"
+#include "PublicStruct.h"
+
+namespace ZXEngine
+{
+	class GameObject;
+	class MeshRenderer;
+	// 场景加载时把使用相同材质的静态物体合并成一个世界空间下的Mesh
+	// 成员仍然各自参与剔除，绘制时只提交本帧可见成员在合并Mesh中的索引区间
+	class StaticBatch
+	{
+	public:
+		// 把gameObjects中所有标记为静态的MeshRenderer按材质分组合并
+		static void Build(const vector<GameObject*>& gameObjects, vector<StaticBatch*>& staticBatches);
+
+	private:
+		static void CollectStaticRenderers(GameObject* gameObject, map<pair<uint32_t, bool>, vector<MeshRenderer*>>& groups);
+
+	public:
+		StaticBatch(const vector<MeshRenderer*>& members);
+		~StaticBatch();
+
+		// 合并后用于绘制的Renderer
+		MeshRenderer* GetRenderer() const;
+		// 记录一个本帧可见的成员，如果是本帧第一个可见成员就返回true
+		bool AddVisibleMember(MeshRenderer* member);
+		// 把本帧可见成员的索引区间写入合并后Renderer的绘制区间，并清空本帧的可见记录
+		void UpdateDrawRanges();
+		// 成员的Transform变化过，如果和合并时不一致就标记为需要重新合并
+		void CheckMember(MeshRenderer* member);
+		// 只有成员被编辑过才重新合并
+		void RebuildIfDirty();
+
+	private:
+		struct Member
+		{
+			MeshRenderer* renderer = nullptr;
+			// 在合并后Mesh中的索引区间
+			IndexRange range;
+			// 合并时Transform的版本号
+			uint32_t transformVersion = 0;
+		};
+
+		bool mIsDirty = false;
+		GameObject* mGameObject = nullptr;
+		MeshRenderer* mRenderer = nullptr;
+		vector<Member> mMembers;
+		// 本帧可见成员的索引区间
+		vector<IndexRange> mVisibleRanges;
+
+		void Merge();
+	};
+}
\ No newline at end of file
@@ -21,10 +21,10 @@ namespace ZXEngine
 
 	TextCharactersManager::TextCharactersManager()
 	{
-        // ַȾShader
+        // 创建字符渲染Shader
         textShader = new Shader(Resources::GetAssetFullPath("Shaders/TextRenderer.zxshader", true), FrameBufferType::Present);
 
-        // ַ
+        // 加载字符
         LoadCharacters();
 	}
 
@@ -76,7 +76,7 @@ namespace ZXEngine
                 static_cast<unsigned int>(face->glyph->advance.x)
             };
 
-            // ֻʵͼַ
+            // 只生成有实际图像的字符纹理
             if (face->glyph->bitmap.width > 0 && face->glyph->bitmap.rows > 0)
                 character.TextureID = RenderAPI::GetInstance()->GenerateTextTexture(face->glyph->bitmap.width, face->glyph->bitmap.rows, face->glyph->bitmap.buffer);
 
@@ -18,12 +18,16 @@ namespace ZXEngine
 	Texture::Texture(TextureFullData* data)
 	{
 		type = TextureType::ZX_2D;
+		width = data->width;
+		height = data->height;
 		ID = RenderAPI::GetInstance()->CreateTexture(data);
 	}
 
 	Texture::Texture(CubeMapFullData* data)
 	{
 		type = TextureType::ZX_Cube;
+		width = data->width;
+		height = data->height;
 		ID = RenderAPI::GetInstance()->CreateCubeMap(data);
 	}
 
@@ -24,11 +24,11 @@ namespace ZXEngine
 		long long time = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 		long long time_micro = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
-		// ǵһUpdatedeltaTimeΪ0䣬ʱ
+		// 如果是第一次Update，保持deltaTime为0不变，否则会变成时间戳
 		if (curSysTime_micro != 0)
 		{
 #ifdef ZX_EDITOR
-			// ༭ʱ䲻ͣӰ
+			// 编辑器时间不受暂停影响
 			curEditorTime += (time_micro - curSysTime_micro) / 1000000.0f;
 
 			if (EditorDataManager::isGameStart && EditorDataManager::isGamePause)
@@ -42,14 +42,14 @@ namespace ZXEngine
 				deltaTime = deltaTime_micro / 1000000.0f;
 			}
 #else
-			// ΢deltaTimeúпܾȲ
+			// 这里用微秒计算deltaTime，用毫秒有可能精度不够
 			deltaTime_micro = time_micro - curSysTime_micro;
 			deltaTime = deltaTime_micro / 1000000.0f;
 #endif
 		}
 
 #ifdef ZX_EDITOR
-		// ʱֱµǰϷʱ䣬ͣ״̬Ҫֶһ֡ȡͣŸ
+		// 正常运行时直接在这里更新当前游戏时间，暂停状态下需要手动点击下一帧或取消暂停才更新
 		if (EditorDataManager::isGameStart && !EditorDataManager::isGamePause)
 		{
 			curTime += deltaTime;
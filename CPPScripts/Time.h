@@ -7,31 +7,31 @@ namespace ZXEngine
 	class Time
 	{
 	public:
-		// ǰϵͳʱ룩
+		// 当前系统时间戳（秒）
 		static long long curSysTime;
-		// ǰϵͳʱ΢룩
+		// 当前系统时间戳（微秒）
 		static long long curSysTime_micro;
-		// Ϸǰʱ䣨룩
+		// 从游戏启动到当前的时间（秒）
 		static float curTime;
-		// Ϸǰʱ䣨΢룩
+		// 从游戏启动到当前的时间（微秒）
 		static long long curTime_micro;
-		// һ֡ڵʱ䣨룩
+		// 从上一帧到现在的时间（秒）
 		static float deltaTime;
-		// һ֡ڵʱ䣨΢룩
+		// 从上一帧到现在的时间（微秒）
 		static long long deltaTime_micro;
 #ifdef ZX_EDITOR
-		// ӱ༭ǰʱ䣨룩
+		// 从编辑器启动到当前的时间（秒）
 		static float curEditorTime;
 #endif
 
-		// ֡
+		// 物理帧率
 		static const int fixedFrameRate;
-		// ֡ʱ䣨룩
+		// 物理帧时间（秒）
 		static const float fixedDeltaTime;
-		// ֡ʱ䣨΢룩
+		// 物理帧时间（微秒）
 		static const long long fixedDeltaTime_micro;
 
-		// ʱ
+		// 更新时间
 		static void Update();
 		static void UpdateCurTime();
 	};
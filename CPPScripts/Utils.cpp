@@ -63,9 +63,9 @@ namespace ZXEngine
         size_t wordSize = word.size();
         while (pos != std::string::npos)
         {
-            // ͬʱ˵һĵʣһʵһ:
-            // 1, ǰһλַַǺϷַ
-            // 2, ʺһλַַǺϷַ
+            // 同时满足以下两个条件，说明这个单词是一个独立的单词，而不是另一个单词的一部分:
+            // 1, 单词前一个位置无字符，或者字符不是合法单词字符
+            // 2, 单词后一个位置无字符，或者字符不是合法单词字符
             if ((pos == 0 || (pos > 0 && !IsValidWordChar(str[pos - 1]))) && ((pos + wordSize == strSize) || !IsValidWordChar(str[pos + wordSize])))
                 return pos;
 
@@ -8,36 +8,36 @@ namespace ZXEngine
 	class Utils
 	{
 	public:
-		// ַתΪСд
+		// 字符串转换为小写
 		static inline std::string StringToLower(const std::string& str);
-		// ַתΪд
+		// 字符串转换为大写
 		static inline std::string StringToUpper(const std::string& str);
-		// ַָ
+		// 字符串分割
 		static std::vector<std::string> StringSplit(const std::string& oriStr, char p);
-		// ȡַее
+		// 提取字符串中的所有单词
 		static std::vector<std::string> ExtractWords(const std::string& str);
-		// ǷΪϷַ
+		// 是否为合法单词字符
 		static bool IsValidWordChar(char c);
-		// ַǷĳʣʼλ
+		// 查找字符串中是否存在某个单词，并返回起始位
 		static size_t FindWord(const std::string& str, const std::string& word, size_t offset);
-		// ַеĵ
+		// 替代字符串中的单词
 		static void ReplaceAllWord(std::string& oriStr, const std::string& srcWord, const std::string& dstWord);
-		// ַеַ
+		// 替代字符串中的字符串
 		static void ReplaceAllString(std::string& oriStr, const std::string& srcStr, const std::string& dstStr);
-		// ȡsChareCharһַֹλ
+		// 获取由sChar和eChar括起来的一段字符串起止位置
 		static void GetNextStringBlockPos(std::string& oriStr, size_t offset, char sChar, char eChar, size_t& sPos, size_t& ePos);
-		// ַƴ
+		// 字符串拼接
 		static std::string ConcatenateStrings(const std::vector<std::string>& strings);
-		// ·תΪWindowsʽ
+		// 路径转换为Windows格式
 		static inline std::string ConvertPathToWindowsFormat(const std::string path);
-		// ȡļչ
+		// 获取文件扩展名
 		static inline std::string GetFileExtension(const std::string& path);
-		// ʱ()תΪַ
+		// 时间(秒)转换为字符串
 		static std::string SecondsToString(float seconds);
 		static std::string SecondsToString(uint32_t seconds);
-		// ʱ()תΪַ
+		// 时间(毫秒)转换为字符串
 		static std::string MillisecondsToString(uint32_t milliseconds);
-		// ݴС(Byte)תΪַ
+		// 数据大小(Byte)转换为字符串
 		static std::string DataSizeToString(uint64_t size);
 	};
 
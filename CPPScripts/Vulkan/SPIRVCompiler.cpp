@@ -95,10 +95,10 @@ namespace ZXEngine
 			Debug::LogError("Generate SPIR-V file failed: " + path.string());
 		}
 
-		// VulkanSPIR-Vļ
+		// 用Vulkan工具生成SPIR-V文件
 		string command = "..\\..\\..\\Tools\\glslangValidator.exe -V " + Utils::ConvertPathToWindowsFormat(writeTempPath) + " -o " + Utils::ConvertPathToWindowsFormat(outputFinalPath);
 		std::system(command.c_str());
-		// ɾʱļ
+		// 删除临时文件
 		if (!ProjectSetting::preserveIntermediateShader)
 			if (!(std::remove(writeTempPath.c_str()) == 0))
 				Debug::LogError("Remove temporary SPIR-V file failed: " + path.string());
@@ -270,7 +270,7 @@ namespace ZXEngine
 
 		VkShaderModuleCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		// codeSizebytesģspirv.size()uint32_tһ32λintռ4ֽ
+		// 这里的codeSize是以bytes计算的，spirv.size()是uint32_t的数量，一个32位int占4字节
 		createInfo.codeSize = spirv.size() * 4;
 		createInfo.pCode = spirv.data();
 
@@ -7,7 +7,7 @@ namespace ZXEngine
 {
 	class SPIRVCompiler
 	{
-		// Ԥ
+		// 预编译
 	public:
 		static void CompileAllShader(string path);
 
@@ -17,9 +17,9 @@ namespace ZXEngine
 		static void GenerateSPIRVFile(const filesystem::path& path, const string& code, ShaderStageFlagBit stage);
 
 
-		// ʱ
-		// ҪõһGLSLangdllЩdllDebug汾̫ˣûӣЩӿ޷ֱʹãҪֶЩӽ
-		// ҹٷõWindows:https://github.com/KhronosGroup/glslang/releases
+		// 运行时编译
+		// 需要用到一堆GLSLang库的dll，但是这些dll的Debug版本太大了，工程里就没有添加，所以这些接口无法直接使用，需要手动把这些库链接进来才能用
+		// 可以在这里找官方编译好的Windows库:https://github.com/KhronosGroup/glslang/releases
 		/*
 	public:
 		static void RTInitialize();
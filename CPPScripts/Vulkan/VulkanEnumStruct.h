@@ -1,14 +1,14 @@
 #pragma once
 #include "../pubh.h"
-// volk⣬OpenGLGLAD⣬Vulkan
-// OpenGLһǱģֻդߵȾͲҪVulkanչͿԲ
-// VulkanĹ׷ȾģVulkanչVulkanչĺȫҪֶأҪVulkan
+// 添加volk库，这个库类似OpenGL的GLAD库，是用来加载Vulkan函数的
+// 但是这个和OpenGL不一样，这个不是必须的，如果只是做光栅化管线的渲染，就不需要启用Vulkan的扩展，就可以不做这个加载
+// 但是Vulkan的光线追踪渲染模块在Vulkan扩展里，而Vulkan扩展里的函数全部需要我们手动加载，所以需要用这个库来加载所有Vulkan函数
 #define VK_NO_PROTOTYPES
 #include <volk.h>
-// GLFWĻͲҪԼȥinclude Vulkanͷļ궨壬GLFWԼȥȻЩӿ
+// 用GLFW的话这里就不要自己去include Vulkan的头文件，用这个宏定义，让GLFW自己去处理，不然有些接口有问题
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
-// AMDдVulkanڴ
+// AMD写的Vulkan内存分配器
 #include "vk_mem_alloc.h"
 #include "../PublicStruct.h"
 
@@ -16,26 +16,26 @@
 
 namespace ZXEngine
 {
-    // GPUȾʱCPUԴ֡
+    // 在GPU渲染画面的时候，CPU可以处理的帧数
     const uint32_t MAX_FRAMES_IN_FLIGHT = 1;
 
-    // Ҫ֤
+    // 需要的验证层
     const vector<const char*> validationLayers =
     {
-        // Vulkan SDKͨVK_LAYER_KHRONOS_validation㣬ʽĿϵlayersӶȷָеȷϲ
+        // Vulkan SDK通过请求VK_LAYER_KHRONOS_validation层，来隐式的开启有所关于诊断的layers，从而避免明确的指定所有的明确的诊断层
         "VK_LAYER_KHRONOS_validation"
     };
 
-    // Ҫõչ
+    // 需要用到的扩展
     const vector<const char*> deviceExtensions =
     {
-        // չ֧ҲʹǷֽ֧ͼƵʾ(GPUͼ)
+        // 交换链扩展名，这个的支持也就代表了是否支持将图像绘制到显示器上(不是所有GPU都可以拿来绘图)
         VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-        // ׷չ
+        // 光追扩展
         VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME,
         VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME,
         VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME,
-        // Shaderʱչ
+        // Shader计时器扩展
         VK_KHR_SHADER_CLOCK_EXTENSION_NAME
     };
 
@@ -57,14 +57,14 @@ namespace ZXEngine
         bool isComplete() { return present != UINT32_MAX && graphics != UINT32_MAX; }
     };
 
-    // 
+    // 交换链的三大类属性设置
     struct SwapChainSupportDetails
     {
-        // surface(min/max number of images in swap chain, min/max width and height of images)
+        // 基本的surface功能属性(min/max number of images in swap chain, min/max width and height of images)
         VkSurfaceCapabilitiesKHR capabilities = {};
-        // Surfaceʽ(pixel format, color space)
+        // Surface格式(pixel format, color space)
         vector<VkSurfaceFormatKHR> formats;
-        // Чpresentationģʽ
+        // 有效的presentation模式
         vector<VkPresentModeKHR> presentModes;
     };
 
@@ -120,6 +120,10 @@ namespace ZXEngine
         uint32_t VAO = 0;
         uint32_t pipelineID = 0;
         uint32_t materialDataID = 0;
+        uint32_t instanceNum = 1;
+        uint32_t instanceBufferID = UINT32_MAX; // UINT32_MAX表示不是Instancing绘制
+        uint32_t indexOffset = 0;
+        uint32_t indexCount = UINT32_MAX; // UINT32_MAX表示绘制整个索引缓冲区
     };
 
     // For build Vulkan Acceleration Structure Instance
@@ -160,13 +164,13 @@ namespace ZXEngine
 
     struct VulkanVAO
     {
-        uint32_t indexCount = 0; // 
+        uint32_t indexCount = 0; // 索引数量
         VkBuffer indexBuffer = VK_NULL_HANDLE;
         VmaAllocation indexBufferAlloc = VK_NULL_HANDLE;
         void* indexBufferAddress = nullptr; // Only for dynamic mesh
         VkDeviceAddress indexBufferDeviceAddress = 0; // Only for ray tracing
 
-        uint32_t vertexCount = 0; // 
+        uint32_t vertexCount = 0; // 顶点数量
         VkBuffer vertexBuffer = VK_NULL_HANDLE;
         VmaAllocation vertexBufferAlloc = VK_NULL_HANDLE;
         void* vertexBufferAddress = nullptr; // Only for dynamic mesh
@@ -176,6 +180,13 @@ namespace ZXEngine
         bool inUse = false;
     };
 
+    struct VulkanInstanceBuffer
+    {
+        vector<VulkanBuffer> buffers; // 每个in flight的帧一个，CPU写入的同时GPU可能还在读上一帧的数据
+        uint32_t size = 0; // 最多能存放的实例数量
+        bool inUse = false;
+    };
+
     struct VulkanPipeline
     {
         string name; // For debug
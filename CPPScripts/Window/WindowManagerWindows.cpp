@@ -69,26 +69,26 @@ namespace ZXEngine
 
 	LRESULT WindowManagerWindows::WindowProcedure(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 	{
-		// ImGuiWin32Ϣ
+		// 给ImGui传递Win32窗口消息
 		if (ImGui_ImplWin32_WndProcHandler(hWnd, msg, wParam, lParam))
 			return true;
 
 		switch (msg)
 		{
-		// ڴС仯
+		// 窗口大小变化
 		case WM_SIZE:
 			mWindowWidth = static_cast<uint32_t>(LOWORD(lParam));
 			mWindowHeight = static_cast<uint32_t>(HIWORD(lParam));
 			mResized = true;
 
-			// С
+			// 窗口最小化
 			if (wParam == SIZE_MINIMIZED)
 			{
 				mAppPaused = true;
 				mMinimized = true;
 				mMaximized = false;
 			}
-			// 
+			// 窗口最大化
 			else if (wParam == SIZE_MAXIMIZED)
 			{
 				mAppPaused = false;
@@ -96,30 +96,30 @@ namespace ZXEngine
 				mMaximized = true;
 				OnResize();
 			}
-			// ڴСָ
+			// 窗口大小恢复
 			else if (wParam == SIZE_RESTORED)
 			{
-				// Сָ
+				// 从最小化恢复
 				if (mMinimized)
 				{
 					mAppPaused = false;
 					mMinimized = false;
 					OnResize();
 				}
-				// 󻯻ָ
+				// 从最大化恢复
 				else if (mMaximized)
 				{
 					mAppPaused = false;
 					mMaximized = false;
 					OnResize();
 				}
-				// û϶ڱ߿
+				// 用户正在拖动窗口边框
 				else if (mResizing)
 				{
-					// ʱڴСһֱͣ仯Ӧٴ
-					// Ҳյ WM_EXITSIZEMOVE ʱ
+					// 此时窗口大小会一直不停变化，不做响应，等拖完了再处理
+					// 也就是收到 WM_EXITSIZEMOVE 的时候
 				}
-				// һЩµĴڱ仯 SetWindowPos  mSwapChain->SetFullscreenState Ƚӿڵĵ
+				// 一些其他情况导致的窗口变化，比如 SetWindowPos 或 mSwapChain->SetFullscreenState 等接口的调用
 				else
 				{
 					OnResize();
@@ -127,25 +127,25 @@ namespace ZXEngine
 			}
 			return 0;
 
-		// ûϴڱ߿
+		// 用户在拖窗口边框
 		case WM_ENTERSIZEMOVE:
 			mAppPaused = true;
 			mResizing = true;
 			return 0;
 
-		// ûɿ˴ڱ߿
+		// 用户松开了窗口边框
 		case WM_EXITSIZEMOVE:
 			mAppPaused = false;
 			mResizing = false;
 			OnResize();
 			return 0;
 
-		// ¼
+		// 鼠标滚轮事件
 		case WM_MOUSEWHEEL:
 			OnMouseScroll(GET_WHEEL_DELTA_WPARAM(wParam));
 			return 0;
 
-		// ڹر
+		// 窗口关闭
 		case WM_DESTROY:
 			PostQuitMessage(0);
 			return 0;
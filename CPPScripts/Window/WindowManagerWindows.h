@@ -1,7 +1,7 @@
 #pragma once
 #include "WindowManager.h"
 
-// ֹwindows.hĺ궨maxminӰ쵽ֶͬ
+// 防止windows.h里的宏定义max和min影响到其它库里的相同字段
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
@@ -12,23 +12,25 @@ namespace ZXEngine
 		vector<Vertex> mVertices;
 		vector<uint32_t> mIndices;
 
-		// ƫ
+		// 骨骼偏移量数组
 		vector<Matrix4> mBonesOffset;
-		// ձ任(򣬻ֱӴԴ湩Shaderʹ)
+		// 骨骼最终变换矩阵数组(列主序，会直接传给显存供Shader使用)
 		vector<Matrix4> mBonesFinalTransform;
-		// ֵӳ
+		// 骨骼名字到数组索引的映射
 		unordered_map<string, uint32_t> mBoneNameToIndexMap;
+		// 数组索引到Skeleton骨骼下标的映射，加载时由Skeleton::BindMesh计算
+		vector<uint32_t> mBoneSkeletonIndices;
 
-		// xyzԶĵ㣬0-5ֱӦ+x, -x, +y, -y, +z, -z
+		// 在xyz方向上最远的点，0-5分别对应+x, -x, +y, -y, +z, -z
 		array<Vertex, 6> mExtremeVertices;
-		// ģXϵĳ
+		// 模型在X轴上的长度
 		float mAABBSizeX = 0.0f;
-		// ģYϵĳ
+		// 模型在Y轴上的长度
 		float mAABBSizeY = 0.0f;
-		// ģZϵĳ
+		// 模型在Z轴上的长度
 		float mAABBSizeZ = 0.0f;
 
-		~Mesh();
+		virtual ~Mesh();
 
 		virtual void SetUp() {};
 	};
@@ -2,12 +2,13 @@
 #include "RenderAPI.h"
 #include "Resources.h"
 #include "GlobalData.h"
+#include "AssetCache.h"
 
 namespace ZXEngine
 {
 	vector<ShaderReference*> Shader::loadedShaders;
 
-	// ڶΪVulkanPipelineʱҪúʵRenderPass֮VulkanĳDynamic RenderingͿȥ
+	// 第二个参数是因为Vulkan创建Pipeline的时候需要设置合适的RenderPass，如果之后Vulkan改成了Dynamic Rendering，这个参数就可以去掉了
 	Shader::Shader(const string& path, FrameBufferType type)
 	{
 		name = Resources::GetAssetName(path);
@@ -16,19 +17,21 @@ namespace ZXEngine
 		{
 			if (path == shaderReference->path)
 			{
-				// Ѽعֱ
+				// 如果已加载过，直接引用
 				reference = shaderReference;
-				// ü+1
+				// 引用计数+1
 				reference->referenceCount++;
+				AssetCache::RecordHit(CachedAssetType::Shader);
 				break;
 			}
 		}
-		// ûмعִļغͱ
+		// 如果没有加载过，执行真正的加载和编译
 		if (reference == nullptr)
 		{
 			reference = RenderAPI::GetInstance()->LoadAndSetUpShader(path, type);
 			reference->path = path;
 			loadedShaders.push_back(reference);
+			AssetCache::RecordLoad(CachedAssetType::Shader, 0);
 		}
 	}
 
@@ -42,6 +45,7 @@ namespace ZXEngine
 			{
 				reference = shaderReference;
 				reference->referenceCount++;
+				AssetCache::RecordHit(CachedAssetType::Shader);
 				break;
 			}
 		}
@@ -50,13 +54,14 @@ namespace ZXEngine
 			reference = RenderAPI::GetInstance()->SetUpShader(path, shaderCode, type);
 			reference->path = path;
 			loadedShaders.push_back(reference);
+			AssetCache::RecordLoad(CachedAssetType::Shader, 0);
 		}
 	}
 
 	Shader::~Shader()
 	{
 		reference->referenceCount--;
-		// üִɾ
+		// 引用计数归零后执行真正的删除操作
 		if (reference->referenceCount == 0)
 		{
 			size_t pos = -1;
@@ -70,10 +75,11 @@ namespace ZXEngine
 			}
 			if (pos != -1)
 			{
-				// ִ
+				// 执行清理操作
 				loadedShaders.erase(loadedShaders.begin() + pos);
 				RenderAPI::GetInstance()->DeleteShader(reference->ID);
 				delete reference;
+				AssetCache::RecordRelease(CachedAssetType::Shader, 0);
 			}
 			else
 			{
@@ -11,7 +11,10 @@
 */
 
 #pragma once
+// 定义了ZX_HEADLESS时只编译不依赖窗口，渲染和编辑器的模块(数学库，物理引擎，JobSystem)，用于独立的测试和性能测试程序
+#ifndef ZX_HEADLESS
 #define ZX_EDITOR
+#endif
 #define ZX_API_OPENGL
 // #define ZX_API_VULKAN
 // #define ZX_API_D3D12
@@ -31,6 +34,7 @@
 #include <thread>
 #include <atomic>
 #include <future>
+#include <span>
 #include <nlohmann/json.hpp>
 
 using std::string; 
@@ -57,6 +61,7 @@ using std::shared_ptr;
 using std::make_shared;
 using std::unique_ptr;
 using std::make_unique;
+using std::span;
 using json = nlohmann::json;
 namespace filesystem = std::filesystem;
 
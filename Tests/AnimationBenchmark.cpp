@@ -0,0 +1,208 @@
+#include "Animation/Animation.h"
+#include "Animation/AnimationController.h"
+#include "Animation/BlendTree.h"
+#include "Animation/NodeAnimation.h"
+#include "Animation/Skeleton.h"
+#include "Component/Animator.h"
+#include "Concurrent/JobSystem.h"
+
+using namespace ZXEngine;
+
+// 用代码生成骨骼和动画，模拟一群播放同一个混合树的角色，对比逐个采样和用JobSystem并行采样的耗时
+// 并行的方式和Animator::Update一样，每个Job处理ANIMATOR_JOB_SIZE个AnimationController
+// 没有Mesh，所以不包含写入蒙皮矩阵的部分，只测量推进进度，采样，混合和计算全局变换
+// 分别测试所有角色的动画数据相同和每个角色的动画数据(幅度，相位和关键帧数量)都不同两种情况
+// 并行部分依次用1到CPU核心数个工作线程测试，输出每种线程数相对逐个采样的加速比
+// 用法: AnimationBenchmark [角色数量] [帧数] [最大工作线程数]    不传角色数量时依次测试100，1000和5000，不传最大工作线程数时为CPU核心数
+
+static const float FrameDeltaTime = 1.0f / 60.0f;
+// 骨骼结构: 一个根骨骼下面挂5条链，每条链12节
+static const uint32_t ChainNum = 5;
+static const uint32_t ChainLength = 12;
+// 动画长度1秒，每秒30帧
+static const uint32_t KeyNum = 31;
+static const float TicksPerSecond = 30.0f;
+
+enum class ClipMode
+{
+	// 每个角色的动画数据一样
+	Same,
+	// 每个角色的动画数据都不一样
+	Different,
+};
+
+static BoneNode* CreateBoneTree()
+{
+	auto root = new BoneNode();
+	root->name = "Root";
+	root->transform = Matrix4(1.0f);
+
+	for (uint32_t chain = 0; chain < ChainNum; chain++)
+	{
+		BoneNode* parent = root;
+		for (uint32_t i = 0; i < ChainLength; i++)
+		{
+			auto node = new BoneNode();
+			node->name = "Bone_" + std::to_string(chain) + "_" + std::to_string(i);
+			node->transform = Math::Translate(Matrix4(1.0f), Vector3(0.0f, 0.1f, 0.0f));
+			parent->children.push_back(node);
+			parent = node;
+		}
+	}
+
+	return root;
+}
+
+// 每个骨骼都有完整的旋转关键帧，位移和缩放只有首尾两帧
+static Animation* CreateAnimation(const string& name, float amplitude, uint32_t keyNum, float phaseOffset)
+{
+	auto pAnimation = new Animation();
+	pAnimation->mName = name;
+	pAnimation->mTicksPerSecond = TicksPerSecond;
+	pAnimation->mFullTick = static_cast<float>(keyNum - 1);
+	pAnimation->mDuration = pAnimation->mFullTick / TicksPerSecond;
+
+	vector<string> boneNames = { "Root" };
+	for (uint32_t chain = 0; chain < ChainNum; chain++)
+		for (uint32_t i = 0; i < ChainLength; i++)
+			boneNames.push_back("Bone_" + std::to_string(chain) + "_" + std::to_string(i));
+
+	for (size_t boneIdx = 0; boneIdx < boneNames.size(); boneIdx++)
+	{
+		auto pNode = new NodeAnimation();
+		pNode->mName = boneNames[boneIdx];
+
+		Vector3 position = boneIdx == 0 ? Vector3() : Vector3(0.0f, 0.1f, 0.0f);
+		pNode->mKeyPositions = { KeyVector3(0.0f, position), KeyVector3(pAnimation->mFullTick, position) };
+		pNode->mKeyPositionNum = pNode->mKeyPositions.size();
+		pNode->mKeyScales = { KeyVector3(0.0f, Vector3(1.0f)), KeyVector3(pAnimation->mFullTick, Vector3(1.0f)) };
+		pNode->mKeyScaleNum = pNode->mKeyScales.size();
+
+		for (uint32_t k = 0; k < keyNum; k++)
+		{
+			float phase = Math::PI * 2.0f * k / (keyNum - 1) + boneIdx * 0.3f + phaseOffset;
+			pNode->mKeyRotations.push_back(KeyQuaternion(static_cast<float>(k), Quaternion::Euler(amplitude * sinf(phase), 0.0f, amplitude * 0.5f * cosf(phase))));
+		}
+		pNode->mKeyRotationNum = pNode->mKeyRotations.size();
+
+		pAnimation->AddNodeAnimation(pNode);
+	}
+
+	return pAnimation;
+}
+
+// 和模型加载时一样，每个角色有自己的AnimationController和动画数据
+// 播放进度存在Animation和NodeAnimation里，所以数据相同时也不能共用同一份动画
+static AnimationController* CreateController(const Skeleton* pSkeleton, ClipMode mode)
+{
+	auto pController = new AnimationController();
+	pController->BindSkeleton(pSkeleton);
+
+	Animation* pWalk = nullptr;
+	Animation* pRun = nullptr;
+	if (mode == ClipMode::Same)
+	{
+		pWalk = CreateAnimation("Walk", 20.0f, KeyNum, 0.0f);
+		pRun = CreateAnimation("Run", 40.0f, KeyNum, 0.0f);
+	}
+	else
+	{
+		// 关键帧数量不同，每个角色的动画长度和采样时查找关键帧的位置也都不同
+		uint32_t walkKeyNum = KeyNum / 2 + static_cast<uint32_t>(rand()) % (KeyNum * 2);
+		uint32_t runKeyNum = KeyNum / 2 + static_cast<uint32_t>(rand()) % (KeyNum * 2);
+		pWalk = CreateAnimation("Walk", Math::RandomFloat(10.0f, 30.0f), walkKeyNum, Math::RandomFloat(0.0f, Math::PI * 2.0f));
+		pRun = CreateAnimation("Run", Math::RandomFloat(30.0f, 50.0f), runKeyNum, Math::RandomFloat(0.0f, Math::PI * 2.0f));
+	}
+	pController->Add(pWalk);
+	pController->Add(pRun);
+
+	BlendTree* pBlendTree = pController->AddBlendTree("Locomotion", BlendTreeType::Simple1D, "Speed");
+	pBlendTree->AddChild(pWalk, 0.0f);
+	pBlendTree->AddChild(pRun, 1.0f);
+
+	// 速度参数不同的角色混合权重不同，避免所有角色只有一个动画在起作用
+	pController->SetParameter("Speed", Math::RandomFloat(0.0f, 1.0f));
+	pController->Play("Locomotion");
+
+	return pController;
+}
+
+static double SampleSerial(vector<AnimationController*>& controllers, const vector<Mesh*>& meshes, uint32_t frameNum)
+{
+	auto begin = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < frameNum; frame++)
+	{
+		for (auto pController : controllers)
+			pController->Sample(meshes, FrameDeltaTime);
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count() / frameNum;
+}
+
+static double SampleParallel(vector<AnimationController*>& controllers, const vector<Mesh*>& meshes, uint32_t frameNum)
+{
+	auto jobSystem = JobSystem::GetInstance();
+	uint32_t controllerNum = static_cast<uint32_t>(controllers.size());
+
+	auto begin = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < frameNum; frame++)
+	{
+		jobSystem->ParallelFor(controllerNum, ANIMATOR_JOB_SIZE, [&controllers, &meshes](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				controllers[i]->Sample(meshes, FrameDeltaTime);
+		});
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count() / frameNum;
+}
+
+int main(int argc, char* argv[])
+{
+	vector<uint32_t> animatorNums = { 100, 1000, 5000 };
+	if (argc > 1)
+		animatorNums = { static_cast<uint32_t>(std::stoul(argv[1])) };
+	uint32_t frameNum = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 120;
+	uint32_t maxWorkerNum = argc > 3 ? static_cast<uint32_t>(std::stoul(argv[3])) : std::thread::hardware_concurrency();
+	maxWorkerNum = Math::Max(maxWorkerNum, 1u);
+
+	srand(12345);
+
+	// 骨骼树只在构建Skeleton时读取，所有角色共用同一个Skeleton
+	// BoneNode的析构在PublicStruct.cpp里，它依赖图片加载库，这里不链接它，骨骼树留到程序退出时回收
+	BoneNode* pRootBoneNode = CreateBoneTree();
+	Skeleton skeleton(pRootBoneNode);
+	const vector<Mesh*> meshes;
+
+	std::cout << "Animator crowd: " << skeleton.GetBoneNum() << " bones, 2 clips in a 1D blend tree, " << std::thread::hardware_concurrency()
+		<< " hardware threads, 1-" << maxWorkerNum << " workers, " << frameNum << " frames" << std::endl;
+
+	for (ClipMode mode : { ClipMode::Same, ClipMode::Different })
+	{
+		std::cout << (mode == ClipMode::Same ? "Same clips:" : "Different clips:") << std::endl;
+		for (auto animatorNum : animatorNums)
+		{
+			vector<AnimationController*> controllers(animatorNum);
+			for (auto& pController : controllers)
+				pController = CreateController(&skeleton, mode);
+
+			// 先跑几帧预热，让姿势缓冲区之类的内存都分配好
+			SampleSerial(controllers, meshes, 10);
+
+			double serialMS = SampleSerial(controllers, meshes, frameNum);
+			std::cout << "  " << animatorNum << " animators: serial " << serialMS << " ms/frame" << std::endl;
+
+			// ParallelFor等待时主线程也会执行Job，所以实际参与采样的线程比工作线程多一个
+			for (uint32_t workerNum = 1; workerNum <= maxWorkerNum; workerNum++)
+			{
+				JobSystem::Create(workerNum);
+				double parallelMS = SampleParallel(controllers, meshes, frameNum);
+				JobSystem::Destroy();
+				std::cout << "    " << workerNum << " workers: " << parallelMS << " ms/frame, speedup " << serialMS / parallelMS << "x" << std::endl;
+			}
+
+			for (auto pController : controllers)
+				delete pController;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,165 @@
+#include "Animation/NodeAnimation.h"
+#include <chrono>
+
+using namespace ZXEngine;
+
+static int failedNum = 0;
+
+#define ZX_CHECK(condition) \
+	do { if (!(condition)) { std::cerr << "Check failed: " #condition " (" << __FILE__ << ":" << __LINE__ << ")" << std::endl; failedNum++; } } while (0)
+
+// 浮点运算本身的误差，压缩后的误差允许比容差多这么一点
+static const float Epsilon = 1e-5f;
+
+// 和压缩时一样用atan2计算夹角，acos(dot)在夹角很小时精度不够
+static float GetRotationError(const Quaternion& q1, const Quaternion& q2)
+{
+	Quaternion r = q1.GetInverse() * q2;
+	return 2.0f * atan2f(sqrtf(r.x * r.x + r.y * r.y + r.z * r.z), fabsf(r.w));
+}
+
+static float GetVector3Error(const Vector3& v1, const Vector3& v2)
+{
+	return Math::Max(Math::Max(fabsf(v1.x - v2.x), fabsf(v1.y - v2.y)), fabsf(v1.z - v2.z));
+}
+
+// 类似动作捕捉的数据，几个不同频率的正弦叠加上一点噪声，每一帧都有关键帧
+static NodeAnimation CreateChannel(uint32_t keyNum, uint32_t seed)
+{
+	srand(seed);
+	NodeAnimation channel;
+	channel.mName = "Bone";
+
+	for (uint32_t k = 0; k < keyNum; k++)
+	{
+		float t = static_cast<float>(k) / 30.0f;
+		float noise = Math::RandomFloat(-0.2f, 0.2f);
+		Vector3 euler(
+			40.0f * sinf(t * 2.0f) + 10.0f * sinf(t * 7.0f) + noise,
+			25.0f * cosf(t * 1.3f) + noise,
+			15.0f * sinf(t * 3.1f + 1.0f) + noise);
+		channel.mKeyRotations.push_back(KeyQuaternion(static_cast<float>(k), Quaternion::Euler(euler.x, euler.y, euler.z)));
+
+		Vector3 position(0.3f * sinf(t), 1.0f + 0.05f * sinf(t * 4.0f), 2.0f * t + 0.001f * noise);
+		channel.mKeyPositions.push_back(KeyVector3(static_cast<float>(k), position));
+
+		channel.mKeyScales.push_back(KeyVector3(static_cast<float>(k), Vector3(1.0f)));
+	}
+
+	channel.mKeyRotationNum = channel.mKeyRotations.size();
+	channel.mKeyPositionNum = channel.mKeyPositions.size();
+	channel.mKeyScaleNum = channel.mKeyScales.size();
+	return channel;
+}
+
+// 在关键帧上和关键帧之间采样，压缩前后的差别不能超过容差，量化误差也要算在里面
+static void TestCompressionError(uint32_t seed)
+{
+	const uint32_t keyNum = 600;
+	NodeAnimation original = CreateChannel(keyNum, seed);
+	NodeAnimation compressed = original;
+	size_t originalSize = original.GetKeyMemorySize();
+	compressed.Compress();
+
+	ZX_CHECK(compressed.IsCompressed());
+	ZX_CHECK(compressed.GetKeyMemorySize() < originalSize);
+	// 恒定的缩放只保留一个关键帧
+	ZX_CHECK(compressed.mKeyScaleNum == 1);
+
+	float maxRotationError = 0.0f;
+	float maxPositionError = 0.0f;
+	float maxScaleError = 0.0f;
+	original.Reset();
+	compressed.Reset();
+	for (float tick = 0.0f; tick < keyNum - 1; tick += 0.25f)
+	{
+		original.UpdateCurFrame(tick);
+		compressed.UpdateCurFrame(tick);
+		maxRotationError = Math::Max(maxRotationError, GetRotationError(original.mCurFrame.mRotation, compressed.mCurFrame.mRotation));
+		maxPositionError = Math::Max(maxPositionError, GetVector3Error(original.mCurFrame.mPosition, compressed.mCurFrame.mPosition));
+		maxScaleError = Math::Max(maxScaleError, GetVector3Error(original.mCurFrame.mScale, compressed.mCurFrame.mScale));
+	}
+
+	std::cout << "  seed " << seed << ": keys " << originalSize << " -> " << compressed.GetKeyMemorySize() << " bytes, max error rotation "
+		<< maxRotationError << " rad, position " << maxPositionError << ", scale " << maxScaleError << std::endl;
+
+	// 两个关键帧之间压缩前后都是插值出来的，误差不会超过两端的误差
+	ZX_CHECK(maxRotationError <= ANIM_COMPRESS_ROTATION_TOLERANCE + Epsilon);
+	ZX_CHECK(maxPositionError <= ANIM_COMPRESS_POSITION_TOLERANCE + Epsilon);
+	ZX_CHECK(maxScaleError <= ANIM_COMPRESS_SCALE_TOLERANCE + Epsilon);
+}
+
+// 按一个骨骼动画的规模采样，对比压缩前后每次UpdateCurFrame的耗时，只输出结果，不做检查
+// 顺序播放是每帧推进0.5个tick(每秒30个tick，60帧)，跳转播放是每次采样随机选一个时间点
+static double GetSampleTime(vector<NodeAnimation>& channels, const vector<float>& ticks, float& checksum)
+{
+	for (auto& channel : channels)
+		channel.Reset();
+
+	auto begin = std::chrono::steady_clock::now();
+	for (float tick : ticks)
+	{
+		for (auto& channel : channels)
+		{
+			channel.UpdateCurFrame(tick);
+			checksum += channel.mCurFrame.mPosition.x + channel.mCurFrame.mRotation.w;
+		}
+	}
+	double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+	return ns / (static_cast<double>(ticks.size()) * channels.size());
+}
+
+static void TestSamplingTime()
+{
+	const uint32_t channelNum = 64;
+	const uint32_t keyNum = 600;
+	vector<NodeAnimation> originals;
+	vector<NodeAnimation> compressed;
+	for (uint32_t i = 0; i < channelNum; i++)
+	{
+		originals.push_back(CreateChannel(keyNum, 100 + i));
+		compressed.push_back(originals.back());
+		compressed.back().Compress();
+	}
+
+	vector<float> sequentialTicks;
+	for (uint32_t loop = 0; loop < 4; loop++)
+		for (float tick = 0.0f; tick < keyNum - 1; tick += 0.5f)
+			sequentialTicks.push_back(tick);
+
+	srand(12345);
+	vector<float> randomTicks(sequentialTicks.size());
+	for (auto& tick : randomTicks)
+		tick = Math::RandomFloat(0.0f, static_cast<float>(keyNum - 1));
+
+	float checksum = 0.0f;
+	// 先跑一遍预热
+	GetSampleTime(originals, sequentialTicks, checksum);
+	GetSampleTime(compressed, sequentialTicks, checksum);
+
+	double originalSequential = GetSampleTime(originals, sequentialTicks, checksum);
+	double compressedSequential = GetSampleTime(compressed, sequentialTicks, checksum);
+	double originalRandom = GetSampleTime(originals, randomTicks, checksum);
+	double compressedRandom = GetSampleTime(compressed, randomTicks, checksum);
+
+	std::cout << "  sampling " << channelNum << " channels x " << keyNum << " keys, ns per channel sample: sequential "
+		<< originalSequential << " -> " << compressedSequential << ", random " << originalRandom << " -> " << compressedRandom
+		<< " (checksum " << checksum << ")" << std::endl;
+}
+
+int main()
+{
+	for (uint32_t seed = 1; seed <= 4; seed++)
+		TestCompressionError(seed);
+
+	TestSamplingTime();
+
+	if (failedNum > 0)
+	{
+		std::cerr << failedNum << " check(s) failed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "Animation compression tests passed" << std::endl;
+	return 0;
+}
@@ -0,0 +1,59 @@
+#include "Concurrent/JobSystem.h"
+#include <cmath>
+
+using namespace ZXEngine;
+
+// 用不同数量的工作线程跑同一个ParallelFor负载，输出耗时和相对单工作线程的加速比
+// 注意ParallelFor的调用线程也会参与执行，所以N个工作线程时实际是N+1个线程在干活
+
+static double RunOnce(vector<float>& data, uint32_t batchSize)
+{
+	auto begin = std::chrono::steady_clock::now();
+
+	JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(data.size()), batchSize, [&data](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			float v = data[i];
+			for (uint32_t j = 0; j < 64; j++)
+				v = std::sqrt(v * v + 1.0f) * 0.999f;
+			data[i] = v;
+		}
+	});
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+int main(int argc, char* argv[])
+{
+	uint32_t elementNum = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 1 << 20;
+	uint32_t batchSize = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 1024;
+	const uint32_t repeatNum = 10;
+
+	uint32_t maxWorkerNum = std::max(1u, std::thread::hardware_concurrency());
+	vector<float> data(elementNum, 1.0f);
+
+	std::cout << "JobSystem scaling: " << elementNum << " elements, batch size " << batchSize << std::endl;
+
+	double baseTime = 0.0;
+	for (uint32_t workerNum = 1; workerNum <= maxWorkerNum; workerNum *= 2)
+	{
+		JobSystem::Create(workerNum);
+
+		// 第一次运行包含线程唤醒等开销，不计入
+		RunOnce(data, batchSize);
+		double totalTime = 0.0;
+		for (uint32_t i = 0; i < repeatNum; i++)
+			totalTime += RunOnce(data, batchSize);
+		double avgTime = totalTime / repeatNum;
+
+		JobSystem::Destroy();
+
+		if (workerNum == 1)
+			baseTime = avgTime;
+
+		std::cout << "  workers " << workerNum << ": " << avgTime << " ms, speedup " << baseTime / avgTime << "x" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,182 @@
+#include "Concurrent/JobSystem.h"
+#include <ctime>
+
+using namespace ZXEngine;
+
+static int failedNum = 0;
+
+#define ZX_CHECK(condition) \
+	do { if (!(condition)) { std::cerr << "Check failed: " #condition " (" << __FILE__ << ":" << __LINE__ << ")" << std::endl; failedNum++; } } while (0)
+
+// 提交的Job全部执行一次，Wait返回时计数已经归零
+static void TestCounterWait()
+{
+	auto jobSystem = JobSystem::GetInstance();
+
+	const uint32_t jobNum = 10000;
+	std::atomic<uint32_t> sum = 0;
+	JobCounter counter;
+	for (uint32_t i = 0; i < jobNum; i++)
+		jobSystem->Submit([&sum]() { sum.fetch_add(1); }, &counter);
+	jobSystem->Wait(&counter);
+
+	ZX_CHECK(counter.IsDone());
+	ZX_CHECK(sum.load() == jobNum);
+}
+
+// 依赖的Job全部执行完之前，后面的Job不会开始
+static void TestDependency()
+{
+	auto jobSystem = JobSystem::GetInstance();
+
+	for (uint32_t round = 0; round < 100; round++)
+	{
+		const uint32_t firstNum = 16;
+		std::atomic<uint32_t> firstDone = 0;
+		std::atomic<uint32_t> violationNum = 0;
+		JobCounter firstCounter;
+		JobCounter secondCounter;
+
+		for (uint32_t i = 0; i < firstNum; i++)
+		{
+			jobSystem->Submit([&firstDone]()
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+				firstDone.fetch_add(1);
+			}, &firstCounter);
+		}
+		for (uint32_t i = 0; i < firstNum; i++)
+		{
+			jobSystem->Submit([&firstDone, &violationNum, firstNum]()
+			{
+				if (firstDone.load() != firstNum)
+					violationNum.fetch_add(1);
+			}, &secondCounter, &firstCounter);
+		}
+
+		jobSystem->Wait(&secondCounter);
+		ZX_CHECK(violationNum.load() == 0);
+		ZX_CHECK(firstCounter.IsDone());
+	}
+
+	// 依赖一个已经归零的计数器时直接执行
+	JobCounter doneCounter;
+	JobCounter counter;
+	std::atomic<bool> executed = false;
+	jobSystem->Submit([&executed]() { executed = true; }, &counter, &doneCounter);
+	jobSystem->Wait(&counter);
+	ZX_CHECK(executed.load());
+}
+
+// 等待依赖的Job挂在计数器上，不会被工作线程反复取出来空转
+static void TestBlockedJobDoesNotSpin()
+{
+#ifndef _WIN32
+	// std::clock在Windows上是墙钟时间，只在其它平台上用它统计进程的CPU时间
+	auto jobSystem = JobSystem::GetInstance();
+
+	std::atomic<bool> release = false;
+	JobCounter blocker;
+	JobCounter counter;
+	jobSystem->Submit([&release]()
+	{
+		while (!release.load())
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}, &blocker);
+	jobSystem->Submit([]() {}, &counter, &blocker);
+
+	std::clock_t cpuBegin = std::clock();
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	double cpuMS = 1000.0 * static_cast<double>(std::clock() - cpuBegin) / CLOCKS_PER_SEC;
+
+	release = true;
+	jobSystem->Wait(&counter);
+
+	// 如果被阻塞的Job在队列里空转，每个工作线程都会占满一个核心
+	ZX_CHECK(cpuMS < 100.0);
+#endif
+}
+
+// 一个工作线程提交到自己队列里的Job能被其它工作线程偷走
+static void TestStealing()
+{
+	auto jobSystem = JobSystem::GetInstance();
+	if (jobSystem->GetWorkerNum() < 2)
+		return;
+
+	const uint32_t jobNum = 256;
+	std::mutex threadMutex;
+	std::set<std::thread::id> threadIDs;
+	JobCounter counter;
+
+	jobSystem->Submit([&]()
+	{
+		// 这里是在工作线程里提交的，所有Job都会进入这个工作线程自己的队列
+		for (uint32_t i = 0; i < jobNum; i++)
+		{
+			jobSystem->Submit([&]()
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(200));
+				std::lock_guard<std::mutex> lock(threadMutex);
+				threadIDs.insert(std::this_thread::get_id());
+			}, &counter);
+		}
+	}, &counter);
+	jobSystem->Wait(&counter);
+
+	ZX_CHECK(threadIDs.size() > 1);
+}
+
+// ParallelFor的每个下标都只被执行一次，在Job内部嵌套调用也不会死锁
+static void TestParallelFor()
+{
+	auto jobSystem = JobSystem::GetInstance();
+
+	const uint32_t count = 100000;
+	vector<std::atomic<uint32_t>> visits(count);
+	jobSystem->ParallelFor(count, 1000, [&visits](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+			visits[i].fetch_add(1);
+	});
+
+	uint32_t wrongNum = 0;
+	for (auto& visit : visits)
+		if (visit.load() != 1)
+			wrongNum++;
+	ZX_CHECK(wrongNum == 0);
+
+	std::atomic<uint32_t> sum = 0;
+	jobSystem->ParallelFor(16, 1, [jobSystem, &sum](uint32_t, uint32_t)
+	{
+		jobSystem->ParallelFor(64, 8, [&sum](uint32_t begin, uint32_t end) { sum.fetch_add(end - begin); });
+	});
+	ZX_CHECK(sum.load() == 16 * 64);
+}
+
+int main()
+{
+	JobSystem::Create(4);
+
+	TestCounterWait();
+	TestDependency();
+	TestBlockedJobDoesNotSpin();
+	TestStealing();
+	TestParallelFor();
+
+	// Destroy要等所有工作线程退出，之后可以重新创建
+	JobSystem::Destroy();
+	ZX_CHECK(JobSystem::GetInstance() == nullptr);
+	JobSystem::Create(2);
+	TestCounterWait();
+	JobSystem::Destroy();
+
+	if (failedNum > 0)
+	{
+		std::cerr << failedNum << " check(s) failed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "JobSystem tests passed" << std::endl;
+	return 0;
+}
@@ -0,0 +1,108 @@
+#include "pubh.h"
+#include <chrono>
+
+using namespace ZXEngine;
+
+// 数学库常用运算的微基准测试，同一份代码分别编译成MathBenchmark(SIMD)，MathBenchmarkScalar(定义了ZX_MATH_NO_SIMD)和MathBenchmarkAVX2(开启AVX2和FMA)
+// 这几个程序用同样的随机种子生成输入，除了耗时外还会输出结果的累加值，各个程序的累加值应该只有浮点误差级别的差别
+// 用法: MathBenchmark [元素数量] [重复次数]
+
+#if defined(ZX_MATH_SSE) && defined(__AVX2__)
+static const char* BackendName = "SSE, AVX2/FMA build";
+#elif defined(ZX_MATH_SSE)
+static const char* BackendName = "SSE";
+#else
+static const char* BackendName = "scalar";
+#endif
+
+// 对每个元素执行一次func，重复repeatNum次，输出每次运算的平均耗时
+template<typename Func>
+static void Measure(const char* name, size_t count, uint32_t repeatNum, Func func)
+{
+	// 先跑一遍预热缓存
+	for (size_t i = 0; i < count; i++)
+		func(i);
+
+	auto begin = std::chrono::steady_clock::now();
+	for (uint32_t r = 0; r < repeatNum; r++)
+		for (size_t i = 0; i < count; i++)
+			func(i);
+	double totalNS = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+	std::cout << "  " << name << ": " << totalNS / (static_cast<double>(count) * repeatNum) << " ns/op" << std::endl;
+}
+
+static float SumMatrix(const Matrix4& mat)
+{
+	float sum = 0.0f;
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		Vector4 row = mat.GetRow(i);
+		sum += row.x + row.y + row.z + row.w;
+	}
+	return sum;
+}
+
+int main(int argc, char* argv[])
+{
+	size_t count = argc > 1 ? static_cast<size_t>(std::stoul(argv[1])) : 4096;
+	uint32_t repeatNum = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 200;
+
+	srand(12345);
+	vector<Matrix4> matrices(count);
+	vector<Vector4> vectors(count);
+	vector<Quaternion> quaternions(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		// 平移，旋转和缩放组合出来的矩阵一定可逆
+		Vector3 axis(Math::RandomFloat(-1.0f, 1.0f), Math::RandomFloat(-1.0f, 1.0f), Math::RandomFloat(0.1f, 1.0f));
+		axis.Normalize();
+		Matrix4 mat = Math::Translate(Matrix4(1.0f), Vector3(Math::RandomFloat(-10.0f, 10.0f), Math::RandomFloat(-10.0f, 10.0f), Math::RandomFloat(-10.0f, 10.0f)));
+		mat = Math::Rotate(mat, Math::RandomFloat(0.0f, 6.0f), axis);
+		matrices[i] = Math::Scale(mat, Vector3(Math::RandomFloat(0.5f, 2.0f), Math::RandomFloat(0.5f, 2.0f), Math::RandomFloat(0.5f, 2.0f)));
+
+		vectors[i] = Vector4(Math::RandomFloat(-1.0f, 1.0f), Math::RandomFloat(-1.0f, 1.0f), Math::RandomFloat(-1.0f, 1.0f), 1.0f);
+		quaternions[i] = Quaternion::Euler(Math::RandomFloat(-180.0f, 180.0f), Math::RandomFloat(-180.0f, 180.0f), Math::RandomFloat(-180.0f, 180.0f));
+	}
+
+	vector<Matrix4> matrixResults(count);
+	vector<Vector4> vectorResults(count);
+	vector<Quaternion> quaternionResults(count);
+
+	std::cout << "Math benchmark (" << BackendName << "): " << count << " elements, " << repeatNum << " repeats" << std::endl;
+
+	Measure("Matrix4 * Matrix4", count, repeatNum, [&](size_t i) { matrixResults[i] = matrices[i] * matrices[count - 1 - i]; });
+	float mulSum = 0.0f;
+	for (auto& mat : matrixResults)
+		mulSum += SumMatrix(mat);
+
+	Measure("Matrix4 * Vector4", count, repeatNum, [&](size_t i) { vectorResults[i] = matrices[i] * vectors[i]; });
+	float mulVecSum = 0.0f;
+	for (auto& v : vectorResults)
+		mulVecSum += v.x + v.y + v.z + v.w;
+
+	Measure("Matrix4 transpose", count, repeatNum, [&](size_t i) { matrixResults[i] = Math::Transpose(matrices[i]); });
+	float transposeSum = 0.0f;
+	for (auto& mat : matrixResults)
+		transposeSum += SumMatrix(mat);
+
+	Measure("Matrix4 inverse", count, repeatNum, [&](size_t i) { matrixResults[i] = Math::Inverse(matrices[i]); });
+	float inverseSum = 0.0f;
+	for (auto& mat : matrixResults)
+		inverseSum += SumMatrix(mat);
+
+	Measure("Quaternion * Quaternion", count, repeatNum, [&](size_t i) { quaternionResults[i] = quaternions[i] * quaternions[count - 1 - i]; });
+	float quatMulSum = 0.0f;
+	for (auto& q : quaternionResults)
+		quatMulSum += q.x + q.y + q.z + q.w;
+
+	Measure("Quaternion slerp", count, repeatNum, [&](size_t i) { quaternionResults[i] = Math::Slerp(quaternions[i], quaternions[count - 1 - i], 0.3f); });
+	float slerpSum = 0.0f;
+	for (auto& q : quaternionResults)
+		slerpSum += q.x + q.y + q.z + q.w;
+
+	std::cout << "Result sums: mul " << mulSum << ", mul vec " << mulVecSum << ", transpose " << transposeSum << ", inverse " << inverseSum
+		<< ", quat mul " << quatMulSum << ", slerp " << slerpSum << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,609 @@
+#include "PhysZ/PhysZ.h"
+#include "PhysZ/RigidBodyStore.h"
+#include "PhysZ/Broadphase/Broadphase.h"
+#include "PhysZ/CollisionData.h"
+#include "PhysZ/CollisionDetector.h"
+#include "PhysZ/Contact.h"
+#include "Concurrent/JobSystem.h"
+#include <cstring>
+
+using namespace ZXEngine;
+using namespace ZXEngine::PhysZ;
+
+// 不启动渲染器和编辑器，直接用代码搭建物理场景跑固定帧数，输出各阶段的平均耗时和最终状态的校验值
+// 用法: PhysZBenchmark [stack|pyramid|rain|cloth|chain|all] [帧数] [iterative|si]    不指定求解器时两种都跑，可以直接对比求解耗时和残留穿透
+//       PhysZBenchmark broadphase [刚体数量] [帧数]    不传刚体数量时依次测试1k，10k和50k
+//       PhysZBenchmark --check    每个场景用两种求解器各跑两次，校验值不一致时返回1
+
+static const float FixedDeltaTime = 1.0f / 60.0f;
+static const char* ScenarioNames[] = { "stack", "pyramid", "rain", "cloth", "chain" };
+
+// 用代码搭建的物理场景，负责释放自己创建的刚体和碰撞体
+struct Scenario
+{
+	PScene* mScene = nullptr;
+	vector<RigidBody*> mBodies;
+	vector<CollisionPrimitive*> mColliders;
+	vector<Joint*> mJoints;
+
+	~Scenario()
+	{
+		delete mScene;
+		// 关节析构时会从全局列表里移除自己，要在刚体之前释放
+		for (auto joint : mJoints)
+			delete joint;
+		// 刚体析构时会访问碰撞体，所以先释放刚体
+		for (auto body : mBodies)
+			delete body;
+		for (auto collider : mColliders)
+			delete collider;
+	}
+};
+
+// 各阶段耗时的累计值(微秒)
+struct PhaseTimes
+{
+	double mIntegrate = 0.0;
+	double mBroadphase = 0.0;
+	double mNarrowphase = 0.0;
+	double mJoint = 0.0;
+	double mResolve = 0.0;
+	double mSync = 0.0;
+};
+
+// 在y=0处添加一个朝上的地面
+static void AddGround(Scenario& scenario)
+{
+	auto plane = new CollisionPlane();
+	plane->mNormal = Vector3(0.0f, 1.0f, 0.0f);
+	plane->mDistance = 0.0f;
+
+	auto body = new RigidBody();
+	body->SetInverseMass(0.0f);
+	body->SetInverseInertiaTensor(Matrix3(0.0f));
+	body->mCollisionVolume = plane;
+	plane->mRigidBody = body;
+
+	scenario.mColliders.push_back(plane);
+	scenario.mBodies.push_back(body);
+	// 碰撞检测把平面当作无限大，包围盒只要覆盖所有刚体的活动范围即可
+	scenario.mScene->AddRigidBody(body, BoundingBox(Vector3(-1000.0f, -1.0f, -1000.0f), Vector3(1000.0f, 0.0f, 1000.0f)));
+}
+
+// 添加一个受重力影响的Box
+static void AddBox(Scenario& scenario, const Vector3& position, const Vector3& halfSize, float mass = 1.0f)
+{
+	auto box = new CollisionBox();
+	box->mHalfSize = halfSize;
+
+	auto body = new RigidBody();
+	body->SetMass(mass);
+	body->SetLinearDamping(0.99f);
+	body->SetPosition(position);
+	body->SetInertiaTensor(box->GetInertiaTensor(mass));
+	body->AddForceGenerator(new FGGravity(Vector3(0.0f, -9.8f, 0.0f)));
+	body->mCollisionVolume = box;
+	box->mRigidBody = body;
+
+	scenario.mColliders.push_back(box);
+	scenario.mBodies.push_back(body);
+	scenario.mScene->AddRigidBody(body);
+}
+
+// 添加一个受重力影响的球
+static RigidBody* AddSphere(Scenario& scenario, const Vector3& position, float radius, float mass = 1.0f)
+{
+	auto sphere = new CollisionSphere();
+	sphere->mRadius = radius;
+
+	auto body = new RigidBody();
+	body->SetMass(mass);
+	body->SetLinearDamping(0.99f);
+	body->SetPosition(position);
+	body->SetInertiaTensor(sphere->GetInertiaTensor(mass));
+	body->AddForceGenerator(new FGGravity(Vector3(0.0f, -9.8f, 0.0f)));
+	body->mCollisionVolume = sphere;
+	sphere->mRigidBody = body;
+
+	scenario.mColliders.push_back(sphere);
+	scenario.mBodies.push_back(body);
+	scenario.mScene->AddRigidBody(body);
+	return body;
+}
+
+// 把刚体固定在原地，不受力也不会被碰撞推动
+static void MakeStatic(RigidBody* body)
+{
+	body->SetInverseMass(0.0f);
+	body->SetInverseInertiaTensor(Matrix3(0.0f));
+}
+
+// 竖直叠放的一列Box
+static void BuildStack(Scenario& scenario, uint32_t height)
+{
+	AddGround(scenario);
+	for (uint32_t i = 0; i < height; i++)
+		AddBox(scenario, Vector3(0.0f, 0.5f + i * 1.0f, 0.0f), Vector3(0.5f, 0.5f, 0.5f));
+}
+
+// 金字塔，每一层比下一层少一个Box，上层的Box压在下层两个Box的中间
+static void BuildPyramid(Scenario& scenario, uint32_t baseWidth)
+{
+	AddGround(scenario);
+	for (uint32_t row = 0; row < baseWidth; row++)
+	{
+		uint32_t count = baseWidth - row;
+		float startX = -0.5f * (count - 1) * 1.05f;
+		for (uint32_t i = 0; i < count; i++)
+			AddBox(scenario, Vector3(startX + i * 1.05f, 0.5f + row * 1.0f, 0.0f), Vector3(0.5f, 0.5f, 0.5f));
+	}
+}
+
+// 一堆从不同高度落下的球，落地后互相堆积，主要压力在宽相和球与球之间的碰撞
+static void BuildRain(Scenario& scenario, uint32_t sphereNum)
+{
+	AddGround(scenario);
+	srand(12345);
+	for (uint32_t i = 0; i < sphereNum; i++)
+	{
+		Vector3 position(Math::RandomFloat(-3.0f, 3.0f), 2.0f + i * 0.1f, Math::RandomFloat(-3.0f, 3.0f));
+		AddSphere(scenario, position, 0.3f);
+	}
+}
+
+// 和Cloth组件一样，用弹簧把一个网格的质点连起来，拉伸弹簧连相邻和对角的质点，弯曲弹簧隔一个质点连接
+// 网格两个角固定住，剩下的部分在重力作用下垂下来，主要压力在力生成器和积分
+static void BuildCloth(Scenario& scenario, uint32_t gridSize)
+{
+	AddGround(scenario);
+
+	const float spacing = 0.25f;
+	const float particleMass = 0.1f;
+	const float stiffness = 5.0f;
+	const float startX = -0.5f * (gridSize - 1) * spacing;
+
+	vector<RigidBody*> particles;
+	for (uint32_t row = 0; row < gridSize; row++)
+	{
+		for (uint32_t col = 0; col < gridSize; col++)
+		{
+			auto box = new CollisionBox();
+			box->mHalfSize = Vector3(0.1f);
+
+			auto body = new RigidBody();
+			body->SetMass(particleMass);
+			body->SetLinearDamping(0.95f);
+			body->SetAngularDamping(0.8f);
+			body->SetPosition(Vector3(startX + col * spacing, 5.0f, startX + row * spacing));
+			body->SetInertiaTensor(box->GetInertiaTensor(particleMass));
+			body->AddForceGenerator(new FGGravity(Vector3(0.0f, -9.8f, 0.0f)));
+			body->mCollisionVolume = box;
+			box->mRigidBody = body;
+
+			scenario.mColliders.push_back(box);
+			scenario.mBodies.push_back(body);
+			particles.push_back(body);
+		}
+	}
+
+	MakeStatic(particles[0]);
+	MakeStatic(particles[gridSize - 1]);
+
+	auto addSpring = [&particles, gridSize, stiffness](uint32_t row0, uint32_t col0, uint32_t row1, uint32_t col1)
+	{
+		RigidBody* p0 = particles[row0 * gridSize + col0];
+		RigidBody* p1 = particles[row1 * gridSize + col1];
+		float restLength = (p0->GetPosition() - p1->GetPosition()).GetMagnitude();
+		p0->AddForceGenerator(new FGSpring(Vector3(), Vector3(), p1, stiffness, restLength));
+		p1->AddForceGenerator(new FGSpring(Vector3(), Vector3(), p0, stiffness, restLength));
+	};
+
+	for (uint32_t row = 0; row < gridSize; row++)
+	{
+		for (uint32_t col = 0; col < gridSize; col++)
+		{
+			if (col + 1 < gridSize)
+				addSpring(row, col, row, col + 1);
+			if (row + 1 < gridSize)
+				addSpring(row, col, row + 1, col);
+			if (row + 1 < gridSize && col + 1 < gridSize)
+			{
+				addSpring(row, col, row + 1, col + 1);
+				addSpring(row, col + 1, row + 1, col);
+			}
+			if (col + 2 < gridSize)
+				addSpring(row, col, row, col + 2);
+			if (row + 2 < gridSize)
+				addSpring(row, col, row + 2, col);
+		}
+	}
+
+	// 弹簧要在添加到场景之前连好，所以最后统一添加
+	for (auto body : particles)
+		scenario.mScene->AddRigidBody(body);
+}
+
+// 一条用DistanceJoint连起来的链子，第一节固定，其余部分从水平位置摆下来，主要压力在关节约束
+static void BuildChain(Scenario& scenario, uint32_t linkNum)
+{
+	AddGround(scenario);
+
+	const float linkLength = 0.5f;
+	RigidBody* prev = AddSphere(scenario, Vector3(0.0f, 12.0f, 0.0f), 0.2f);
+	MakeStatic(prev);
+	for (uint32_t i = 1; i < linkNum; i++)
+	{
+		RigidBody* cur = AddSphere(scenario, Vector3(i * linkLength, 12.0f, 0.0f), 0.2f);
+		scenario.mJoints.push_back(new DistanceJoint(prev, cur, linkLength));
+		prev = cur;
+	}
+}
+
+static void BuildScenario(Scenario& scenario, const string& name, BroadphaseType broadphaseType, ContactSolverType solverType)
+{
+	scenario.mScene = new PScene(1000, 1000, broadphaseType, solverType);
+	if (name == "stack")
+		BuildStack(scenario, 20);
+	else if (name == "pyramid")
+		BuildPyramid(scenario, 10);
+	else if (name == "rain")
+		BuildRain(scenario, 200);
+	else if (name == "cloth")
+		BuildCloth(scenario, 11);
+	else if (name == "chain")
+		BuildChain(scenario, 20);
+}
+
+static bool IsScenarioName(const string& name)
+{
+	for (auto scenarioName : ScenarioNames)
+		if (name == scenarioName)
+			return true;
+	return false;
+}
+
+static void StepScenario(Scenario& scenario, uint32_t frameNum, PhaseTimes& times)
+{
+	for (uint32_t i = 0; i < frameNum; i++)
+	{
+		scenario.mScene->BeginFrame();
+		scenario.mScene->Update(FixedDeltaTime);
+		scenario.mScene->EndFrame();
+
+		const PSceneStats& stats = scenario.mScene->GetStats();
+		times.mIntegrate += stats.mIntegrateTime;
+		times.mBroadphase += stats.mBroadphaseTime;
+		times.mNarrowphase += stats.mNarrowphaseTime;
+		times.mJoint += stats.mJointTime;
+		times.mResolve += stats.mResolveTime;
+		times.mSync += stats.mSyncTime;
+	}
+}
+
+// 模拟结束后重新对所有刚体两两做一次细检测，统计残留的穿透深度，用来比较不同求解器的收敛程度
+static void MeasurePenetration(Scenario& scenario, float& maxPenetration, float& avgPenetration, uint32_t& contactNum)
+{
+	for (auto body : scenario.mBodies)
+		body->CalculateDerivedData();
+
+	CollisionData data(256);
+	for (size_t i = 0; i < scenario.mBodies.size(); i++)
+	{
+		for (size_t j = i + 1; j < scenario.mBodies.size(); j++)
+		{
+			data.Reserve(PHYSZ_MAX_CONTACTS_PER_PAIR);
+			CollisionDetector::Detect(scenario.mBodies[i]->mCollisionVolume, scenario.mBodies[j]->mCollisionVolume, &data);
+		}
+	}
+
+	maxPenetration = 0.0f;
+	float sum = 0.0f;
+	contactNum = data.mCurContactCount;
+	for (uint32_t i = 0; i < contactNum; i++)
+	{
+		maxPenetration = Math::Max(maxPenetration, data.mContactArray[i].mPenetration);
+		sum += data.mContactArray[i].mPenetration;
+	}
+	avgPenetration = contactNum > 0 ? sum / contactNum : 0.0f;
+}
+
+static const char* GetSolverName(ContactSolverType solverType)
+{
+	return solverType == ContactSolverType::SequentialImpulse ? "si" : "iterative";
+}
+
+static uint64_t RunScenario(const string& name, uint32_t frameNum, ContactSolverType solverType, bool print)
+{
+	Scenario scenario;
+	BuildScenario(scenario, name, BroadphaseType::DynamicAABBTree, solverType);
+
+	PhaseTimes times;
+	auto begin = std::chrono::steady_clock::now();
+	StepScenario(scenario, frameNum, times);
+	double totalMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+	uint64_t checksum = scenario.mScene->ComputeStateChecksum();
+	if (print)
+	{
+		const PSceneStats& stats = scenario.mScene->GetStats();
+		std::cout << name << " (" << GetSolverName(solverType) << ", " << scenario.mBodies.size() << " bodies, " << frameNum << " frames)" << std::endl;
+		std::cout << "  total " << totalMS << " ms, per frame (us):"
+			<< " integrate " << times.mIntegrate / frameNum
+			<< " broadphase " << times.mBroadphase / frameNum
+			<< " narrowphase " << times.mNarrowphase / frameNum
+			<< " joint " << times.mJoint / frameNum
+			<< " resolve " << times.mResolve / frameNum
+			<< " sync " << times.mSync / frameNum << std::endl;
+		std::cout << "  contacts " << stats.mContactNum << " (peak " << stats.mPeakContactNum << "), awake " << stats.mAwakeBodyNum
+			<< ", sleeping " << stats.mSleepingBodyNum << std::endl;
+
+		float maxPenetration, avgPenetration;
+		uint32_t contactNum;
+		MeasurePenetration(scenario, maxPenetration, avgPenetration, contactNum);
+		std::cout << "  residual penetration: max " << maxPenetration << ", avg " << avgPenetration << " (" << contactNum << " contacts)" << std::endl;
+		std::cout << "  checksum " << std::hex << checksum << std::dec << std::endl;
+	}
+
+	return checksum;
+}
+
+// 粗检测的测试场景，只生成每帧的包围盒，不做细检测和碰撞处理，这样才能在几万个刚体的规模下单独测量粗检测
+class BroadphaseScene
+{
+public:
+	vector<BoundingBox> mBounds;
+
+	virtual ~BroadphaseScene() {};
+	virtual const char* GetName() const = 0;
+	// 推进一帧，更新mBounds
+	virtual void Step() = 0;
+};
+
+// 随机散布在空中的Box往下掉，落地后停住，越往后重叠的越多
+class FallingPileScene : public BroadphaseScene
+{
+public:
+	FallingPileScene(uint32_t bodyNum)
+	{
+		float halfWidth = std::cbrt(static_cast<float>(bodyNum)) * 1.5f;
+		mPositions.resize(bodyNum);
+		mSpeeds.resize(bodyNum);
+		mBounds.resize(bodyNum);
+		for (uint32_t i = 0; i < bodyNum; i++)
+		{
+			mPositions[i] = Vector3(Math::RandomFloat(-halfWidth, halfWidth), Math::RandomFloat(0.5f, halfWidth * 2.0f), Math::RandomFloat(-halfWidth, halfWidth));
+			mSpeeds[i] = Math::RandomFloat(0.0f, 2.0f);
+			UpdateBounds(i);
+		}
+	}
+
+	virtual const char* GetName() const { return "falling pile"; };
+
+	virtual void Step()
+	{
+		for (uint32_t i = 0; i < mPositions.size(); i++)
+		{
+			mSpeeds[i] += 9.8f * FixedDeltaTime;
+			mPositions[i].y = Math::Max(0.5f, mPositions[i].y - mSpeeds[i] * FixedDeltaTime);
+			UpdateBounds(i);
+		}
+	}
+
+private:
+	vector<Vector3> mPositions;
+	vector<float> mSpeeds;
+
+	void UpdateBounds(uint32_t i)
+	{
+		mBounds[i] = BoundingBox(mPositions[i] - Vector3(0.5f, 0.5f, 0.5f), mPositions[i] + Vector3(0.5f, 0.5f, 0.5f));
+	}
+};
+
+// 10层高的Box方阵，相邻的Box互相接触，模拟已经稳定下来的堆叠
+// 醒着的刚体即使没有移动，PScene每帧也会更新它的包围盒，所以这里每帧用不变的包围盒调用Update
+class RestingStackScene : public BroadphaseScene
+{
+public:
+	RestingStackScene(uint32_t bodyNum)
+	{
+		const uint32_t height = 10;
+		uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(bodyNum) / height)));
+		mBounds.resize(bodyNum);
+		for (uint32_t i = 0; i < bodyNum; i++)
+		{
+			uint32_t column = i / height;
+			Vector3 position(static_cast<float>(column % side), 0.5f + (i % height), static_cast<float>(column / side));
+			mBounds[i] = BoundingBox(position - Vector3(0.5f, 0.5f, 0.5f), position + Vector3(0.5f, 0.5f, 0.5f));
+		}
+	}
+
+	virtual const char* GetName() const { return "resting stack"; };
+	virtual void Step() {};
+};
+
+// 两两检测所有包围盒，作为其它粗检测算法的参照
+static uint32_t GetBruteForcePairNum(const vector<BoundingBox>& bounds)
+{
+	uint32_t count = 0;
+	for (size_t i = 0; i < bounds.size(); i++)
+		for (size_t j = i + 1; j < bounds.size(); j++)
+			if (bounds[i].IsOverlapWith(bounds[j]))
+				count++;
+	return count;
+}
+
+static const char* GetBroadphaseName(BroadphaseType type)
+{
+	if (type == BroadphaseType::BVH)
+		return "BVH";
+	else if (type == BroadphaseType::DynamicAABBTree)
+		return "DynamicAABBTree";
+	else
+		return "SweepAndPrune";
+}
+
+// 每种算法都从同样的随机种子重新生成场景，保证输入完全一致
+static void RunBroadphase(BroadphaseScene* (*createScene)(uint32_t), uint32_t bodyNum, uint32_t frameNum)
+{
+	for (auto type : { BroadphaseType::BVH, BroadphaseType::DynamicAABBTree, BroadphaseType::SweepAndPrune })
+	{
+		srand(12345);
+		BroadphaseScene* scene = createScene(bodyNum);
+		Broadphase* broadphase = Broadphase::Create(type);
+		FrameArena<PotentialContact> contacts(1024);
+
+		// 和PScene一样，数组不够大时扩容后重新获取
+		auto query = [broadphase, &contacts]()
+		{
+			uint32_t count = broadphase->GetPotentialContacts(contacts.GetData(), contacts.GetCapacity());
+			while (count > contacts.GetCapacity())
+			{
+				contacts.Reserve(count, 0);
+				count = broadphase->GetPotentialContacts(contacts.GetData(), contacts.GetCapacity());
+			}
+			return count;
+		};
+
+		// SweepAndPrune会把插入推迟到下一次查询时批量处理，所以插入时间包含第一次查询
+		vector<RigidBody*> bodies(bodyNum);
+		auto begin = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < bodyNum; i++)
+		{
+			bodies[i] = new RigidBody();
+			broadphase->Insert(bodies[i], scene->mBounds[i]);
+		}
+		query();
+		double insertMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+		double updateMS = 0.0;
+		double queryMS = 0.0;
+		uint64_t pairSum = 0;
+		for (uint32_t frame = 0; frame < frameNum; frame++)
+		{
+			scene->Step();
+
+			begin = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < bodyNum; i++)
+				broadphase->Update(bodies[i], scene->mBounds[i]);
+			auto mid = std::chrono::steady_clock::now();
+
+			uint32_t count = query();
+			auto end = std::chrono::steady_clock::now();
+
+			updateMS += std::chrono::duration<double, std::milli>(mid - begin).count();
+			queryMS += std::chrono::duration<double, std::milli>(end - mid).count();
+			pairSum += count;
+		}
+
+		std::cout << "  " << GetBroadphaseName(type) << ": insert " << insertMS << " ms, per frame update " << updateMS / frameNum
+			<< " ms, query " << queryMS / frameNum << " ms, pairs " << pairSum / frameNum << std::endl;
+
+		delete broadphase;
+		for (auto body : bodies)
+			delete body;
+		delete scene;
+	}
+
+	// 暴力检测是O(n^2)的，刚体很多时只抽样其中几帧计时，场景本身仍然每帧推进，保证抽到的帧和其它算法的帧一致
+	srand(12345);
+	BroadphaseScene* scene = createScene(bodyNum);
+	uint32_t sampleStride = Math::Max(1u, bodyNum / 1000);
+	uint32_t sampleNum = 0;
+	double queryMS = 0.0;
+	uint64_t pairSum = 0;
+	for (uint32_t frame = 0; frame < frameNum; frame++)
+	{
+		scene->Step();
+		if (frame % sampleStride != 0)
+			continue;
+
+		auto begin = std::chrono::steady_clock::now();
+		pairSum += GetBruteForcePairNum(scene->mBounds);
+		queryMS += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+		sampleNum++;
+	}
+	delete scene;
+
+	std::cout << "  BruteForce: query " << queryMS / sampleNum << " ms, pairs " << pairSum / sampleNum
+		<< " (" << sampleNum << " of " << frameNum << " frames sampled)" << std::endl;
+}
+
+static void RunBroadphaseBenchmark(const vector<uint32_t>& bodyNums, uint32_t frameNum)
+{
+	for (auto bodyNum : bodyNums)
+	{
+		std::cout << "Broadphase, falling pile, " << bodyNum << " bodies, " << frameNum << " frames" << std::endl;
+		RunBroadphase([](uint32_t n) -> BroadphaseScene* { return new FallingPileScene(n); }, bodyNum, frameNum);
+		std::cout << "Broadphase, resting stack, " << bodyNum << " bodies, " << frameNum << " frames" << std::endl;
+		RunBroadphase([](uint32_t n) -> BroadphaseScene* { return new RestingStackScene(n); }, bodyNum, frameNum);
+	}
+}
+
+// 同一个场景跑两次的结果必须逐位一致
+static int CheckDeterminism()
+{
+	int failedNum = 0;
+	for (auto name : ScenarioNames)
+	{
+		for (auto solverType : { ContactSolverType::Iterative, ContactSolverType::SequentialImpulse })
+		{
+			uint64_t first = RunScenario(name, 300, solverType, false);
+			uint64_t second = RunScenario(name, 300, solverType, false);
+			if (first != second)
+			{
+				std::cerr << name << " (" << GetSolverName(solverType) << ") is not deterministic: "
+					<< std::hex << first << " != " << second << std::dec << std::endl;
+				failedNum++;
+			}
+		}
+	}
+
+	if (failedNum == 0)
+		std::cout << "PhysZ determinism check passed" << std::endl;
+	return failedNum > 0 ? 1 : 0;
+}
+
+int main(int argc, char* argv[])
+{
+	JobSystem::Create();
+	RigidBodyStore::Create();
+
+	int result = 0;
+	if (argc > 1 && strcmp(argv[1], "--check") == 0)
+	{
+		result = CheckDeterminism();
+	}
+	else if (argc > 1 && strcmp(argv[1], "broadphase") == 0)
+	{
+		vector<uint32_t> bodyNums = { 1000, 10000, 50000 };
+		if (argc > 2)
+			bodyNums = { static_cast<uint32_t>(std::stoul(argv[2])) };
+		uint32_t frameNum = argc > 3 ? static_cast<uint32_t>(std::stoul(argv[3])) : 60;
+		RunBroadphaseBenchmark(bodyNums, frameNum);
+	}
+	else
+	{
+		string name = argc > 1 ? argv[1] : "all";
+		if (name != "all" && !IsScenarioName(name))
+		{
+			std::cerr << "Unknown scenario: " << name << std::endl;
+			JobSystem::Destroy();
+			return 1;
+		}
+		uint32_t frameNum = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 600;
+		vector<ContactSolverType> solverTypes = { ContactSolverType::Iterative, ContactSolverType::SequentialImpulse };
+		if (argc > 3)
+			solverTypes = { strcmp(argv[3], "si") == 0 ? ContactSolverType::SequentialImpulse : ContactSolverType::Iterative };
+
+		for (auto scenarioName : ScenarioNames)
+		{
+			if (name != "all" && name != scenarioName)
+				continue;
+			for (auto solverType : solverTypes)
+				RunScenario(scenarioName, frameNum, solverType, true);
+		}
+	}
+
+	JobSystem::Destroy();
+	return result;
+}
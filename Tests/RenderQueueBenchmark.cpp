@@ -0,0 +1,179 @@
+#include "RenderSort.h"
+#include "PublicStruct.h"
+#include <chrono>
+
+using namespace ZXEngine;
+
+// 渲染队列排序和批次划分的性能测试，不启动渲染器，用随机生成的物体数据代替MeshRenderer
+// 排序键和基数排序用的是RenderQueue里的同一份代码，批次划分按RenderQueue::Batch和InstanceBatch的规则扫描排序结果
+// 相机每帧移动一次，所以每帧的深度键都不一样，另外输出同样数据用std::stable_sort的耗时作为对比
+// 用法: RenderQueueBenchmark [物体数量] [帧数]
+
+static const uint32_t ShaderNum = 32;
+static const uint32_t MaterialNum = 512;
+static const uint32_t MeshNum = 64;
+
+// 排序和批次划分需要的Renderer数据
+struct FakeRenderer
+{
+	Vector3 center;
+	uint32_t shaderID;
+	uint32_t materialID;
+	uint32_t meshID;
+	bool instancing;
+};
+
+struct FrameTimes
+{
+	double mKey = 0.0;
+	double mSort = 0.0;
+	double mBatch = 0.0;
+	double mStdSort = 0.0;
+	size_t mBatchNum = 0;
+};
+
+static double GetElapsedMS(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// 排序不会访问Item里的renderer，这里存的是模拟数据的指针
+static FakeRenderer* GetRenderer(const RenderSort::Item& item)
+{
+	return reinterpret_cast<FakeRenderer*>(item.renderer);
+}
+
+// 和RenderQueue::Batch一样，相同Shader的连续区间是一个批次，支持Instancing的Shader再按Mesh和材质细分
+static size_t CountBatches(const vector<FakeRenderer*>& renderers)
+{
+	size_t batchNum = 0;
+	size_t begin = 0;
+	while (begin < renderers.size())
+	{
+		uint32_t shaderID = renderers[begin]->shaderID;
+		size_t end = begin + 1;
+		while (end < renderers.size() && renderers[end]->shaderID == shaderID)
+			end++;
+
+		if (renderers[begin]->instancing)
+		{
+			size_t instanceBegin = begin;
+			while (instanceBegin < end)
+			{
+				auto first = renderers[instanceBegin];
+				size_t instanceEnd = instanceBegin + 1;
+				while (instanceEnd < end && instanceEnd - instanceBegin < MAX_INSTANCE_NUM
+					&& renderers[instanceEnd]->meshID == first->meshID && renderers[instanceEnd]->materialID == first->materialID)
+					instanceEnd++;
+				batchNum++;
+				instanceBegin = instanceEnd;
+			}
+		}
+		else
+		{
+			batchNum++;
+		}
+
+		begin = end;
+	}
+	return batchNum;
+}
+
+static FrameTimes RunQueue(const vector<FakeRenderer*>& visibleRenderers, bool isTransparent, uint32_t frameNum)
+{
+	FrameTimes times;
+	vector<FakeRenderer*> renderers;
+	vector<RenderSort::Item> sortItems;
+	vector<RenderSort::Item> sortBuffer;
+	vector<RenderSort::Item> stdSortItems;
+
+	for (uint32_t frame = 0; frame < frameNum; frame++)
+	{
+		Vector3 cPos(sinf(frame * 0.05f) * 100.0f, 10.0f, cosf(frame * 0.05f) * 100.0f);
+		// 和引擎一样每帧重新按剔除结果的顺序填充队列，而不是在上一帧排好的顺序上继续排序
+		renderers = visibleRenderers;
+
+		// 计算排序键，对应RenderQueue::Sort的第一个循环
+		auto begin = std::chrono::steady_clock::now();
+		sortItems.resize(renderers.size());
+		for (size_t i = 0; i < renderers.size(); i++)
+		{
+			auto renderer = renderers[i];
+			float disSquared = (renderer->center - cPos).GetMagnitudeSquared();
+			uint64_t key = isTransparent ?
+				RenderSort::GetTransparentKey(renderer->shaderID, renderer->materialID, disSquared) :
+				RenderSort::GetOpaqueKey(renderer->shaderID, renderer->materialID, renderer->meshID, disSquared);
+			sortItems[i] = { key, reinterpret_cast<MeshRenderer*>(renderer) };
+		}
+		times.mKey += GetElapsedMS(begin);
+
+		stdSortItems = sortItems;
+
+		begin = std::chrono::steady_clock::now();
+		RenderSort::RadixSort(sortItems, sortBuffer);
+		for (size_t i = 0; i < renderers.size(); i++)
+			renderers[i] = GetRenderer(sortItems[i]);
+		times.mSort += GetElapsedMS(begin);
+
+		begin = std::chrono::steady_clock::now();
+		times.mBatchNum = CountBatches(renderers);
+		times.mBatch += GetElapsedMS(begin);
+
+		begin = std::chrono::steady_clock::now();
+		std::stable_sort(stdSortItems.begin(), stdSortItems.end(), [](const RenderSort::Item& a, const RenderSort::Item& b) { return a.key < b.key; });
+		times.mStdSort += GetElapsedMS(begin);
+
+		// 两种排序的结果必须完全一致
+		for (size_t i = 0; i < renderers.size(); i++)
+		{
+			if (stdSortItems[i].renderer != sortItems[i].renderer)
+			{
+				std::cerr << "Radix sort result differs from std::stable_sort at " << i << std::endl;
+				exit(1);
+			}
+		}
+	}
+
+	times.mKey /= frameNum;
+	times.mSort /= frameNum;
+	times.mBatch /= frameNum;
+	times.mStdSort /= frameNum;
+	return times;
+}
+
+int main(int argc, char* argv[])
+{
+	uint32_t rendererNum = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 100000;
+	uint32_t frameNum = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 100;
+
+	// 每个物体单独分配，再打乱顺序，和场景里的MeshRenderer一样散落在内存里
+	srand(12345);
+	vector<FakeRenderer*> renderers(rendererNum);
+	for (auto& renderer : renderers)
+	{
+		renderer = new FakeRenderer();
+		renderer->center = Vector3(Math::RandomFloat(-500.0f, 500.0f), Math::RandomFloat(0.0f, 20.0f), Math::RandomFloat(-500.0f, 500.0f));
+		renderer->shaderID = static_cast<uint32_t>(rand()) % ShaderNum;
+		// 每种材质只属于一个Shader，四分之一的Shader支持Instancing
+		renderer->materialID = renderer->shaderID + ShaderNum * (static_cast<uint32_t>(rand()) % (MaterialNum / ShaderNum));
+		renderer->meshID = static_cast<uint32_t>(rand()) % MeshNum;
+		renderer->instancing = renderer->shaderID % 4 == 0;
+	}
+	for (uint32_t i = rendererNum - 1; i > 0; i--)
+		std::swap(renderers[i], renderers[static_cast<uint32_t>(rand()) % (i + 1)]);
+
+	std::cout << "RenderQueue sort: " << rendererNum << " renderers, " << ShaderNum << " shaders, " << MaterialNum << " materials, "
+		<< MeshNum << " meshes, " << frameNum << " frames" << std::endl;
+
+	for (bool isTransparent : { false, true })
+	{
+		FrameTimes times = RunQueue(renderers, isTransparent, frameNum);
+		std::cout << "  " << (isTransparent ? "transparent" : "opaque") << ": key " << times.mKey << " ms, radix sort " << times.mSort
+			<< " ms, batch " << times.mBatch << " ms (" << times.mBatchNum << " batches), sort + batch " << times.mSort + times.mBatch
+			<< " ms, std::stable_sort " << times.mStdSort << " ms" << std::endl;
+	}
+
+	for (auto renderer : renderers)
+		delete renderer;
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include "SpatialIndex.h"
+#include "GameObject.h"
+#include <chrono>
+
+using namespace ZXEngine;
+
+// 空间索引的性能测试，不启动渲染器，只创建带包围盒的MeshRenderer
+// 在1000m x 1000m的区域里随机摆放1m大小的物体，模拟开放世界里的静态摆件，对比建树、增量更新以及视锥体查询和逐个判断的耗时
+// 用法: SpatialIndexBenchmark [物体数量]    不传物体数量时依次测试10000和100000
+
+static double GetElapsedMS(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+static void RunBenchmark(uint32_t objectNum)
+{
+	// GameObject的析构在GameObject.cpp里，它依赖场景和资源模块，这里不链接它，物体留到程序退出时回收
+	vector<GameObject*> gameObjects(objectNum);
+	vector<MeshRenderer*> renderers(objectNum);
+	for (uint32_t i = 0; i < objectNum; i++)
+	{
+		gameObjects[i] = new GameObject();
+		auto transform = gameObjects[i]->AddComponent<Transform>();
+		transform->SetPosition(Math::RandomFloat(-500.0f, 500.0f), Math::RandomFloat(0.0f, 20.0f), Math::RandomFloat(-500.0f, 500.0f));
+		renderers[i] = gameObjects[i]->AddComponent<MeshRenderer>();
+		renderers[i]->SetLocalAABB(AABB(Vector3(-0.5f), Vector3(0.5f)));
+	}
+	Transform::UpdateAllDirtyTransforms();
+
+	SpatialIndex index;
+	auto begin = std::chrono::steady_clock::now();
+	for (auto renderer : renderers)
+		index.Insert(renderer);
+	double insertTime = GetElapsedMS(begin);
+
+	// 从不同朝向的相机做查询，和逐个做视锥体判断对比
+	const uint32_t queryNum = 64;
+	Matrix4 projection = Math::Perspective(Math::Deg2Rad(60.0f), 16.0f / 9.0f, 0.1f, 300.0f);
+	vector<MeshRenderer*> result;
+	size_t indexVisibleNum = 0;
+	size_t linearVisibleNum = 0;
+	double indexQueryTime = 0.0;
+	double linearQueryTime = 0.0;
+	for (uint32_t i = 0; i < queryNum; i++)
+	{
+		float angle = Math::PI * 2.0f * static_cast<float>(i) / static_cast<float>(queryNum);
+		Vector3 forward(std::cos(angle), 0.0f, std::sin(angle));
+		Frustum frustum(projection * Math::GetLookToMatrix(Vector3(0.0f, 10.0f, 0.0f), forward, Vector3(0.0f, 1.0f, 0.0f)));
+
+		result.clear();
+		begin = std::chrono::steady_clock::now();
+		index.QueryFrustum(frustum, result);
+		indexQueryTime += GetElapsedMS(begin);
+		indexVisibleNum += result.size();
+
+		begin = std::chrono::steady_clock::now();
+		for (auto renderer : renderers)
+		{
+			if (frustum.Intersects(renderer->GetWorldAABB()))
+				linearVisibleNum++;
+		}
+		linearQueryTime += GetElapsedMS(begin);
+	}
+
+	// 每帧有10%的物体移动一小段距离
+	for (uint32_t i = 0; i < objectNum; i += 10)
+	{
+		auto transform = gameObjects[i]->GetComponent<Transform>();
+		transform->SetPosition(transform->GetPosition() + Vector3(Math::RandomFloat(-0.5f, 0.5f), 0.0f, Math::RandomFloat(-0.5f, 0.5f)));
+	}
+	Transform::UpdateAllDirtyTransforms();
+	begin = std::chrono::steady_clock::now();
+	index.Refit(Transform::GetChangedTransforms());
+	double refitTime = GetElapsedMS(begin);
+
+	std::cout << "SpatialIndex: " << objectNum << " objects, tree height " << index.GetHeight() << std::endl;
+	std::cout << "  insert all " << insertTime << " ms, refit 10% " << refitTime << " ms" << std::endl;
+	std::cout << "  frustum query " << indexQueryTime / queryNum << " ms (" << indexVisibleNum / queryNum << " visible), linear test "
+		<< linearQueryTime / queryNum << " ms (" << linearVisibleNum / queryNum << " visible)" << std::endl;
+
+	// 树里的查询结果是保守的，不能比逐个判断少
+	if (indexVisibleNum < linearVisibleNum)
+	{
+		std::cerr << "Frustum query returned fewer renderers than the linear test" << std::endl;
+		exit(1);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	vector<uint32_t> objectNums = { 10000, 100000 };
+	if (argc > 1)
+		objectNums = { static_cast<uint32_t>(std::stoul(argv[1])) };
+
+	srand(12345);
+	for (auto objectNum : objectNums)
+		RunBenchmark(objectNum);
+
+	return 0;
+}